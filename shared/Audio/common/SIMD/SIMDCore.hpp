@@ -2,10 +2,13 @@
 
 #ifdef __cplusplus
 #include <stdint.h>
+#include <cstring>
 #include <string>
 #include <vector>
 #include <functional>
+#if defined(__SSE__) || defined(_M_X64) || defined(__x86_64__)
 #include <immintrin.h> // Pour les intrinsics supplémentaires
+#endif
 
 // Support ARM NEON (Mobile uniquement)
 #ifdef __ARM_NEON
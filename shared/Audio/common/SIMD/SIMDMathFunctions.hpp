@@ -6,6 +6,7 @@
 #include <functional>
 #include <memory>
 #include <cmath>
+#include <cstring>
 
 namespace AudioNR {
 namespace SIMD {
@@ -106,6 +107,23 @@ public:
 
         return expTable[i0] * (1.0f - frac) + expTable[i1] * frac;
     }
+
+    /**
+     * Bloc de sinus par accumulateur de phase : out[i] = sin(2π (phase + i · increment))
+     * Phase en cycles : ni fmod ni branchement, chaque échantillon est indépendant (vectorisable)
+     */
+    MATH_INLINE void sineBlock(float phase, float increment, float* out, size_t count) const {
+        const float size = static_cast<float>(SINE_TABLE_SIZE);
+        for (size_t i = 0; i < count; ++i) {
+            float p = phase + increment * static_cast<float>(i);
+            p -= std::floor(p);
+            const float index = p * size;
+            const float whole = std::floor(index);
+            const size_t i0 = static_cast<size_t>(whole) & (SINE_TABLE_SIZE - 1);
+            const size_t i1 = (i0 + 1) & (SINE_TABLE_SIZE - 1);
+            out[i] = sineTable[i0] + (index - whole) * (sineTable[i1] - sineTable[i0]);
+        }
+    }
 };
 
 // ====================
@@ -21,6 +21,16 @@ static constexpr bool DEFAULT_ENABLED_STATE = true;
 static constexpr size_t FIRST_EFFECT_INDEX = 0;
 static constexpr size_t CHAIN_START_INDEX = 1;
 static constexpr size_t ZERO_SAMPLES = 0;
+static constexpr size_t INTERLEAVED_BLOCK_SIZE = 256; // trames désentrelacées sur la pile par processInterleaved()
+
+// === PARAMETER AUTOMATION CONSTANTS ===
+static constexpr size_t PARAMETER_EVENT_QUEUE_CAPACITY = 128; // événements en attente par effet
+static constexpr double PARAMETER_SMOOTHING_MS = 5.0;         // lissage des gains / mix entre événements
+
+// === EFFECT GRAPH CONSTANTS ===
+static constexpr size_t EFFECT_GRAPH_BLOCK_SIZE = 512;          // taille des tampons de nœud du plan temps réel
+static constexpr size_t EFFECT_GRAPH_OFFLINE_BLOCK_SIZE = 4096; // rendu hors ligne : moins de synchronisations
+static constexpr size_t EFFECT_GRAPH_RETIRED_SLOTS = 2;         // plans adoptables entre deux collectGarbage()
 
 // === COMPRESSOR CONSTANTS ===
 // NOTE: Default values for compressor are now defined in EffectsLimits.h
@@ -28,20 +38,23 @@ static constexpr size_t ZERO_SAMPLES = 0;
 // constants should remain here.
 static constexpr double MIN_RATIO = 1.0;
 static constexpr double MIN_TIME_MS = 0.1;
-static constexpr double DEFAULT_ENVELOPE = 0.0;
-static constexpr double DEFAULT_GAIN = 1.0;
-static constexpr double DEFAULT_ATTACK_COEFF = 0.99;
-static constexpr double DEFAULT_RELEASE_COEFF = 0.999;
-static constexpr double DEFAULT_GAIN_ATTACK_COEFF = 0.99;
-static constexpr double DEFAULT_GAIN_RELEASE_COEFF = 0.999;
 static constexpr double EPSILON_DB = 1e-10;
-static constexpr double DB_CONVERSION_FACTOR = 20.0;
-static constexpr double POWER_CONVERSION_BASE = 10.0;
 static constexpr double MS_TO_SECONDS_COMPRESSOR = 1000.0;
-static constexpr double MIN_GAIN_ATTACK_MS = 0.1;
-static constexpr double MIN_GAIN_RELEASE_MS = 0.1;
-static constexpr double GAIN_ATTACK_FACTOR = 0.5;
-static constexpr double STEREO_AVERAGE_FACTOR = 0.5;
+static constexpr size_t COMPRESSOR_BLOCK_SIZE = 64;        // detector / gain computer sub-block
+static constexpr float MIN_KNEE_WIDTH_DB = 1e-3f;          // narrower knees behave as hard knees
+static constexpr float GAIN_REDUCTION_ACTIVE_DB = -0.01f;  // metrics: compressor considered active
+static constexpr float SILENCE_LEVEL_DB = -240.0f;
+
+// === DYNAMICS CONSTANTS (EXPANDER / GATE / TRANSIENT SHAPER) ===
+// NOTE: Default values for these effects are defined in EffectsLimits.h.
+static constexpr size_t DYNAMICS_BLOCK_SIZE = 64;             // detector / gain computer sub-block
+static constexpr double DYNAMICS_DETECTOR_ATTACK_MS = 0.05;   // détecteur crête quasi instantané
+static constexpr double DYNAMICS_DETECTOR_RELEASE_MS = 20.0;  // tient entre deux crêtes jusqu'à ~50 Hz
+static constexpr double TRANSIENT_FAST_ATTACK_MS = 1.0;
+static constexpr double TRANSIENT_SLOW_ATTACK_MS = 25.0;
+static constexpr double TRANSIENT_FAST_RELEASE_MS = 60.0;
+static constexpr double TRANSIENT_SLOW_RELEASE_MS = 400.0;
+static constexpr float TRANSIENT_FULL_SCALE_DB = 12.0f;       // écart d'enveloppes donnant le gain réglé
 
 // === DELAY CONSTANTS ===
 // NOTE: Default values for delay are now defined in EffectsLimits.h.
@@ -53,15 +66,68 @@ static constexpr double MAX_MIX = 1.0;
 static constexpr double MIX_THRESHOLD = 0.001;
 static constexpr double MIX_INVERT_FACTOR = 1.0;
 static constexpr double MS_TO_SECONDS_DELAY = 0.001;
-static constexpr size_t MIN_DELAY_SAMPLES = 1;
-static constexpr size_t MAX_DELAY_SECONDS = 4;
-static constexpr size_t DEFAULT_BUFFER_SIZE = 1024;
-static constexpr size_t DEFAULT_INDEX = 0;
-static constexpr float BUFFER_INIT_VALUE = 0.0f;
-
-// === PERFORMANCE CONSTANTS ===
-static constexpr size_t UNROLL_BLOCK_SIZE = 4;
-static constexpr size_t PREFETCH_DISTANCE = 64;
+static constexpr size_t MAX_DELAY_SECONDS = 4;          // buffer preallocated for this delay
+static constexpr double DELAY_SMOOTHING_MS = 50.0;       // delay-time glide (tape-style sweeps)
+
+// === OVERSAMPLING CONSTANTS ===
+static constexpr size_t MIN_OVERSAMPLING_FACTOR = 1;
+static constexpr size_t MAX_OVERSAMPLING_FACTOR = 8;
+static constexpr size_t DEFAULT_OVERSAMPLING_FACTOR = 2;
+static constexpr size_t OVERSAMPLING_BLOCK_SIZE = 512; // base-rate samples per internal block
+
+// === LIMITER CONSTANTS ===
+// NOTE: Default values for limiter are defined in EffectsLimits.h.
+static constexpr size_t LIMITER_OVERSAMPLING_FACTOR = 4; // détection true-peak (ITU-R BS.1770)
+static constexpr size_t LIMITER_BLOCK_SIZE = 64;         // samples per oversampled detector sub-block
+
+// === REVERB CONSTANTS ===
+// NOTE: Default values for reverb are defined in EffectsLimits.h.
+static constexpr size_t FDN_LINES = 8; // 2 registres NEON/SSE
+// Longueurs nominales des lignes (ms) ; ReverbEffect::setSampleRate les arrondit à des nombres premiers distincts
+static constexpr double FDN_DELAY_TIMES_MS[FDN_LINES] = {29.7, 37.1, 41.1, 43.7, 53.3, 59.9, 67.7, 73.1};
+static constexpr double REVERB_MIN_RT60_SECONDS = 0.3;  // roomSize = 0
+static constexpr double REVERB_MAX_RT60_SECONDS = 8.0;  // roomSize = 1
+static constexpr double REVERB_DAMPING_MAX_HZ = 18000.0; // damping = 0
+static constexpr double REVERB_DAMPING_MIN_HZ = 1500.0;  // damping = 1
+static constexpr double REVERB_MOD_RATE_HZ = 0.6;
+static constexpr double REVERB_MOD_DEPTH_MS = 0.25;
+static constexpr double RT60_DECAY_DB = -60.0;
+
+// === CONVOLUTION REVERB CONSTANTS ===
+// NOTE: IR length and mix limits are defined in EffectsLimits.h.
+static constexpr size_t CONVOLUTION_HEAD_SIZE = 128; // partition du thread audio = latence de l'effet
+static constexpr size_t CONVOLUTION_TAIL_STAGES = 2;
+// Partitions de la queue (thread de travail) ; l'étage s démarre à 2 * taille dans la RI
+static constexpr size_t CONVOLUTION_TAIL_SIZES[CONVOLUTION_TAIL_STAGES] = {1024, 4096};
+static constexpr size_t CONVOLUTION_QUEUE_DEPTH = 4; // blocs en attente par file
+static constexpr int CONVOLUTION_WORKER_WAIT_MS = 2;
+
+// === PITCH SHIFT CONSTANTS ===
+// NOTE: Semitone and mix limits are defined in EffectsLimits.h; frame sizes in TimeStretcher.hpp.
+static constexpr size_t PITCH_SHIFT_BLOCK_SIZE = 64;    // samples per stretcher / resampler sub-block
+static constexpr size_t PITCH_SHIFT_RESAMPLER_TAPS = 4; // interpolation Hermite 4 points
+
+// === MODULATION CONSTANTS (CHORUS / FLANGER / PHASER) ===
+// NOTE: Default values for modulation effects are defined in EffectsLimits.h.
+static constexpr size_t MODULATION_BLOCK_SIZE = 32;        // une évaluation LFO par sous-bloc
+static constexpr double MODULATION_STEREO_PHASE = 0.25;    // décalage LFO du canal droit (cycles)
+static constexpr double PHASER_MAX_NORMALIZED_FREQ = 0.45; // fréquence max d'un étage / Nyquist
+
+// === MULTIBAND COMPRESSOR CONSTANTS ===
+static constexpr size_t MULTIBAND_BLOCK_SIZE = 64; // samples per filter bank / detector sub-block
+
+// === STEREO IMAGER CONSTANTS ===
+// NOTE: Default values for the stereo imager are defined in EffectsLimits.h.
+static constexpr size_t STEREO_IMAGER_BLOCK_SIZE = 64;             // trames par passe mid/side + filtre du side
+static constexpr double STEREO_IMAGER_MAX_NORMALIZED_FREQ = 0.45; // fréquence de coupure max / fréquence d'échantillonnage
+
+// === FUSED CHAIN CONSTANTS ===
+// Sous-bloc commun à tous les étages ; égal aux blocs du compresseur et du limiteur
+static constexpr size_t FUSED_CHAIN_BLOCK_SIZE = 64;
+// Identifiants de paramètres réservés par étage (stageParameter)
+static constexpr uint32_t FUSED_CHAIN_PARAMS_PER_STAGE = 16;
+// Fréquence centrale max d'une bande d'égaliseur de la tranche / fréquence d'échantillonnage
+static constexpr double CHANNEL_STRIP_MAX_NORMALIZED_FREQ = 0.45;
 
 // Constantes utilitaires (C++17 constexpr)
 static constexpr double MAX_FLOAT = 3.40282347e+38;     // Maximum float value
@@ -89,14 +89,15 @@ namespace NoiseManagerConstants {
 // Calculs de statistiques
 constexpr float SNR_LOG_FACTOR = 20.0f;        // Facteur de conversion en dB pour SNR
 constexpr float SPEECH_THRESHOLD_LEVEL = 0.1f; // Seuil de détection de parole (niveau d'entrée)
-constexpr float MULTIBAND_REDUCTION_FACTOR = 0.7f; // Facteur de réduction multi-bande
 constexpr float DEFAULT_RESET_VALUE = 0.0f;    // Valeur de reset par défaut
 
 // SIMD et optimisation
-constexpr float LOWPASS_CUTOFF_FREQUENCY = 8000.0f; // Fréquence de coupure passe-bas (Hz)
-constexpr size_t SIMD_MIN_SIZE = 64;                // Taille minimale pour SIMD
-constexpr size_t SIMD_STEREO_MIN_SIZE = 128;        // Taille minimale stéréo SIMD
-constexpr size_t SIMD_MULTIBAND_MIN_SIZE = 256;     // Taille minimale multi-bande SIMD
+constexpr size_t SIMD_MIN_SIZE = 64; // Taille minimale pour SIMD
+
+// Chemin temps réel (sans verrou ni allocation)
+constexpr size_t MAX_BLOCK_SIZE = 4096;        // Trames par passe interne : taille des buffers pré-alloués
+constexpr int STATS_NOTIFY_INTERVAL_MS = 50;   // Période du fil qui notifie les statistiques et les erreurs
+constexpr size_t RETIRED_ENGINE_SLOTS = 2;     // Moteurs adoptables entre deux collectGarbage()
 
 // Validation d'agressivité
 constexpr float MIN_AGGRESSIVENESS = 0.0f; // Agressivité minimale
@@ -183,6 +184,7 @@ constexpr bool DEFAULT_ENABLE_HIGHPASS = true; // Default high-pass enable state
 // Valeurs d'initialisation d'état (par canal)
 constexpr double INITIAL_ENVELOPE = 0.0; // Initial envelope follower value
 constexpr double INITIAL_GAIN = 1.0;     // Initial gain value (unity gain)
+constexpr size_t DETECTOR_BLOCK_SIZE = 64;  // Sub-block of the vectorized detector / gain computer
 
 // Constantes pré-calculées pour éviter des calculs coûteux
 constexpr double DEFAULT_THRESH_LINEAR = 0.0316227766;  // pow(10, DEFAULT_THRESHOLD_DB/20)
@@ -238,33 +240,33 @@ static constexpr double OVERLAP_PERCENTAGE = GlobalAudioConstants::OVERLAP_PERCE
 constexpr float STEREO_DOWNMIX_FACTOR = 0.5f;        // Stereo to mono downmix factor
 constexpr double AGGRESSIVENESS_NORMALIZATION = 3.0; // Normalization factor for aggressiveness
 
-// Mappage agressivité → paramètres du NoiseReducer (gate)
-namespace GateMapping {
-static constexpr double THRESHOLD_BASE_DB = -45.0;
-static constexpr double THRESHOLD_RANGE_DB = -25.0;
-static constexpr double RATIO_BASE = 1.5;
-static constexpr double RATIO_RANGE = 6.5;
-static constexpr double FLOOR_BASE_DB = -12.0;
-static constexpr double FLOOR_RANGE_DB = -23.0;
-static constexpr double ATTACK_BASE_MS = 3.0;
-static constexpr double ATTACK_RANGE_MS = 7.0;
-static constexpr double RELEASE_BASE_MS = 30.0;
-static constexpr double RELEASE_RANGE_MS = 120.0;
-static constexpr double HIGHPASS_BASE_HZ = 60.0;
-static constexpr double HIGHPASS_RANGE_HZ = 60.0;
-} // namespace GateMapping
-
-// Mappage agressivité → paramètres de la SpectralNR
-namespace SpectralMapping {
-static constexpr uint32_t FFT_SIZE = 1024; // Fixed and robust
-static constexpr uint32_t HOP_SIZE = 256;  // 75% overlap
-static constexpr double BETA_BASE = 1.2;
-static constexpr double BETA_RANGE = 1.6;
-static constexpr double FLOOR_GAIN_BASE = 0.10;
-static constexpr double FLOOR_GAIN_RANGE = -0.07;
-static constexpr double NOISE_UPDATE_BASE = 0.95;
-static constexpr double NOISE_UPDATE_RANGE = 0.035;
-} // namespace SpectralMapping
+// Trame d'analyse du suppresseur par bandes : ≈ 20 ms, 50 % de recouvrement
+constexpr double FRAME_DURATION_S = 0.02; // arrondie à la puissance de deux supérieure
+constexpr size_t HOP_DIVISOR = 2;
+
+// Bandes (échelle proche de Bark, bords des bandes Opus / RNNoise), en Hz
+constexpr size_t NB_BANDS = 22;
+static constexpr float BAND_EDGES_HZ[NB_BANDS] = {0.0f,    200.0f,  400.0f,  600.0f,  800.0f,   1000.0f,
+                                                  1200.0f, 1400.0f, 1600.0f, 2000.0f, 2400.0f,  2800.0f,
+                                                  3200.0f, 4000.0f, 4800.0f, 5600.0f, 6800.0f,  8000.0f,
+                                                  9600.0f, 12000.0f, 15600.0f, 20000.0f};
+constexpr float BAND_EDGE_WEIGHT = 2.0f; // première et dernière bande : demi-triangle
+
+// Descripteurs : x = (dB - OFFSET) * SCALE, dans la zone linéaire de tanh
+constexpr float FEATURE_DB_OFFSET = -60.0f;
+constexpr float FEATURE_DB_SCALE = 1.0f / 240.0f;
+constexpr float BAND_ENERGY_FLOOR = 1e-10f;   // -100 dB
+constexpr float PITCH_ENERGY_EPSILON = 1e-20f; // corrélation de bande
+constexpr float PITCH_FILTER_EPSILON = 1e-3f;  // filtre de pitch (dénominateur)
+constexpr float ENERGY_RATIO_EPSILON = 1e-20f; // rapports d'énergie de bande
+
+// Période de pitch : recherche grossière décimée, affinée à pleine cadence
+constexpr double PITCH_ANALYSIS_RATE = 12000.0;
+constexpr double PITCH_MIN_HZ = 60.0;
+constexpr double PITCH_MAX_HZ = 500.0;
+
+// Agressivité (0..3) → atténuation maximale par bande
+constexpr double MAX_ATTENUATION_DB = 40.0;
 } // namespace RNNoiseSuppressorConstants
 
 // SpectralNR specific constants
@@ -285,6 +287,7 @@ static constexpr double DEFAULT_FLOOR_GAIN =
     GlobalValidationConstants::DEFAULT_FLOOR_GAIN; // Default spectral floor gain
 static constexpr double DEFAULT_NOISE_UPDATE =
     GlobalValidationConstants::DEFAULT_NOISE_UPDATE; // Default noise estimation smoothing
+static constexpr bool DEFAULT_VAD_GATING = true; // Noise learned only while the VAD reports no voice
 
 // Bornes/validation des paramètres utilisateur - Utilise les constantes globales
 static constexpr double MIN_BETA = GlobalValidationConstants::MIN_BETA;             // Minimum over-subtraction factor
@@ -334,6 +337,12 @@ constexpr float ONE = 1.0f;                     // One value
 constexpr float TWO = 2.0f;                     // Two value
 constexpr float ZERO = 0.0f;                    // Zero value
 
+// Règles de gain (domaine puissance, sans phase)
+constexpr float DECISION_DIRECTED_ALPHA = 0.98f; // Lissage du SNR a priori (Ephraim-Malah)
+constexpr float MIN_PRIORI_SNR = 0.0031623f;     // Plancher du SNR a priori (-25 dB)
+constexpr float MAX_LSA_GAIN = 1.0f;             // Gain MMSE-LSA maximal
+constexpr float NOISE_POWER_EPSILON = 1e-20f;    // Évite la division par un bruit nul
+
 // Indices et offsets dans le spectre
 constexpr size_t SPECTRUM_DC_INDEX = 0;       // DC component index
 constexpr size_t SPECTRUM_NYQUIST_OFFSET = 1; // Nyquist offset
@@ -367,6 +376,10 @@ constexpr double HALF_VALUE = 0.5;           // Valeur 0.5
 // Constantes pour les calculs mathématiques
 constexpr int MAX_ITERATIONS_EXPINT = 20;              // Nombre maximum d'itérations pour expint
 constexpr double EXPONENTIAL_SERIES_THRESHOLD = 1e-10; // Seuil pour la série exponentielle
+constexpr double LOG2_E = 1.4426950408889634;          // exp(x) = 2^(x log2 e)
+
+// Disposition de l'état (lignes SoA)
+constexpr size_t STATE_ALIGNMENT = 64; // Alignement des lignes en octets (ligne de cache)
 } // namespace IMCRAConstants
 
 // Constantes spécifiques aux composants Noise
@@ -506,6 +519,21 @@ constexpr float NOISE_SPECTRAL = 0.6f; // Poids spectral pour le bruit
 constexpr float NOISE_WIENER = 0.4f;   // Poids Wiener pour le bruit
 } // namespace AlgorithmWeights
 
+// Réducteur hybride : classification sur l'analyse STFT partagée
+namespace Hybrid {
+constexpr float SPEECH_BAND_LOW = 300.0f;    // Bande de présence de parole (Hz)
+constexpr float SPEECH_BAND_HIGH = 3400.0f;  // Bande de présence de parole (Hz)
+constexpr float FLUX_SCALE = 4.0f;           // Flux spectral normalisé -> score de variation [0, 1]
+constexpr float ZCR_NOISE_LEVEL = 0.5f;      // Taux de passage par zéro d'un bruit blanc
+constexpr float SCORE_SMOOTHING = 0.9f;      // Lissage des scores de contenu (par trame)
+constexpr float ACTIVITY_THRESHOLD = 0.5f;   // Activité minimale pour un contenu "mixed"
+constexpr float WEIGHT_SMOOTHING = 0.95f;    // Fondu des poids d'algorithme (par trame)
+constexpr float WEIGHT_EPSILON = 1e-3f;      // Poids en dessous duquel une règle n'est pas calculée
+constexpr float ENERGY_SMOOTHING = 0.95f;    // Moyenne lente de l'énergie de trame (transitoires)
+constexpr float SUBTRACTION_BETA = 2.0f;     // Sur-soustraction de la règle spectrale
+constexpr float POWER_EPSILON = 1e-20f;      // Évite les divisions par un spectre nul
+} // namespace Hybrid
+
 // Paramètres de traitement par défaut
 constexpr size_t DEFAULT_BLOCK_SIZE = 512;          // Taille de bloc par défaut
 constexpr bool DEFAULT_ENABLE_MULTIBAND = true;     // Activation multibande par défaut
@@ -540,6 +568,24 @@ constexpr size_t MIN_NUM_BANDS = 4;   // Nombre minimum de bandes
 constexpr size_t MAX_NUM_BANDS = 128; // Nombre maximum de bandes
 constexpr float MIN_FREQ = 1.0f;      // Fréquence minimale (1 Hz)
 constexpr float MAX_FREQ = 100000.0f; // Fréquence maximale (100 kHz)
+
+// Analyse spectrale - Utilise les constantes globales
+static constexpr uint32_t DEFAULT_SAMPLE_RATE = GlobalAudioConstants::DEFAULT_SAMPLE_RATE;
+static constexpr size_t DEFAULT_FFT_SIZE = GlobalAudioConstants::DEFAULT_FFT_SIZE;
+
+// Soustraction spectrale multibande (Kamath & Loizou 2002)
+constexpr float OVERSUB_AT_0DB = 4.0f;             // alpha = 4 - 3 SNR / 20, borné à [1, 4.75]
+constexpr float OVERSUB_SLOPE_PER_DB = 0.15f;      // 3 / 20
+constexpr float OVERSUB_MIN = 1.0f;                // Sur-soustraction à SNR élevé (> 20 dB)
+constexpr float OVERSUB_MAX = 4.75f;               // Sur-soustraction à SNR faible (< -5 dB)
+constexpr float BAND_WEIGHT_LOW = 1.0f;            // delta sous 1 kHz
+constexpr float BAND_WEIGHT_MID = 2.5f;            // delta de 1 kHz à fs/2 - 2 kHz
+constexpr float BAND_WEIGHT_HIGH = 1.5f;           // delta au-delà
+constexpr float BAND_WEIGHT_LOW_EDGE = 1000.0f;    // Fin de la zone delta bas (Hz)
+constexpr float BAND_WEIGHT_HIGH_MARGIN = 2000.0f; // Début de la zone delta haut, sous Nyquist (Hz)
+constexpr float SPECTRAL_FLOOR = 0.01f;            // Plancher de puissance (-20 dB)
+constexpr float BAND_GAIN_SMOOTHING = 0.5f;        // Lissage temporel des gains de bande
+constexpr float POWER_EPSILON = 1e-20f;            // Évite la division par une bande vide
 } // namespace MultibandProcessorConstants
 
 
@@ -591,12 +637,13 @@ constexpr float PERCEPTUAL_WEIGHT_MAX = 2.0f;  // Poids perceptuel maximal
 // Constantes de lissage spectral
 constexpr float FREQUENCY_SMOOTHING_WEIGHT = 0.25f; // Poids du lissage spectral (3-point)
 
-// Constantes pour expint (intégrale exponentielle)
-constexpr int MAX_EXPINT_ITERATIONS = 20;              // Nombre maximum d'itérations pour expint
-constexpr int MAX_CONTINUED_FRACTION_ITERATIONS = 100; // Nombre maximum d'itérations pour fraction continue
-constexpr float EXPINT_SMALL_THRESHOLD = 0.001f;       // Seuil pour approximation expint
-constexpr float CONTINUED_FRACTION_INIT = 1e30f;       // Valeur initiale pour fraction continue
-constexpr float EULER_MASCHERONI = -0.57721566f;       // Constante d'Euler-Mascheroni
+// Table des gains MMSE (LSA / STSA), indexée par log2 v
+constexpr float MMSE_TABLE_MIN_LOG2 = -16.0f;        // v = 2^-16 en début de table
+constexpr size_t MMSE_TABLE_STEPS_PER_OCTAVE = 16;   // Pas d'interpolation par octave de v
+constexpr size_t MMSE_TABLE_OCTAVES = 30;            // Jusqu'à v = 2^14 (correction ≈ 1 au-delà)
+constexpr size_t MMSE_TABLE_SIZE = MMSE_TABLE_OCTAVES * MMSE_TABLE_STEPS_PER_OCTAVE + 1;
+constexpr float MMSE_SMALL_V_SLOPE = -0.5f;          // log2 F ~ c - log2(v) / 2 sous la table
+constexpr float MMSE_MIN_V = 1e-12f;                 // Plancher de v (celui du log2 de VectorMath)
 
 // Constantes de validation
 constexpr double MIN_ALPHA = 0.0;             // Alpha minimal
@@ -662,3 +709,13 @@ constexpr double MAX_RESIDUAL_THRESHOLD = 1.0;                                 /
 constexpr double MIN_RESIDUAL_SMOOTHING = 0.0;                                 // Lissage résiduel minimal
 constexpr double MAX_RESIDUAL_SMOOTHING = 1.0;                                 // Lissage résiduel maximal
 } // namespace TwoStepNoiseReductionConstants
+
+// Débruitage hors ligne d'un fichier par blocs parallèles
+namespace OfflineDenoiserConstants {
+constexpr double DEFAULT_CHUNK_SECONDS = 30.0;  // Durée d'un bloc traité par une tâche
+constexpr double DEFAULT_PREROLL_SECONDS = 3.0; // Signal précédent joué pour chauffer l'estimateur de bruit
+constexpr double DEFAULT_CROSSFADE_MS = 100.0;  // Fondu entre deux blocs voisins
+constexpr double MIN_CHUNK_SECONDS = 1.0;       // Bloc minimal (au-delà du fondu et de la FFT)
+constexpr double MAX_PREROLL_SECONDS = 60.0;    // Pré-roulage maximal
+constexpr double MAX_CROSSFADE_MS = 1000.0;     // Fondu maximal
+} // namespace OfflineDenoiserConstants
@@ -324,6 +324,11 @@ void BiquadFilter::processMono(const float* input, float* output, size_t numSamp
 
 void BiquadFilter::processStereo(const float* inputL, const float* inputR,
                                 float* outputL, float* outputR, size_t numSamples) {
+    processStereoPlanar(inputL, inputR, outputL, outputR, numSamples);
+}
+
+void BiquadFilter::processStereoPlanar(const float* inputL, const float* inputR,
+                                       float* outputL, float* outputR, size_t numSamples) {
     // Optimized stereo processing - interleaved for better cache usage
     double y1L = m_y1, y2L = m_y2;
     double y1R = m_y1R, y2R = m_y2R;
@@ -66,6 +66,10 @@ public:
     // Mono processing method
     void processMono(const float* input, float* output, size_t numSamples);
 
+    // Stereo processing method on planar buffers (in place allowed)
+    void processStereoPlanar(const float* inputL, const float* inputR,
+                             float* outputL, float* outputR, size_t numSamples);
+
     // Process single sample (for real-time processing)
     template<typename T = float,
              typename = std::enable_if_t<std::is_floating_point<T>::value>>
@@ -0,0 +1,107 @@
+#pragma once
+#ifndef NYTH_AUDIO_FX_BLOCK_LFO_HPP
+#define NYTH_AUDIO_FX_BLOCK_LFO_HPP
+
+// C++17 standard headers
+#include "../SIMD/SIMDMathFunctions.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+
+namespace Nyth {
+namespace Audio {
+namespace FX {
+
+enum class LfoShape {
+    SINE = 0,
+    TRIANGLE = 1
+};
+
+/**
+ * @brief Low-frequency oscillator rendered a block at a time
+ *
+ * The phase (in cycles) is advanced once per block; render() fills a whole
+ * block of bipolar values from that phase, optionally offset for another
+ * voice or channel. Sine values come from the shared 4096-point table of
+ * AudioNR::SIMD::LookupTables with linear interpolation, triangle values from
+ * the phase alone. Every output sample is computed independently of the
+ * previous one, so the loops vectorize and no sin() is called per sample.
+ * Several consumers (chorus voices, stereo channels, phaser stages) read the
+ * same oscillator and stay phase-locked.
+ */
+class BlockLfo {
+public:
+    BlockLfo() = default;
+
+    // Hors temps réel : construit aussi la table partagée pour que le premier render() n'initialise rien
+    void setSampleRate(double sampleRate) noexcept {
+        sampleRate_ = std::max(1.0, sampleRate);
+        updateIncrement();
+        (void)AudioNR::SIMD::LookupTables::getInstance();
+    }
+    void setRate(double rateHz) noexcept {
+        rateHz_ = std::max(0.0, rateHz);
+        updateIncrement();
+    }
+    void setShape(LfoShape shape) noexcept {
+        shape_ = shape;
+    }
+    [[nodiscard]] double getRate() const noexcept {
+        return rateHz_;
+    }
+    [[nodiscard]] LfoShape getShape() const noexcept {
+        return shape_;
+    }
+    // Cycles par échantillon
+    [[nodiscard]] double getIncrement() const noexcept {
+        return increment_;
+    }
+
+    void reset(double phase = 0.0) noexcept {
+        phase_ = phase - std::floor(phase);
+    }
+
+    /**
+     * @brief Writes count values in [-1, 1] starting at the current phase
+     * @param phaseOffset additional phase in cycles (0.25 = quadrature)
+     */
+    void render(float* out, size_t count, double phaseOffset = 0.0) const noexcept {
+        double start = phase_ + phaseOffset;
+        start -= std::floor(start);
+        const float phase = static_cast<float>(start);
+        const float increment = static_cast<float>(increment_);
+        if (shape_ == LfoShape::SINE) {
+            AudioNR::SIMD::LookupTables::getInstance().sineBlock(phase, increment, out, count);
+            return;
+        }
+        // Triangle : 1 - 4 |q - 1/2| avec q = p + 1/4, en phase avec le sinus (0, +1, 0, -1)
+        for (size_t i = 0; i < count; ++i) {
+            float p = phase + increment * static_cast<float>(i) + 0.25f;
+            p -= std::floor(p);
+            out[i] = 1.0f - 4.0f * std::fabs(p - 0.5f);
+        }
+    }
+
+    // Avance la phase de count échantillons (une fois par bloc, après tous les render())
+    void advance(size_t count) noexcept {
+        phase_ += increment_ * static_cast<double>(count);
+        phase_ -= std::floor(phase_);
+    }
+
+private:
+    void updateIncrement() noexcept {
+        increment_ = rateHz_ / sampleRate_;
+    }
+
+    double sampleRate_ = 48000.0;
+    double rateHz_ = 1.0;
+    double increment_ = 1.0 / 48000.0; // cycles par échantillon
+    double phase_ = 0.0;               // en cycles, [0, 1)
+    LfoShape shape_ = LfoShape::SINE;
+};
+
+} // namespace FX
+} // namespace Audio
+} // namespace Nyth
+
+#endif // NYTH_AUDIO_FX_BLOCK_LFO_HPP
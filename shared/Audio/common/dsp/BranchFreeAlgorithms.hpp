@@ -2,6 +2,7 @@
 #ifndef NYTH_AUDIO_FX_BRANCH_FREE_ALGORITHMS_HPP
 #define BRANCH_FREE_ALGORITHMS_HPP
 
+#include "DynamicsDetector.hpp"
 #include <cmath>
 #include <cstdint>
 #include <type_traits>
@@ -213,39 +214,40 @@ inline void pan(float input, float panPosition, float& left, float& right) noexc
 /**
  * @brief Branch-free envelope follower
  * Attack/release envelope without conditional branches
+ * (per-sample wrapper of Dynamics::AttackReleaseFilter; processBlock() for whole buffers)
  */
 class EnvelopeFollower {
 public:
-    EnvelopeFollower(float attackTime, float releaseTime, float sampleRate) : m_envelope(0.0f) {
-        setAttack(attackTime, sampleRate);
-        setRelease(releaseTime, sampleRate);
+    EnvelopeFollower(float attackTime, float releaseTime, float sampleRate) {
+        m_filter.setTimes(attackTime, releaseTime, sampleRate);
     }
 
     float process(float input) noexcept {
-        float inputAbs = BranchFree::abs(input);
-
         // Branch-free selection of attack or release coefficient
         // Traditional: if (inputAbs > m_envelope) use attack else use release
-        float coefficient = select(inputAbs > m_envelope, m_attackCoef, m_releaseCoef);
-
-        // One-pole filter
-        m_envelope = inputAbs + coefficient * (m_envelope - inputAbs);
+        return m_filter.step(BranchFree::abs(input));
+    }
 
-        return m_envelope;
+    // output[i] = enveloppe après input[i] (redressement vectorisé)
+    void processBlock(const float* input, float* output, size_t count) noexcept {
+        Dynamics::rectify(input, output, count);
+        m_filter.process(output, output, count);
     }
 
     void setAttack(float timeMs, float sampleRate) noexcept {
-        m_attackCoef = std::exp(-1.0f / (timeMs * 0.001f * sampleRate));
+        m_attackCoef = Dynamics::timeCoefficient(timeMs, sampleRate);
+        m_filter.setCoefficients(m_attackCoef, m_releaseCoef);
     }
 
     void setRelease(float timeMs, float sampleRate) noexcept {
-        m_releaseCoef = std::exp(-1.0f / (timeMs * 0.001f * sampleRate));
+        m_releaseCoef = Dynamics::timeCoefficient(timeMs, sampleRate);
+        m_filter.setCoefficients(m_attackCoef, m_releaseCoef);
     }
 
 private:
-    float m_envelope;
-    float m_attackCoef;
-    float m_releaseCoef;
+    Dynamics::AttackReleaseFilter m_filter;
+    float m_attackCoef = 0.0f;
+    float m_releaseCoef = 0.0f;
 };
 
 /**
@@ -352,16 +354,15 @@ inline uint32_t countLeadingZeros(uint32_t x) noexcept {
 class BranchFreeCompressor {
 public:
     BranchFreeCompressor(float threshold, float ratio, float attack, float release, float sampleRate)
-        : m_threshold(threshold), m_ratio(ratio), m_envelope(0.0f) {
-        m_attackCoef = std::exp(-1.0f / (attack * 0.001f * sampleRate));
-        m_releaseCoef = std::exp(-1.0f / (release * 0.001f * sampleRate));
+        : m_threshold(threshold), m_ratio(ratio) {
+        m_envelope.setTimes(attack, release, sampleRate);
     }
 
     float process(float input) noexcept {
         float inputAbs = BranchFree::abs(input);
 
         // Compute gain reduction in dB domain (branch-free)
-        float inputDb = 20.0f * FastMath::fast_log10(inputAbs + 1e-10f);
+        float inputDb = VectorMath::DB_PER_LOG2 * VectorMath::log2Scalar(inputAbs);
         float overDb = inputDb - m_threshold;
 
         // Branch-free max(0, overDb)
@@ -370,12 +371,11 @@ public:
         // Compute target gain reduction
         float grDb = overDb * (1.0f - 1.0f / m_ratio);
 
-        // Smooth with envelope follower (branch-free)
-        float coef = select(grDb > m_envelope, m_attackCoef, m_releaseCoef);
-        m_envelope = grDb + coef * (m_envelope - grDb);
+        // Smooth with envelope follower (branch-free, attack while the reduction grows)
+        const float envelope = m_envelope.step(grDb);
 
         // Convert back to linear and apply
-        float grLinear = FastMath::fast_pow10(-m_envelope / 20.0f);
+        float grLinear = VectorMath::exp2Scalar(-envelope * VectorMath::LOG2_PER_DB);
 
         return input * grLinear;
     }
@@ -383,31 +383,7 @@ public:
 private:
     float m_threshold;
     float m_ratio;
-    float m_envelope;
-    float m_attackCoef;
-    float m_releaseCoef;
-
-    // Fast math approximations
-    struct FastMath {
-        static float fast_log10(float x) noexcept {
-            union {
-                float f;
-                uint32_t i;
-            } u = {x};
-            float log2_approx = ((u.i >> 23) & 0xFF) - 127;
-            u.i = (u.i & 0x007FFFFF) | 0x3F800000;
-            float m = u.f;
-            float p = m * (m * (-0.333333f) + 2.0f) - 0.666666f;
-            return (log2_approx + p) * 0.301029996f;
-        }
-
-        static float fast_pow10(float x) noexcept {
-            constexpr float ln10 = 2.302585093f;
-            float t = x * ln10;
-            float result = 1.0f + t + t * t / 2.0f + t * t * t / 6.0f;
-            return result;
-        }
-    };
+    Dynamics::AttackReleaseFilter m_envelope;
 };
 
 /**
@@ -0,0 +1,240 @@
+#pragma once
+#ifndef NYTH_AUDIO_FX_CROSSOVER_FILTER_BANK_HPP
+#define NYTH_AUDIO_FX_CROSSOVER_FILTER_BANK_HPP
+
+// C++17 standard headers
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+
+// Platform detection and SIMD headers
+#if defined(__ARM_NEON) || defined(__aarch64__)
+#include <arm_neon.h>
+#define NYTH_CROSSOVER_NEON
+#elif defined(__SSE__) || defined(_M_X64) || defined(__x86_64__)
+#include <xmmintrin.h>
+#define NYTH_CROSSOVER_SSE
+#endif
+
+namespace Nyth {
+namespace Audio {
+namespace FX {
+
+// C++17 constexpr constants for the Linkwitz-Riley filter bank
+namespace CrossoverConstants {
+constexpr size_t MAX_BANDS = 5;
+constexpr size_t MAX_CROSSOVERS = MAX_BANDS - 1;
+constexpr size_t LANES = 8;                         // MAX_BANDS arrondi à 2 registres de 4
+constexpr size_t MAX_SECTIONS = 2 * MAX_CROSSOVERS; // pire cas : dernière bande, LR4 passe-haut par crossover
+constexpr double BUTTERWORTH_Q = 0.70710678118654752440;
+constexpr double MAX_FREQUENCY_RATIO = 0.45; // fraction de la fréquence d'échantillonnage
+constexpr double PI = 3.14159265358979323846;
+constexpr double QUARTER_PI = PI / 4.0;
+constexpr double HALF_PI = PI / 2.0;
+} // namespace CrossoverConstants
+
+/**
+ * @brief Phase-coherent LR4 band splitter evaluated as a SIMD filter bank
+ *
+ * The classic crossover tree (LP/HP at each split, all-pass compensation of the
+ * lower bands) is serial. Since every filter is linear and time-invariant, each
+ * band can equivalently be computed straight from the input as its own cascade:
+ *
+ *   band i = LP4(f_i) * prod_{j<i} HP4(f_j) * prod_{j>i} AP2(f_j)
+ *
+ * (LR4 low-pass + high-pass is exactly the 2nd order Butterworth-Q all-pass.)
+ * Bands become independent lanes: section s of every band is updated at once,
+ * 4 lanes per NEON/SSE register, with identity sections padding the shorter
+ * cascades. The sum of all bands is an all-pass response of the input.
+ *
+ * One instance handles one channel. Output is sample-major: bands[n * LANES + b].
+ */
+class CrossoverFilterBank {
+public:
+    CrossoverFilterBank() {
+        reset();
+        clearCoefficients();
+    }
+
+    /**
+     * @brief Designs the bank (real-time safe: no allocation, rational tan)
+     * @param numBands 2..MAX_BANDS
+     * @param crossoversHz numBands - 1 ascending frequencies
+     */
+    void configure(size_t numBands, const float* crossoversHz, double sampleRate) {
+        numBands_ = std::max<size_t>(2, std::min(numBands, CrossoverConstants::MAX_BANDS));
+        const size_t numCrossovers = numBands_ - 1;
+        numSections_ = 2 * numCrossovers;
+        numGroups_ = (numBands_ + 3) / 4;
+        clearCoefficients();
+
+        // Fréquences croissantes imposées pour garder des bandes disjointes
+        const double maxFreq = sampleRate * CrossoverConstants::MAX_FREQUENCY_RATIO;
+        double previous = 0.0;
+        for (size_t c = 0; c < numCrossovers; ++c) {
+            previous = std::min(maxFreq, std::max(static_cast<double>(crossoversHz[c]), previous));
+            frequencies_[c] = static_cast<float>(previous);
+        }
+
+        for (size_t band = 0; band < numBands_; ++band) {
+            size_t section = 0;
+            for (size_t c = 0; c < numCrossovers; ++c) {
+                const double freq = frequencies_[c];
+                if (c < band) {
+                    setSection(section++, band, Shape::HIGHPASS, freq, sampleRate);
+                    setSection(section++, band, Shape::HIGHPASS, freq, sampleRate);
+                } else if (c == band) {
+                    setSection(section++, band, Shape::LOWPASS, freq, sampleRate);
+                    setSection(section++, band, Shape::LOWPASS, freq, sampleRate);
+                } else {
+                    setSection(section++, band, Shape::ALLPASS, freq, sampleRate);
+                }
+            }
+        }
+    }
+
+    void reset() noexcept {
+        std::fill(&z1_[0][0], &z1_[0][0] + CrossoverConstants::MAX_SECTIONS * CrossoverConstants::LANES, 0.0f);
+        std::fill(&z2_[0][0], &z2_[0][0] + CrossoverConstants::MAX_SECTIONS * CrossoverConstants::LANES, 0.0f);
+    }
+
+    [[nodiscard]] size_t getNumBands() const noexcept {
+        return numBands_;
+    }
+    [[nodiscard]] float getCrossover(size_t index) const noexcept {
+        return index < CrossoverConstants::MAX_CROSSOVERS ? frequencies_[index] : 0.0f;
+    }
+
+    /**
+     * @brief Splits numSamples inputs into bands (numSamples * LANES floats)
+     */
+    void process(const float* input, float* bands, size_t numSamples) noexcept {
+        for (size_t n = 0; n < numSamples; ++n) {
+            float* out = bands + n * CrossoverConstants::LANES;
+            for (size_t g = 0; g < numGroups_; ++g) {
+                processGroup(input[n], out, g * 4);
+            }
+        }
+    }
+
+private:
+    enum class Shape { LOWPASS, HIGHPASS, ALLPASS };
+
+    // Transposed direct form II on 4 lanes: y = b0 x + z1 ; z1 = b1 x - a1 y + z2 ; z2 = b2 x - a2 y
+    void processGroup(float x, float* out, size_t lane) noexcept {
+#if defined(NYTH_CROSSOVER_NEON)
+        float32x4_t v = vdupq_n_f32(x);
+        for (size_t s = 0; s < numSections_; ++s) {
+            float32x4_t z1 = vld1q_f32(&z1_[s][lane]);
+            float32x4_t z2 = vld1q_f32(&z2_[s][lane]);
+            float32x4_t y = vmlaq_f32(z1, vld1q_f32(&b0_[s][lane]), v);
+            z1 = vmlsq_f32(vmlaq_f32(z2, vld1q_f32(&b1_[s][lane]), v), vld1q_f32(&a1_[s][lane]), y);
+            z2 = vmlsq_f32(vmulq_f32(vld1q_f32(&b2_[s][lane]), v), vld1q_f32(&a2_[s][lane]), y);
+            vst1q_f32(&z1_[s][lane], z1);
+            vst1q_f32(&z2_[s][lane], z2);
+            v = y;
+        }
+        vst1q_f32(out + lane, v);
+#elif defined(NYTH_CROSSOVER_SSE)
+        __m128 v = _mm_set1_ps(x);
+        for (size_t s = 0; s < numSections_; ++s) {
+            __m128 z1 = _mm_load_ps(&z1_[s][lane]);
+            __m128 z2 = _mm_load_ps(&z2_[s][lane]);
+            __m128 y = _mm_add_ps(z1, _mm_mul_ps(_mm_load_ps(&b0_[s][lane]), v));
+            z1 = _mm_sub_ps(_mm_add_ps(z2, _mm_mul_ps(_mm_load_ps(&b1_[s][lane]), v)),
+                            _mm_mul_ps(_mm_load_ps(&a1_[s][lane]), y));
+            z2 = _mm_sub_ps(_mm_mul_ps(_mm_load_ps(&b2_[s][lane]), v), _mm_mul_ps(_mm_load_ps(&a2_[s][lane]), y));
+            _mm_store_ps(&z1_[s][lane], z1);
+            _mm_store_ps(&z2_[s][lane], z2);
+            v = y;
+        }
+        _mm_storeu_ps(out + lane, v);
+#else
+        float v[4] = {x, x, x, x};
+        for (size_t s = 0; s < numSections_; ++s) {
+            for (size_t l = 0; l < 4; ++l) {
+                const size_t k = lane + l;
+                const float y = b0_[s][k] * v[l] + z1_[s][k];
+                z1_[s][k] = b1_[s][k] * v[l] - a1_[s][k] * y + z2_[s][k];
+                z2_[s][k] = b2_[s][k] * v[l] - a2_[s][k] * y;
+                v[l] = y;
+            }
+        }
+        std::copy_n(v, 4, out + lane);
+#endif
+    }
+
+    // Toutes les sections à l'identité (b0 = 1) : les voies inutilisées restent transparentes
+    void clearCoefficients() noexcept {
+        for (size_t s = 0; s < CrossoverConstants::MAX_SECTIONS; ++s) {
+            for (size_t l = 0; l < CrossoverConstants::LANES; ++l) {
+                b0_[s][l] = 1.0f;
+                b1_[s][l] = b2_[s][l] = a1_[s][l] = a2_[s][l] = 0.0f;
+            }
+        }
+    }
+
+    // tan(x) pour x dans [0, pi/2) : Padé [5/4] sur [0, pi/4], cotangente au-delà.
+    // Erreur relative < 2e-8 jusqu'à MAX_FREQUENCY_RATIO, sans appel à la libm :
+    // l'automation des crossovers reconfigure la banque sur le thread audio.
+    static double prewarp(double x) noexcept {
+        auto pade = [](double t) {
+            const double t2 = t * t;
+            return t * (945.0 - 105.0 * t2 + t2 * t2) / (945.0 - 420.0 * t2 + 15.0 * t2 * t2);
+        };
+        return x <= CrossoverConstants::QUARTER_PI ? pade(x) : 1.0 / pade(CrossoverConstants::HALF_PI - x);
+    }
+
+    void setSection(size_t section, size_t lane, Shape shape, double frequency, double sampleRate) noexcept {
+        const double k = prewarp(CrossoverConstants::PI * frequency / sampleRate);
+        const double kk = k * k;
+        const double kq = k / CrossoverConstants::BUTTERWORTH_Q;
+        const double norm = 1.0 / (1.0 + kq + kk);
+        const double a1 = 2.0 * (kk - 1.0) * norm;
+        const double a2 = (1.0 - kq + kk) * norm;
+
+        double b0 = 0.0, b1 = 0.0, b2 = 0.0;
+        switch (shape) {
+            case Shape::LOWPASS:
+                b0 = kk * norm;
+                b1 = 2.0 * b0;
+                b2 = b0;
+                break;
+            case Shape::HIGHPASS:
+                b0 = norm;
+                b1 = -2.0 * norm;
+                b2 = norm;
+                break;
+            case Shape::ALLPASS:
+                b0 = a2;
+                b1 = a1;
+                b2 = 1.0;
+                break;
+        }
+        b0_[section][lane] = static_cast<float>(b0);
+        b1_[section][lane] = static_cast<float>(b1);
+        b2_[section][lane] = static_cast<float>(b2);
+        a1_[section][lane] = static_cast<float>(a1);
+        a2_[section][lane] = static_cast<float>(a2);
+    }
+
+    // Coefficients et états en SoA : [section][voie]
+    alignas(16) float b0_[CrossoverConstants::MAX_SECTIONS][CrossoverConstants::LANES];
+    alignas(16) float b1_[CrossoverConstants::MAX_SECTIONS][CrossoverConstants::LANES];
+    alignas(16) float b2_[CrossoverConstants::MAX_SECTIONS][CrossoverConstants::LANES];
+    alignas(16) float a1_[CrossoverConstants::MAX_SECTIONS][CrossoverConstants::LANES];
+    alignas(16) float a2_[CrossoverConstants::MAX_SECTIONS][CrossoverConstants::LANES];
+    alignas(16) float z1_[CrossoverConstants::MAX_SECTIONS][CrossoverConstants::LANES];
+    alignas(16) float z2_[CrossoverConstants::MAX_SECTIONS][CrossoverConstants::LANES];
+
+    float frequencies_[CrossoverConstants::MAX_CROSSOVERS] = {};
+    size_t numBands_ = 2;
+    size_t numSections_ = 0;
+    size_t numGroups_ = 1;
+};
+
+} // namespace FX
+} // namespace Audio
+} // namespace Nyth
+
+#endif // NYTH_AUDIO_FX_CROSSOVER_FILTER_BANK_HPP
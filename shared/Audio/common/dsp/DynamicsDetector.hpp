@@ -0,0 +1,269 @@
+#pragma once
+#ifndef NYTH_AUDIO_FX_DYNAMICS_DETECTOR_HPP
+#define NYTH_AUDIO_FX_DYNAMICS_DETECTOR_HPP
+
+// C++17 standard headers
+#include "VectorMath.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+// Platform detection and SIMD headers
+#if defined(__ARM_NEON) || defined(__aarch64__)
+#include <arm_neon.h>
+#define NYTH_DYNAMICS_NEON
+#elif defined(__SSE2__) || defined(_M_X64) || defined(__x86_64__)
+#include <emmintrin.h>
+#define NYTH_DYNAMICS_SSE2
+#endif
+
+namespace Nyth {
+namespace Audio {
+namespace FX {
+namespace Dynamics {
+
+/**
+ * @brief Block-based level detection shared by the dynamics processors
+ *
+ * A detector is split into the steps that vectorize and the one that does not:
+ *  - rectification and stereo linking (|x|, max(|L|, |R|), mean square),
+ *    4 lanes at a time (NEON/SSE2) with a scalar tail,
+ *  - attack/release one-pole smoothing, the only recursive step: a single
+ *    branch-free filter, or FollowerBank which runs four filters with their
+ *    own times in the lanes of one register,
+ *  - level -> dB and gain dB -> linear, with the VectorMath log2/exp2 kernels.
+ * Expander, gate, transient shaper and NoiseReducer build on these pieces;
+ * BranchFree::EnvelopeFollower is a per-sample wrapper around the same filter.
+ */
+
+constexpr float DENORMAL_FLOOR = 1e-30f; // état remis à zéro sous ce niveau (fin de bloc)
+constexpr double MIN_TIME_MS = 1e-3;
+
+// Coefficient d'un filtre à un pôle atteignant 1 - 1/e de sa cible en timeMs
+inline float timeCoefficient(double timeMs, double sampleRate) noexcept {
+    const double seconds = std::max(timeMs, MIN_TIME_MS) * 0.001;
+    return static_cast<float>(std::exp(-1.0 / (seconds * std::max(1.0, sampleRate))));
+}
+
+/**
+ * @brief output[i] = |input[i]| (in place allowed)
+ */
+inline void rectify(const float* input, float* output, size_t count) noexcept {
+    size_t i = 0;
+#if defined(NYTH_DYNAMICS_NEON)
+    for (; i + 4 <= count; i += 4) {
+        vst1q_f32(output + i, vabsq_f32(vld1q_f32(input + i)));
+    }
+#elif defined(NYTH_DYNAMICS_SSE2)
+    const __m128 signMask = _mm_set1_ps(-0.0f);
+    for (; i + 4 <= count; i += 4) {
+        _mm_storeu_ps(output + i, _mm_andnot_ps(signMask, _mm_loadu_ps(input + i)));
+    }
+#endif
+    for (; i < count; ++i) {
+        output[i] = std::abs(input[i]);
+    }
+}
+
+/**
+ * @brief output[i] = max(|left[i]|, |right[i]|) : détection stéréo liée crête
+ */
+inline void rectifyLinked(const float* left, const float* right, float* output, size_t count) noexcept {
+    size_t i = 0;
+#if defined(NYTH_DYNAMICS_NEON)
+    for (; i + 4 <= count; i += 4) {
+        vst1q_f32(output + i, vmaxq_f32(vabsq_f32(vld1q_f32(left + i)), vabsq_f32(vld1q_f32(right + i))));
+    }
+#elif defined(NYTH_DYNAMICS_SSE2)
+    const __m128 signMask = _mm_set1_ps(-0.0f);
+    for (; i + 4 <= count; i += 4) {
+        _mm_storeu_ps(output + i, _mm_max_ps(_mm_andnot_ps(signMask, _mm_loadu_ps(left + i)),
+                                             _mm_andnot_ps(signMask, _mm_loadu_ps(right + i))));
+    }
+#endif
+    for (; i < count; ++i) {
+        output[i] = std::max(std::abs(left[i]), std::abs(right[i]));
+    }
+}
+
+/**
+ * @brief output[i] = (left[i]² + right[i]²) / 2 : puissance moyenne (racine à prendre en dB, x0.5)
+ */
+inline void meanSquareLinked(const float* left, const float* right, float* output, size_t count) noexcept {
+    size_t i = 0;
+#if defined(NYTH_DYNAMICS_NEON)
+    const float32x4_t half = vdupq_n_f32(0.5f);
+    for (; i + 4 <= count; i += 4) {
+        const float32x4_t l = vld1q_f32(left + i);
+        const float32x4_t r = vld1q_f32(right + i);
+        vst1q_f32(output + i, vmulq_f32(half, vmlaq_f32(vmulq_f32(l, l), r, r)));
+    }
+#elif defined(NYTH_DYNAMICS_SSE2)
+    const __m128 half = _mm_set1_ps(0.5f);
+    for (; i + 4 <= count; i += 4) {
+        const __m128 l = _mm_loadu_ps(left + i);
+        const __m128 r = _mm_loadu_ps(right + i);
+        _mm_storeu_ps(output + i, _mm_mul_ps(half, _mm_add_ps(_mm_mul_ps(l, l), _mm_mul_ps(r, r))));
+    }
+#endif
+    for (; i < count; ++i) {
+        output[i] = 0.5f * (left[i] * left[i] + right[i] * right[i]);
+    }
+}
+
+/**
+ * @brief One-pole smoother with separate attack (rising) and release (falling) times
+ *
+ * y = x + c * (y - x), c chosen without a branch. Smooths a level (envelope
+ * follower) as well as a gain in dB (opening = attack).
+ */
+class AttackReleaseFilter {
+public:
+    void setTimes(double attackMs, double releaseMs, double sampleRate) noexcept {
+        attackCoeff_ = timeCoefficient(attackMs, sampleRate);
+        releaseCoeff_ = timeCoefficient(releaseMs, sampleRate);
+    }
+    void setCoefficients(float attackCoeff, float releaseCoeff) noexcept {
+        attackCoeff_ = attackCoeff;
+        releaseCoeff_ = releaseCoeff;
+    }
+    void reset(float value = 0.0f) noexcept {
+        state_ = value;
+    }
+    [[nodiscard]] float value() const noexcept {
+        return state_;
+    }
+
+    float step(float x) noexcept {
+        const float coeff = x > state_ ? attackCoeff_ : releaseCoeff_; // cmov
+        state_ = x + coeff * (state_ - x);
+        return state_;
+    }
+
+    // output[i] = état après input[i] (in place allowed)
+    void process(const float* input, float* output, size_t count) noexcept {
+        float state = state_;
+        const float attack = attackCoeff_;
+        const float release = releaseCoeff_;
+        for (size_t i = 0; i < count; ++i) {
+            const float x = input[i];
+            const float coeff = x > state ? attack : release;
+            state = x + coeff * (state - x);
+            output[i] = state;
+        }
+        state_ = std::abs(state) < DENORMAL_FLOOR ? 0.0f : state;
+    }
+
+private:
+    float attackCoeff_ = 0.0f;
+    float releaseCoeff_ = 0.0f;
+    float state_ = 0.0f;
+};
+
+/**
+ * @brief Four attack/release followers of one input, one per SIMD lane
+ *
+ * Detectors that compare envelopes of the same signal (fast vs slow attack,
+ * fast vs slow release) advance them together: one broadcast, compare,
+ * select and multiply-add per sample for all four. Output is interleaved,
+ * output[i * LANES + lane], so the whole block converts to dB in one call.
+ */
+class FollowerBank {
+public:
+    static constexpr size_t LANES = 4;
+
+    void setLane(size_t lane, double attackMs, double releaseMs, double sampleRate) noexcept {
+        if (lane >= LANES) {
+            return;
+        }
+        attack_[lane] = timeCoefficient(attackMs, sampleRate);
+        release_[lane] = timeCoefficient(releaseMs, sampleRate);
+    }
+    void reset(float value = 0.0f) noexcept {
+        std::fill_n(state_, LANES, value);
+    }
+    [[nodiscard]] float value(size_t lane) const noexcept {
+        return state_[std::min(lane, LANES - 1)];
+    }
+
+    // output doit contenir count * LANES valeurs
+    void processShared(const float* input, float* output, size_t count) noexcept {
+#if defined(NYTH_DYNAMICS_NEON)
+        const float32x4_t attack = vld1q_f32(attack_);
+        const float32x4_t release = vld1q_f32(release_);
+        float32x4_t state = vld1q_f32(state_);
+        for (size_t i = 0; i < count; ++i) {
+            const float32x4_t x = vdupq_n_f32(input[i]);
+            const float32x4_t coeff = vbslq_f32(vcgtq_f32(x, state), attack, release);
+            state = vmlaq_f32(x, coeff, vsubq_f32(state, x));
+            vst1q_f32(output + i * LANES, state);
+        }
+        vst1q_f32(state_, state);
+#elif defined(NYTH_DYNAMICS_SSE2)
+        const __m128 attack = _mm_loadu_ps(attack_);
+        const __m128 release = _mm_loadu_ps(release_);
+        __m128 state = _mm_loadu_ps(state_);
+        for (size_t i = 0; i < count; ++i) {
+            const __m128 x = _mm_set1_ps(input[i]);
+            const __m128 rising = _mm_cmpgt_ps(x, state);
+            const __m128 coeff = _mm_or_ps(_mm_and_ps(rising, attack), _mm_andnot_ps(rising, release));
+            state = _mm_add_ps(x, _mm_mul_ps(coeff, _mm_sub_ps(state, x)));
+            _mm_storeu_ps(output + i * LANES, state);
+        }
+        _mm_storeu_ps(state_, state);
+#else
+        for (size_t i = 0; i < count; ++i) {
+            const float x = input[i];
+            for (size_t lane = 0; lane < LANES; ++lane) {
+                const float coeff = x > state_[lane] ? attack_[lane] : release_[lane];
+                state_[lane] = x + coeff * (state_[lane] - x);
+                output[i * LANES + lane] = state_[lane];
+            }
+        }
+#endif
+        for (float& level : state_) {
+            level = std::abs(level) < DENORMAL_FLOOR ? 0.0f : level;
+        }
+    }
+
+private:
+    alignas(16) float attack_[LANES] = {};
+    alignas(16) float release_[LANES] = {};
+    alignas(16) float state_[LANES] = {};
+};
+
+/**
+ * @brief Peak level in dBFS: rectify (linked in stereo) -> attack/release -> dB
+ */
+class LevelDetector {
+public:
+    void setTimes(double attackMs, double releaseMs, double sampleRate) noexcept {
+        follower_.setTimes(attackMs, releaseMs, sampleRate);
+    }
+    void reset() noexcept {
+        follower_.reset(0.0f);
+    }
+
+    // levelDb reçoit count niveaux ; peut être le tampon d'entrée d'un traitement hors place
+    void processMono(const float* input, float* levelDb, size_t count) noexcept {
+        rectify(input, levelDb, count);
+        follower_.process(levelDb, levelDb, count);
+        VectorMath::linearToDb(levelDb, levelDb, count);
+    }
+    void processStereo(const float* left, const float* right, float* levelDb, size_t count) noexcept {
+        rectifyLinked(left, right, levelDb, count);
+        follower_.process(levelDb, levelDb, count);
+        VectorMath::linearToDb(levelDb, levelDb, count);
+    }
+
+private:
+    AttackReleaseFilter follower_;
+};
+
+} // namespace Dynamics
+} // namespace FX
+} // namespace Audio
+} // namespace Nyth
+
+#endif // NYTH_AUDIO_FX_DYNAMICS_DETECTOR_HPP
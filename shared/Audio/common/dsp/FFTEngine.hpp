@@ -42,6 +42,9 @@ public:
 
     virtual void forwardR2C(const float* real, std::vector<float>& realOut, std::vector<float>& imagOut) = 0;
     virtual void inverseC2R(const std::vector<float>& realIn, const std::vector<float>& imagIn, float* real) = 0;
+    // Transformées complexes en place sur getSize() points (inverse normalisée en 1/N, comme inverseC2R)
+    virtual void forwardC2C(std::vector<float>& real, std::vector<float>& imag) = 0;
+    virtual void inverseC2C(std::vector<float>& real, std::vector<float>& imag) = 0;
     virtual size_t getSize() const = 0;
 };
 
@@ -61,6 +64,8 @@ public:
 
         // Precompute twiddle factors
         computeTwiddleFactors();
+        scratchReal_.resize(size_);
+        scratchImag_.resize(size_);
     }
 
     void forwardR2C(const float* real, std::vector<float>& realOut, std::vector<float>& imagOut) override {
@@ -78,16 +83,30 @@ public:
     }
 
     void inverseC2R(const std::vector<float>& realIn, const std::vector<float>& imagIn, float* real) override {
-        std::vector<float> tempReal = realIn;
-        std::vector<float> tempImag = imagIn;
+        // Scratch préalloué : pas d'allocation par appel (utilisable en temps réel)
+        std::copy_n(realIn.begin(), size_, scratchReal_.begin());
+        std::copy_n(imagIn.begin(), size_, scratchImag_.begin());
 
         // Perform inverse FFT
-        fftRadix2(tempReal, tempImag, true);
+        fftRadix2(scratchReal_, scratchImag_, true);
 
         // Copy real part and normalize
         float norm = 1.0f / static_cast<float>(size_);
         for (size_t i = 0; i < size_; ++i) {
-            real[i] = tempReal[i] * norm;
+            real[i] = scratchReal_[i] * norm;
+        }
+    }
+
+    void forwardC2C(std::vector<float>& real, std::vector<float>& imag) override {
+        fftRadix2(real, imag, false);
+    }
+
+    void inverseC2C(std::vector<float>& real, std::vector<float>& imag) override {
+        fftRadix2(real, imag, true);
+        float norm = 1.0f / static_cast<float>(size_);
+        for (size_t i = 0; i < size_; ++i) {
+            real[i] *= norm;
+            imag[i] *= norm;
         }
     }
 
@@ -99,6 +118,8 @@ private:
     size_t size_;
     std::vector<float> twiddleReal_;
     std::vector<float> twiddleImag_;
+    std::vector<float> scratchReal_;
+    std::vector<float> scratchImag_;
 
     static bool isPowerOfTwo(size_t n) {
         return n && !(n & (n - 1));
@@ -178,6 +199,57 @@ inline std::unique_ptr<IFFTEngine> createFFTEngine(size_t size) {
     return std::make_unique<SimpleFFT>(size);
 }
 
+/**
+ * @brief Two real FFTs for the price of one complex FFT
+ *
+ * z = a + j b is transformed once, then split with the Hermitian symmetry of
+ * real signals: A[k] = (Z[k] + Z*[N-k]) / 2, B[k] = (Z[k] - Z*[N-k]) / 2j.
+ * Outputs are half spectra of N / 2 + 1 bins; re / im are N-point scratch.
+ */
+inline void forwardR2CPair(IFFTEngine& fft, const float* a, const float* b, std::vector<float>& re,
+                           std::vector<float>& im, float* reA, float* imA, float* reB, float* imB) {
+    const size_t n = fft.getSize();
+    std::copy_n(a, n, re.begin());
+    std::copy_n(b, n, im.begin());
+    fft.forwardC2C(re, im);
+    for (size_t k = 0; k <= n / 2; ++k) {
+        const size_t mirror = (n - k) & (n - 1);
+        const float zr = re[k], zi = im[k];
+        const float cr = re[mirror], ci = im[mirror];
+        reA[k] = 0.5f * (zr + cr);
+        imA[k] = 0.5f * (zi - ci);
+        reB[k] = 0.5f * (zi + ci);
+        imB[k] = 0.5f * (cr - zr);
+    }
+}
+
+/**
+ * @brief Inverse of forwardR2CPair: Z = A + j B rebuilt on N points, one
+ *        complex IFFT, a = Re(z), b = Im(z)
+ *
+ * As with inverseC2R, the imaginary parts of the DC and Nyquist bins are
+ * ignored (they have no real-signal counterpart).
+ */
+inline void inverseC2RPair(IFFTEngine& fft, const float* reA, const float* imA, const float* reB, const float* imB,
+                           std::vector<float>& re, std::vector<float>& im, float* a, float* b) {
+    const size_t n = fft.getSize();
+    const size_t half = n / 2;
+    re[0] = reA[0];
+    im[0] = reB[0];
+    re[half] = reA[half];
+    im[half] = reB[half];
+    for (size_t k = 1; k < half; ++k) {
+        // Z[k] = A + j B, Z[N-k] = A* + j B*
+        re[k] = reA[k] - imB[k];
+        im[k] = imA[k] + reB[k];
+        re[n - k] = reA[k] + imB[k];
+        im[n - k] = reB[k] - imA[k];
+    }
+    fft.inverseC2C(re, im);
+    std::copy_n(re.begin(), n, a);
+    std::copy_n(im.begin(), n, b);
+}
+
 } // namespace FX
 } // namespace Audio
 } // namespace Nyth
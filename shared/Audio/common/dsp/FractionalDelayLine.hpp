@@ -0,0 +1,103 @@
+#pragma once
+#ifndef NYTH_AUDIO_FX_FRACTIONAL_DELAY_LINE_HPP
+#define NYTH_AUDIO_FX_FRACTIONAL_DELAY_LINE_HPP
+
+// C++17 standard headers
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+namespace Nyth {
+namespace Audio {
+namespace FX {
+
+// C++17 constexpr constants for fractional delay lines
+namespace DelayLineConstants {
+constexpr size_t INTERPOLATION_GUARD = 4;       // échantillons en plus de la capacité demandée
+constexpr float MIN_DELAY_SAMPLES = 2.0f;       // la fenêtre Hermite ne lit que le passé
+} // namespace DelayLineConstants
+
+/**
+ * @brief Circular buffer with fractional (4-point Hermite) read taps
+ *
+ * Storage is allocated once in prepare() for the largest delay the owner will
+ * ever request; delay times then change freely without touching memory. Any
+ * number of taps can read the same line, so multi-tap or modulated effects
+ * share a single buffer per channel.
+ *
+ * read(d) returns the sample written d samples ago (d = 1: last write). Call
+ * read() before write() when the read value feeds back into the line.
+ */
+class FractionalDelayLine {
+public:
+    FractionalDelayLine() = default;
+
+    /**
+     * @brief Allocates the line (non real-time)
+     * @param maxDelaySamples largest delay passed to read()
+     */
+    void prepare(size_t maxDelaySamples) {
+        buffer_.assign(maxDelaySamples + DelayLineConstants::INTERPOLATION_GUARD, 0.0f);
+        maxDelay_ = static_cast<float>(maxDelaySamples);
+        writePos_ = 0;
+    }
+
+    void reset() noexcept {
+        std::fill(buffer_.begin(), buffer_.end(), 0.0f);
+        writePos_ = 0;
+    }
+
+    [[nodiscard]] float getMaxDelay() const noexcept {
+        return maxDelay_;
+    }
+    [[nodiscard]] bool isPrepared() const noexcept {
+        return !buffer_.empty();
+    }
+
+    void write(float x) noexcept {
+        buffer_[writePos_] = x;
+        writePos_ = (writePos_ + 1 == buffer_.size()) ? 0 : writePos_ + 1;
+    }
+
+    /**
+     * @brief Hermite-interpolated read, delay clamped to [MIN_DELAY_SAMPLES, max]
+     */
+    [[nodiscard]] float read(float delaySamples) const noexcept {
+        const float d = std::min(std::max(delaySamples, DelayLineConstants::MIN_DELAY_SAMPLES), maxDelay_);
+        const size_t whole = static_cast<size_t>(d);
+        const float frac = d - static_cast<float>(whole);
+
+        // Points de retard whole + 2, whole + 1, whole, whole - 1 (du plus ancien au plus récent) ;
+        // la position lue est à t = 1 - frac après le point "whole + 1"
+        const size_t size = buffer_.size();
+        const size_t newer = writePos_ >= whole ? writePos_ - whole : writePos_ + size - whole;
+        const size_t older = newer == 0 ? size - 1 : newer - 1;
+        if (frac == 0.0f) {
+            return buffer_[newer];
+        }
+        const size_t oldest = older == 0 ? size - 1 : older - 1;
+        const size_t newest = newer + 1 == size ? 0 : newer + 1;
+
+        const float xm1 = buffer_[oldest];
+        const float x0 = buffer_[older];
+        const float x1 = buffer_[newer];
+        const float x2 = buffer_[newest];
+        const float t = 1.0f - frac;
+
+        const float c1 = 0.5f * (x1 - xm1);
+        const float c2 = xm1 - 2.5f * x0 + 2.0f * x1 - 0.5f * x2;
+        const float c3 = 0.5f * (x2 - xm1) + 1.5f * (x0 - x1);
+        return ((c3 * t + c2) * t + c1) * t + x0;
+    }
+
+private:
+    std::vector<float> buffer_;
+    size_t writePos_ = 0;
+    float maxDelay_ = 0.0f;
+};
+
+} // namespace FX
+} // namespace Audio
+} // namespace Nyth
+
+#endif // NYTH_AUDIO_FX_FRACTIONAL_DELAY_LINE_HPP
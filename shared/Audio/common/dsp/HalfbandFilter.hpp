@@ -0,0 +1,295 @@
+#pragma once
+#ifndef NYTH_AUDIO_FX_HALFBAND_FILTER_HPP
+#define NYTH_AUDIO_FX_HALFBAND_FILTER_HPP
+
+// C++17 standard headers
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+// Platform detection and SIMD headers
+#if defined(__ARM_NEON) || defined(__aarch64__)
+#include <arm_neon.h>
+#define NYTH_HALFBAND_NEON
+#elif defined(__SSE__) || defined(_M_X64) || defined(__x86_64__)
+#include <xmmintrin.h>
+#define NYTH_HALFBAND_SSE
+#endif
+
+namespace Nyth {
+namespace Audio {
+namespace FX {
+
+// C++17 constexpr constants for half-band oversampling
+namespace HalfbandConstants {
+constexpr size_t FIRST_STAGE_HALF_LENGTH = 8; // 31 taps, 16 non-zero
+constexpr size_t CASCADE_STAGE_HALF_LENGTH = 4; // 15 taps, 8 non-zero
+constexpr size_t MAX_STAGES = 3;              // 2x, 4x, 8x
+constexpr double KAISER_BETA = 7.5;
+constexpr double PI = 3.14159265358979323846;
+} // namespace HalfbandConstants
+
+/**
+ * @brief Dot product used by the polyphase branches (NEON/SSE, scalar fallback)
+ */
+inline float halfbandDot(const float* a, const float* b, size_t n) noexcept {
+    size_t i = 0;
+#if defined(NYTH_HALFBAND_NEON)
+    float32x4_t acc = vdupq_n_f32(0.0f);
+    for (; i + 4 <= n; i += 4) {
+        acc = vmlaq_f32(acc, vld1q_f32(a + i), vld1q_f32(b + i));
+    }
+    float32x2_t sum2 = vadd_f32(vget_low_f32(acc), vget_high_f32(acc));
+    float sum = vget_lane_f32(vpadd_f32(sum2, sum2), 0);
+#elif defined(NYTH_HALFBAND_SSE)
+    __m128 acc = _mm_setzero_ps();
+    for (; i + 4 <= n; i += 4) {
+        acc = _mm_add_ps(acc, _mm_mul_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i)));
+    }
+    alignas(16) float lanes[4];
+    _mm_store_ps(lanes, acc);
+    float sum = (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+#else
+    float s0 = 0.0f, s1 = 0.0f, s2 = 0.0f, s3 = 0.0f;
+    for (; i + 4 <= n; i += 4) {
+        s0 += a[i] * b[i];
+        s1 += a[i + 1] * b[i + 1];
+        s2 += a[i + 2] * b[i + 2];
+        s3 += a[i + 3] * b[i + 3];
+    }
+    float sum = (s0 + s1) + (s2 + s3);
+#endif
+    for (; i < n; ++i) {
+        sum += a[i] * b[i];
+    }
+    return sum;
+}
+
+/**
+ * @brief Linear-phase half-band FIR stage in polyphase form (2x up / 2x down)
+ *
+ * A half-band filter of length 4M-1 has every other tap equal to zero except
+ * the centre one (0.5). Split into its two polyphase branches, one branch is a
+ * pure delay and the other a 2M-tap FIR running at the low rate, so each
+ * interpolated or decimated sample costs 2M MACs instead of 4M-1.
+ *
+ * Histories are stored twice back-to-back so that the FIR window is always a
+ * contiguous block and the dot product can run on SIMD registers.
+ */
+class HalfbandStage {
+public:
+    HalfbandStage() {
+        design(HalfbandConstants::FIRST_STAGE_HALF_LENGTH);
+    }
+
+    /**
+     * @brief Computes the Kaiser-windowed half-band taps (non real-time)
+     * @param halfLength M, number of non-zero taps per side of the centre
+     */
+    void design(size_t halfLength) {
+        halfLength_ = std::max<size_t>(1, halfLength);
+        taps_ = 2 * halfLength_;
+
+        const size_t length = 4 * halfLength_ - 1;
+        const double centre = static_cast<double>(length - 1) * 0.5;
+        const double i0Beta = besselI0(HalfbandConstants::KAISER_BETA);
+
+        coeffs_.assign(taps_, 0.0f);
+        double sum = 0.0;
+        for (size_t k = 0; k < taps_; ++k) {
+            // Even taps of the full filter: index 2k, distance (2k - centre) is odd
+            const double t = static_cast<double>(2 * k) - centre;
+            const double sinc = std::sin(HalfbandConstants::PI * t * 0.5) / (HalfbandConstants::PI * t);
+            const double r = t / centre;
+            const double window = besselI0(HalfbandConstants::KAISER_BETA * std::sqrt(std::max(0.0, 1.0 - r * r))) / i0Beta;
+            coeffs_[k] = static_cast<float>(sinc * window);
+            sum += sinc * window;
+        }
+        // Normalise so the FIR branch sums to 0.5 (unity DC gain with the 0.5 centre tap)
+        const float norm = sum != 0.0 ? static_cast<float>(0.5 / sum) : 1.0f;
+        for (auto& c : coeffs_) {
+            c *= norm;
+        }
+
+        upHistory_.assign(2 * taps_, 0.0f);
+        downEven_.assign(2 * taps_, 0.0f);
+        downOdd_.assign(2 * taps_, 0.0f);
+        reset();
+    }
+
+    void reset() noexcept {
+        std::fill(upHistory_.begin(), upHistory_.end(), 0.0f);
+        std::fill(downEven_.begin(), downEven_.end(), 0.0f);
+        std::fill(downOdd_.begin(), downOdd_.end(), 0.0f);
+        upPos_ = downPos_ = 0;
+    }
+
+    /**
+     * @brief Interpolates numSamples inputs into 2 * numSamples outputs
+     */
+    void upsample(const float* input, float* output, size_t numSamples) noexcept {
+        for (size_t n = 0; n < numSamples; ++n) {
+            const float* window = push(upHistory_, upPos_, input[n]);
+            output[2 * n] = 2.0f * halfbandDot(coeffs_.data(), window, taps_);
+            output[2 * n + 1] = window[halfLength_];
+            upPos_ = upPos_ + 1 == taps_ ? 0 : upPos_ + 1;
+        }
+    }
+
+    /**
+     * @brief Decimates 2 * numSamples inputs into numSamples outputs
+     */
+    void downsample(const float* input, float* output, size_t numSamples) noexcept {
+        for (size_t n = 0; n < numSamples; ++n) {
+            const float* even = push(downEven_, downPos_, input[2 * n]);
+            const float* odd = push(downOdd_, downPos_, input[2 * n + 1]);
+            output[n] = halfbandDot(coeffs_.data(), even, taps_) + 0.5f * odd[taps_ - 1 - halfLength_];
+            downPos_ = downPos_ + 1 == taps_ ? 0 : downPos_ + 1;
+        }
+    }
+
+    /**
+     * @brief Group delay of one up + down pass, in samples at the high rate
+     */
+    [[nodiscard]] size_t getRoundTripDelay() const noexcept {
+        return 2 * (2 * halfLength_ - 1);
+    }
+
+private:
+    // Writes x into the doubled ring and returns the contiguous window (oldest first)
+    static const float* push(std::vector<float>& ring, size_t pos, float x) noexcept {
+        const size_t taps = ring.size() / 2;
+        ring[pos] = x;
+        ring[pos + taps] = x;
+        return ring.data() + pos + 1;
+    }
+
+    static double besselI0(double x) noexcept {
+        double sum = 1.0;
+        double term = 1.0;
+        const double halfX = 0.5 * x;
+        for (int k = 1; k < 32; ++k) {
+            term *= (halfX / k) * (halfX / k);
+            sum += term;
+            if (term < 1e-12 * sum) {
+                break;
+            }
+        }
+        return sum;
+    }
+
+    size_t halfLength_ = HalfbandConstants::FIRST_STAGE_HALF_LENGTH;
+    size_t taps_ = 2 * HalfbandConstants::FIRST_STAGE_HALF_LENGTH;
+    std::vector<float> coeffs_;
+    std::vector<float> upHistory_;
+    std::vector<float> downEven_;
+    std::vector<float> downOdd_;
+    size_t upPos_ = 0;
+    size_t downPos_ = 0;
+};
+
+/**
+ * @brief 2x / 4x / 8x oversampler built from cascaded half-band stages
+ *
+ * The first stage carries the steep transition band; the following stages
+ * only have to reject images above the already band-limited signal and use
+ * shorter filters. One instance handles a single channel.
+ */
+class PolyphaseOversampler {
+public:
+    PolyphaseOversampler() = default;
+
+    /**
+     * @brief Configures factor and maximum base-rate block size (non real-time)
+     * @param factor 1, 2, 4 or 8 (rounded down to a supported power of two)
+     */
+    void prepare(size_t factor, size_t maxBlockSize) {
+        numStages_ = 0;
+        while (numStages_ < HalfbandConstants::MAX_STAGES && (size_t(2) << numStages_) <= factor) {
+            ++numStages_;
+        }
+        factor_ = size_t(1) << numStages_;
+        maxBlockSize_ = std::max<size_t>(1, maxBlockSize);
+
+        for (size_t s = 0; s < numStages_; ++s) {
+            stages_[s].design(s == 0 ? HalfbandConstants::FIRST_STAGE_HALF_LENGTH
+                                     : HalfbandConstants::CASCADE_STAGE_HALF_LENGTH);
+        }
+        scratch_.assign(maxBlockSize_ * factor_, 0.0f);
+    }
+
+    void reset() noexcept {
+        for (auto& stage : stages_) {
+            stage.reset();
+        }
+    }
+
+    [[nodiscard]] size_t getFactor() const noexcept {
+        return factor_;
+    }
+    [[nodiscard]] size_t getMaxBlockSize() const noexcept {
+        return maxBlockSize_;
+    }
+
+    /**
+     * @brief Round-trip latency (up + down) expressed in base-rate samples
+     */
+    [[nodiscard]] double getLatencySamples() const noexcept {
+        double latency = 0.0;
+        for (size_t s = 0; s < numStages_; ++s) {
+            latency += static_cast<double>(stages_[s].getRoundTripDelay()) / static_cast<double>(size_t(2) << s);
+        }
+        return latency;
+    }
+
+    /**
+     * @brief Upsamples numSamples (<= maxBlockSize) into numSamples * factor samples
+     */
+    void upsample(const float* input, float* output, size_t numSamples) noexcept {
+        if (numStages_ == 0) {
+            std::copy_n(input, numSamples, output);
+            return;
+        }
+        // Ping-pong between output and scratch so the last stage lands in output
+        const float* src = input;
+        size_t n = numSamples;
+        for (size_t s = 0; s < numStages_; ++s) {
+            float* dst = ((numStages_ - 1 - s) & 1) ? scratch_.data() : output;
+            stages_[s].upsample(src, dst, n);
+            src = dst;
+            n *= 2;
+        }
+    }
+
+    /**
+     * @brief Downsamples numSamples * factor samples into numSamples outputs
+     *
+     * Intermediate stages decimate in place inside input (sample k only depends
+     * on samples >= k), so the oversampled buffer is clobbered.
+     */
+    void downsample(float* input, float* output, size_t numSamples) noexcept {
+        if (numStages_ == 0) {
+            std::copy_n(input, numSamples, output);
+            return;
+        }
+        size_t n = numSamples * factor_;
+        for (size_t s = numStages_; s-- > 0;) {
+            n /= 2;
+            stages_[s].downsample(input, s == 0 ? output : input, n);
+        }
+    }
+
+private:
+    HalfbandStage stages_[HalfbandConstants::MAX_STAGES];
+    size_t numStages_ = 0;
+    size_t factor_ = 1;
+    size_t maxBlockSize_ = 0;
+    std::vector<float> scratch_;
+};
+
+} // namespace FX
+} // namespace Audio
+} // namespace Nyth
+
+#endif // NYTH_AUDIO_FX_HALFBAND_FILTER_HPP
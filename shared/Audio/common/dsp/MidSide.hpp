@@ -0,0 +1,201 @@
+#pragma once
+#ifndef NYTH_AUDIO_FX_MID_SIDE_HPP
+#define NYTH_AUDIO_FX_MID_SIDE_HPP
+
+// C++17 standard headers
+#include <cstddef>
+
+// Platform detection and SIMD headers
+#if defined(__ARM_NEON) || defined(__aarch64__)
+#include <arm_neon.h>
+#define NYTH_MID_SIDE_NEON
+#elif defined(__SSE2__) || defined(_M_X64) || defined(__x86_64__)
+#include <emmintrin.h>
+#define NYTH_MID_SIDE_SSE2
+#endif
+
+namespace Nyth {
+namespace Audio {
+namespace FX {
+namespace MidSide {
+
+/**
+ * @brief 2x2 channel matrices applied in one vectorized pass
+ *
+ * Mid/side encode and decode, width, mid/side gains and their products are
+ * all 2x2 matrices on a (first, second) channel pair:
+ *
+ *     y0 = m00 * x0 + m01 * x1
+ *     y1 = m10 * x0 + m11 * x1
+ *
+ * so any sequence of them folds into one matrix (product()) and runs as a
+ * single pass over the block. Four kernels cover the layouts: planar ->
+ * planar, interleaved -> interleaved (pairs swapped inside the register, no
+ * deinterleave), interleaved -> planar and planar -> interleaved (for the
+ * stages that need the channels apart, e.g. filtering the side only).
+ * apply() and applyInterleaved() allow in-place processing.
+ */
+
+struct Matrix {
+    float m00 = 1.0f;
+    float m01 = 0.0f;
+    float m10 = 0.0f;
+    float m11 = 1.0f;
+};
+
+constexpr Matrix IDENTITY{1.0f, 0.0f, 0.0f, 1.0f};
+constexpr Matrix ENCODE{0.5f, 0.5f, 0.5f, -0.5f}; // L/R -> M = (L + R) / 2, S = (L - R) / 2
+constexpr Matrix DECODE{1.0f, 1.0f, 1.0f, -1.0f}; // M/S -> L = M + S, R = M - S
+
+// Gains séparés sur les deux canaux (mid / side)
+constexpr Matrix scale(float g0, float g1) noexcept {
+    return Matrix{g0, 0.0f, 0.0f, g1};
+}
+
+// a appliquée après b
+constexpr Matrix product(const Matrix& a, const Matrix& b) noexcept {
+    return Matrix{a.m00 * b.m00 + a.m01 * b.m10, a.m00 * b.m01 + a.m01 * b.m11, a.m10 * b.m00 + a.m11 * b.m10,
+                  a.m10 * b.m01 + a.m11 * b.m11};
+}
+
+/**
+ * @brief Planar -> planar: (y0[i], y1[i]) = m * (x0[i], x1[i])
+ */
+inline void apply(const float* x0, const float* x1, float* y0, float* y1, size_t count, const Matrix& m) noexcept {
+    size_t i = 0;
+#if defined(NYTH_MID_SIDE_NEON)
+    const float32x4_t m00 = vdupq_n_f32(m.m00), m01 = vdupq_n_f32(m.m01);
+    const float32x4_t m10 = vdupq_n_f32(m.m10), m11 = vdupq_n_f32(m.m11);
+    for (; i + 4 <= count; i += 4) {
+        const float32x4_t a = vld1q_f32(x0 + i);
+        const float32x4_t b = vld1q_f32(x1 + i);
+        vst1q_f32(y0 + i, vmlaq_f32(vmulq_f32(m00, a), m01, b));
+        vst1q_f32(y1 + i, vmlaq_f32(vmulq_f32(m10, a), m11, b));
+    }
+#elif defined(NYTH_MID_SIDE_SSE2)
+    const __m128 m00 = _mm_set1_ps(m.m00), m01 = _mm_set1_ps(m.m01);
+    const __m128 m10 = _mm_set1_ps(m.m10), m11 = _mm_set1_ps(m.m11);
+    for (; i + 4 <= count; i += 4) {
+        const __m128 a = _mm_loadu_ps(x0 + i);
+        const __m128 b = _mm_loadu_ps(x1 + i);
+        _mm_storeu_ps(y0 + i, _mm_add_ps(_mm_mul_ps(m00, a), _mm_mul_ps(m01, b)));
+        _mm_storeu_ps(y1 + i, _mm_add_ps(_mm_mul_ps(m10, a), _mm_mul_ps(m11, b)));
+    }
+#endif
+    for (; i < count; ++i) {
+        const float a = x0[i];
+        const float b = x1[i];
+        y0[i] = m.m00 * a + m.m01 * b;
+        y1[i] = m.m10 * a + m.m11 * b;
+    }
+}
+
+/**
+ * @brief Interleaved -> interleaved (x0 x1 x0 x1 ...), frames pairs
+ *
+ * y = x * (m00 m11 m00 m11) + swap(x) * (m01 m10 m01 m10), swap exchanging
+ * the two samples of each frame inside the register.
+ */
+inline void applyInterleaved(const float* input, float* output, size_t frames, const Matrix& m) noexcept {
+    size_t i = 0;
+#if defined(NYTH_MID_SIDE_NEON)
+    const float direct[4] = {m.m00, m.m11, m.m00, m.m11};
+    const float crossed[4] = {m.m01, m.m10, m.m01, m.m10};
+    const float32x4_t d = vld1q_f32(direct);
+    const float32x4_t c = vld1q_f32(crossed);
+    for (; i + 2 <= frames; i += 2) {
+        const float32x4_t x = vld1q_f32(input + i * 2);
+        vst1q_f32(output + i * 2, vmlaq_f32(vmulq_f32(d, x), c, vrev64q_f32(x)));
+    }
+#elif defined(NYTH_MID_SIDE_SSE2)
+    const __m128 d = _mm_setr_ps(m.m00, m.m11, m.m00, m.m11);
+    const __m128 c = _mm_setr_ps(m.m01, m.m10, m.m01, m.m10);
+    for (; i + 2 <= frames; i += 2) {
+        const __m128 x = _mm_loadu_ps(input + i * 2);
+        const __m128 swapped = _mm_shuffle_ps(x, x, _MM_SHUFFLE(2, 3, 0, 1));
+        _mm_storeu_ps(output + i * 2, _mm_add_ps(_mm_mul_ps(d, x), _mm_mul_ps(c, swapped)));
+    }
+#endif
+    for (; i < frames; ++i) {
+        const float a = input[i * 2];
+        const float b = input[i * 2 + 1];
+        output[i * 2] = m.m00 * a + m.m01 * b;
+        output[i * 2 + 1] = m.m10 * a + m.m11 * b;
+    }
+}
+
+/**
+ * @brief Interleaved -> planar, the matrix applied on the way
+ */
+inline void deinterleave(const float* input, float* y0, float* y1, size_t frames, const Matrix& m) noexcept {
+    size_t i = 0;
+#if defined(NYTH_MID_SIDE_NEON)
+    const float32x4_t m00 = vdupq_n_f32(m.m00), m01 = vdupq_n_f32(m.m01);
+    const float32x4_t m10 = vdupq_n_f32(m.m10), m11 = vdupq_n_f32(m.m11);
+    for (; i + 4 <= frames; i += 4) {
+        const float32x4x2_t x = vld2q_f32(input + i * 2);
+        vst1q_f32(y0 + i, vmlaq_f32(vmulq_f32(m00, x.val[0]), m01, x.val[1]));
+        vst1q_f32(y1 + i, vmlaq_f32(vmulq_f32(m10, x.val[0]), m11, x.val[1]));
+    }
+#elif defined(NYTH_MID_SIDE_SSE2)
+    const __m128 m00 = _mm_set1_ps(m.m00), m01 = _mm_set1_ps(m.m01);
+    const __m128 m10 = _mm_set1_ps(m.m10), m11 = _mm_set1_ps(m.m11);
+    for (; i + 4 <= frames; i += 4) {
+        const __m128 lo = _mm_loadu_ps(input + i * 2);
+        const __m128 hi = _mm_loadu_ps(input + i * 2 + 4);
+        const __m128 a = _mm_shuffle_ps(lo, hi, _MM_SHUFFLE(2, 0, 2, 0));
+        const __m128 b = _mm_shuffle_ps(lo, hi, _MM_SHUFFLE(3, 1, 3, 1));
+        _mm_storeu_ps(y0 + i, _mm_add_ps(_mm_mul_ps(m00, a), _mm_mul_ps(m01, b)));
+        _mm_storeu_ps(y1 + i, _mm_add_ps(_mm_mul_ps(m10, a), _mm_mul_ps(m11, b)));
+    }
+#endif
+    for (; i < frames; ++i) {
+        const float a = input[i * 2];
+        const float b = input[i * 2 + 1];
+        y0[i] = m.m00 * a + m.m01 * b;
+        y1[i] = m.m10 * a + m.m11 * b;
+    }
+}
+
+/**
+ * @brief Planar -> interleaved, the matrix applied on the way
+ */
+inline void interleave(const float* x0, const float* x1, float* output, size_t frames, const Matrix& m) noexcept {
+    size_t i = 0;
+#if defined(NYTH_MID_SIDE_NEON)
+    const float32x4_t m00 = vdupq_n_f32(m.m00), m01 = vdupq_n_f32(m.m01);
+    const float32x4_t m10 = vdupq_n_f32(m.m10), m11 = vdupq_n_f32(m.m11);
+    for (; i + 4 <= frames; i += 4) {
+        const float32x4_t a = vld1q_f32(x0 + i);
+        const float32x4_t b = vld1q_f32(x1 + i);
+        float32x4x2_t y;
+        y.val[0] = vmlaq_f32(vmulq_f32(m00, a), m01, b);
+        y.val[1] = vmlaq_f32(vmulq_f32(m10, a), m11, b);
+        vst2q_f32(output + i * 2, y);
+    }
+#elif defined(NYTH_MID_SIDE_SSE2)
+    const __m128 m00 = _mm_set1_ps(m.m00), m01 = _mm_set1_ps(m.m01);
+    const __m128 m10 = _mm_set1_ps(m.m10), m11 = _mm_set1_ps(m.m11);
+    for (; i + 4 <= frames; i += 4) {
+        const __m128 a = _mm_loadu_ps(x0 + i);
+        const __m128 b = _mm_loadu_ps(x1 + i);
+        const __m128 y0 = _mm_add_ps(_mm_mul_ps(m00, a), _mm_mul_ps(m01, b));
+        const __m128 y1 = _mm_add_ps(_mm_mul_ps(m10, a), _mm_mul_ps(m11, b));
+        _mm_storeu_ps(output + i * 2, _mm_unpacklo_ps(y0, y1));
+        _mm_storeu_ps(output + i * 2 + 4, _mm_unpackhi_ps(y0, y1));
+    }
+#endif
+    for (; i < frames; ++i) {
+        const float a = x0[i];
+        const float b = x1[i];
+        output[i * 2] = m.m00 * a + m.m01 * b;
+        output[i * 2 + 1] = m.m10 * a + m.m11 * b;
+    }
+}
+
+} // namespace MidSide
+} // namespace FX
+} // namespace Audio
+} // namespace Nyth
+
+#endif // NYTH_AUDIO_FX_MID_SIDE_HPP
@@ -0,0 +1,151 @@
+#pragma once
+#ifndef NYTH_AUDIO_FX_PARTITIONED_CONVOLVER_HPP
+#define NYTH_AUDIO_FX_PARTITIONED_CONVOLVER_HPP
+
+// C++17 standard headers
+#include "FFTEngine.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace Nyth {
+namespace Audio {
+namespace FX {
+
+/**
+ * @brief Uniformly partitioned overlap-save convolver (one channel)
+ *
+ * The impulse response segment is cut into partitions of blockSize samples,
+ * each transformed once with a 2 * blockSize IFFTEngine. Every process() call
+ * transforms one input block, stores its spectrum in a frequency-domain delay
+ * line and multiply-accumulates it against all partitions: one forward and one
+ * inverse FFT per block regardless of the IR length.
+ *
+ * Only the blockSize + 1 non-redundant bins are stored and accumulated; the
+ * conjugate-symmetric half is rebuilt before the inverse transform.
+ * prepare() allocates everything, process() does not allocate.
+ */
+class PartitionedConvolver {
+public:
+    PartitionedConvolver() = default;
+
+    /**
+     * @brief Designs the convolver (non real-time)
+     * @param blockSize partition and hop size, power of two (FFT size is twice that)
+     * @param ir impulse response segment, irLength samples
+     */
+    void prepare(size_t blockSize, const float* ir, size_t irLength) {
+        blockSize_ = blockSize;
+        fftSize_ = 2 * blockSize;
+        numBins_ = blockSize + 1;
+        numPartitions_ = std::max<size_t>(1, (irLength + blockSize - 1) / blockSize);
+        fft_ = createFFTEngine(fftSize_);
+
+        irRe_.assign(numPartitions_ * numBins_, 0.0f);
+        irIm_.assign(numPartitions_ * numBins_, 0.0f);
+        fdlRe_.assign(numPartitions_ * numBins_, 0.0f);
+        fdlIm_.assign(numPartitions_ * numBins_, 0.0f);
+        accRe_.assign(numBins_, 0.0f);
+        accIm_.assign(numBins_, 0.0f);
+        specRe_.assign(fftSize_, 0.0f);
+        specIm_.assign(fftSize_, 0.0f);
+        input_.assign(fftSize_, 0.0f);
+        time_.assign(fftSize_, 0.0f);
+
+        // Spectres des partitions : chaque segment complété par des zéros jusqu'à 2 * blockSize
+        for (size_t p = 0; p < numPartitions_; ++p) {
+            std::fill(time_.begin(), time_.end(), 0.0f);
+            const size_t start = p * blockSize;
+            if (ir && start < irLength) {
+                std::copy_n(ir + start, std::min(blockSize, irLength - start), time_.begin());
+            }
+            fft_->forwardR2C(time_.data(), specRe_, specIm_);
+            std::copy_n(specRe_.begin(), numBins_, irRe_.begin() + p * numBins_);
+            std::copy_n(specIm_.begin(), numBins_, irIm_.begin() + p * numBins_);
+        }
+        fdlPos_ = 0;
+    }
+
+    void reset() noexcept {
+        std::fill(fdlRe_.begin(), fdlRe_.end(), 0.0f);
+        std::fill(fdlIm_.begin(), fdlIm_.end(), 0.0f);
+        std::fill(input_.begin(), input_.end(), 0.0f);
+        fdlPos_ = 0;
+    }
+
+    [[nodiscard]] bool isPrepared() const noexcept {
+        return fft_ != nullptr;
+    }
+    [[nodiscard]] size_t getBlockSize() const noexcept {
+        return blockSize_;
+    }
+    [[nodiscard]] size_t getNumPartitions() const noexcept {
+        return numPartitions_;
+    }
+
+    /**
+     * @brief Convolves exactly getBlockSize() samples (output may alias input)
+     */
+    void process(const float* input, float* output) noexcept {
+        // Fenêtre glissante [bloc précédent | bloc courant]
+        std::copy_n(input_.begin() + blockSize_, blockSize_, input_.begin());
+        std::copy_n(input, blockSize_, input_.begin() + blockSize_);
+        fft_->forwardR2C(input_.data(), specRe_, specIm_);
+        std::copy_n(specRe_.begin(), numBins_, fdlRe_.begin() + fdlPos_ * numBins_);
+        std::copy_n(specIm_.begin(), numBins_, fdlIm_.begin() + fdlPos_ * numBins_);
+
+        // Y = somme_p X(n - p) . H(p), boucles plates vectorisables
+        std::fill(accRe_.begin(), accRe_.end(), 0.0f);
+        std::fill(accIm_.begin(), accIm_.end(), 0.0f);
+        float* accRe = accRe_.data();
+        float* accIm = accIm_.data();
+        size_t slot = fdlPos_;
+        for (size_t p = 0; p < numPartitions_; ++p) {
+            const float* xr = fdlRe_.data() + slot * numBins_;
+            const float* xi = fdlIm_.data() + slot * numBins_;
+            const float* hr = irRe_.data() + p * numBins_;
+            const float* hi = irIm_.data() + p * numBins_;
+            for (size_t k = 0; k < numBins_; ++k) {
+                accRe[k] += xr[k] * hr[k] - xi[k] * hi[k];
+                accIm[k] += xr[k] * hi[k] + xi[k] * hr[k];
+            }
+            slot = slot == 0 ? numPartitions_ - 1 : slot - 1;
+        }
+        fdlPos_ = fdlPos_ + 1 == numPartitions_ ? 0 : fdlPos_ + 1;
+
+        // Spectre complet (symétrie hermitienne) puis retour temporel
+        std::copy_n(accRe_.begin(), numBins_, specRe_.begin());
+        std::copy_n(accIm_.begin(), numBins_, specIm_.begin());
+        for (size_t k = numBins_; k < fftSize_; ++k) {
+            specRe_[k] = accRe[fftSize_ - k];
+            specIm_[k] = -accIm[fftSize_ - k];
+        }
+        fft_->inverseC2R(specRe_, specIm_, time_.data());
+
+        // Overlap-save : seule la seconde moitié est exempte de repliement circulaire
+        std::copy_n(time_.begin() + blockSize_, blockSize_, output);
+    }
+
+private:
+    std::unique_ptr<IFFTEngine> fft_;
+    size_t blockSize_ = 0;
+    size_t fftSize_ = 0;
+    size_t numBins_ = 0;
+    size_t numPartitions_ = 0;
+    size_t fdlPos_ = 0;
+
+    // Spectres des partitions et ligne de retard fréquentielle : [partition][bin]
+    std::vector<float> irRe_, irIm_;
+    std::vector<float> fdlRe_, fdlIm_;
+    std::vector<float> accRe_, accIm_;
+    std::vector<float> specRe_, specIm_;
+    std::vector<float> input_;
+    std::vector<float> time_;
+};
+
+} // namespace FX
+} // namespace Audio
+} // namespace Nyth
+
+#endif // NYTH_AUDIO_FX_PARTITIONED_CONVOLVER_HPP
@@ -0,0 +1,226 @@
+#pragma once
+#ifndef NYTH_AUDIO_FX_PHASE_VOCODER_HPP
+#define NYTH_AUDIO_FX_PHASE_VOCODER_HPP
+
+// C++17 standard headers
+#include "FFTEngine.hpp"
+#include "WindowFunctions.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace Nyth {
+namespace Audio {
+namespace FX {
+
+// C++17 constexpr constants for the phase vocoder
+namespace PhaseVocoderConstants {
+constexpr float TWO_PI = 6.28318530717958647692f;
+constexpr float PEAK_FLOOR = 1e-12f; // puissance minimale d'un pic (silence numérique)
+} // namespace PhaseVocoderConstants
+
+/**
+ * @brief Phase vocoder frame kernel with identity phase locking (Laroche-Dolson)
+ *
+ * Each call analyses one frame taken analysisHop samples after the previous
+ * one and returns a grain to overlap-add getSynthesisHop() samples after the
+ * previous grain: the ratio of the two hops is the time-stretch factor.
+ *
+ * Only spectral peaks get a propagated phase. A peak's instantaneous
+ * frequency comes from the phase difference X(t) . conj(X(t - 1)), and its
+ * new phase advances from the previous synthesis phase by that frequency
+ * times the synthesis hop. Every bin in the peak's region of influence (up to
+ * the lowest bin between two peaks) is then rotated by the same unit complex
+ * as the peak. This keeps the phase relations inside each partial and removes
+ * most of the "phasiness" of the classic vocoder. The rotation is a complex
+ * multiply, so atan2/sin/cos run only once per peak instead of once per bin.
+ *
+ * prepare() allocates everything, process() does not allocate.
+ */
+class PhaseVocoder {
+public:
+    PhaseVocoder() = default;
+
+    /**
+     * @brief Allocates the kernel (non real-time)
+     * @param fftSize frame length, power of two supported by IFFTEngine
+     * @param synthesisHop output hop; fftSize / 4 gives a COLA Hann^2 overlap
+     */
+    void prepare(size_t fftSize, size_t synthesisHop) {
+        fftSize_ = fftSize;
+        numBins_ = fftSize / 2 + 1;
+        synthesisHop_ = std::max<size_t>(1, synthesisHop);
+        fft_ = createFFTEngine(fftSize_);
+
+        window_.assign(fftSize_, 0.0f);
+        fillHannWindow(window_.data(), fftSize_);
+        outputScale_ = 1.0f / overlapAddGain(window_.data(), window_.data(), fftSize_, synthesisHop_);
+
+        time_.assign(fftSize_, 0.0f);
+        specRe_.assign(fftSize_, 0.0f);
+        specIm_.assign(fftSize_, 0.0f);
+        power_.assign(numBins_, 0.0f);
+        prevRe_.assign(numBins_, 0.0f);
+        prevIm_.assign(numBins_, 0.0f);
+        synthRe_.assign(numBins_, 0.0f);
+        synthIm_.assign(numBins_, 0.0f);
+        peaks_.assign(numBins_, 0);
+        reset();
+    }
+
+    // Oublie l'historique de phase : la trame suivante est resynthétisée telle quelle
+    void reset() noexcept {
+        std::fill(prevRe_.begin(), prevRe_.end(), 0.0f);
+        std::fill(prevIm_.begin(), prevIm_.end(), 0.0f);
+        std::fill(synthRe_.begin(), synthRe_.end(), 0.0f);
+        std::fill(synthIm_.begin(), synthIm_.end(), 0.0f);
+        firstFrame_ = true;
+    }
+
+    [[nodiscard]] bool isPrepared() const noexcept {
+        return fft_ != nullptr;
+    }
+    [[nodiscard]] size_t getFftSize() const noexcept {
+        return fftSize_;
+    }
+    [[nodiscard]] size_t getSynthesisHop() const noexcept {
+        return synthesisHop_;
+    }
+
+    /**
+     * @brief Analyses one frame and writes the windowed grain to overlap-add
+     * @param frame getFftSize() unwindowed input samples
+     * @param analysisHop input distance from the previous frame, in samples
+     * @param grain getFftSize() output samples, already scaled for overlap-add
+     */
+    void process(const float* frame, float analysisHop, float* grain) noexcept {
+        for (size_t n = 0; n < fftSize_; ++n) {
+            time_[n] = frame[n] * window_[n];
+        }
+        fft_->forwardR2C(time_.data(), specRe_, specIm_);
+
+        float* re = specRe_.data();
+        float* im = specIm_.data();
+        for (size_t k = 0; k < numBins_; ++k) {
+            power_[k] = re[k] * re[k] + im[k] * im[k];
+        }
+
+        // Historique : spectre d'analyse courant (sauvé par lockPhases avant rotation) et spectre resynthétisé
+        const size_t numPeaks = findPeaks();
+        if (!firstFrame_ && numPeaks > 0) {
+            lockPhases(numPeaks, std::max(analysisHop, 1.0f));
+        } else {
+            std::copy_n(re, numBins_, prevRe_.begin());
+            std::copy_n(im, numBins_, prevIm_.begin());
+        }
+        firstFrame_ = false;
+        std::copy_n(re, numBins_, synthRe_.begin());
+        std::copy_n(im, numBins_, synthIm_.begin());
+
+        // Spectre complet (symétrie hermitienne) puis retour temporel
+        for (size_t k = numBins_; k < fftSize_; ++k) {
+            re[k] = re[fftSize_ - k];
+            im[k] = -im[fftSize_ - k];
+        }
+        fft_->inverseC2R(specRe_, specIm_, time_.data());
+        for (size_t n = 0; n < fftSize_; ++n) {
+            grain[n] = time_[n] * window_[n] * outputScale_;
+        }
+    }
+
+private:
+    // Maxima locaux sur +/- 2 bins, en ordre croissant
+    size_t findPeaks() noexcept {
+        size_t count = 0;
+        const float* p = power_.data();
+        for (size_t k = 0; k < numBins_; ++k) {
+            const float v = p[k];
+            if (v <= PhaseVocoderConstants::PEAK_FLOOR)
+                continue;
+            if (k >= 1 && p[k - 1] >= v)
+                continue;
+            if (k >= 2 && p[k - 2] >= v)
+                continue;
+            if (k + 1 < numBins_ && p[k + 1] > v)
+                continue;
+            if (k + 2 < numBins_ && p[k + 2] > v)
+                continue;
+            peaks_[count++] = k;
+        }
+        return count;
+    }
+
+    void lockPhases(size_t numPeaks, float analysisHop) noexcept {
+        float* re = specRe_.data();
+        float* im = specIm_.data();
+        const float binToOmega = PhaseVocoderConstants::TWO_PI / static_cast<float>(fftSize_);
+        const float synthesisHop = static_cast<float>(synthesisHop_);
+
+        size_t lo = 0;
+        for (size_t i = 0; i < numPeaks; ++i) {
+            const size_t peak = peaks_[i];
+
+            // Fin de la région : bin le plus faible avant le pic suivant
+            size_t hi = numBins_ - 1;
+            if (i + 1 < numPeaks) {
+                hi = peak;
+                for (size_t k = peak + 1; k < peaks_[i + 1]; ++k) {
+                    if (power_[k] < power_[hi])
+                        hi = k;
+                }
+            }
+
+            // Fréquence instantanée du pic : écart de phase mesuré vs attendu pour le bin
+            const float xr = re[peak];
+            const float xi = im[peak];
+            const float dr = xr * prevRe_[peak] + xi * prevIm_[peak];
+            const float di = xi * prevRe_[peak] - xr * prevIm_[peak];
+            const float omega = binToOmega * static_cast<float>(peak);
+            float deviation = std::atan2(di, dr) - omega * analysisHop;
+            deviation -= PhaseVocoderConstants::TWO_PI * std::round(deviation / PhaseVocoderConstants::TWO_PI);
+            const float instantFreq = omega + deviation / analysisHop;
+
+            // Nouvelle phase du pic puis rotation unitaire Z = e^{i theta} . conj(X) / |X|
+            const float theta = std::atan2(synthIm_[peak], synthRe_[peak]) + instantFreq * synthesisHop;
+            const float invMag = 1.0f / std::sqrt(power_[peak]);
+            const float c = std::cos(theta) * invMag;
+            const float s = std::sin(theta) * invMag;
+            const float zr = c * xr + s * xi;
+            const float zi = s * xr - c * xi;
+
+            // Les régions sont disjointes et croissantes : l'historique des pics suivants reste intact
+            for (size_t k = lo; k <= hi; ++k) {
+                const float r = re[k];
+                const float m = im[k];
+                prevRe_[k] = r;
+                prevIm_[k] = m;
+                re[k] = r * zr - m * zi;
+                im[k] = r * zi + m * zr;
+            }
+            lo = hi + 1;
+        }
+    }
+
+    std::unique_ptr<IFFTEngine> fft_;
+    size_t fftSize_ = 0;
+    size_t numBins_ = 0;
+    size_t synthesisHop_ = 1;
+    float outputScale_ = 1.0f;
+    bool firstFrame_ = true;
+
+    std::vector<float> window_;
+    std::vector<float> time_;
+    std::vector<float> specRe_, specIm_;
+    std::vector<float> power_;
+    std::vector<float> prevRe_, prevIm_;   // spectre d'analyse de la trame précédente
+    std::vector<float> synthRe_, synthIm_; // spectre resynthétisé de la trame précédente
+    std::vector<size_t> peaks_;
+};
+
+} // namespace FX
+} // namespace Audio
+} // namespace Nyth
+
+#endif // NYTH_AUDIO_FX_PHASE_VOCODER_HPP
@@ -0,0 +1,94 @@
+#pragma once
+#ifndef NYTH_AUDIO_FX_SLIDING_WINDOW_MAX_HPP
+#define NYTH_AUDIO_FX_SLIDING_WINDOW_MAX_HPP
+
+// C++17 standard headers
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Nyth {
+namespace Audio {
+namespace FX {
+
+/**
+ * @brief Running maximum over the last N samples in O(1) amortized time
+ *
+ * Monotonic deque (Lemire's streaming max-filter): candidates
+ * are kept in decreasing order, a new sample evicts every smaller one from the
+ * back and the front expires once it leaves the window. Each sample is pushed
+ * and popped at most once, whatever the window length. The deque lives in a
+ * ring allocated by prepare(), so process() never allocates.
+ */
+class SlidingWindowMax {
+public:
+    SlidingWindowMax() = default;
+
+    /**
+     * @brief Allocates for windows up to maxWindow samples (non real-time)
+     */
+    void prepare(size_t maxWindow) {
+        capacity_ = std::max<size_t>(1, maxWindow) + 1;
+        values_.assign(capacity_, 0.0f);
+        times_.assign(capacity_, 0);
+        window_ = capacity_ - 1;
+        reset();
+    }
+
+    // Change la longueur de la fenêtre (bornée par prepare) et vide l'historique
+    void setWindow(size_t window) noexcept {
+        window_ = std::max<size_t>(1, std::min(window, capacity_ > 0 ? capacity_ - 1 : 1));
+        reset();
+    }
+    [[nodiscard]] size_t getWindow() const noexcept {
+        return window_;
+    }
+
+    void reset() noexcept {
+        head_ = 0;
+        count_ = 0;
+        time_ = 0;
+    }
+
+    /**
+     * @brief Pushes x and returns the maximum of the last getWindow() samples
+     */
+    float process(float x) noexcept {
+        // Les candidats plus petits que x ne pourront plus jamais être le maximum
+        while (count_ > 0 && values_[slot(count_ - 1)] <= x) {
+            --count_;
+        }
+        values_[slot(count_)] = x;
+        times_[slot(count_)] = time_;
+        ++count_;
+
+        // Le plus ancien candidat sort de la fenêtre
+        while (times_[head_] + window_ <= time_) {
+            head_ = head_ + 1 == capacity_ ? 0 : head_ + 1;
+            --count_;
+        }
+        ++time_;
+        return values_[head_];
+    }
+
+private:
+    [[nodiscard]] size_t slot(size_t offset) const noexcept {
+        const size_t s = head_ + offset;
+        return s >= capacity_ ? s - capacity_ : s;
+    }
+
+    std::vector<float> values_;
+    std::vector<uint64_t> times_;
+    size_t capacity_ = 0;
+    size_t window_ = 1;
+    size_t head_ = 0;
+    size_t count_ = 0;
+    uint64_t time_ = 0;
+};
+
+} // namespace FX
+} // namespace Audio
+} // namespace Nyth
+
+#endif // NYTH_AUDIO_FX_SLIDING_WINDOW_MAX_HPP
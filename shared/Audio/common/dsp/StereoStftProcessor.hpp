@@ -0,0 +1,201 @@
+#pragma once
+#ifndef NYTH_AUDIO_FX_STEREO_STFT_PROCESSOR_HPP
+#define NYTH_AUDIO_FX_STEREO_STFT_PROCESSOR_HPP
+
+// C++17 standard headers
+#include "FFTEngine.hpp"
+#include "WindowFunctions.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+namespace Nyth {
+namespace Audio {
+namespace FX {
+
+/**
+ * @brief Two-channel StftProcessor with batched transforms
+ *
+ * Same framing, windows, rings and latency as StftProcessor, for a left /
+ * right pair sharing one clock. Both channels' frames go through a single
+ * complex FFT (forwardR2CPair) and a single complex IFFT (inverseC2RPair),
+ * so a stereo frame costs about one mono frame plus the split / merge pass.
+ *
+ * The callback sees both half spectra of the same frame at once, which is
+ * what linked processing (shared noise estimate or gain mask) needs:
+ *
+ *     stft.process(inL, inR, outL, outR, n,
+ *                  [&](float* reL, float* imL, float* reR, float* imR, size_t numBins) { ... });
+ *
+ * prepare() allocates everything, process() does not allocate.
+ */
+class StereoStftProcessor {
+public:
+    StereoStftProcessor() = default;
+
+    /**
+     * @brief Allocates the rings, windows and FFT (non real-time)
+     * @param fftSize power of two supported by IFFTEngine
+     * @param hopSize 1..fftSize / 2
+     * @throws std::invalid_argument on an unsupported size or hop
+     */
+    void prepare(size_t fftSize, size_t hopSize) {
+        // Recouvrement d'au moins 50 % : sum w² >= 0.5 partout, la fenêtre duale reste exacte
+        if (hopSize == 0 || hopSize > fftSize / 2) {
+            throw std::invalid_argument("STFT hop size must be between 1 and half the FFT size");
+        }
+        fft_ = createFFTEngine(fftSize); // valide la taille
+        fftSize_ = fftSize;
+        hopSize_ = hopSize;
+        numBins_ = fftSize / 2 + 1;
+        mask_ = fftSize - 1;
+
+        analysisWindow_.assign(fftSize_, 0.0f);
+        synthesisWindow_.assign(fftSize_, 0.0f);
+        fillHannWindow(analysisWindow_.data(), fftSize_);
+        fillSynthesisWindow(analysisWindow_.data(), synthesisWindow_.data(), fftSize_, hopSize_);
+
+        for (size_t c = 0; c < CHANNELS; ++c) {
+            inputRing_[c].assign(fftSize_, 0.0f);
+            outputRing_[c].assign(fftSize_, 0.0f);
+            frame_[c].assign(fftSize_, 0.0f);
+            re_[c].assign(numBins_, 0.0f);
+            im_[c].assign(numBins_, 0.0f);
+        }
+        scratchRe_.assign(fftSize_, 0.0f);
+        scratchIm_.assign(fftSize_, 0.0f);
+        reset();
+    }
+
+    // Vide les anneaux : la sortie reprend par fftSize zéros
+    void reset() noexcept {
+        for (size_t c = 0; c < CHANNELS; ++c) {
+            std::fill(inputRing_[c].begin(), inputRing_[c].end(), 0.0f);
+            std::fill(outputRing_[c].begin(), outputRing_[c].end(), 0.0f);
+        }
+        position_ = 0;
+        hopFill_ = 0;
+    }
+
+    [[nodiscard]] bool isPrepared() const noexcept {
+        return fft_ != nullptr;
+    }
+    [[nodiscard]] size_t getFftSize() const noexcept {
+        return fftSize_;
+    }
+    [[nodiscard]] size_t getHopSize() const noexcept {
+        return hopSize_;
+    }
+    [[nodiscard]] size_t getNumBins() const noexcept {
+        return numBins_;
+    }
+    [[nodiscard]] size_t getLatency() const noexcept {
+        return fftSize_;
+    }
+    [[nodiscard]] const float* getAnalysisWindow() const noexcept {
+        return analysisWindow_.data();
+    }
+
+    /**
+     * @brief Streams numSamples samples per channel (in place allowed)
+     * @param onFrame void(float* reL, float* imL, float* reR, float* imR,
+     *        size_t numBins), called once per hop; it may modify both half
+     *        spectra in place
+     */
+    template <typename FrameCallback>
+    void process(const float* inL, const float* inR, float* outL, float* outR, size_t numSamples,
+                 FrameCallback&& onFrame) {
+        if (!fft_ || !inL || !inR || !outL || !outR) {
+            return;
+        }
+        const float* inputs[CHANNELS] = {inL, inR};
+        float* outputs[CHANNELS] = {outL, outR};
+        size_t done = 0;
+        while (done < numSamples) {
+            const size_t chunk = std::min(hopSize_ - hopFill_, numSamples - done);
+            size_t remaining = chunk;
+            size_t offset = done;
+            while (remaining > 0) {
+                const size_t n = std::min(remaining, fftSize_ - position_);
+                for (size_t c = 0; c < CHANNELS; ++c) {
+                    std::copy_n(inputs[c] + offset, n, inputRing_[c].data() + position_);
+                    std::copy_n(outputRing_[c].data() + position_, n, outputs[c] + offset);
+                    std::fill_n(outputRing_[c].data() + position_, n, 0.0f);
+                }
+                position_ = (position_ + n) & mask_;
+                offset += n;
+                remaining -= n;
+            }
+            done += chunk;
+            hopFill_ += chunk;
+            if (hopFill_ == hopSize_) {
+                hopFill_ = 0;
+                processFrame(onFrame);
+            }
+        }
+    }
+
+private:
+    static constexpr size_t CHANNELS = 2;
+
+    // position_ désigne l'échantillon le plus ancien de la trame
+    template <typename FrameCallback>
+    void processFrame(FrameCallback& onFrame) {
+        const size_t head = fftSize_ - position_;
+        const float* window = analysisWindow_.data();
+        for (size_t c = 0; c < CHANNELS; ++c) {
+            const float* ring = inputRing_[c].data();
+            float* frame = frame_[c].data();
+            for (size_t k = 0; k < head; ++k) {
+                frame[k] = ring[position_ + k] * window[k];
+            }
+            for (size_t k = head; k < fftSize_; ++k) {
+                frame[k] = ring[k - head] * window[k];
+            }
+        }
+
+        forwardR2CPair(*fft_, frame_[0].data(), frame_[1].data(), scratchRe_, scratchIm_, re_[0].data(),
+                       im_[0].data(), re_[1].data(), im_[1].data());
+        onFrame(re_[0].data(), im_[0].data(), re_[1].data(), im_[1].data(), numBins_);
+        inverseC2RPair(*fft_, re_[0].data(), im_[0].data(), re_[1].data(), im_[1].data(), scratchRe_, scratchIm_,
+                       frame_[0].data(), frame_[1].data());
+
+        const float* synthesis = synthesisWindow_.data();
+        for (size_t c = 0; c < CHANNELS; ++c) {
+            float* ring = outputRing_[c].data();
+            const float* frame = frame_[c].data();
+            for (size_t k = 0; k < head; ++k) {
+                ring[position_ + k] += frame[k] * synthesis[k];
+            }
+            for (size_t k = head; k < fftSize_; ++k) {
+                ring[k - head] += frame[k] * synthesis[k];
+            }
+        }
+    }
+
+    std::unique_ptr<IFFTEngine> fft_;
+    size_t fftSize_ = 0;
+    size_t hopSize_ = 0;
+    size_t numBins_ = 0;
+    size_t mask_ = 0;
+
+    std::vector<float> analysisWindow_;
+    std::vector<float> synthesisWindow_;
+    std::vector<float> inputRing_[CHANNELS];  // fftSize derniers échantillons d'entrée
+    std::vector<float> outputRing_[CHANNELS]; // somme overlap-add, lue fftSize échantillons plus tard
+    std::vector<float> frame_[CHANNELS];      // trame fenêtrée, puis sortie de l'IFFT
+    std::vector<float> re_[CHANNELS];         // demi-spectres remis au callback
+    std::vector<float> im_[CHANNELS];
+    std::vector<float> scratchRe_; // spectre complexe commun (N points)
+    std::vector<float> scratchIm_;
+    size_t position_ = 0; // case d'écriture commune aux anneaux
+    size_t hopFill_ = 0;  // échantillons reçus depuis la dernière trame
+};
+
+} // namespace FX
+} // namespace Audio
+} // namespace Nyth
+
+#endif // NYTH_AUDIO_FX_STEREO_STFT_PROCESSOR_HPP
@@ -0,0 +1,191 @@
+#pragma once
+#ifndef NYTH_AUDIO_FX_STFT_PROCESSOR_HPP
+#define NYTH_AUDIO_FX_STFT_PROCESSOR_HPP
+
+// C++17 standard headers
+#include "FFTEngine.hpp"
+#include "WindowFunctions.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace Nyth {
+namespace Audio {
+namespace FX {
+
+/**
+ * @brief Streaming STFT analysis / overlap-add synthesis on ring buffers
+ *
+ * Input samples go into a ring of fftSize samples and leave from an
+ * overlap-add ring of the same size, both indexed modulo fftSize (a power of
+ * two, so a mask): no buffer is shifted. Every hopSize input samples, the last
+ * fftSize samples are windowed (periodic Hann), transformed, handed to the
+ * frame callback as a half spectrum, mirrored back to the Hermitian full
+ * spectrum, inverse transformed and accumulated with the synthesis window
+ * (fillSynthesisWindow: exact reconstruction for any hop up to fftSize / 2).
+ *
+ * Host blocks of any size are accepted: they are cut at hop boundaries only.
+ * An output sample is read from the overlap-add ring at the slot its input
+ * sample is written to, once every frame covering it has been added, so the
+ * latency is a constant fftSize samples whatever the block sizes.
+ *
+ * The callback is a template parameter (no std::function, no allocation):
+ *
+ *     stft.process(in, out, n, [&](float* re, float* im, size_t numBins) {
+ *         for (size_t k = 0; k < numBins; ++k) { re[k] *= gain[k]; im[k] *= gain[k]; }
+ *     });
+ *
+ * prepare() allocates everything, process() does not allocate.
+ */
+class StftProcessor {
+public:
+    StftProcessor() = default;
+
+    /**
+     * @brief Allocates the rings, windows and FFT (non real-time)
+     * @param fftSize power of two supported by IFFTEngine
+     * @param hopSize 1..fftSize / 2; fftSize / 4 for the usual 75 % overlap
+     * @throws std::invalid_argument on an unsupported size or hop
+     */
+    void prepare(size_t fftSize, size_t hopSize) {
+        // Recouvrement d'au moins 50 % : sum w² >= 0.5 partout, la fenêtre duale reste exacte
+        if (hopSize == 0 || hopSize > fftSize / 2) {
+            throw std::invalid_argument("STFT hop size must be between 1 and half the FFT size");
+        }
+        fft_ = createFFTEngine(fftSize); // valide la taille
+        fftSize_ = fftSize;
+        hopSize_ = hopSize;
+        numBins_ = fftSize / 2 + 1;
+        mask_ = fftSize - 1;
+
+        analysisWindow_.assign(fftSize_, 0.0f);
+        synthesisWindow_.assign(fftSize_, 0.0f);
+        fillHannWindow(analysisWindow_.data(), fftSize_);
+        fillSynthesisWindow(analysisWindow_.data(), synthesisWindow_.data(), fftSize_, hopSize_);
+
+        inputRing_.assign(fftSize_, 0.0f);
+        outputRing_.assign(fftSize_, 0.0f);
+        frame_.assign(fftSize_, 0.0f);
+        re_.assign(fftSize_, 0.0f);
+        im_.assign(fftSize_, 0.0f);
+        reset();
+    }
+
+    // Vide les anneaux : la sortie reprend par fftSize zéros
+    void reset() noexcept {
+        std::fill(inputRing_.begin(), inputRing_.end(), 0.0f);
+        std::fill(outputRing_.begin(), outputRing_.end(), 0.0f);
+        position_ = 0;
+        hopFill_ = 0;
+    }
+
+    [[nodiscard]] bool isPrepared() const noexcept {
+        return fft_ != nullptr;
+    }
+    [[nodiscard]] size_t getFftSize() const noexcept {
+        return fftSize_;
+    }
+    [[nodiscard]] size_t getHopSize() const noexcept {
+        return hopSize_;
+    }
+    [[nodiscard]] size_t getNumBins() const noexcept {
+        return numBins_;
+    }
+    [[nodiscard]] size_t getLatency() const noexcept {
+        return fftSize_;
+    }
+    [[nodiscard]] const float* getAnalysisWindow() const noexcept {
+        return analysisWindow_.data();
+    }
+
+    /**
+     * @brief Streams numSamples samples (in place allowed)
+     * @param onFrame void(float* re, float* im, size_t numBins), called once
+     *        per hop; it may modify the half spectrum in place
+     */
+    template <typename FrameCallback>
+    void process(const float* input, float* output, size_t numSamples, FrameCallback&& onFrame) {
+        if (!fft_ || !input || !output) {
+            return;
+        }
+        size_t done = 0;
+        while (done < numSamples) {
+            const size_t chunk = std::min(hopSize_ - hopFill_, numSamples - done);
+            // Écriture de l'entrée puis lecture de la sortie sur les mêmes cases (au plus deux segments)
+            size_t remaining = chunk;
+            size_t offset = done;
+            while (remaining > 0) {
+                const size_t n = std::min(remaining, fftSize_ - position_);
+                std::copy_n(input + offset, n, inputRing_.data() + position_);
+                std::copy_n(outputRing_.data() + position_, n, output + offset);
+                std::fill_n(outputRing_.data() + position_, n, 0.0f);
+                position_ = (position_ + n) & mask_;
+                offset += n;
+                remaining -= n;
+            }
+            done += chunk;
+            hopFill_ += chunk;
+            if (hopFill_ == hopSize_) {
+                hopFill_ = 0;
+                processFrame(onFrame);
+            }
+        }
+    }
+
+private:
+    // position_ désigne l'échantillon le plus ancien de la trame
+    template <typename FrameCallback>
+    void processFrame(FrameCallback& onFrame) {
+        const size_t head = fftSize_ - position_;
+        const float* window = analysisWindow_.data();
+        for (size_t k = 0; k < head; ++k) {
+            frame_[k] = inputRing_[position_ + k] * window[k];
+        }
+        for (size_t k = head; k < fftSize_; ++k) {
+            frame_[k] = inputRing_[k - head] * window[k];
+        }
+
+        fft_->forwardR2C(frame_.data(), re_, im_);
+        onFrame(re_.data(), im_.data(), numBins_);
+
+        // Spectre hermitien pour un signal réel
+        for (size_t k = numBins_; k < fftSize_; ++k) {
+            re_[k] = re_[fftSize_ - k];
+            im_[k] = -im_[fftSize_ - k];
+        }
+        fft_->inverseC2R(re_, im_, frame_.data());
+
+        const float* synthesis = synthesisWindow_.data();
+        for (size_t k = 0; k < head; ++k) {
+            outputRing_[position_ + k] += frame_[k] * synthesis[k];
+        }
+        for (size_t k = head; k < fftSize_; ++k) {
+            outputRing_[k - head] += frame_[k] * synthesis[k];
+        }
+    }
+
+    std::unique_ptr<IFFTEngine> fft_;
+    size_t fftSize_ = 0;
+    size_t hopSize_ = 0;
+    size_t numBins_ = 0;
+    size_t mask_ = 0;
+
+    std::vector<float> analysisWindow_;
+    std::vector<float> synthesisWindow_;
+    std::vector<float> inputRing_;  // fftSize derniers échantillons d'entrée
+    std::vector<float> outputRing_; // somme overlap-add, lue fftSize échantillons plus tard
+    std::vector<float> frame_;      // trame fenêtrée, puis sortie de l'IFFT
+    std::vector<float> re_;
+    std::vector<float> im_;
+    size_t position_ = 0; // case d'écriture commune aux deux anneaux
+    size_t hopFill_ = 0;  // échantillons reçus depuis la dernière trame
+};
+
+} // namespace FX
+} // namespace Audio
+} // namespace Nyth
+
+#endif // NYTH_AUDIO_FX_STFT_PROCESSOR_HPP
@@ -0,0 +1,382 @@
+#pragma once
+#ifndef NYTH_AUDIO_FX_TIME_STRETCHER_HPP
+#define NYTH_AUDIO_FX_TIME_STRETCHER_HPP
+
+// C++17 standard headers
+#include "../utils/WavReader.hpp"
+#include "PhaseVocoder.hpp"
+#include "Wsola.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Nyth {
+namespace Audio {
+namespace FX {
+
+// C++17 constexpr constants for time stretching
+namespace TimeStretchConstants {
+constexpr double MIN_STRETCH = 0.25; // sortie 4x plus courte
+constexpr double MAX_STRETCH = 4.0;  // sortie 4x plus longue
+constexpr double VOCODER_FRAME_SECONDS = 0.04; // arrondi à la puissance de deux supérieure
+constexpr size_t VOCODER_OVERLAP = 4;          // Hann^2 à 75 % de recouvrement
+constexpr size_t MIN_VOCODER_FFT_SIZE = 256;
+constexpr size_t MAX_VOCODER_FFT_SIZE = 8192;
+constexpr double WSOLA_GRAIN_SECONDS = 0.02;
+constexpr double WSOLA_TOLERANCE_SECONDS = 0.005;
+constexpr size_t OUTPUT_BACKLOG_FRAMES = 4; // grains d'avance que la file de sortie peut contenir
+constexpr size_t OFFLINE_CHUNK = 4096;
+} // namespace TimeStretchConstants
+
+enum class StretchAlgorithm {
+    PHASE_VOCODER = 0, // polyphonique, musique
+    WSOLA = 1          // domaine temporel, faible latence (voix)
+};
+
+/**
+ * @brief Streaming time-stretcher shared by the pitch shifter and the offline API
+ *
+ * Input is written into a ring; each time a full analysis segment is
+ * available the selected kernel (PhaseVocoder or Wsola) turns it into a grain
+ * that is overlap-added into the output ring at the fixed synthesis hop. The
+ * analysis position advances by synthesisHop / stretch, so the output holds
+ * stretch times as many samples as the input. Fractional analysis hops are
+ * accumulated and rounded per frame; the phase vocoder is told the actual
+ * integer hop.
+ *
+ * write() and read() accept any block size; write() stops early when the
+ * output ring is full, so callers alternate the two or size the ring for
+ * their backlog with reserveOutput(). prepare() and reserveOutput()
+ * allocate, everything else is real-time safe.
+ */
+class TimeStretcher {
+public:
+    TimeStretcher() = default;
+
+    /**
+     * @brief Allocates with frame sizes derived from the sample rate (non real-time)
+     */
+    void prepare(StretchAlgorithm algorithm, uint32_t sampleRate) {
+        using namespace TimeStretchConstants;
+        const double rate = static_cast<double>(std::max<uint32_t>(1, sampleRate));
+        if (algorithm == StretchAlgorithm::PHASE_VOCODER) {
+            size_t fftSize = MIN_VOCODER_FFT_SIZE;
+            while (fftSize < MAX_VOCODER_FFT_SIZE && static_cast<double>(fftSize) < rate * VOCODER_FRAME_SECONDS) {
+                fftSize *= 2;
+            }
+            prepare(algorithm, fftSize, 0);
+        } else {
+            prepare(algorithm, static_cast<size_t>(std::lround(rate * WSOLA_GRAIN_SECONDS)),
+                    static_cast<size_t>(std::lround(rate * WSOLA_TOLERANCE_SECONDS)));
+        }
+    }
+
+    /**
+     * @brief Allocates with explicit sizes (non real-time)
+     * @param frameSize FFT size (phase vocoder) or grain size (WSOLA)
+     * @param tolerance WSOLA search range on each side, ignored by the phase vocoder
+     */
+    void prepare(StretchAlgorithm algorithm, size_t frameSize, size_t tolerance) {
+        using namespace TimeStretchConstants;
+        algorithm_ = algorithm;
+        if (algorithm_ == StretchAlgorithm::PHASE_VOCODER) {
+            vocoder_.prepare(frameSize, frameSize / VOCODER_OVERLAP);
+            frameSize_ = vocoder_.getFftSize();
+            synthesisHop_ = vocoder_.getSynthesisHop();
+            tolerance_ = 0;
+        } else {
+            wsola_.prepare(frameSize, tolerance);
+            frameSize_ = wsola_.getGrainSize();
+            synthesisHop_ = wsola_.getSynthesisHop();
+            tolerance_ = wsola_.getTolerance();
+        }
+        segmentSize_ = frameSize_ + 2 * tolerance_;
+
+        inputMask_ = nextPowerOfTwo(segmentSize_ + 1) - 1;
+        input_.assign(inputMask_ + 1, 0.0f);
+        outputMask_ = nextPowerOfTwo(OUTPUT_BACKLOG_FRAMES * frameSize_) - 1;
+        output_.assign(outputMask_ + 1, 0.0f);
+        segment_.assign(segmentSize_, 0.0f);
+        grain_.assign(frameSize_, 0.0f);
+        setStretch(stretch_);
+        reset();
+    }
+
+    /**
+     * @brief Grows the output ring so that capacity finished samples plus one grain fit (non real-time)
+     *
+     * Callers that keep a known backlog unread size the ring with it, so that
+     * write() always consumes its whole block.
+     */
+    void reserveOutput(size_t capacity) {
+        const size_t size = nextPowerOfTwo(capacity + frameSize_);
+        if (size > output_.size()) {
+            outputMask_ = size - 1;
+            output_.assign(size, 0.0f);
+            reset();
+        }
+    }
+
+    // Ratio durée de sortie / durée d'entrée, borné à [MIN_STRETCH, MAX_STRETCH]
+    static double clampStretch(double stretch) noexcept {
+        return std::max(TimeStretchConstants::MIN_STRETCH, std::min(TimeStretchConstants::MAX_STRETCH, stretch));
+    }
+    void setStretch(double stretch) noexcept {
+        stretch_ = clampStretch(stretch);
+        const double analysisHop = static_cast<double>(synthesisHop_) / stretch_;
+        const double written = static_cast<double>(inputWritten_) - static_cast<double>(segmentSize_);
+        if (analysisHop != analysisHop_ && outputWrite_ > 0 && analysisPos_ > written) {
+            // Le reste du pas d'analyse en cours passe au nouveau pas au prorata : la sortie suit
+            // le nouveau débit sans à-coup et la réserve du lecteur ne dérive pas d'un changement à l'autre
+            analysisPos_ = written + (analysisPos_ - written) * (analysisHop / analysisHop_);
+        }
+        analysisHop_ = analysisHop;
+    }
+    [[nodiscard]] double getStretch() const noexcept {
+        return stretch_;
+    }
+
+    void reset() noexcept {
+        std::fill(input_.begin(), input_.end(), 0.0f);
+        std::fill(output_.begin(), output_.end(), 0.0f);
+        // Les tolerance_ premiers échantillons (nuls) précèdent l'entrée réelle : le premier
+        // grain nominal démarre sur l'échantillon 0 avec une marge de recherche de chaque côté
+        inputWritten_ = tolerance_;
+        analysisPos_ = 0.0;
+        lastFrameStart_ = 0;
+        outputRead_ = 0;
+        outputWrite_ = 0;
+        vocoder_.reset();
+        wsola_.reset();
+    }
+
+    [[nodiscard]] bool isPrepared() const noexcept {
+        return !grain_.empty();
+    }
+    [[nodiscard]] StretchAlgorithm getAlgorithm() const noexcept {
+        return algorithm_;
+    }
+    [[nodiscard]] size_t getFrameSize() const noexcept {
+        return frameSize_;
+    }
+    [[nodiscard]] size_t getSynthesisHop() const noexcept {
+        return synthesisHop_;
+    }
+    [[nodiscard]] size_t getTolerance() const noexcept {
+        return tolerance_;
+    }
+    // Échantillons d'entrée nécessaires avant le premier grain
+    [[nodiscard]] size_t getInputLatency() const noexcept {
+        return frameSize_ + tolerance_;
+    }
+    // Entrée écrite depuis reset() au rapport stretch quand getAvailable() atteint count
+    [[nodiscard]] size_t getInputForOutput(size_t count, double stretch) const noexcept {
+        const double analysisHop = static_cast<double>(synthesisHop_) / clampStretch(stretch);
+        const size_t frames = std::max<size_t>(1, (count + synthesisHop_ - 1) / synthesisHop_);
+        double position = 0.0; // même accumulation que synthesizeFrame()
+        for (size_t k = 1; k < frames; ++k) {
+            position += analysisHop;
+        }
+        return static_cast<size_t>(std::llround(position)) + frameSize_ + tolerance_;
+    }
+    // Entrée à écrire avant la synthèse du prochain grain
+    [[nodiscard]] size_t getInputToNextFrame() const noexcept {
+        const uint64_t needed = static_cast<uint64_t>(std::llround(analysisPos_)) + segmentSize_;
+        return inputWritten_ < needed ? static_cast<size_t>(needed - inputWritten_) : 0;
+    }
+    // Échantillons de sortie terminés (plus aucun grain ne s'y ajoutera)
+    [[nodiscard]] size_t getAvailable() const noexcept {
+        return static_cast<size_t>(outputWrite_ - outputRead_);
+    }
+
+    /**
+     * @brief Feeds input and synthesizes every grain that becomes ready
+     * @return samples consumed; less than numSamples only when the output ring is full
+     */
+    size_t write(const float* input, size_t numSamples) noexcept {
+        size_t consumed = 0;
+        for (;;) {
+            const uint64_t frameStart = static_cast<uint64_t>(std::llround(analysisPos_));
+            const uint64_t needed = frameStart + segmentSize_;
+            if (inputWritten_ >= needed) {
+                if (!synthesizeFrame(frameStart))
+                    break;
+                continue;
+            }
+            if (consumed == numSamples)
+                break;
+            const size_t take = std::min(numSamples - consumed, static_cast<size_t>(needed - inputWritten_));
+            for (size_t i = 0; i < take; ++i) {
+                input_[(inputWritten_ + i) & inputMask_] = input[consumed + i];
+            }
+            inputWritten_ += take;
+            consumed += take;
+        }
+        return consumed;
+    }
+
+    /**
+     * @brief Pops up to numSamples finished output samples
+     * @return samples written to output
+     */
+    size_t read(float* output, size_t numSamples) noexcept {
+        const size_t count = std::min(numSamples, getAvailable());
+        for (size_t i = 0; i < count; ++i) {
+            float& slot = output_[(outputRead_ + i) & outputMask_];
+            output[i] = slot;
+            slot = 0.0f; // prêt pour les prochains recouvrements
+        }
+        outputRead_ += count;
+        return count;
+    }
+
+private:
+    static size_t nextPowerOfTwo(size_t n) noexcept {
+        size_t p = 1;
+        while (p < n)
+            p <<= 1;
+        return p;
+    }
+
+    bool synthesizeFrame(uint64_t frameStart) noexcept {
+        if (outputWrite_ + frameSize_ - outputRead_ > outputMask_ + 1) {
+            return false;
+        }
+        for (size_t i = 0; i < segmentSize_; ++i) {
+            segment_[i] = input_[(frameStart + i) & inputMask_];
+        }
+        if (algorithm_ == StretchAlgorithm::PHASE_VOCODER) {
+            vocoder_.process(segment_.data(), static_cast<float>(frameStart - lastFrameStart_), grain_.data());
+        } else {
+            wsola_.process(segment_.data(), grain_.data());
+        }
+        for (size_t i = 0; i < frameSize_; ++i) {
+            output_[(outputWrite_ + i) & outputMask_] += grain_[i];
+        }
+        outputWrite_ += synthesisHop_;
+        lastFrameStart_ = frameStart;
+        analysisPos_ += analysisHop_;
+        return true;
+    }
+
+    StretchAlgorithm algorithm_ = StretchAlgorithm::PHASE_VOCODER;
+    PhaseVocoder vocoder_;
+    Wsola wsola_;
+
+    size_t frameSize_ = 0;
+    size_t synthesisHop_ = 0;
+    size_t tolerance_ = 0;
+    size_t segmentSize_ = 0;
+    double stretch_ = 1.0;
+    double analysisHop_ = 0.0;
+
+    // Positions absolues (échantillons depuis reset) ; les anneaux sont indexés modulo leur taille
+    std::vector<float> input_;
+    size_t inputMask_ = 0;
+    uint64_t inputWritten_ = 0;
+    double analysisPos_ = 0.0;
+    uint64_t lastFrameStart_ = 0;
+
+    std::vector<float> output_;
+    size_t outputMask_ = 0;
+    uint64_t outputRead_ = 0;
+    uint64_t outputWrite_ = 0;
+
+    std::vector<float> segment_;
+    std::vector<float> grain_;
+};
+
+/**
+ * @brief Offline time-stretch of one channel (non real-time, allocates)
+ *
+ * Runs the streaming TimeStretcher over the whole buffer, then trims the
+ * framing delay so that output sample round(t * stretch) matches input sample t.
+ * @return round(numSamples * stretch) samples
+ */
+inline std::vector<float> timeStretch(const float* input, size_t numSamples, double stretch, uint32_t sampleRate,
+                                      StretchAlgorithm algorithm = StretchAlgorithm::PHASE_VOCODER) {
+    TimeStretcher stretcher;
+    stretcher.prepare(algorithm, sampleRate);
+    stretcher.setStretch(stretch);
+    stretch = stretcher.getStretch();
+
+    // Centre du premier grain = frameSize / 2 en entrée comme en sortie : on précède l'entrée de
+    // frameSize / 2 zéros et on retire autant d'échantillons en sortie
+    const size_t half = stretcher.getFrameSize() / 2;
+    const size_t outLength = static_cast<size_t>(std::llround(static_cast<double>(numSamples) * stretch));
+    std::vector<float> result;
+    result.reserve(outLength);
+
+    std::vector<float> chunk(TimeStretchConstants::OFFLINE_CHUNK, 0.0f);
+    size_t toSkip = half;
+    auto drain = [&]() {
+        size_t got;
+        while ((got = stretcher.read(chunk.data(), chunk.size())) > 0) {
+            const size_t skip = std::min(toSkip, got);
+            toSkip -= skip;
+            const size_t keep = std::min(got - skip, outLength - result.size());
+            result.insert(result.end(), chunk.begin() + static_cast<std::ptrdiff_t>(skip),
+                          chunk.begin() + static_cast<std::ptrdiff_t>(skip + keep));
+        }
+    };
+    auto feed = [&](const float* data, size_t count) {
+        while (count > 0) {
+            const size_t used = stretcher.write(data, count);
+            data += used;
+            count -= used;
+            drain();
+        }
+    };
+
+    const std::vector<float> silence(TimeStretchConstants::OFFLINE_CHUNK, 0.0f);
+    for (size_t pad = half; pad > 0;) {
+        const size_t n = std::min(pad, silence.size());
+        feed(silence.data(), n);
+        pad -= n;
+    }
+    if (input && numSamples > 0) {
+        feed(input, numSamples);
+    }
+    // Vidange : des zéros jusqu'à obtenir toute la sortie attendue
+    while (result.size() < outLength) {
+        feed(silence.data(), silence.size());
+    }
+    return result;
+}
+
+/**
+ * @brief Offline time-stretch of every channel of a decoded file (non real-time)
+ */
+inline void timeStretch(const WavData& input, double stretch, WavData& output,
+                        StretchAlgorithm algorithm = StretchAlgorithm::PHASE_VOCODER) {
+    output.sampleRate = input.sampleRate;
+    output.channels.clear();
+    output.channels.reserve(input.channels.size());
+    for (const auto& channel : input.channels) {
+        output.channels.push_back(timeStretch(channel.data(), channel.size(), stretch, input.sampleRate, algorithm));
+    }
+}
+
+/**
+ * @brief Reads a WAV file and time-stretches it (non real-time)
+ * @param error optional human readable reason on failure
+ * @return false if the file cannot be decoded
+ */
+inline bool timeStretchFile(const std::string& path, double stretch, WavData& output,
+                            StretchAlgorithm algorithm = StretchAlgorithm::PHASE_VOCODER, std::string* error = nullptr) {
+    WavData decoded;
+    if (!WavReader::readFile(path, decoded, error)) {
+        return false;
+    }
+    timeStretch(decoded, stretch, output, algorithm);
+    return true;
+}
+
+} // namespace FX
+} // namespace Audio
+} // namespace Nyth
+
+#endif // NYTH_AUDIO_FX_TIME_STRETCHER_HPP
@@ -0,0 +1,328 @@
+#pragma once
+#ifndef NYTH_AUDIO_FX_VECTOR_MATH_HPP
+#define NYTH_AUDIO_FX_VECTOR_MATH_HPP
+
+// C++17 standard headers
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+// Platform detection and SIMD headers
+#if defined(__ARM_NEON) || defined(__aarch64__)
+#include <arm_neon.h>
+#define NYTH_VECTOR_MATH_NEON
+#elif defined(__SSE2__) || defined(_M_X64) || defined(__x86_64__)
+#include <emmintrin.h>
+#define NYTH_VECTOR_MATH_SSE2
+#endif
+
+namespace Nyth {
+namespace Audio {
+namespace FX {
+namespace VectorMath {
+
+/**
+ * @brief Block-wise log2/exp2 and dB conversions for dynamics processors
+ *
+ * Polynomial approximations evaluated 4 lanes at a time (NEON/SSE2) with an
+ * identical scalar fallback, so every platform produces the same curve.
+ * log2 error < 3e-5 (≈ 2e-4 dB), exp2 relative error < 1e-5.
+ */
+
+// C++17 constexpr constants
+constexpr float DB_PER_LOG2 = 6.02059991f;      // 20 * log10(2)
+constexpr float LOG2_PER_DB = 0.166096404f;     // 1 / DB_PER_LOG2
+constexpr float MIN_LINEAR = 1e-12f;            // ≈ -240 dB floor
+constexpr float MAX_EXP2_ARG = 126.0f;
+constexpr float MIN_POWER = 1e-24f;             // MIN_LINEAR², plancher de rsqrt()
+
+// log2(1 + t) ≈ t * (L1 + t * (L2 + t * (L3 + t * (L4 + t * L5)))), t in [0, 1)
+constexpr float LOG2_C1 = 1.4418255f;
+constexpr float LOG2_C2 = -0.708678912f;
+constexpr float LOG2_C3 = 0.415411186f;
+constexpr float LOG2_C4 = -0.194408323f;
+constexpr float LOG2_C5 = 0.0458789501f;
+
+// 2^f ≈ E0 + f * (E1 + f * (E2 + f * (E3 + f * E4))), f in [0, 1)
+constexpr float EXP2_C0 = 1.00000727f;
+constexpr float EXP2_C1 = 0.692931415f;
+constexpr float EXP2_C2 = 0.241709986f;
+constexpr float EXP2_C3 = 0.0516670284f;
+constexpr float EXP2_C4 = 0.0136765608f;
+
+inline float log2Scalar(float x) noexcept {
+    x = std::max(x, MIN_LINEAR);
+    uint32_t bits;
+    std::memcpy(&bits, &x, sizeof(bits));
+    const float exponent = static_cast<float>(static_cast<int32_t>(bits >> 23) - 127);
+    bits = (bits & 0x007FFFFFu) | 0x3F800000u;
+    float m;
+    std::memcpy(&m, &bits, sizeof(m));
+    const float t = m - 1.0f;
+    return exponent + t * (LOG2_C1 + t * (LOG2_C2 + t * (LOG2_C3 + t * (LOG2_C4 + t * LOG2_C5))));
+}
+
+inline float exp2Scalar(float x) noexcept {
+    x = std::min(std::max(x, -MAX_EXP2_ARG), MAX_EXP2_ARG);
+    int32_t i = static_cast<int32_t>(x);
+    i -= (static_cast<float>(i) > x) ? 1 : 0; // floor
+    const float f = x - static_cast<float>(i);
+    const float p = EXP2_C0 + f * (EXP2_C1 + f * (EXP2_C2 + f * (EXP2_C3 + f * EXP2_C4)));
+    const uint32_t bits = static_cast<uint32_t>(i + 127) << 23;
+    float scale;
+    std::memcpy(&scale, &bits, sizeof(scale));
+    return p * scale;
+}
+
+/**
+ * @brief output[i] = log2(max(input[i], MIN_LINEAR))
+ */
+inline void log2(const float* input, float* output, size_t count) noexcept {
+    size_t i = 0;
+#if defined(NYTH_VECTOR_MATH_NEON)
+    const float32x4_t floorVec = vdupq_n_f32(MIN_LINEAR);
+    const float32x4_t one = vdupq_n_f32(1.0f);
+    for (; i + 4 <= count; i += 4) {
+        float32x4_t x = vmaxq_f32(vld1q_f32(input + i), floorVec);
+        uint32x4_t bits = vreinterpretq_u32_f32(x);
+        int32x4_t e = vsubq_s32(vreinterpretq_s32_u32(vshrq_n_u32(bits, 23)), vdupq_n_s32(127));
+        uint32x4_t mBits = vorrq_u32(vandq_u32(bits, vdupq_n_u32(0x007FFFFFu)), vdupq_n_u32(0x3F800000u));
+        float32x4_t t = vsubq_f32(vreinterpretq_f32_u32(mBits), one);
+        float32x4_t p = vmlaq_f32(vdupq_n_f32(LOG2_C4), t, vdupq_n_f32(LOG2_C5));
+        p = vmlaq_f32(vdupq_n_f32(LOG2_C3), t, p);
+        p = vmlaq_f32(vdupq_n_f32(LOG2_C2), t, p);
+        p = vmlaq_f32(vdupq_n_f32(LOG2_C1), t, p);
+        vst1q_f32(output + i, vmlaq_f32(vcvtq_f32_s32(e), t, p));
+    }
+#elif defined(NYTH_VECTOR_MATH_SSE2)
+    const __m128 floorVec = _mm_set1_ps(MIN_LINEAR);
+    const __m128 one = _mm_set1_ps(1.0f);
+    for (; i + 4 <= count; i += 4) {
+        __m128 x = _mm_max_ps(_mm_loadu_ps(input + i), floorVec);
+        __m128i bits = _mm_castps_si128(x);
+        __m128i e = _mm_sub_epi32(_mm_srli_epi32(bits, 23), _mm_set1_epi32(127));
+        __m128i mBits = _mm_or_si128(_mm_and_si128(bits, _mm_set1_epi32(0x007FFFFF)), _mm_set1_epi32(0x3F800000));
+        __m128 t = _mm_sub_ps(_mm_castsi128_ps(mBits), one);
+        __m128 p = _mm_add_ps(_mm_set1_ps(LOG2_C4), _mm_mul_ps(t, _mm_set1_ps(LOG2_C5)));
+        p = _mm_add_ps(_mm_set1_ps(LOG2_C3), _mm_mul_ps(t, p));
+        p = _mm_add_ps(_mm_set1_ps(LOG2_C2), _mm_mul_ps(t, p));
+        p = _mm_add_ps(_mm_set1_ps(LOG2_C1), _mm_mul_ps(t, p));
+        _mm_storeu_ps(output + i, _mm_add_ps(_mm_cvtepi32_ps(e), _mm_mul_ps(t, p)));
+    }
+#endif
+    for (; i < count; ++i) {
+        output[i] = log2Scalar(input[i]);
+    }
+}
+
+/**
+ * @brief output[i] = 2^input[i] (argument clamped to ±126)
+ */
+inline void exp2(const float* input, float* output, size_t count) noexcept {
+    size_t i = 0;
+#if defined(NYTH_VECTOR_MATH_NEON)
+    const float32x4_t lo = vdupq_n_f32(-MAX_EXP2_ARG);
+    const float32x4_t hi = vdupq_n_f32(MAX_EXP2_ARG);
+    for (; i + 4 <= count; i += 4) {
+        float32x4_t x = vminq_f32(vmaxq_f32(vld1q_f32(input + i), lo), hi);
+        int32x4_t xi = vcvtq_s32_f32(x);
+        // floor: subtract 1 where truncation rounded up (negative non-integers)
+        uint32x4_t adjust = vcgtq_f32(vcvtq_f32_s32(xi), x);
+        xi = vsubq_s32(xi, vreinterpretq_s32_u32(vandq_u32(adjust, vdupq_n_u32(1))));
+        float32x4_t f = vsubq_f32(x, vcvtq_f32_s32(xi));
+        float32x4_t p = vmlaq_f32(vdupq_n_f32(EXP2_C3), f, vdupq_n_f32(EXP2_C4));
+        p = vmlaq_f32(vdupq_n_f32(EXP2_C2), f, p);
+        p = vmlaq_f32(vdupq_n_f32(EXP2_C1), f, p);
+        p = vmlaq_f32(vdupq_n_f32(EXP2_C0), f, p);
+        int32x4_t scaleBits = vshlq_n_s32(vaddq_s32(xi, vdupq_n_s32(127)), 23);
+        vst1q_f32(output + i, vmulq_f32(p, vreinterpretq_f32_s32(scaleBits)));
+    }
+#elif defined(NYTH_VECTOR_MATH_SSE2)
+    const __m128 lo = _mm_set1_ps(-MAX_EXP2_ARG);
+    const __m128 hi = _mm_set1_ps(MAX_EXP2_ARG);
+    const __m128 one = _mm_set1_ps(1.0f);
+    for (; i + 4 <= count; i += 4) {
+        __m128 x = _mm_min_ps(_mm_max_ps(_mm_loadu_ps(input + i), lo), hi);
+        __m128 xt = _mm_cvtepi32_ps(_mm_cvttps_epi32(x));
+        // floor: subtract 1 where truncation rounded up (negative non-integers)
+        __m128 fl = _mm_sub_ps(xt, _mm_and_ps(_mm_cmpgt_ps(xt, x), one));
+        __m128 f = _mm_sub_ps(x, fl);
+        __m128 p = _mm_add_ps(_mm_set1_ps(EXP2_C3), _mm_mul_ps(f, _mm_set1_ps(EXP2_C4)));
+        p = _mm_add_ps(_mm_set1_ps(EXP2_C2), _mm_mul_ps(f, p));
+        p = _mm_add_ps(_mm_set1_ps(EXP2_C1), _mm_mul_ps(f, p));
+        p = _mm_add_ps(_mm_set1_ps(EXP2_C0), _mm_mul_ps(f, p));
+        __m128i scaleBits = _mm_slli_epi32(_mm_add_epi32(_mm_cvttps_epi32(fl), _mm_set1_epi32(127)), 23);
+        _mm_storeu_ps(output + i, _mm_mul_ps(p, _mm_castsi128_ps(scaleBits)));
+    }
+#endif
+    for (; i < count; ++i) {
+        output[i] = exp2Scalar(input[i]);
+    }
+}
+
+/**
+ * @brief Linear magnitude to dBFS, in place allowed
+ */
+inline void linearToDb(const float* input, float* output, size_t count) noexcept {
+    log2(input, output, count);
+    for (size_t i = 0; i < count; ++i) {
+        output[i] *= DB_PER_LOG2;
+    }
+}
+
+/**
+ * @brief dB to linear gain, in place allowed
+ */
+inline void dbToLinear(const float* input, float* output, size_t count) noexcept {
+    for (size_t i = 0; i < count; ++i) {
+        output[i] = input[i] * LOG2_PER_DB;
+    }
+    exp2(output, output, count);
+}
+
+/**
+ * @brief Spectral helpers: power, (reciprocal) square root, real gain
+ *
+ * A real gain applied to a complex bin scales re and im alike, so spectral
+ * gain rules only need |X|² and, for magnitude-domain rules, 1 / |X|: no
+ * phase is ever computed. rsqrt() refines the hardware estimate with Newton
+ * steps (relative error < 1e-6).
+ */
+
+/**
+ * @brief output[i] = re[i]² + im[i]²
+ */
+inline void power(const float* re, const float* im, float* output, size_t count) noexcept {
+    size_t i = 0;
+#if defined(NYTH_VECTOR_MATH_NEON)
+    for (; i + 4 <= count; i += 4) {
+        const float32x4_t r = vld1q_f32(re + i);
+        const float32x4_t m = vld1q_f32(im + i);
+        vst1q_f32(output + i, vmlaq_f32(vmulq_f32(r, r), m, m));
+    }
+#elif defined(NYTH_VECTOR_MATH_SSE2)
+    for (; i + 4 <= count; i += 4) {
+        const __m128 r = _mm_loadu_ps(re + i);
+        const __m128 m = _mm_loadu_ps(im + i);
+        _mm_storeu_ps(output + i, _mm_add_ps(_mm_mul_ps(r, r), _mm_mul_ps(m, m)));
+    }
+#endif
+    for (; i < count; ++i) {
+        output[i] = re[i] * re[i] + im[i] * im[i];
+    }
+}
+
+/**
+ * @brief output[i] = 1 / sqrt(max(input[i], MIN_POWER)), in place allowed
+ */
+inline void rsqrt(const float* input, float* output, size_t count) noexcept {
+    size_t i = 0;
+#if defined(NYTH_VECTOR_MATH_NEON)
+    const float32x4_t floorVec = vdupq_n_f32(MIN_POWER);
+    for (; i + 4 <= count; i += 4) {
+        const float32x4_t x = vmaxq_f32(vld1q_f32(input + i), floorVec);
+        float32x4_t y = vrsqrteq_f32(x);
+        y = vmulq_f32(y, vrsqrtsq_f32(vmulq_f32(x, y), y));
+        y = vmulq_f32(y, vrsqrtsq_f32(vmulq_f32(x, y), y));
+        vst1q_f32(output + i, y);
+    }
+#elif defined(NYTH_VECTOR_MATH_SSE2)
+    const __m128 floorVec = _mm_set1_ps(MIN_POWER);
+    const __m128 half = _mm_set1_ps(0.5f);
+    const __m128 threeHalves = _mm_set1_ps(1.5f);
+    for (; i + 4 <= count; i += 4) {
+        const __m128 x = _mm_max_ps(_mm_loadu_ps(input + i), floorVec);
+        __m128 y = _mm_rsqrt_ps(x);
+        // y * (1.5 - 0.5 * x * y²)
+        y = _mm_mul_ps(y, _mm_sub_ps(threeHalves, _mm_mul_ps(_mm_mul_ps(half, x), _mm_mul_ps(y, y))));
+        _mm_storeu_ps(output + i, y);
+    }
+#endif
+    for (; i < count; ++i) {
+        output[i] = 1.0f / std::sqrt(std::max(input[i], MIN_POWER));
+    }
+}
+
+/**
+ * @brief output[i] = sqrt(max(input[i], 0)), in place allowed
+ */
+inline void sqrt(const float* input, float* output, size_t count) noexcept {
+    size_t i = 0;
+#if defined(NYTH_VECTOR_MATH_NEON) && defined(__aarch64__)
+    const float32x4_t zero = vdupq_n_f32(0.0f);
+    for (; i + 4 <= count; i += 4) {
+        vst1q_f32(output + i, vsqrtq_f32(vmaxq_f32(vld1q_f32(input + i), zero)));
+    }
+#elif defined(NYTH_VECTOR_MATH_SSE2)
+    const __m128 zero = _mm_setzero_ps();
+    for (; i + 4 <= count; i += 4) {
+        _mm_storeu_ps(output + i, _mm_sqrt_ps(_mm_max_ps(_mm_loadu_ps(input + i), zero)));
+    }
+#endif
+    for (; i < count; ++i) {
+        output[i] = std::sqrt(std::max(input[i], 0.0f));
+    }
+}
+
+/**
+ * @brief (re[i], im[i]) *= gain[i], in place
+ */
+inline void scaleComplex(float* re, float* im, const float* gain, size_t count) noexcept {
+    size_t i = 0;
+#if defined(NYTH_VECTOR_MATH_NEON)
+    for (; i + 4 <= count; i += 4) {
+        const float32x4_t g = vld1q_f32(gain + i);
+        vst1q_f32(re + i, vmulq_f32(vld1q_f32(re + i), g));
+        vst1q_f32(im + i, vmulq_f32(vld1q_f32(im + i), g));
+    }
+#elif defined(NYTH_VECTOR_MATH_SSE2)
+    for (; i + 4 <= count; i += 4) {
+        const __m128 g = _mm_loadu_ps(gain + i);
+        _mm_storeu_ps(re + i, _mm_mul_ps(_mm_loadu_ps(re + i), g));
+        _mm_storeu_ps(im + i, _mm_mul_ps(_mm_loadu_ps(im + i), g));
+    }
+#endif
+    for (; i < count; ++i) {
+        re[i] *= gain[i];
+        im[i] *= gain[i];
+    }
+}
+
+/**
+ * @brief max |input[i]| (0 for an empty block)
+ */
+inline float peak(const float* input, size_t count) noexcept {
+    size_t i = 0;
+    float result = 0.0f;
+#if defined(NYTH_VECTOR_MATH_NEON)
+    float32x4_t acc = vdupq_n_f32(0.0f);
+    for (; i + 4 <= count; i += 4) {
+        acc = vmaxq_f32(acc, vabsq_f32(vld1q_f32(input + i)));
+    }
+    float32x2_t pair = vpmax_f32(vget_low_f32(acc), vget_high_f32(acc));
+    pair = vpmax_f32(pair, pair);
+    result = vget_lane_f32(pair, 0);
+#elif defined(NYTH_VECTOR_MATH_SSE2)
+    const __m128 signMask = _mm_set1_ps(-0.0f);
+    __m128 acc = _mm_setzero_ps();
+    for (; i + 4 <= count; i += 4) {
+        acc = _mm_max_ps(acc, _mm_andnot_ps(signMask, _mm_loadu_ps(input + i)));
+    }
+    acc = _mm_max_ps(acc, _mm_shuffle_ps(acc, acc, _MM_SHUFFLE(1, 0, 3, 2)));
+    acc = _mm_max_ps(acc, _mm_shuffle_ps(acc, acc, _MM_SHUFFLE(2, 3, 0, 1)));
+    result = _mm_cvtss_f32(acc);
+#endif
+    for (; i < count; ++i) {
+        result = std::max(result, std::abs(input[i]));
+    }
+    return result;
+}
+
+} // namespace VectorMath
+} // namespace FX
+} // namespace Audio
+} // namespace Nyth
+
+#endif // NYTH_AUDIO_FX_VECTOR_MATH_HPP
@@ -0,0 +1,286 @@
+#pragma once
+#ifndef NYTH_AUDIO_FX_VOICE_ACTIVITY_DETECTOR_HPP
+#define NYTH_AUDIO_FX_VOICE_ACTIVITY_DETECTOR_HPP
+
+// C++17 standard headers
+#include "VectorMath.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+namespace Nyth {
+namespace Audio {
+namespace FX {
+
+/**
+ * @brief Low-cost voice activity detector fed with features the caller already has
+ *
+ * Three features per frame, each compared with its value on the background
+ * noise (Moattar & Homayounpour, 2009):
+ *  - energy (mean square), against a noise floor that drops to any lower
+ *    frame at once, follows frames that look like the noise and otherwise
+ *    rises by floorRiseDbPerSecond,
+ *  - spectral flatness (geometric / arithmetic mean of |X|²): speech is more
+ *    tonal than the noise under it,
+ *  - zero-crossing rate, away from the one of the noise.
+ * A frame is active when its energy clears the floor by energyMarginDb and
+ * either flatness or zero crossings depart from the noise, or the energy
+ * alone clears the floor by strongMarginDb. holdMs of hangover bridge the
+ * pauses between words. Below silenceThresholdDb (absolute) a frame is
+ * silence: hasSignal() is false and the caller can skip its analysis.
+ *
+ * processSpectrum() reads the half-spectrum |X|² an STFT already produced:
+ * energy by Parseval, flatness with the VectorMath log2 kernel, and the
+ * zero-crossing rate from the lag-1 autocorrelation of the same spectrum
+ * (Kedem: zcr = acos(rho1) / pi), so there is no pass over the samples.
+ * Time-domain callers sum squares and count crossings in a loop they
+ * already run and call update(); a feature they lack (negative value)
+ * abstains from the vote.
+ *
+ * prepare() allocates, processSpectrum() and update() do not.
+ */
+class VoiceActivityDetector {
+public:
+    struct Config {
+        double silenceThresholdDb = -70.0;  ///< Absolute silence (dBFS, mean square)
+        double energyMarginDb = 6.0;        ///< Energy above the noise floor for an active frame
+        double strongMarginDb = 15.0;       ///< Energy alone decides above this margin
+        double flatnessMarginDb = 5.0;      ///< Flatness below the noise flatness (dB)
+        double zeroCrossingMargin = 0.1;    ///< |zcr - noise zcr|, crossings per sample
+        double floorRiseDbPerSecond = 3.0;  ///< Noise floor rise under a foreground signal
+        double noiseTimeConstantMs = 500.0; ///< Smoothing of the noise floor, flatness and zcr
+        double holdMs = 300.0;              ///< Hangover after the last active frame
+    };
+
+    /**
+     * @brief Per-frame features; flatness or zeroCrossingRate < 0 when unknown
+     */
+    struct Features {
+        float energy = 0.0f;            ///< Mean square of the frame
+        float flatness = -1.0f;         ///< 0 (tonal) .. 1 (white)
+        float zeroCrossingRate = -1.0f; ///< Crossings per sample, 0 .. 1
+    };
+
+    VoiceActivityDetector() = default;
+
+    /**
+     * @brief Time-domain use: features passed to update()
+     * @throws std::invalid_argument on a non-positive sample rate
+     */
+    void prepare(double sampleRate, const Config& config) {
+        if (!(sampleRate > 0.0)) {
+            throw std::invalid_argument("VAD sample rate must be positive");
+        }
+        config_ = config;
+        sampleRate_ = sampleRate;
+        holdSamples_ = static_cast<uint64_t>(std::max(config_.holdMs, 0.0) * 0.001 * sampleRate_);
+        numBins_ = 0;
+        hopSize_ = 0;
+        reset();
+    }
+
+    /**
+     * @brief STFT use: half spectra of fftSize / 2 + 1 bins, one every hopSize samples
+     * @param analysisWindow the fftSize-sample window applied before the FFT (energy scale)
+     */
+    void prepare(double sampleRate, size_t fftSize, size_t hopSize, const float* analysisWindow,
+                 const Config& config) {
+        if (fftSize < 4 || hopSize == 0 || !analysisWindow) {
+            throw std::invalid_argument("Invalid STFT layout for the VAD");
+        }
+        prepare(sampleRate, config);
+        numBins_ = fftSize / 2 + 1;
+        hopSize_ = hopSize;
+
+        // Parseval : moyenne quadratique du signal = sum|X|² / (N sum w²)
+        double windowEnergy = 0.0;
+        for (size_t n = 0; n < fftSize; ++n) {
+            windowEnergy += static_cast<double>(analysisWindow[n]) * analysisWindow[n];
+        }
+        energyScale_ = static_cast<float>(1.0 / (static_cast<double>(fftSize) * std::max(windowEnergy, 1e-12)));
+
+        // Poids du demi-spectre (DC et Nyquist une fois, les autres deux fois) et cos(w_k)
+        binWeight_.assign(numBins_, 2.0f);
+        binWeight_.front() = 1.0f;
+        binWeight_.back() = 1.0f;
+        binCosine_.resize(numBins_);
+        const double step = PI / static_cast<double>(numBins_ - 1);
+        for (size_t k = 0; k < numBins_; ++k) {
+            binCosine_[k] = binWeight_[k] * static_cast<float>(std::cos(step * static_cast<double>(k)));
+        }
+        logScratch_.assign(numBins_, 0.0f);
+    }
+
+    void prepare(double sampleRate) {
+        prepare(sampleRate, Config{});
+    }
+    void prepare(double sampleRate, size_t fftSize, size_t hopSize, const float* analysisWindow) {
+        prepare(sampleRate, fftSize, hopSize, analysisWindow, Config{});
+    }
+
+    void reset() noexcept {
+        primed_ = false;
+        active_ = false;
+        signal_ = false;
+        holdRemaining_ = 0;
+        energyDb_ = static_cast<float>(config_.silenceThresholdDb);
+        noiseFloorDb_ = energyDb_;
+        noiseFlatnessDb_ = 0.0f;
+        noiseZeroCrossingRate_ = 0.5f;
+        features_ = Features{};
+    }
+
+    /**
+     * @brief One STFT frame: features from |X|², then update()
+     * @param power numBins values of |X|² (prepare(sampleRate, fftSize, ...))
+     * @return isActive()
+     */
+    bool processSpectrum(const float* power, size_t numBins) noexcept {
+        if (!power || numBins != numBins_ || numBins_ == 0) {
+            return active_;
+        }
+        float total = 0.0f;
+        float lagOne = 0.0f;
+        for (size_t k = 0; k < numBins; ++k) {
+            total += binWeight_[k] * power[k];
+            lagOne += binCosine_[k] * power[k];
+        }
+
+        // Planéité hors DC : exp2(moyenne de log2 |X|²) / moyenne de |X|²
+        const size_t count = numBins - 1;
+        VectorMath::log2(power + 1, logScratch_.data(), count);
+        float logSum = 0.0f;
+        float sum = 0.0f;
+        for (size_t k = 0; k < count; ++k) {
+            logSum += logScratch_[k];
+            sum += power[k + 1];
+        }
+        const float mean = sum / static_cast<float>(count);
+
+        Features features;
+        features.energy = total * energyScale_;
+        features.flatness =
+            (mean > MIN_POWER) ? std::min(std::exp2(logSum / static_cast<float>(count)) / mean, 1.0f) : 1.0f;
+        const float rho = (total > MIN_POWER) ? std::clamp(lagOne / total, -1.0f, 1.0f) : 0.0f;
+        features.zeroCrossingRate = std::acos(rho) * static_cast<float>(1.0 / PI);
+        return update(features, hopSize_);
+    }
+
+    /**
+     * @brief Decision for a frame of numSamples samples
+     * @return isActive()
+     */
+    bool update(const Features& features, size_t numSamples) noexcept {
+        features_ = features;
+        const float seconds = static_cast<float>(static_cast<double>(numSamples) / sampleRate_);
+        energyDb_ = 10.0f * std::log10(std::max(features.energy, MIN_POWER));
+        signal_ = energyDb_ >= static_cast<float>(config_.silenceThresholdDb);
+
+        bool frameActive = false;
+        if (signal_) {
+            const bool hasFlatness = features.flatness >= 0.0f;
+            const bool hasCrossings = features.zeroCrossingRate >= 0.0f;
+            const float flatnessDb = hasFlatness ? 10.0f * std::log10(std::max(features.flatness, MIN_FLATNESS)) : 0.0f;
+            if (!primed_) {
+                // Premier bloc non silencieux pris pour du bruit ; tout bloc plus faible corrige le plancher
+                noiseFloorDb_ = energyDb_;
+                noiseFlatnessDb_ = flatnessDb;
+                noiseZeroCrossingRate_ = hasCrossings ? features.zeroCrossingRate : noiseZeroCrossingRate_;
+                primed_ = true;
+            }
+
+            const float margin = energyDb_ - noiseFloorDb_;
+            const bool tonal = hasFlatness && noiseFlatnessDb_ - flatnessDb > static_cast<float>(config_.flatnessMarginDb);
+            const bool crossings = hasCrossings && std::abs(features.zeroCrossingRate - noiseZeroCrossingRate_) >
+                                                       static_cast<float>(config_.zeroCrossingMargin);
+            frameActive = margin > static_cast<float>(config_.energyMarginDb) &&
+                          (tonal || crossings || margin > static_cast<float>(config_.strongMarginDb));
+
+            // Plancher : rejoint tout minimum, suit une trame semblable au bruit, monte lentement sinon
+            const float keep = static_cast<float>(
+                std::exp(-static_cast<double>(seconds) * 1000.0 / std::max(config_.noiseTimeConstantMs, 1.0)));
+            if (energyDb_ < noiseFloorDb_) {
+                noiseFloorDb_ = energyDb_;
+            } else if (!tonal && !crossings) {
+                noiseFloorDb_ = keep * noiseFloorDb_ + (1.0f - keep) * energyDb_;
+            } else {
+                noiseFloorDb_ += static_cast<float>(config_.floorRiseDbPerSecond) * seconds;
+            }
+            if (!frameActive) {
+                if (hasFlatness) {
+                    noiseFlatnessDb_ = keep * noiseFlatnessDb_ + (1.0f - keep) * flatnessDb;
+                }
+                if (hasCrossings) {
+                    noiseZeroCrossingRate_ = keep * noiseZeroCrossingRate_ + (1.0f - keep) * features.zeroCrossingRate;
+                }
+            }
+        }
+
+        if (frameActive) {
+            holdRemaining_ = holdSamples_;
+            active_ = true;
+        } else if (holdRemaining_ > numSamples) {
+            holdRemaining_ -= numSamples;
+        } else {
+            holdRemaining_ = 0;
+            active_ = false;
+        }
+        return active_;
+    }
+
+    /// Voice (or any foreground signal) in the last frame, hangover included
+    [[nodiscard]] bool isActive() const noexcept {
+        return active_;
+    }
+    /// Last frame above the absolute silence threshold
+    [[nodiscard]] bool hasSignal() const noexcept {
+        return signal_;
+    }
+    [[nodiscard]] const Features& getFeatures() const noexcept {
+        return features_;
+    }
+    [[nodiscard]] float getEnergyDb() const noexcept {
+        return energyDb_;
+    }
+    [[nodiscard]] float getNoiseFloorDb() const noexcept {
+        return noiseFloorDb_;
+    }
+    [[nodiscard]] const Config& getConfig() const noexcept {
+        return config_;
+    }
+
+private:
+    static constexpr double PI = 3.14159265358979324;
+    static constexpr float MIN_POWER = 1e-20f;
+    static constexpr float MIN_FLATNESS = 1e-10f;
+
+    Config config_{};
+    double sampleRate_ = 48000.0;
+    size_t numBins_ = 0;
+    size_t hopSize_ = 0;
+    float energyScale_ = 1.0f;
+    uint64_t holdSamples_ = 0;
+
+    std::vector<float> binWeight_;  // 1 ou 2 : compte des cases du spectre complet
+    std::vector<float> binCosine_;  // binWeight * cos(pi k / (numBins - 1))
+    std::vector<float> logScratch_; // log2 |X|²
+
+    Features features_{};
+    float energyDb_ = 0.0f;
+    float noiseFloorDb_ = 0.0f;
+    float noiseFlatnessDb_ = 0.0f;
+    float noiseZeroCrossingRate_ = 0.5f;
+    uint64_t holdRemaining_ = 0;
+    bool primed_ = false;
+    bool active_ = false;
+    bool signal_ = false;
+};
+
+} // namespace FX
+} // namespace Audio
+} // namespace Nyth
+
+#endif // NYTH_AUDIO_FX_VOICE_ACTIVITY_DETECTOR_HPP
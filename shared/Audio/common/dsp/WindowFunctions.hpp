@@ -0,0 +1,94 @@
+#pragma once
+#ifndef NYTH_AUDIO_FX_WINDOW_FUNCTIONS_HPP
+#define NYTH_AUDIO_FX_WINDOW_FUNCTIONS_HPP
+
+// C++17 standard headers
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+
+namespace Nyth {
+namespace Audio {
+namespace FX {
+
+// C++17 constexpr constants for analysis / synthesis windows
+namespace WindowConstants {
+constexpr double TWO_PI = 6.283185307179586476925286766559;
+constexpr float MIN_OVERLAP_GAIN = 1e-6f;
+} // namespace WindowConstants
+
+/**
+ * @brief Hann window of the given size
+ *
+ * The periodic form (default) is the one to use for STFT framing: at hop
+ * size / 2 it sums to exactly 1 and at size / 4 its square sums to 1.5, so
+ * overlap-add reconstruction only needs a constant gain.
+ */
+inline void fillHannWindow(float* window, size_t size, bool periodic = true) noexcept {
+    if (!window || size == 0) {
+        return;
+    }
+    if (size == 1) {
+        window[0] = 1.0f;
+        return;
+    }
+    const double denom = static_cast<double>(periodic ? size : size - 1);
+    for (size_t n = 0; n < size; ++n) {
+        window[n] = static_cast<float>(0.5 - 0.5 * std::cos(WindowConstants::TWO_PI * static_cast<double>(n) / denom));
+    }
+}
+
+/**
+ * @brief Average overlap-add gain of analysis * synthesis windows at a given hop
+ *
+ * Dividing the synthesis output by this value restores unity gain; for
+ * COLA-compliant window / hop pairs the sum is the same for every sample.
+ * Pass nullptr as synthesis when only the analysis window is applied.
+ */
+inline float overlapAddGain(const float* analysis, const float* synthesis, size_t size, size_t hop) noexcept {
+    if (!analysis || size == 0 || hop == 0) {
+        return 1.0f;
+    }
+    double total = 0.0;
+    for (size_t n = 0; n < hop; ++n) {
+        for (size_t m = n; m < size; m += hop) {
+            total += static_cast<double>(analysis[m]) * (synthesis ? static_cast<double>(synthesis[m]) : 1.0);
+        }
+    }
+    const float gain = static_cast<float>(total / static_cast<double>(hop));
+    return std::max(gain, WindowConstants::MIN_OVERLAP_GAIN);
+}
+
+/**
+ * @brief Synthesis window giving exact overlap-add reconstruction up to hop = size / 2
+ *
+ * synthesis[n] = analysis[n] / sum_k analysis[n + k.hop]^2 (the least-squares
+ * dual window, Griffin-Lim), so analysis x synthesis overlap-adds to exactly
+ * 1 at every sample. For a COLA pair (Hann at size / 4) this reduces to the
+ * analysis window divided by overlapAddGain(); at other hops it also removes
+ * the ripple a constant gain leaves. The denominator must not vanish: with
+ * a periodic Hann window it is >= 0.5 for hop <= size / 2, but above that it
+ * falls to the window tail squared (0 at hop == size) and reconstruction
+ * breaks down, so callers keep at least 50 % overlap.
+ */
+inline void fillSynthesisWindow(const float* analysis, float* synthesis, size_t size, size_t hop) noexcept {
+    if (!analysis || !synthesis || size == 0 || hop == 0) {
+        return;
+    }
+    for (size_t n = 0; n < std::min(hop, size); ++n) {
+        double total = 0.0;
+        for (size_t m = n; m < size; m += hop) {
+            total += static_cast<double>(analysis[m]) * static_cast<double>(analysis[m]);
+        }
+        const double inverse = 1.0 / std::max(total, static_cast<double>(WindowConstants::MIN_OVERLAP_GAIN));
+        for (size_t m = n; m < size; m += hop) {
+            synthesis[m] = static_cast<float>(static_cast<double>(analysis[m]) * inverse);
+        }
+    }
+}
+
+} // namespace FX
+} // namespace Audio
+} // namespace Nyth
+
+#endif // NYTH_AUDIO_FX_WINDOW_FUNCTIONS_HPP
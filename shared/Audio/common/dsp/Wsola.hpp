@@ -0,0 +1,139 @@
+#pragma once
+#ifndef NYTH_AUDIO_FX_WSOLA_HPP
+#define NYTH_AUDIO_FX_WSOLA_HPP
+
+// C++17 standard headers
+#include "WindowFunctions.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+namespace Nyth {
+namespace Audio {
+namespace FX {
+
+// C++17 constexpr constants for WSOLA
+namespace WsolaConstants {
+constexpr float ENERGY_FLOOR = 1e-9f;
+} // namespace WsolaConstants
+
+/**
+ * @brief WSOLA grain kernel (waveform-similarity overlap-add)
+ *
+ * Time-domain alternative to the phase vocoder: each grain is cut from the
+ * input near its nominal position, shifted by up to +/- tolerance samples to
+ * the offset whose waveform best matches the natural continuation of the
+ * previous grain (normalized cross-correlation). Grains are Hann-windowed and
+ * overlap by half, so no FFT is involved and the latency is one short grain,
+ * which suits speech. Transients and polyphonic material smear less with the
+ * phase vocoder; speech sounds more natural here.
+ *
+ * prepare() allocates everything, process() does not allocate.
+ */
+class Wsola {
+public:
+    Wsola() = default;
+
+    /**
+     * @brief Allocates the kernel (non real-time)
+     * @param grainSize grain length in samples (the synthesis hop is half of it)
+     * @param tolerance largest shift searched on each side of the nominal position
+     */
+    void prepare(size_t grainSize, size_t tolerance) {
+        grainSize_ = std::max<size_t>(2, grainSize & ~static_cast<size_t>(1));
+        synthesisHop_ = grainSize_ / 2;
+        overlap_ = grainSize_ - synthesisHop_;
+        tolerance_ = tolerance;
+        window_.assign(grainSize_, 0.0f);
+        fillHannWindow(window_.data(), grainSize_);
+        outputScale_ = 1.0f / overlapAddGain(window_.data(), nullptr, grainSize_, synthesisHop_);
+        template_.assign(overlap_, 0.0f);
+        reset();
+    }
+
+    void reset() noexcept {
+        std::fill(template_.begin(), template_.end(), 0.0f);
+        firstFrame_ = true;
+    }
+
+    [[nodiscard]] bool isPrepared() const noexcept {
+        return !window_.empty();
+    }
+    [[nodiscard]] size_t getGrainSize() const noexcept {
+        return grainSize_;
+    }
+    [[nodiscard]] size_t getSynthesisHop() const noexcept {
+        return synthesisHop_;
+    }
+    [[nodiscard]] size_t getTolerance() const noexcept {
+        return tolerance_;
+    }
+
+    /**
+     * @brief Picks the best-matching grain and writes it windowed
+     * @param segment getGrainSize() + 2 * getTolerance() input samples; the
+     *        nominal grain starts at segment[getTolerance()]
+     * @param grain getGrainSize() output samples, already scaled for overlap-add
+     */
+    void process(const float* segment, float* grain) noexcept {
+        const size_t offset = firstFrame_ ? tolerance_ : findBestOffset(segment);
+        firstFrame_ = false;
+
+        const float* chosen = segment + offset;
+        for (size_t n = 0; n < grainSize_; ++n) {
+            grain[n] = chosen[n] * window_[n] * outputScale_;
+        }
+        // Continuation naturelle du grain retenu : cible du prochain alignement
+        std::copy_n(chosen + synthesisHop_, overlap_, template_.begin());
+    }
+
+private:
+    // Décalage maximisant la corrélation normalisée <candidat, cible> / ||candidat||
+    size_t findBestOffset(const float* segment) const noexcept {
+        const float* target = template_.data();
+        float energy = 0.0f;
+        for (size_t n = 0; n < overlap_; ++n) {
+            energy += segment[n] * segment[n];
+        }
+
+        size_t best = tolerance_;
+        float bestScore = std::numeric_limits<float>::lowest();
+        for (size_t d = 0; d <= 2 * tolerance_; ++d) {
+            const float* candidate = segment + d;
+            float dot = 0.0f;
+            for (size_t n = 0; n < overlap_; ++n) {
+                dot += candidate[n] * target[n];
+            }
+            // Score signé au carré (évite la racine) : corr * |corr| / énergie
+            const float score = dot * std::fabs(dot) / std::max(energy, WsolaConstants::ENERGY_FLOOR);
+            // À égalité (silence) on garde le décalage le plus proche de la position nominale
+            const size_t distance = d > tolerance_ ? d - tolerance_ : tolerance_ - d;
+            const size_t bestDistance = best > tolerance_ ? best - tolerance_ : tolerance_ - best;
+            if (score > bestScore || (score == bestScore && distance < bestDistance)) {
+                bestScore = score;
+                best = d;
+            }
+            // Énergie glissante de la fenêtre candidate
+            energy += candidate[overlap_] * candidate[overlap_] - candidate[0] * candidate[0];
+        }
+        return best;
+    }
+
+    size_t grainSize_ = 0;
+    size_t synthesisHop_ = 0;
+    size_t overlap_ = 0;
+    size_t tolerance_ = 0;
+    float outputScale_ = 1.0f;
+    bool firstFrame_ = true;
+
+    std::vector<float> window_;
+    std::vector<float> template_;
+};
+
+} // namespace FX
+} // namespace Audio
+} // namespace Nyth
+
+#endif // NYTH_AUDIO_FX_WSOLA_HPP
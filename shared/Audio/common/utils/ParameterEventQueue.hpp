@@ -0,0 +1,84 @@
+#pragma once
+#ifndef NYTH_AUDIO_PARAMETER_EVENT_QUEUE_HPP
+#define NYTH_AUDIO_PARAMETER_EVENT_QUEUE_HPP
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace Nyth { namespace Audio { namespace FX {
+
+// Changement de paramètre horodaté (position absolue en échantillons ; 0 = dès le prochain bloc)
+struct ParameterEvent {
+    uint64_t sampleTime = 0;
+    uint32_t paramId = 0;
+    float value = 0.0f;
+};
+
+/**
+ * @brief Wait-free single-producer / single-consumer queue of timestamped parameter events
+ *
+ * Storage is a fixed array: no allocation on either side. The control thread
+ * pushes events in non-decreasing sampleTime order; the audio thread pops the
+ * ones that are due and peeks at the next one to know where to split its block.
+ */
+template <size_t Capacity>
+class ParameterEventQueue {
+    static_assert(Capacity > 0, "ParameterEventQueue needs a non-zero capacity");
+
+public:
+    ParameterEventQueue() = default;
+    ParameterEventQueue(const ParameterEventQueue&) = delete;
+    ParameterEventQueue& operator=(const ParameterEventQueue&) = delete;
+
+    // Producteur : false si la file est pleine (événement perdu)
+    bool tryPush(const ParameterEvent& event) noexcept {
+        const size_t tail = tail_.load(std::memory_order_relaxed);
+        const size_t next = tail + 1 == NUM_SLOTS ? 0 : tail + 1;
+        if (next == head_.load(std::memory_order_acquire)) {
+            return false;
+        }
+        slots_[tail] = event;
+        tail_.store(next, std::memory_order_release);
+        return true;
+    }
+
+    // Consommateur : position du prochain événement sans le retirer
+    bool peekTime(uint64_t& sampleTime) const noexcept {
+        const size_t head = head_.load(std::memory_order_relaxed);
+        if (head == tail_.load(std::memory_order_acquire)) {
+            return false;
+        }
+        sampleTime = slots_[head].sampleTime;
+        return true;
+    }
+
+    // Consommateur : retire l'événement en tête s'il est dû (sampleTime <= now)
+    bool popDue(uint64_t now, ParameterEvent& event) noexcept {
+        const size_t head = head_.load(std::memory_order_relaxed);
+        if (head == tail_.load(std::memory_order_acquire) || slots_[head].sampleTime > now) {
+            return false;
+        }
+        event = slots_[head];
+        head_.store(head + 1 == NUM_SLOTS ? 0 : head + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consommateur uniquement
+    void clear() noexcept {
+        head_.store(tail_.load(std::memory_order_acquire), std::memory_order_release);
+    }
+
+private:
+    // Un slot reste vide pour distinguer plein et vide
+    static constexpr size_t NUM_SLOTS = Capacity + 1;
+
+    std::array<ParameterEvent, NUM_SLOTS> slots_{};
+    alignas(64) std::atomic<size_t> head_{0};
+    alignas(64) std::atomic<size_t> tail_{0};
+};
+
+}}} // namespace Nyth { namespace Audio { namespace FX
+
+#endif // NYTH_AUDIO_PARAMETER_EVENT_QUEUE_HPP
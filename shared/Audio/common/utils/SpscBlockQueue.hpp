@@ -0,0 +1,97 @@
+#pragma once
+#ifndef NYTH_AUDIO_SPSC_BLOCK_QUEUE_HPP
+#define NYTH_AUDIO_SPSC_BLOCK_QUEUE_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Nyth { namespace Audio { namespace FX {
+
+/**
+ * @brief Wait-free single-producer / single-consumer queue of fixed-size float blocks
+ *
+ * All slots are allocated in prepare(); push/pop only copy floats and publish
+ * indices with acquire/release ordering, so either side may be the audio
+ * thread. Each block carries a sequence tag that lets the consumer detect
+ * blocks that were dropped or arrived late.
+ */
+class SpscBlockQueue {
+public:
+    SpscBlockQueue() = default;
+    SpscBlockQueue(const SpscBlockQueue&) = delete;
+    SpscBlockQueue& operator=(const SpscBlockQueue&) = delete;
+
+    /**
+     * @brief Allocates capacity blocks of blockSize floats (non real-time, no concurrent access)
+     */
+    void prepare(size_t capacity, size_t blockSize) {
+        // Un slot reste vide pour distinguer plein et vide
+        numSlots_ = capacity + 1;
+        blockSize_ = blockSize;
+        data_.assign(numSlots_ * blockSize_, 0.0f);
+        tags_.assign(numSlots_, 0);
+        head_.store(0, std::memory_order_relaxed);
+        tail_.store(0, std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] size_t getBlockSize() const noexcept {
+        return blockSize_;
+    }
+
+    // Producteur : copie blockSize floats ; false si la file est pleine
+    bool tryPush(const float* block, uint64_t tag) noexcept {
+        const size_t tail = tail_.load(std::memory_order_relaxed);
+        const size_t next = tail + 1 == numSlots_ ? 0 : tail + 1;
+        if (numSlots_ == 0 || next == head_.load(std::memory_order_acquire)) {
+            return false;
+        }
+        std::copy_n(block, blockSize_, data_.data() + tail * blockSize_);
+        tags_[tail] = tag;
+        tail_.store(next, std::memory_order_release);
+        return true;
+    }
+
+    // Consommateur : tag du bloc en tête sans le retirer
+    bool peekTag(uint64_t& tag) const noexcept {
+        const size_t head = head_.load(std::memory_order_relaxed);
+        if (head == tail_.load(std::memory_order_acquire)) {
+            return false;
+        }
+        tag = tags_[head];
+        return true;
+    }
+
+    // Consommateur : copie le bloc en tête (si block != nullptr) et le retire
+    bool tryPop(float* block, uint64_t& tag) noexcept {
+        const size_t head = head_.load(std::memory_order_relaxed);
+        if (head == tail_.load(std::memory_order_acquire)) {
+            return false;
+        }
+        if (block) {
+            std::copy_n(data_.data() + head * blockSize_, blockSize_, block);
+        }
+        tag = tags_[head];
+        head_.store(head + 1 == numSlots_ ? 0 : head + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consommateur uniquement
+    void clear() noexcept {
+        head_.store(tail_.load(std::memory_order_acquire), std::memory_order_release);
+    }
+
+private:
+    std::vector<float> data_;
+    std::vector<uint64_t> tags_;
+    size_t numSlots_ = 0;
+    size_t blockSize_ = 0;
+    alignas(64) std::atomic<size_t> head_{0};
+    alignas(64) std::atomic<size_t> tail_{0};
+};
+
+}}} // namespace Nyth { namespace Audio { namespace FX
+
+#endif // NYTH_AUDIO_SPSC_BLOCK_QUEUE_HPP
@@ -0,0 +1,180 @@
+#pragma once
+#ifndef NYTH_AUDIO_WAV_READER_HPP
+#define NYTH_AUDIO_WAV_READER_HPP
+
+#include "../config/Constant.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+namespace Nyth { namespace Audio { namespace FX {
+
+// C++17 constexpr constants for the RIFF/WAVE parser
+namespace WavConstants {
+constexpr uint16_t FORMAT_EXTENSIBLE = 0xFFFE;
+constexpr size_t CHUNK_HEADER_SIZE = 8;
+constexpr size_t FMT_MIN_SIZE = 16;
+constexpr size_t EXTENSIBLE_SUBFORMAT_OFFSET = 24; // GUID dont les 2 premiers octets donnent le format
+constexpr uint16_t MAX_CHANNELS = 8;
+constexpr double INT32_TO_FLOAT_SCALE = 1.0 / 2147483648.0;
+} // namespace WavConstants
+
+/**
+ * @brief Decoded WAV file, one float vector per channel
+ */
+struct WavData {
+    uint32_t sampleRate = 0;
+    std::vector<std::vector<float>> channels;
+
+    [[nodiscard]] size_t getNumFrames() const noexcept {
+        return channels.empty() ? 0 : channels[0].size();
+    }
+};
+
+/**
+ * @brief Minimal RIFF/WAVE reader (non real-time)
+ *
+ * Supports PCM 16/24/32 bits, IEEE float 32 bits and WAVE_FORMAT_EXTENSIBLE
+ * wrappers of those. Unknown chunks are skipped. Samples are returned
+ * deinterleaved and scaled to [-1, 1].
+ */
+class WavReader {
+public:
+    /**
+     * @brief Reads a whole file
+     * @param error optional human readable reason on failure
+     * @return false if the file cannot be opened or the format is unsupported
+     */
+    static bool readFile(const std::string& path, WavData& out, std::string* error = nullptr) {
+        std::ifstream file(path, std::ios::binary);
+        if (!file) {
+            return fail(error, "cannot open file");
+        }
+        std::vector<uint8_t> bytes((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+        return readMemory(bytes.data(), bytes.size(), out, error);
+    }
+
+    static bool readMemory(const uint8_t* data, size_t size, WavData& out, std::string* error = nullptr) {
+        if (!data || size < 12 || std::memcmp(data, "RIFF", 4) != 0 || std::memcmp(data + 8, "WAVE", 4) != 0) {
+            return fail(error, "not a RIFF/WAVE file");
+        }
+
+        uint16_t format = 0;
+        uint16_t numChannels = 0;
+        uint16_t bitsPerSample = 0;
+        uint32_t sampleRate = 0;
+        bool haveFormat = false;
+
+        size_t pos = 12;
+        while (pos + WavConstants::CHUNK_HEADER_SIZE <= size) {
+            const uint8_t* chunk = data + pos;
+            const size_t chunkSize = readU32(chunk + 4);
+            const uint8_t* body = chunk + WavConstants::CHUNK_HEADER_SIZE;
+            const size_t available = size - pos - WavConstants::CHUNK_HEADER_SIZE;
+
+            if (std::memcmp(chunk, "fmt ", 4) == 0) {
+                if (chunkSize < WavConstants::FMT_MIN_SIZE || chunkSize > available) {
+                    return fail(error, "invalid fmt chunk");
+                }
+                format = readU16(body);
+                numChannels = readU16(body + 2);
+                sampleRate = readU32(body + 4);
+                bitsPerSample = readU16(body + 14);
+                if (format == WavConstants::FORMAT_EXTENSIBLE &&
+                    chunkSize >= WavConstants::EXTENSIBLE_SUBFORMAT_OFFSET + 2) {
+                    format = readU16(body + WavConstants::EXTENSIBLE_SUBFORMAT_OFFSET);
+                }
+                haveFormat = true;
+            } else if (std::memcmp(chunk, "data", 4) == 0) {
+                if (!haveFormat) {
+                    return fail(error, "data chunk before fmt chunk");
+                }
+                // Fichiers tronqués ou taille 0xFFFFFFFF (enregistrement interrompu) : lire ce qui est présent
+                return decode(body, std::min(chunkSize, available), format, numChannels, bitsPerSample, sampleRate,
+                              out, error);
+            }
+
+            // Les chunks sont alignés sur 2 octets
+            pos += WavConstants::CHUNK_HEADER_SIZE + chunkSize + (chunkSize & 1);
+        }
+        return fail(error, "no data chunk");
+    }
+
+private:
+    static bool fail(std::string* error, const char* reason) {
+        if (error) {
+            *error = reason;
+        }
+        return false;
+    }
+
+    static uint16_t readU16(const uint8_t* p) noexcept {
+        return static_cast<uint16_t>(p[0] | (p[1] << 8));
+    }
+    static uint32_t readU24(const uint8_t* p) noexcept {
+        return static_cast<uint32_t>(p[0]) | (static_cast<uint32_t>(p[1]) << 8) | (static_cast<uint32_t>(p[2]) << 16);
+    }
+    static uint32_t readU32(const uint8_t* p) noexcept {
+        return static_cast<uint32_t>(p[0]) | (static_cast<uint32_t>(p[1]) << 8) |
+               (static_cast<uint32_t>(p[2]) << 16) | (static_cast<uint32_t>(p[3]) << 24);
+    }
+
+    static bool decode(const uint8_t* body, size_t size, uint16_t format, uint16_t numChannels, uint16_t bits,
+                       uint32_t sampleRate, WavData& out, std::string* error) {
+        if (numChannels == 0 || numChannels > WavConstants::MAX_CHANNELS || sampleRate == 0) {
+            return fail(error, "unsupported channel count or sample rate");
+        }
+        const bool isFloat = format == Constants::WAV_FORMAT_IEEE_FLOAT && bits == Constants::BITS_PER_SAMPLE_32;
+        const bool isPcm = format == Constants::WAV_FORMAT_PCM &&
+                           (bits == Constants::BITS_PER_SAMPLE_16 || bits == Constants::BITS_PER_SAMPLE_24 ||
+                            bits == Constants::BITS_PER_SAMPLE_32);
+        if (!isFloat && !isPcm) {
+            return fail(error, "unsupported sample format");
+        }
+
+        const size_t bytesPerSample = bits / Constants::BITS_TO_BYTES_FACTOR;
+        const size_t frameBytes = bytesPerSample * numChannels;
+        const size_t numFrames = size / frameBytes;
+
+        out.sampleRate = sampleRate;
+        out.channels.assign(numChannels, std::vector<float>(numFrames));
+        for (size_t frame = 0; frame < numFrames; ++frame) {
+            const uint8_t* p = body + frame * frameBytes;
+            for (size_t ch = 0; ch < numChannels; ++ch, p += bytesPerSample) {
+                out.channels[ch][frame] = decodeSample(p, bits, isFloat);
+            }
+        }
+        return true;
+    }
+
+    static float decodeSample(const uint8_t* p, uint16_t bits, bool isFloat) noexcept {
+        if (isFloat) {
+            const uint32_t raw = readU32(p);
+            float value;
+            std::memcpy(&value, &raw, sizeof(value));
+            return value;
+        }
+        switch (bits) {
+            case Constants::BITS_PER_SAMPLE_16:
+                return static_cast<float>(static_cast<int16_t>(readU16(p))) * Constants::INT16_TO_FLOAT_SCALE;
+            case Constants::BITS_PER_SAMPLE_24: {
+                // Extension de signe : placer les 24 bits en tête d'un int32 puis décaler
+                const int32_t v =
+                    static_cast<int32_t>(readU24(p) << Constants::INT24_SHIFT_8) >> Constants::INT24_SHIFT_8;
+                return static_cast<float>(v) / -Constants::INT24_MIN;
+            }
+            default:
+                return static_cast<float>(static_cast<double>(static_cast<int32_t>(readU32(p))) *
+                                          WavConstants::INT32_TO_FLOAT_SCALE);
+        }
+    }
+
+};
+
+}}} // namespace Nyth { namespace Audio { namespace FX
+
+#endif // NYTH_AUDIO_WAV_READER_HPP
@@ -22,42 +22,53 @@ AudioEqualizer::AudioEqualizer(size_t numBands, uint32_t sampleRate)
     : m_sampleRate(sampleRate)
     , m_masterGain(EqualizerConstants::DEFAULT_MASTER_GAIN)
     , m_bypass(false)
-    , m_parametersChanged(false) {
+    , m_parametersChanged(false)
+    , m_controlSampleRate(sampleRate) {
     initialize(numBands, sampleRate);
 }
 
 AudioEqualizer::~AudioEqualizer() = default;
 
 void AudioEqualizer::initialize(size_t numBands, uint32_t sampleRate) {
-    std::lock_guard<std::mutex> lock(m_parameterMutex);
+    std::lock_guard<std::recursive_mutex> lock(m_parameterMutex);
 
     m_sampleRate = sampleRate;
-    m_bands.clear();
-    m_bands.resize(numBands);
+    m_controlSampleRate = sampleRate;
+    m_settings.resize(numBands);
 
     // Setup default bands
     setupDefaultBands();
 
+    m_bands.clear();
+    m_bands.resize(numBands);
+    for (size_t i = EqualizerConstants::FIRST_BAND_INDEX; i < numBands; ++i) {
+        m_bands[i].frequency = m_settings[i].frequency;
+        m_bands[i].gain = m_settings[i].gain;
+        m_bands[i].q = m_settings[i].q;
+        m_bands[i].type = m_settings[i].type;
+        m_bands[i].enabled = m_settings[i].enabled;
+    }
+
     // Update all filters
     updateFilters();
 }
 
 void AudioEqualizer::setupDefaultBands() {
-    size_t numBands = m_bands.size();
+    size_t numBands = m_settings.size();
 
     if (numBands == NUM_BANDS) {
         // Use predefined frequencies for 10-band EQ
         for (size_t i = EqualizerConstants::FIRST_BAND_INDEX; i < numBands; ++i) {
-            m_bands[i].frequency = DEFAULT_FREQUENCIES[i];
-            m_bands[i].gain = EqualizerConstants::ZERO_GAIN;
-            m_bands[i].q = DEFAULT_Q;
-            m_bands[i].type = FilterType::PEAK;
-            m_bands[i].enabled = true;
+            m_settings[i].frequency = DEFAULT_FREQUENCIES[i];
+            m_settings[i].gain = EqualizerConstants::ZERO_GAIN;
+            m_settings[i].q = DEFAULT_Q;
+            m_settings[i].type = FilterType::PEAK;
+            m_settings[i].enabled = true;
         }
 
         // Set first and last bands as shelf filters
-        m_bands[EqualizerConstants::FIRST_BAND_INDEX].type = FilterType::LOWSHELF;
-        m_bands[numBands - EqualizerConstants::STEP_INCREMENT].type = FilterType::HIGHSHELF;
+        m_settings[EqualizerConstants::FIRST_BAND_INDEX].type = FilterType::LOWSHELF;
+        m_settings[numBands - EqualizerConstants::STEP_INCREMENT].type = FilterType::HIGHSHELF;
     } else {
         // Calculate logarithmically spaced frequencies
         double minFreq = EqualizerConstants::MIN_FREQUENCY_HZ;
@@ -68,25 +79,70 @@ void AudioEqualizer::setupDefaultBands() {
 
         for (size_t i = EqualizerConstants::FIRST_BAND_INDEX; i < numBands; ++i) {
             double logFreq = logMin + i * logStep;
-            m_bands[i].frequency = std::pow(EqualizerConstants::LOGARITHMIC_BASE, logFreq);
-            m_bands[i].gain = EqualizerConstants::ZERO_GAIN;
-            m_bands[i].q = DEFAULT_Q;
-            m_bands[i].type = FilterType::PEAK;
-            m_bands[i].enabled = true;
+            m_settings[i].frequency = std::pow(EqualizerConstants::LOGARITHMIC_BASE, logFreq);
+            m_settings[i].gain = EqualizerConstants::ZERO_GAIN;
+            m_settings[i].q = DEFAULT_Q;
+            m_settings[i].type = FilterType::PEAK;
+            m_settings[i].enabled = true;
         }
 
         // Set first and last bands as shelf filters
         if (numBands > EqualizerConstants::FIRST_BAND_INDEX) {
-            m_bands[EqualizerConstants::FIRST_BAND_INDEX].type = FilterType::LOWSHELF;
+            m_settings[EqualizerConstants::FIRST_BAND_INDEX].type = FilterType::LOWSHELF;
             if (numBands > EqualizerConstants::MINIMUM_BANDS_FOR_SHELF) {
-                m_bands[numBands - EqualizerConstants::STEP_INCREMENT].type = FilterType::HIGHSHELF;
+                m_settings[numBands - EqualizerConstants::STEP_INCREMENT].type = FilterType::HIGHSHELF;
             }
         }
     }
 }
 
+// Verrou tenu : gain transmis au thread audio par sa file d'événements
+void AudioEqualizer::pushGain(size_t bandIndex, double gainDB) {
+    m_settings[bandIndex].gain = gainDB;
+    if (!m_gainChanges.tryPush(ParameterEvent{0, static_cast<uint32_t>(bandIndex), static_cast<float>(gainDB)})) {
+        m_gainResync.store(true, std::memory_order_relaxed);
+        m_parametersChanged.store(true, std::memory_order_release);
+    }
+}
+
+// Thread audio, début de bloc : gains de la file (rejoints en rampe par processAutomated),
+// puis les autres réglages si le thread de contrôle ne tient pas le verrou
+void AudioEqualizer::applyPendingChanges() {
+    ParameterEvent event;
+    while (m_gainChanges.popDue(0, event)) {
+        if (event.paramId < m_bands.size()) {
+            m_bands[event.paramId].gain = event.value;
+        }
+    }
+
+    if (!m_parametersChanged.load(std::memory_order_acquire) || !m_parameterMutex.try_lock()) {
+        return;
+    }
+    std::lock_guard<std::recursive_mutex> lock(m_parameterMutex, std::adopt_lock);
+    m_parametersChanged.store(false, std::memory_order_relaxed);
+    const bool resync = m_gainResync.exchange(false, std::memory_order_relaxed);
+
+    m_sampleRate = m_controlSampleRate;
+    const size_t numBands = std::min(m_settings.size(), m_bands.size());
+    for (size_t i = EqualizerConstants::FIRST_BAND_INDEX; i < numBands; ++i) {
+        EQBand& band = m_bands[i];
+        band.frequency = m_settings[i].frequency;
+        band.q = m_settings[i].q;
+        band.type = m_settings[i].type;
+        band.enabled = m_settings[i].enabled;
+        if (resync) {
+            band.gain = m_settings[i].gain;
+        }
+        // Gain courant de la rampe conservé : pas de saut
+        updateBandFilter(i);
+    }
+}
+
 void AudioEqualizer::updateFilters() {
+    // Un réglage direct (initialisation) s'applique sans rampe
+    m_rampGains.resize(m_bands.size());
     for (size_t i = EqualizerConstants::FIRST_BAND_INDEX; i < m_bands.size(); ++i) {
+        m_rampGains[i] = m_bands[i].gain;
         updateBandFilter(i);
     }
 }
@@ -95,6 +151,8 @@ void AudioEqualizer::updateBandFilter(size_t bandIndex) {
     if (bandIndex >= m_bands.size()) return;
 
     EQBand& band = m_bands[bandIndex];
+    // Gain courant de la rampe d'automation (égal à band.gain hors rampe)
+    const double gain = bandIndex < m_rampGains.size() ? m_rampGains[bandIndex] : band.gain;
 
     // Calculate filter coefficients based on band type
     switch (band.type) {
@@ -111,13 +169,13 @@ void AudioEqualizer::updateBandFilter(size_t bandIndex) {
             band.filter->calculateNotch(band.frequency, m_sampleRate, band.q);
             break;
         case FilterType::PEAK:
-            band.filter->calculatePeaking(band.frequency, m_sampleRate, band.q, band.gain);
+            band.filter->calculatePeaking(band.frequency, m_sampleRate, band.q, gain);
             break;
         case FilterType::LOWSHELF:
-            band.filter->calculateLowShelf(band.frequency, m_sampleRate, band.q, band.gain);
+            band.filter->calculateLowShelf(band.frequency, m_sampleRate, band.q, gain);
             break;
         case FilterType::HIGHSHELF:
-            band.filter->calculateHighShelf(band.frequency, m_sampleRate, band.q, band.gain);
+            band.filter->calculateHighShelf(band.frequency, m_sampleRate, band.q, gain);
             break;
         case FilterType::ALLPASS:
             band.filter->calculateAllpass(band.frequency, m_sampleRate, band.q);
@@ -125,28 +183,30 @@ void AudioEqualizer::updateBandFilter(size_t bandIndex) {
     }
 }
 
-void AudioEqualizer::processOptimized(const std::vector<float>& input, std::vector<float>& output) {
-    // Check if parameters have changed
-    if (m_parametersChanged.load()) {
-        std::lock_guard<std::mutex> lock(m_parameterMutex);
-        updateFilters();
-        m_parametersChanged.store(false);
-    }
+bool AudioEqualizer::isBandActive(size_t bandIndex) const {
+    const EQBand& band = m_bands[bandIndex];
+    return band.enabled && std::abs(band.gain) > EqualizerConstants::ACTIVE_GAIN_THRESHOLD;
+}
+
+void AudioEqualizer::processOptimized(const float* input, float* output, size_t numSamples) {
+    applyPendingChanges();
 
     // Optimisation: traiter par blocs plus grands pour améliorer la localité du cache
     constexpr size_t OPTIMAL_BLOCK_SIZE_LOCAL = EqualizerConstants::OPTIMAL_BLOCK_SIZE;
-    size_t numSamples = input.size();
-
-    // Pré-calculer les filtres actifs pour éviter les vérifications répétées
-    std::vector<BiquadFilter*> activeFilters;
-    {
-        std::lock_guard<std::mutex> lock(m_parameterMutex);
-        activeFilters.reserve(m_bands.size());
-        for (const auto& band : m_bands) {
-            if (band.enabled && std::abs(band.gain) > EqualizerConstants::ACTIVE_GAIN_THRESHOLD) {
-                activeFilters.push_back(band.filter.get());
-            }
+
+    // Événements en attente ou rampe en cours : traitement découpé à l'échantillon près
+    if (isAutomationActive()) {
+        if (input != output) {
+            std::copy(input, input + numSamples, output);
         }
+        processAutomated(output, nullptr, numSamples);
+        return;
+    }
+    m_samplePosition.fetch_add(numSamples, std::memory_order_relaxed);
+
+    bool anyActive = false;
+    for (size_t b = EqualizerConstants::FIRST_BAND_INDEX; b < m_bands.size() && !anyActive; ++b) {
+        anyActive = isBandActive(b);
     }
 
     // Pré-calculer le gain master une seule fois
@@ -154,11 +214,11 @@ void AudioEqualizer::processOptimized(const std::vector<float>& input, std::vect
     bool needsMasterGain = std::abs(masterGainLinear - EqualizerConstants::UNITY_GAIN_F) > EqualizerConstants::MASTER_GAIN_THRESHOLD;
 
     // Si aucun filtre actif, appliquer seulement le gain master
-    if (activeFilters.empty()) {
+    if (!anyActive) {
         if (!needsMasterGain) {
             // Pas de traitement nécessaire, copie directe
-            if (input.data() != output.data()) {
-                std::copy(input.begin(), input.end(), output.begin());
+            if (input != output) {
+                std::copy(input, input + numSamples, output);
             }
         } else {
             // Appliquer le gain master avec unrolling
@@ -187,18 +247,20 @@ void AudioEqualizer::processOptimized(const std::vector<float>& input, std::vect
         }
 
         // Copier l'entrée vers la sortie si nécessaire
-        if (output.data() != input.data()) {
-            std::copy(input.data() + offset, input.data() + offset + blockSize, output.data() + offset);
+        if (output != input) {
+            std::copy(input + offset, input + offset + blockSize, output + offset);
         }
 
         // Appliquer chaque filtre actif en séquence
-        for (auto* filter : activeFilters) {
-            filter->process(output.data() + offset, output.data() + offset, blockSize);
+        for (size_t b = EqualizerConstants::FIRST_BAND_INDEX; b < m_bands.size(); ++b) {
+            if (isBandActive(b)) {
+                m_bands[b].filter->processMono(output + offset, output + offset, blockSize);
+            }
         }
 
         // Appliquer le gain master si nécessaire
         if (needsMasterGain) {
-            float* blockPtr = output.data() + offset;
+            float* blockPtr = output + offset;
             size_t i = EqualizerConstants::FIRST_BAND_INDEX;
 
             // Unroll par UNROLL_FACTOR pour meilleure performance
@@ -215,29 +277,29 @@ void AudioEqualizer::processOptimized(const std::vector<float>& input, std::vect
     }
 }
 
-void AudioEqualizer::processStereoOptimized(const std::vector<float>& inputL, const std::vector<float>& inputR,
-                                           std::vector<float>& outputL, std::vector<float>& outputR) {
-    // Check if parameters have changed
-    if (m_parametersChanged.load()) {
-        std::lock_guard<std::mutex> lock(m_parameterMutex);
-        updateFilters();
-        m_parametersChanged.store(false);
-    }
+void AudioEqualizer::processStereoOptimized(const float* inputL, const float* inputR, float* outputL, float* outputR,
+                                            size_t numSamples) {
+    applyPendingChanges();
 
     // Optimisation: traiter par blocs plus grands
     constexpr size_t OPTIMAL_BLOCK_SIZE_LOCAL = EqualizerConstants::OPTIMAL_BLOCK_SIZE;
-    size_t numSamples = inputL.size();
-
-    // Pré-calculer les filtres actifs
-    std::vector<BiquadFilter*> activeFilters;
-    {
-        std::lock_guard<std::mutex> lock(m_parameterMutex);
-        activeFilters.reserve(m_bands.size());
-        for (const auto& band : m_bands) {
-            if (band.enabled && std::abs(band.gain) > EqualizerConstants::ACTIVE_GAIN_THRESHOLD) {
-                activeFilters.push_back(band.filter.get());
-            }
+
+    // Événements en attente ou rampe en cours : traitement découpé à l'échantillon près
+    if (isAutomationActive()) {
+        if (outputL != inputL) {
+            std::copy(inputL, inputL + numSamples, outputL);
+        }
+        if (outputR != inputR) {
+            std::copy(inputR, inputR + numSamples, outputR);
         }
+        processAutomated(outputL, outputR, numSamples);
+        return;
+    }
+    m_samplePosition.fetch_add(numSamples, std::memory_order_relaxed);
+
+    bool anyActive = false;
+    for (size_t b = EqualizerConstants::FIRST_BAND_INDEX; b < m_bands.size() && !anyActive; ++b) {
+        anyActive = isBandActive(b);
     }
 
     // Pré-calculer le gain master
@@ -245,11 +307,11 @@ void AudioEqualizer::processStereoOptimized(const std::vector<float>& inputL, co
     bool needsMasterGain = std::abs(masterGainLinear - EqualizerConstants::UNITY_GAIN_F) > EqualizerConstants::MASTER_GAIN_THRESHOLD;
 
     // Si aucun filtre actif, appliquer seulement le gain master
-    if (activeFilters.empty() && !needsMasterGain) {
+    if (!anyActive && !needsMasterGain) {
         // Copie directe optimisée
-        if (outputL.data() != inputL.data() || outputR.data() != inputR.data()) {
-            std::copy(inputL.data(), inputL.data() + numSamples, outputL.data());
-            std::copy(inputR.data(), inputR.data() + numSamples, outputR.data());
+        if (outputL != inputL || outputR != inputR) {
+            std::copy(inputL, inputL + numSamples, outputL);
+            std::copy(inputR, inputR + numSamples, outputR);
         }
         return;
     }
@@ -267,23 +329,25 @@ void AudioEqualizer::processStereoOptimized(const std::vector<float>& inputL, co
         }
 
         // Copier l'entrée vers la sortie si nécessaire
-        if (outputL.data() != inputL.data()) {
-            std::copy(inputL.data() + offset, inputL.data() + offset + blockSize, outputL.data() + offset);
+        if (outputL != inputL) {
+            std::copy(inputL + offset, inputL + offset + blockSize, outputL + offset);
         }
-        if (outputR.data() != inputR.data()) {
-            std::copy(inputR.data() + offset, inputR.data() + offset + blockSize, outputR.data() + offset);
+        if (outputR != inputR) {
+            std::copy(inputR + offset, inputR + offset + blockSize, outputR + offset);
         }
 
         // Appliquer chaque filtre actif
-        for (auto* filter : activeFilters) {
-            filter->processStereo(outputL.data() + offset, outputR.data() + offset,
-                                outputL.data() + offset, outputR.data() + offset, blockSize);
+        for (size_t b = EqualizerConstants::FIRST_BAND_INDEX; b < m_bands.size(); ++b) {
+            if (isBandActive(b)) {
+                m_bands[b].filter->processStereoPlanar(outputL + offset, outputR + offset, outputL + offset,
+                                                       outputR + offset, blockSize);
+            }
         }
 
         // Appliquer le gain master si nécessaire avec unrolling
         if (needsMasterGain) {
-            float* blockPtrL = outputL.data() + offset;
-            float* blockPtrR = outputR.data() + offset;
+            float* blockPtrL = outputL + offset;
+            float* blockPtrR = outputR + offset;
             size_t i = EqualizerConstants::FIRST_BAND_INDEX;
 
             // Unroll par UNROLL_FACTOR
@@ -308,101 +372,161 @@ void AudioEqualizer::processStereoOptimized(const std::vector<float>& inputL, co
     }
 }
 
-// Band control methods
-void AudioEqualizer::setBandGain(size_t bandIndex, double gainDB) {
-    if (bandIndex >= m_bands.size()) return;
+// Thread audio
+bool AudioEqualizer::isAutomationActive() const {
+    uint64_t next = 0;
+    if (m_gainEvents.peekTime(next)) {
+        return true;
+    }
+    for (size_t i = EqualizerConstants::FIRST_BAND_INDEX; i < m_rampGains.size() && i < m_bands.size(); ++i) {
+        if (m_rampGains[i] != m_bands[i].gain) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Thread audio, en place ; right == nullptr : mono
+void AudioEqualizer::processAutomated(float* left, float* right, size_t numSamples) {
+    const uint64_t blockStart = m_samplePosition.fetch_add(numSamples, std::memory_order_relaxed);
+    // Lissage à un pôle du gain en dB, un pas par sous-bloc de GAIN_RAMP_BLOCK_SIZE
+    const double rampCoeff = std::exp(-static_cast<double>(EqualizerConstants::GAIN_RAMP_BLOCK_SIZE) /
+                                      (EqualizerConstants::GAIN_RAMP_TIME_MS * 0.001 * m_sampleRate));
+    const float masterGainLinear = static_cast<float>(dbToLinear(m_masterGain.load()));
+    const bool needsMasterGain =
+        std::abs(masterGainLinear - EqualizerConstants::UNITY_GAIN_F) > EqualizerConstants::MASTER_GAIN_THRESHOLD;
+
+    size_t offset = 0;
+    while (offset < numSamples) {
+        const uint64_t now = blockStart + offset;
+        ParameterEvent event;
+        while (m_gainEvents.popDue(now, event)) {
+            if (event.paramId < m_bands.size()) {
+                m_bands[event.paramId].gain = std::max(MIN_GAIN_DB, std::min(MAX_GAIN_DB, static_cast<double>(event.value)));
+            }
+        }
 
-    gainDB = std::max(MIN_GAIN_DB, std::min(MAX_GAIN_DB, gainDB));
+        for (size_t b = EqualizerConstants::FIRST_BAND_INDEX; b < m_bands.size(); ++b) {
+            const double target = m_bands[b].gain;
+            if (m_rampGains[b] != target) {
+                double gain = target + rampCoeff * (m_rampGains[b] - target);
+                if (std::abs(gain - target) < EqualizerConstants::GAIN_RAMP_SNAP_DB) {
+                    gain = target;
+                }
+                m_rampGains[b] = gain;
+                updateBandFilter(b);
+            }
+        }
 
-    // Si on est déjà dans une session de mise à jour, pas besoin de lock
-    if (m_parameterMutex.try_lock()) {
-        m_bands[bandIndex].gain = gainDB;
-        m_parametersChanged.store(true);
-        m_parameterMutex.unlock();
-    } else {
-        // On est déjà dans une session de mise à jour
-        m_bands[bandIndex].gain = gainDB;
-        m_parametersChanged.store(true);
+        // Segment : jusqu'au prochain pas de rampe ou au prochain événement
+        size_t n = std::min(EqualizerConstants::GAIN_RAMP_BLOCK_SIZE, numSamples - offset);
+        uint64_t next = 0;
+        if (m_gainEvents.peekTime(next) && next < now + n) {
+            n = static_cast<size_t>(next - now);
+        }
+
+        float* blockL = left + offset;
+        float* blockR = right ? right + offset : nullptr;
+        for (size_t b = EqualizerConstants::FIRST_BAND_INDEX; b < m_bands.size(); ++b) {
+            if (!m_bands[b].enabled || std::abs(m_rampGains[b]) <= EqualizerConstants::ACTIVE_GAIN_THRESHOLD) {
+                continue;
+            }
+            if (blockR) {
+                m_bands[b].filter->processStereoPlanar(blockL, blockR, blockL, blockR, n);
+            } else {
+                m_bands[b].filter->processMono(blockL, blockL, n);
+            }
+        }
+        if (needsMasterGain) {
+            for (size_t i = 0; i < n; ++i) {
+                blockL[i] *= masterGainLinear;
+            }
+            if (blockR) {
+                for (size_t i = 0; i < n; ++i) {
+                    blockR[i] *= masterGainLinear;
+                }
+            }
+        }
+        offset += n;
     }
 }
 
-void AudioEqualizer::setBandFrequency(size_t bandIndex, double frequency) {
-    if (bandIndex >= m_bands.size()) return;
+bool AudioEqualizer::scheduleBandGain(size_t bandIndex, double gainDB, uint64_t sampleTime) {
+    std::lock_guard<std::recursive_mutex> lock(m_parameterMutex);
+    if (bandIndex >= m_settings.size()) return false;
 
-    frequency = std::max(EqualizerConstants::MIN_FREQUENCY_HZ, std::min(m_sampleRate / EqualizerConstants::NYQUIST_DIVISOR, frequency));
+    return m_gainEvents.tryPush(ParameterEvent{sampleTime, static_cast<uint32_t>(bandIndex), static_cast<float>(gainDB)});
+}
 
-    // Si on est déjà dans une session de mise à jour, pas besoin de lock
-    if (m_parameterMutex.try_lock()) {
-        m_bands[bandIndex].frequency = frequency;
-        m_parametersChanged.store(true);
-        m_parameterMutex.unlock();
-    } else {
-        // On est déjà dans une session de mise à jour
-        m_bands[bandIndex].frequency = frequency;
-        m_parametersChanged.store(true);
-    }
+uint64_t AudioEqualizer::getSamplePosition() const {
+    return m_samplePosition.load(std::memory_order_relaxed);
 }
 
-void AudioEqualizer::setBandQ(size_t bandIndex, double q) {
-    if (bandIndex >= m_bands.size()) return;
+// Band control methods
+void AudioEqualizer::setBandGain(size_t bandIndex, double gainDB) {
+    std::lock_guard<std::recursive_mutex> lock(m_parameterMutex);
+    if (bandIndex >= m_settings.size()) return;
+
+    pushGain(bandIndex, std::max(MIN_GAIN_DB, std::min(MAX_GAIN_DB, gainDB)));
+}
 
-    q = std::max(MIN_Q, std::min(MAX_Q, q));
+void AudioEqualizer::setBandFrequency(size_t bandIndex, double frequency) {
+    std::lock_guard<std::recursive_mutex> lock(m_parameterMutex);
+    if (bandIndex >= m_settings.size()) return;
 
-    // Si on est déjà dans une session de mise à jour, pas besoin de lock
-    if (m_parameterMutex.try_lock()) {
-        m_bands[bandIndex].q = q;
-        m_parametersChanged.store(true);
-        m_parameterMutex.unlock();
-    } else {
-        // On est déjà dans une session de mise à jour
-        m_bands[bandIndex].q = q;
-        m_parametersChanged.store(true);
-    }
+    frequency = std::max(EqualizerConstants::MIN_FREQUENCY_HZ, std::min(m_controlSampleRate / EqualizerConstants::NYQUIST_DIVISOR, frequency));
+    m_settings[bandIndex].frequency = frequency;
+    m_parametersChanged.store(true, std::memory_order_release);
+}
+
+void AudioEqualizer::setBandQ(size_t bandIndex, double q) {
+    std::lock_guard<std::recursive_mutex> lock(m_parameterMutex);
+    if (bandIndex >= m_settings.size()) return;
+
+    m_settings[bandIndex].q = std::max(MIN_Q, std::min(MAX_Q, q));
+    m_parametersChanged.store(true, std::memory_order_release);
 }
 
 void AudioEqualizer::setBandType(size_t bandIndex, FilterType type) {
-    if (bandIndex >= m_bands.size()) return;
+    std::lock_guard<std::recursive_mutex> lock(m_parameterMutex);
+    if (bandIndex >= m_settings.size()) return;
 
-    {
-        std::lock_guard<std::mutex> lock(m_parameterMutex);
-        m_bands[bandIndex].type = type;
-        m_parametersChanged.store(true);
-    }
+    m_settings[bandIndex].type = type;
+    m_parametersChanged.store(true, std::memory_order_release);
 }
 
 void AudioEqualizer::setBandEnabled(size_t bandIndex, bool enabled) {
-    if (bandIndex >= m_bands.size()) return;
+    std::lock_guard<std::recursive_mutex> lock(m_parameterMutex);
+    if (bandIndex >= m_settings.size()) return;
 
-    {
-        std::lock_guard<std::mutex> lock(m_parameterMutex);
-        m_bands[bandIndex].enabled = enabled;
-    }
+    m_settings[bandIndex].enabled = enabled;
+    m_parametersChanged.store(true, std::memory_order_release);
 }
 
-// Get band parameters
+// Get band parameters (réglages demandés, côté contrôle)
 double AudioEqualizer::getBandGain(size_t bandIndex) const {
-    std::lock_guard<std::mutex> lock(m_parameterMutex);
-    return (bandIndex < m_bands.size()) ? m_bands[bandIndex].gain : EqualizerConstants::ZERO_GAIN;
+    std::lock_guard<std::recursive_mutex> lock(m_parameterMutex);
+    return (bandIndex < m_settings.size()) ? m_settings[bandIndex].gain : EqualizerConstants::ZERO_GAIN;
 }
 
 double AudioEqualizer::getBandFrequency(size_t bandIndex) const {
-    std::lock_guard<std::mutex> lock(m_parameterMutex);
-    return (bandIndex < m_bands.size()) ? m_bands[bandIndex].frequency : EqualizerConstants::ZERO_GAIN;
+    std::lock_guard<std::recursive_mutex> lock(m_parameterMutex);
+    return (bandIndex < m_settings.size()) ? m_settings[bandIndex].frequency : EqualizerConstants::ZERO_GAIN;
 }
 
 double AudioEqualizer::getBandQ(size_t bandIndex) const {
-    std::lock_guard<std::mutex> lock(m_parameterMutex);
-    return (bandIndex < m_bands.size()) ? m_bands[bandIndex].q : DEFAULT_Q;
+    std::lock_guard<std::recursive_mutex> lock(m_parameterMutex);
+    return (bandIndex < m_settings.size()) ? m_settings[bandIndex].q : DEFAULT_Q;
 }
 
 FilterType AudioEqualizer::getBandType(size_t bandIndex) const {
-    std::lock_guard<std::mutex> lock(m_parameterMutex);
-    return (bandIndex < m_bands.size()) ? m_bands[bandIndex].type : FilterType::PEAK;
+    std::lock_guard<std::recursive_mutex> lock(m_parameterMutex);
+    return (bandIndex < m_settings.size()) ? m_settings[bandIndex].type : FilterType::PEAK;
 }
 
 bool AudioEqualizer::isBandEnabled(size_t bandIndex) const {
-    std::lock_guard<std::mutex> lock(m_parameterMutex);
-    return (bandIndex < m_bands.size()) ? m_bands[bandIndex].enabled : false;
+    std::lock_guard<std::recursive_mutex> lock(m_parameterMutex);
+    return (bandIndex < m_settings.size()) ? m_settings[bandIndex].enabled : false;
 }
 
 // Global controls
@@ -425,90 +549,74 @@ bool AudioEqualizer::isBypassed() const {
 
 // Preset management
 void AudioEqualizer::loadPreset(const EQPreset& preset) {
-    std::lock_guard<std::mutex> lock(m_parameterMutex);
+    std::lock_guard<std::recursive_mutex> lock(m_parameterMutex);
 
-    size_t numBands = std::min(preset.gains.size(), m_bands.size());
+    size_t numBands = std::min(preset.gains.size(), m_settings.size());
     for (size_t i = EqualizerConstants::FIRST_BAND_INDEX; i < numBands; ++i) {
-        m_bands[i].gain = preset.gains[i];
+        pushGain(i, std::max(MIN_GAIN_DB, std::min(MAX_GAIN_DB, preset.gains[i])));
     }
-
-    m_parametersChanged.store(true);
 }
 
 void AudioEqualizer::savePreset(EQPreset& preset) const {
-    std::lock_guard<std::mutex> lock(m_parameterMutex);
+    std::lock_guard<std::recursive_mutex> lock(m_parameterMutex);
 
     preset.gains.clear();
-    preset.gains.reserve(m_bands.size());
+    preset.gains.reserve(m_settings.size());
 
-    std::transform(m_bands.begin(), m_bands.end(), std::back_inserter(preset.gains),
-                          [](const EQBand& band) {
+    std::transform(m_settings.begin(), m_settings.end(), std::back_inserter(preset.gains),
+                          [](const BandSettings& band) {
                               return band.gain;
                           });
 }
 
 void AudioEqualizer::resetAllBands() {
-    std::lock_guard<std::mutex> lock(m_parameterMutex);
-
-    std::for_each(m_bands.begin(), m_bands.end(), [](EQBand& band) {
-        band.gain = EqualizerConstants::ZERO_GAIN;
-    });
+    std::lock_guard<std::recursive_mutex> lock(m_parameterMutex);
 
-    m_parametersChanged.store(true);
+    for (size_t i = EqualizerConstants::FIRST_BAND_INDEX; i < m_settings.size(); ++i) {
+        pushGain(i, EqualizerConstants::ZERO_GAIN);
+    }
 }
 
 void AudioEqualizer::reset() {
-    std::lock_guard<std::mutex> lock(m_parameterMutex);
+    std::lock_guard<std::recursive_mutex> lock(m_parameterMutex);
 
     // Reset all bands to default values
     setupDefaultBands();
+    for (size_t i = EqualizerConstants::FIRST_BAND_INDEX; i < m_settings.size(); ++i) {
+        pushGain(i, m_settings[i].gain);
+    }
 
     // Reset master gain and bypass
     m_masterGain.store(EqualizerConstants::DEFAULT_MASTER_GAIN);
     m_bypass.store(false);
 
     // Mark parameters as changed to trigger filter update
-    m_parametersChanged.store(true);
+    m_parametersChanged.store(true, std::memory_order_release);
 }
 
 void AudioEqualizer::processMono(const float* input, float* output, size_t numSamples) {
-    std::lock_guard<std::mutex> lock(m_parameterMutex);
-
     // Check if bypass is enabled
     if (m_bypass.load()) {
         std::copy(input, input + numSamples, output);
+        m_samplePosition.fetch_add(numSamples, std::memory_order_relaxed);
         return;
     }
 
-    // Convert to vectors for processing
-    std::vector<float> inputVector(input, input + numSamples);
-    std::vector<float> outputVector(numSamples);
-
-    // Process using the optimized mono method
-    processOptimized(inputVector, outputVector);
-
-    // Apply master gain
-    double masterGain = m_masterGain.load();
-    if (std::abs(masterGain - EqualizerConstants::DEFAULT_MASTER_GAIN) > 0.001) {
-        double gainLinear = dbToLinear(masterGain);
-        for (size_t i = 0; i < numSamples; ++i) {
-            output[i] = static_cast<float>(outputVector[i] * gainLinear);
-        }
-    } else {
-        std::copy(outputVector.begin(), outputVector.end(), output);
-    }
+    // processOptimized applique les réglages en attente et le gain master
+    processOptimized(input, output, numSamples);
 }
 
 void AudioEqualizer::setSampleRate(uint32_t sampleRate) {
-    if (sampleRate != m_sampleRate) {
-        std::lock_guard<std::mutex> lock(m_parameterMutex);
-        m_sampleRate = sampleRate;
-        m_parametersChanged.store(true);
+    std::lock_guard<std::recursive_mutex> lock(m_parameterMutex);
+    if (sampleRate != m_controlSampleRate) {
+        m_controlSampleRate = sampleRate;
+        m_parametersChanged.store(true, std::memory_order_release);
     }
 }
 
 uint32_t AudioEqualizer::getSampleRate() const {
-    return m_sampleRate;
+    std::lock_guard<std::recursive_mutex> lock(m_parameterMutex);
+    return m_controlSampleRate;
 }
 
 void AudioEqualizer::beginParameterUpdate() {
@@ -516,7 +624,7 @@ void AudioEqualizer::beginParameterUpdate() {
 }
 
 void AudioEqualizer::endParameterUpdate() {
-    m_parametersChanged.store(true);
+    m_parametersChanged.store(true, std::memory_order_release);
     m_parameterMutex.unlock();
 }
 
@@ -532,11 +640,11 @@ double AudioEqualizer::linearToDb(double linear) const {
 // Filter operations
 std::vector<std::reference_wrapper<const EQBand>> AudioEqualizer::getActiveBands() const {
     std::vector<std::reference_wrapper<const EQBand>> activeBands;
-    std::lock_guard<std::mutex> lock(m_parameterMutex);
+    std::lock_guard<std::recursive_mutex> lock(m_parameterMutex);
 
-    for (const auto& band : m_bands) {
-        if (band.enabled) {
-            activeBands.emplace_back(std::cref(band));
+    for (size_t i = EqualizerConstants::FIRST_BAND_INDEX; i < m_settings.size() && i < m_bands.size(); ++i) {
+        if (m_settings[i].enabled) {
+            activeBands.emplace_back(std::cref(m_bands[i]));
         }
     }
     return activeBands;
@@ -544,11 +652,11 @@ std::vector<std::reference_wrapper<const EQBand>> AudioEqualizer::getActiveBands
 
 std::vector<std::reference_wrapper<const EQBand>> AudioEqualizer::getBandsByType(FilterType type) const {
     std::vector<std::reference_wrapper<const EQBand>> filteredBands;
-    std::lock_guard<std::mutex> lock(m_parameterMutex);
+    std::lock_guard<std::recursive_mutex> lock(m_parameterMutex);
 
-    for (const auto& band : m_bands) {
-        if (band.type == type) {
-            filteredBands.emplace_back(std::cref(band));
+    for (size_t i = EqualizerConstants::FIRST_BAND_INDEX; i < m_settings.size() && i < m_bands.size(); ++i) {
+        if (m_settings[i].type == type) {
+            filteredBands.emplace_back(std::cref(m_bands[i]));
         }
     }
     return filteredBands;
@@ -557,16 +665,17 @@ std::vector<std::reference_wrapper<const EQBand>> AudioEqualizer::getBandsByType
 // C++17 formatted debugging
 std::string AudioEqualizer::getDebugInfo(const std::string& location) const {
     (void)location; // Éviter warning unused
+    std::lock_guard<std::recursive_mutex> lock(m_parameterMutex);
     std::ostringstream oss;
     oss << "AudioEqualizer Debug Info:\n"
-        << "  Sample Rate: " << m_sampleRate << " Hz\n"
+        << "  Sample Rate: " << m_controlSampleRate << " Hz\n"
         << "  Master Gain: " << getMasterGain() << " dB\n"
         << "  Bypassed: " << (isBypassed() ? "true" : "false") << "\n"
         << "  Number of Bands: " << getNumBands() << "\n"
         << "  Bands:\n";
 
-    for (size_t i = EqualizerConstants::FIRST_BAND_INDEX; i < m_bands.size(); ++i) {
-        const auto& band = m_bands[i];
+    for (size_t i = EqualizerConstants::FIRST_BAND_INDEX; i < m_settings.size(); ++i) {
+        const auto& band = m_settings[i];
         oss << "    Band " << i << ": Freq=" << band.frequency << "Hz, Gain="
             << band.gain << "dB, Q=" << band.q << ", Type="
             << static_cast<int>(band.type) << ", Enabled="
@@ -15,6 +15,7 @@
 
 
 // Project headers
+#include "../../../common/utils/ParameterEventQueue.hpp"
 #include "../constant/CoreConstants.hpp"
 #include "../EQBand/EQBand.hpp"
 #include "../EQBand/EQPreset.hpp"
@@ -48,8 +49,17 @@ public:
   // Mono processing method for single channel audio
   void processMono(const float* input, float* output, size_t numSamples);
 
-  // Band control
+  // Band control (control thread). Gains reach the audio thread through a
+  // queue drained at the start of each block and glide like automation; the
+  // other settings are copied by the audio thread when it can take the
+  // parameter lock without waiting, so processing never blocks.
   void setBandGain(size_t bandIndex, double gainDB);
+
+  // Sample-accurate gain automation: the change lands at sampleTime (position
+  // counted by getSamplePosition(), 0 = next block) and the band glides to it.
+  // Single producer; events in non-decreasing time. false if the queue is full.
+  bool scheduleBandGain(size_t bandIndex, double gainDB, uint64_t sampleTime = 0);
+  uint64_t getSamplePosition() const;
   void setBandFrequency(size_t bandIndex, double frequency);
   void setBandQ(size_t bandIndex, double q);
   void setBandType(size_t bandIndex, FilterType type);
@@ -73,7 +83,7 @@ public:
   void savePreset(EQPreset &preset) const;
   void resetAllBands();
 
-  // Reset and initialization
+  // Reset and initialization (initialize() resizes the bands: stream stopped)
   void reset();
 
   // Sample rate
@@ -117,16 +127,28 @@ public:
       getBandsByType(FilterType type) const;
 
 private:
+  // Réglages d'une bande côté contrôle (sous m_parameterMutex)
+  struct BandSettings {
+    double frequency;
+    double gain;
+    double q;
+    FilterType type;
+    bool enabled;
+  };
+
   // Implementation details
   void setupDefaultBands();
+  void pushGain(size_t bandIndex, double gainDB);
+  void applyPendingChanges();
   void updateFilters();
   void updateBandFilter(size_t bandIndex);
-  void processOptimized(const std::vector<float> &input,
-                        std::vector<float> &output);
-  void processStereoOptimized(const std::vector<float> &inputL,
-                              const std::vector<float> &inputR,
-                              std::vector<float> &outputL,
-                              std::vector<float> &outputR);
+  bool isBandActive(size_t bandIndex) const;
+  bool isAutomationActive() const;
+  void processAutomated(float *left, float *right, size_t numSamples);
+  void processOptimized(const float *input, float *output, size_t numSamples);
+  void processStereoOptimized(const float *inputL, const float *inputR,
+                              float *outputL, float *outputR,
+                              size_t numSamples);
 
   // Helper functions
   double dbToLinear(double db) const;
@@ -135,21 +157,21 @@ private:
   // Type dispatch helpers for C++11 compatibility
   template <typename T>
   void processTypeDispatch(const std::vector<T> &input, std::vector<T> &output, std::true_type) {
-    processOptimized(input, output);
+    processOptimized(input.data(), output.data(), input.size());
   }
 
   template <typename T>
   void processTypeDispatch(const std::vector<T> &input, std::vector<T> &output, std::false_type) {
     std::vector<float> tempInput(input.begin(), input.end());
     std::vector<float> tempOutput(tempInput.size());
-    processOptimized(tempInput, tempOutput);
+    processOptimized(tempInput.data(), tempOutput.data(), tempInput.size());
     std::copy(tempOutput.begin(), tempOutput.end(), output.begin());
   }
 
   template <typename T>
   void processStereoTypeDispatch(const std::vector<T> &inputL, const std::vector<T> &inputR,
                                  std::vector<T> &outputL, std::vector<T> &outputR, std::true_type) {
-    processStereoOptimized(inputL, inputR, outputL, outputR);
+    processStereoOptimized(inputL.data(), inputR.data(), outputL.data(), outputR.data(), inputL.size());
   }
 
   template <typename T>
@@ -159,18 +181,31 @@ private:
     std::vector<float> tempInputR(inputR.begin(), inputR.end());
     std::vector<float> tempOutputL(tempInputL.size());
     std::vector<float> tempOutputR(tempInputR.size());
-    processStereoOptimized(tempInputL, tempInputR, tempOutputL, tempOutputR);
+    processStereoOptimized(tempInputL.data(), tempInputR.data(), tempOutputL.data(), tempOutputR.data(),
+                           tempInputL.size());
     std::copy(tempOutputL.begin(), tempOutputL.end(), outputL.begin());
     std::copy(tempOutputR.begin(), tempOutputR.end(), outputR.begin());
   }
 
   // Member variables
-  std::vector<EQBand> m_bands;
-  uint32_t m_sampleRate;
+  std::vector<EQBand> m_bands; // thread audio
+  uint32_t m_sampleRate;       // thread audio
   std::atomic<double> m_masterGain;
   std::atomic<bool> m_bypass;
   std::atomic<bool> m_parametersChanged;
-  mutable std::mutex m_parameterMutex;
+  // Récursif : les setters sont appelés entre beginParameterUpdate() et endParameterUpdate()
+  mutable std::recursive_mutex m_parameterMutex;
+  std::vector<BandSettings> m_settings;
+  uint32_t m_controlSampleRate;
+
+  // Gains immédiats (setBandGain, presets) ; file pleine : recopie complète au prochain verrou
+  ParameterEventQueue<EqualizerConstants::AUTOMATION_QUEUE_CAPACITY> m_gainChanges;
+  std::atomic<bool> m_gainResync{false};
+
+  // Automation : file du thread de contrôle, gains courants des rampes (thread audio)
+  ParameterEventQueue<EqualizerConstants::AUTOMATION_QUEUE_CAPACITY> m_gainEvents;
+  std::vector<double> m_rampGains;
+  std::atomic<uint64_t> m_samplePosition{0};
 };
 
 // ============================================================================
@@ -196,17 +231,12 @@ inline void AudioEqualizer::process(const std::vector<T> &input,
     if (input.data() != output.data()) {
       std::copy(input.begin(), input.end(), output.begin());
     }
+    m_samplePosition.fetch_add(input.size(), std::memory_order_relaxed);
     return;
   }
 
-  // Mise à jour des filtres si nécessaire
-  if (m_parametersChanged.load()) {
-    std::lock_guard<std::mutex> lock(m_parameterMutex);
-    updateFilters();
-    m_parametersChanged.store(false);
-  }
-
-  // Traitement spécialisé selon le type avec SFINAE (compatible C++11)
+  // Traitement spécialisé selon le type avec SFINAE (compatible C++11) ; les
+  // réglages en attente sont appliqués sans verrou bloquant
   processTypeDispatch(input, output, std::is_same<T, float>{});
 }
 
@@ -237,17 +267,12 @@ inline void AudioEqualizer::processStereo(const std::vector<T> &inputL,
     if (outputR.data() != inputR.data()) {
       std::copy(inputR.begin(), inputR.end(), outputR.begin());
     }
+    m_samplePosition.fetch_add(inputL.size(), std::memory_order_relaxed);
     return;
   }
 
-  // Mise à jour des filtres si nécessaire
-  if (m_parametersChanged.load()) {
-    std::lock_guard<std::mutex> lock(m_parameterMutex);
-    updateFilters();
-    m_parametersChanged.store(false);
-  }
-
-  // Traitement spécialisé selon le type avec SFINAE (compatible C++11)
+  // Traitement spécialisé selon le type avec SFINAE (compatible C++11) ; les
+  // réglages en attente sont appliqués sans verrou bloquant
   processStereoTypeDispatch(inputL, inputR, outputL, outputR, std::is_same<T, float>{});
 }
 
@@ -213,6 +213,12 @@ namespace EqualizerConstants {
     // Processing block sizes
     constexpr size_t OPTIMAL_BLOCK_SIZE = 2048;
 
+    // Gain automation (scheduleBandGain)
+    constexpr size_t AUTOMATION_QUEUE_CAPACITY = 128; // événements en attente
+    constexpr size_t GAIN_RAMP_BLOCK_SIZE = 32;       // recalcul des coefficients pendant une rampe
+    constexpr double GAIN_RAMP_TIME_MS = 5.0;         // constante de temps du lissage de gain
+    constexpr double GAIN_RAMP_SNAP_DB = 0.01;        // écart sous lequel la rampe s'arrête
+
     // Frequency range
     constexpr double MIN_FREQUENCY_HZ = 20.0;
     constexpr double MAX_FREQUENCY_HZ = 20000.0;
@@ -1,6 +1,7 @@
 #include "AudioRecorderManager.h"
 #include <algorithm>
 #include <chrono>
+#include <cmath>
 #include <filesystem>
 #include <iomanip>
 #include <sstream>
@@ -212,6 +213,15 @@ bool AudioRecorderManager::startRecording() {
         currentStats_ = {0, 0, recordingSampleRate_, recordingChannels_, recordingBitsPerSample_, 0.0, 0.0, false};
         pausedDurationMs_ = 0;
 
+        // Niveaux et détection de silence remis à zéro avant que le thread audio ne voie isRecording_
+        silenceDetector_.prepare(static_cast<double>(recordingSampleRate_));
+        skippedFrames_.store(0);
+        peakLevel_.store(0.0f);
+        averageLevel_.store(0.0f);
+        hasClipping_.store(false);
+        levelSumSquares_ = 0.0;
+        levelSampleCount_ = 0;
+
         // Démarrer l'enregistrement
         isRecording_.store(true);
         isPaused_.store(false);
@@ -306,6 +316,75 @@ bool AudioRecorderManager::isPaused() const {
     return isPaused_.load();
 }
 
+// === Données audio ===
+bool AudioRecorderManager::processRecordingBlock(const float* interleaved, size_t frameCount) {
+    if (!interleaved || frameCount == 0 || !isRecording_.load() || isPaused_.load()) {
+        return false;
+    }
+    const size_t channels = static_cast<size_t>(std::max(recordingChannels_, 1));
+
+    // Une seule passe : crête, énergie, écrêtage et passages par zéro de la somme des canaux
+    float peak = 0.0f;
+    double sumSquares = 0.0;
+    size_t crossings = 0;
+    bool clipping = false;
+    float previous = 0.0f;
+    for (size_t frame = 0; frame < frameCount; ++frame) {
+        const float* samples = interleaved + frame * channels;
+        float mono = 0.0f;
+        for (size_t ch = 0; ch < channels; ++ch) {
+            const float magnitude = std::abs(samples[ch]);
+            peak = std::max(peak, magnitude);
+            clipping = clipping || magnitude >= 1.0f;
+            sumSquares += static_cast<double>(samples[ch]) * samples[ch];
+            mono += samples[ch];
+        }
+        crossings += (frame > 0 && (mono >= 0.0f) != (previous >= 0.0f)) ? 1 : 0;
+        previous = mono;
+    }
+
+    const size_t sampleCount = frameCount * channels;
+    peakLevel_.store(std::max(peakLevel_.load(std::memory_order_relaxed), peak), std::memory_order_relaxed);
+    levelSumSquares_ += sumSquares;
+    levelSampleCount_ += sampleCount;
+    averageLevel_.store(static_cast<float>(std::sqrt(levelSumSquares_ / static_cast<double>(levelSampleCount_))),
+                        std::memory_order_relaxed);
+    if (clipping) {
+        hasClipping_.store(true, std::memory_order_relaxed);
+    }
+
+    if (!skipSilence_.load(std::memory_order_relaxed)) {
+        return true;
+    }
+
+    // Même VAD que le module noise, sur les grandeurs déjà calculées : pas de seconde passe
+    Nyth::Audio::FX::VoiceActivityDetector::Features features;
+    features.energy = static_cast<float>(sumSquares / static_cast<double>(sampleCount));
+    if (frameCount > 1) {
+        features.zeroCrossingRate = static_cast<float>(crossings) / static_cast<float>(frameCount - 1);
+    }
+    if (silenceDetector_.update(features, frameCount)) {
+        return true;
+    }
+    skippedFrames_.fetch_add(frameCount, std::memory_order_relaxed);
+    return false;
+}
+
+void AudioRecorderManager::setSilenceSkipping(bool enabled) {
+    skipSilence_.store(enabled);
+}
+
+bool AudioRecorderManager::isSilenceSkippingEnabled() const {
+    return skipSilence_.load();
+}
+
+uint32_t AudioRecorderManager::getSkippedSilenceMs() const {
+    if (recordingSampleRate_ == 0) {
+        return 0;
+    }
+    return static_cast<uint32_t>(skippedFrames_.load() * 1000 / recordingSampleRate_);
+}
+
 // === État et informations ===
 std::string AudioRecorderManager::getRecordingState() const {
     if (!isInitialized_.load()) {
@@ -360,7 +439,11 @@ size_t AudioRecorderManager::getFileSize() const {
 
 AudioRecorderManager::RecordingStats AudioRecorderManager::getRecordingStats() const {
     std::lock_guard<std::mutex> lock(recorderMutex_);
-    return currentStats_;
+    RecordingStats stats = currentStats_;
+    stats.peakLevel = peakLevel_.load();
+    stats.averageLevel = averageLevel_.load();
+    stats.hasClipping = hasClipping_.load();
+    return stats;
 }
 
 // === Callbacks d'événements ===
@@ -461,8 +544,10 @@ void AudioRecorderManager::updateRecordingStats() {
     currentStats_.channels = recordingChannels_;
     currentStats_.bitsPerSample = recordingBitsPerSample_;
 
-    // Note: peakLevel, averageLevel, hasClipping seraient mis à jour
-    // pendant l'enregistrement avec les données audio réelles
+    // Niveaux mesurés par processRecordingBlock
+    currentStats_.peakLevel = peakLevel_.load();
+    currentStats_.averageLevel = averageLevel_.load();
+    currentStats_.hasClipping = hasClipping_.load();
 }
 
 void AudioRecorderManager::notifyRecordingEvent(const std::string& event, const std::string& data) {
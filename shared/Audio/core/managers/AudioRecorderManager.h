@@ -2,6 +2,7 @@
 
 
 #include "../../common/config/AudioConfig.hpp"
+#include "../../common/dsp/VoiceActivityDetector.hpp"
 #include "../../common/jsi/JSICallbackManager.h"
 #include <atomic>
 #include <functional>
@@ -37,6 +38,13 @@ public:
     bool isRecording() const;
     bool isPaused() const;
 
+    // === Données audio (thread audio, sans verrou ni allocation) ===
+    // Met à jour les niveaux ; false si le bloc ne doit pas être écrit (arrêt, pause, silence sauté)
+    bool processRecordingBlock(const float* interleaved, size_t frameCount);
+    void setSilenceSkipping(bool enabled);
+    bool isSilenceSkippingEnabled() const;
+    uint32_t getSkippedSilenceMs() const;
+
     // === État et informations ===
     std::string getRecordingState() const;
     uint32_t getCurrentDuration() const;
@@ -95,6 +103,16 @@ private:
 
     // Statistiques
     RecordingStats currentStats_;
+
+    // Niveaux et détection de silence, écrits par le thread audio
+    Nyth::Audio::FX::VoiceActivityDetector silenceDetector_;
+    std::atomic<bool> skipSilence_{false};
+    std::atomic<uint64_t> skippedFrames_{0};
+    std::atomic<float> peakLevel_{0.0f};
+    std::atomic<float> averageLevel_{0.0f};
+    std::atomic<bool> hasClipping_{false};
+    double levelSumSquares_ = 0.0;
+    uint64_t levelSampleCount_ = 0;
     RecordingCallback recordingCallback_;
 
     // Gestionnaire de fichiers audio (si disponible)
@@ -236,7 +236,13 @@ jsi::Value NativeAudioEffectsModule::createEffect(jsi::Runtime& rt, const jsi::O
         if (effectId >= 0) {
             // Configurer l'effet si nécessaire
             if (config.hasProperty(rt, "enabled") || config.hasProperty(rt, "compressor") ||
-                config.hasProperty(rt, "delay") || config.hasProperty(rt, "reverb")) {
+                config.hasProperty(rt, "delay") || config.hasProperty(rt, "reverb") ||
+                config.hasProperty(rt, "multiband") || config.hasProperty(rt, "convolution") ||
+                config.hasProperty(rt, "limiter") || config.hasProperty(rt, "pitch") ||
+                config.hasProperty(rt, "chorus") || config.hasProperty(rt, "flanger") ||
+                config.hasProperty(rt, "phaser") || config.hasProperty(rt, "strip") ||
+                config.hasProperty(rt, "expander") || config.hasProperty(rt, "gate") ||
+                config.hasProperty(rt, "transient") || config.hasProperty(rt, "imager")) {
                 effectManager_->setEffectConfig(rt, effectId, config);
             }
         }
@@ -367,6 +373,8 @@ jsi::Value NativeAudioEffectsModule::processAudio(jsi::Runtime& rt, const jsi::A
             // Traitement mono
             std::vector<float> outputVector(inputVector.size());
             bool success = effectManager_->processAudio(inputVector.data(), outputVector.data(), frameCount, 1);
+            // Thread JS : le callback de métriques n'est jamais appelé depuis le chemin audio
+            effectManager_->dispatchMetrics();
             return success ? EffectsJSIConverter::vectorToArray(rt, outputVector) : jsi::Value::null(rt);
         } else {
             // Traitement stéréo
@@ -383,6 +391,7 @@ jsi::Value NativeAudioEffectsModule::processAudio(jsi::Runtime& rt, const jsi::A
 
             bool success = effectManager_->processAudioStereo(leftInput.data(), rightInput.data(), leftOutput.data(),
                                                               rightOutput.data(), frameCount);
+            effectManager_->dispatchMetrics();
 
             if (success) {
                 // Réentrelacer
@@ -419,6 +428,7 @@ jsi::Value NativeAudioEffectsModule::processAudioStereo(jsi::Runtime& rt, const
 
         bool success = effectManager_->processAudioStereo(leftVector.data(), rightVector.data(), leftOutput.data(),
                                                           rightOutput.data(), frameCount);
+        effectManager_->dispatchMetrics();
 
         jsi::Object result(rt);
         if (success) {
@@ -608,11 +618,8 @@ jsi::Value NativeAudioEffectsModule::getReverbConfig(jsi::Runtime& rt, int effec
             return jsi::Value::null(rt);
         }
 
-        // TODO: Implémenter quand ReverbEffect sera disponible
-        // Pour l'instant, retourner un objet vide
-        jsi::Object result(rt);
-        result.setProperty(rt, "enabled", jsi::Value(false));
-        return std::move(result);
+        // Utiliser l'API de l'EffectManager qui lit les paramètres réels
+        return effectManager_->getReverbParameters(rt, effectId);
 
     } catch (const std::exception& e) {
         handleError(11, std::string("Get reverb config failed: ") + e.what());
@@ -877,6 +884,24 @@ jsi::Value NativeAudioEffectsModule::getDelayParameters(jsi::Runtime& rt, int ef
     return effectManager_->getDelayParameters(rt, effectId);
 }
 
+jsi::Value NativeAudioEffectsModule::scheduleEffectParameter(jsi::Runtime& rt, int effectId, const std::string& name,
+                                                            float value, double sampleTime) {
+    if (!effectManager_) {
+        return jsi::Value(false);
+    }
+
+    // sampleTime : position absolue de getSamplePosition() ; <= 0 : dès le prochain bloc
+    return jsi::Value(
+        effectManager_->scheduleEffectParameter(effectId, name, value, static_cast<int64_t>(sampleTime)));
+}
+
+jsi::Value NativeAudioEffectsModule::getSamplePosition(jsi::Runtime& rt) {
+    if (!effectManager_) {
+        return jsi::Value(0.0);
+    }
+    return jsi::Value(static_cast<double>(effectManager_->getSamplePosition()));
+}
+
 // === Fonction d'enregistrement du module ===
 std::shared_ptr<TurboModule> NativeAudioEffectsModuleProvider(std::shared_ptr<CallInvoker> jsInvoker) {
     auto module = std::make_shared<NativeAudioEffectsModule>(jsInvoker);
@@ -222,6 +222,11 @@ public:
     jsi::Value setDelayParameters(jsi::Runtime& rt, int effectId, float delayMs, float feedback, float mix);
     jsi::Value getDelayParameters(jsi::Runtime& rt, int effectId);
 
+    // === Automation à l'échantillon près ===
+    jsi::Value scheduleEffectParameter(jsi::Runtime& rt, int effectId, const std::string& name, float value,
+                                       double sampleTime);
+    jsi::Value getSamplePosition(jsi::Runtime& rt);
+
     // === Installation du module ===
     static jsi::Value install(jsi::Runtime& rt, std::shared_ptr<CallInvoker> jsInvoker);
 
@@ -0,0 +1,233 @@
+#pragma once
+
+// C++17 standard headers
+#include "Compressor.hpp"
+#include "FusedEffectChain.hpp"
+#include "Limiter.hpp"
+#include "../../common/config/EffectConstants.hpp"
+#include "../config/EffectsLimits.h" // Source of truth for default values
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+
+namespace Nyth { namespace Audio { namespace FX {
+
+/**
+ * @brief Transposed direct form II biquad section, float state per channel
+ *
+ * Coefficients are designed in double (RBJ cookbook) and stored normalized
+ * (a0 = 1). processSample() is small enough to be inlined by FusedEffectChain.
+ */
+class BiquadSection {
+public:
+    void reset() noexcept {
+        std::fill_n(s1_, Nyth::Audio::FX::STEREO_CHANNELS, 0.0f);
+        std::fill_n(s2_, Nyth::Audio::FX::STEREO_CHANNELS, 0.0f);
+    }
+
+    void setHighPass(double frequencyHz, double q, double sampleRate) noexcept {
+        const double w0 = 2.0 * Nyth::Audio::FX::PI * frequencyHz / sampleRate;
+        const double cosW = std::cos(w0);
+        const double alpha = std::sin(w0) / (2.0 * q);
+        setNormalized(0.5 * (1.0 + cosW), -(1.0 + cosW), 0.5 * (1.0 + cosW), 1.0 + alpha, -2.0 * cosW, 1.0 - alpha);
+    }
+
+    void setPeaking(double frequencyHz, double q, double gainDb, double sampleRate) noexcept {
+        const double a = std::pow(10.0, gainDb / 40.0);
+        const double w0 = 2.0 * Nyth::Audio::FX::PI * frequencyHz / sampleRate;
+        const double cosW = std::cos(w0);
+        const double alpha = std::sin(w0) / (2.0 * q);
+        setNormalized(1.0 + alpha * a, -2.0 * cosW, 1.0 - alpha * a, 1.0 + alpha / a, -2.0 * cosW, 1.0 - alpha / a);
+    }
+
+    float processSample(int channel, float x) noexcept {
+        const float y = b0_ * x + s1_[channel];
+        s1_[channel] = b1_ * x - a1_ * y + s2_[channel];
+        s2_[channel] = b2_ * x - a2_ * y;
+        return y;
+    }
+
+private:
+    void setNormalized(double b0, double b1, double b2, double a0, double a1, double a2) noexcept {
+        const double inv = 1.0 / a0;
+        b0_ = static_cast<float>(b0 * inv);
+        b1_ = static_cast<float>(b1 * inv);
+        b2_ = static_cast<float>(b2 * inv);
+        a1_ = static_cast<float>(a1 * inv);
+        a2_ = static_cast<float>(a2 * inv);
+    }
+
+    float b0_ = 1.0f, b1_ = 0.0f, b2_ = 0.0f, a1_ = 0.0f, a2_ = 0.0f;
+    float s1_[Nyth::Audio::FX::STEREO_CHANNELS] = {};
+    float s2_[Nyth::Audio::FX::STEREO_CHANNELS] = {};
+};
+
+// Passe-haut Butterworth du 2e ordre (étage par échantillon)
+class HighPassStage {
+public:
+    static constexpr bool PER_SAMPLE = true;
+
+    // Paramètres automatisables (FusedEffectChain::stageParameter)
+    enum class Param : uint32_t { FREQUENCY_HZ = 0 };
+
+    void prepare(double sampleRate) noexcept {
+        sampleRate_ = sampleRate;
+        updateCoefficients();
+        section_.reset();
+    }
+    void reset() noexcept {
+        section_.reset();
+    }
+
+    void setFrequency(double frequencyHz) noexcept {
+        frequencyHz_ = std::max(static_cast<double>(Nyth::Audio::Effects::ChannelStrip::MIN_HIGHPASS_HZ),
+                                std::min(static_cast<double>(Nyth::Audio::Effects::ChannelStrip::MAX_HIGHPASS_HZ),
+                                         frequencyHz));
+        updateCoefficients();
+    }
+    [[nodiscard]] float getFrequency() const noexcept {
+        return static_cast<float>(frequencyHz_);
+    }
+
+    void setParameter(uint32_t paramId, float value) noexcept {
+        if (static_cast<Param>(paramId) == Param::FREQUENCY_HZ) {
+            setFrequency(value);
+        }
+    }
+
+    float processSample(int channel, float x) noexcept {
+        return section_.processSample(channel, x);
+    }
+
+private:
+    void updateCoefficients() noexcept {
+        section_.setHighPass(frequencyHz_, BUTTERWORTH_Q, sampleRate_);
+    }
+
+    static constexpr double BUTTERWORTH_Q = 0.70710678118654752;
+
+    double frequencyHz_ = Nyth::Audio::Effects::ChannelStrip::DEFAULT_HIGHPASS_HZ;
+    double sampleRate_ = static_cast<double>(Nyth::Audio::FX::DEFAULT_SAMPLE_RATE);
+    BiquadSection section_;
+};
+
+// Égaliseur à Bands cloches en série (étage par échantillon, boucle de bandes déroulée)
+template <size_t Bands>
+class PeakingEqStage {
+public:
+    static constexpr bool PER_SAMPLE = true;
+    static constexpr size_t NUM_BANDS = Bands;
+
+    struct Band {
+        float frequencyHz;
+        float gainDb;
+        float q;
+    };
+
+    // Paramètres automatisables d'une bande : identifiant = bandParameter(param, bande)
+    enum class Param : uint32_t { FREQUENCY_HZ = 0, GAIN_DB, Q };
+    static constexpr uint32_t PARAMS_PER_BAND = 3;
+
+    static constexpr uint32_t bandParameter(Param param, size_t band) noexcept {
+        return static_cast<uint32_t>(band) * PARAMS_PER_BAND + static_cast<uint32_t>(param);
+    }
+
+    PeakingEqStage() {
+        for (size_t b = 0; b < Bands; ++b) {
+            bands_[b] = Band{Nyth::Audio::Effects::ChannelStrip::DEFAULT_EQ_FREQS_HZ[std::min(
+                                 b, Nyth::Audio::Effects::ChannelStrip::EQ_BANDS - 1)],
+                             Nyth::Audio::Effects::ChannelStrip::DEFAULT_EQ_GAIN_DB,
+                             Nyth::Audio::Effects::ChannelStrip::DEFAULT_EQ_Q};
+        }
+    }
+
+    void prepare(double sampleRate) noexcept {
+        sampleRate_ = sampleRate;
+        for (size_t b = 0; b < Bands; ++b) {
+            updateBand(b);
+            sections_[b].reset();
+        }
+    }
+    void reset() noexcept {
+        for (auto& section : sections_) {
+            section.reset();
+        }
+    }
+
+    void setBand(size_t index, double frequencyHz, double gainDb, double q) noexcept {
+        if (index >= Bands) {
+            return;
+        }
+        bands_[index].frequencyHz = static_cast<float>(
+            std::max(static_cast<double>(Nyth::Audio::Effects::ChannelStrip::MIN_EQ_FREQ_HZ),
+                     std::min(static_cast<double>(Nyth::Audio::Effects::ChannelStrip::MAX_EQ_FREQ_HZ), frequencyHz)));
+        bands_[index].gainDb = static_cast<float>(
+            std::max(static_cast<double>(Nyth::Audio::Effects::ChannelStrip::MIN_EQ_GAIN_DB),
+                     std::min(static_cast<double>(Nyth::Audio::Effects::ChannelStrip::MAX_EQ_GAIN_DB), gainDb)));
+        bands_[index].q = static_cast<float>(
+            std::max(static_cast<double>(Nyth::Audio::Effects::ChannelStrip::MIN_EQ_Q),
+                     std::min(static_cast<double>(Nyth::Audio::Effects::ChannelStrip::MAX_EQ_Q), q)));
+        updateBand(index);
+    }
+    [[nodiscard]] Band getBand(size_t index) const noexcept {
+        return bands_[std::min(index, Bands - 1)];
+    }
+
+    void setParameter(uint32_t paramId, float value) noexcept {
+        const size_t band = paramId / PARAMS_PER_BAND;
+        if (band >= Bands) {
+            return;
+        }
+        Band b = bands_[band];
+        switch (static_cast<Param>(paramId % PARAMS_PER_BAND)) {
+            case Param::FREQUENCY_HZ:
+                b.frequencyHz = value;
+                break;
+            case Param::GAIN_DB:
+                b.gainDb = value;
+                break;
+            case Param::Q:
+                b.q = value;
+                break;
+        }
+        setBand(band, b.frequencyHz, b.gainDb, b.q);
+    }
+
+    float processSample(int channel, float x) noexcept {
+        for (size_t b = 0; b < Bands; ++b) {
+            x = sections_[b].processSample(channel, x);
+        }
+        return x;
+    }
+
+private:
+    void updateBand(size_t index) noexcept {
+        // Fréquence bornée sous Nyquist pour les fréquences d'échantillonnage basses
+        const double frequency = std::min(static_cast<double>(bands_[index].frequencyHz),
+                                          Nyth::Audio::FX::CHANNEL_STRIP_MAX_NORMALIZED_FREQ * sampleRate_);
+        sections_[index].setPeaking(frequency, bands_[index].q, bands_[index].gainDb, sampleRate_);
+    }
+
+    Band bands_[Bands];
+    double sampleRate_ = static_cast<double>(Nyth::Audio::FX::DEFAULT_SAMPLE_RATE);
+    BiquadSection sections_[Bands];
+};
+
+/**
+ * @brief Production channel strip: HPF -> 4-band EQ -> compressor -> limiter, fused
+ *
+ * The two filter stages run in one per-sample loop, then the compressor and
+ * the true-peak limiter process the same L1-resident sub-block through direct
+ * calls. Stages are reached with stage<ChannelStripStages::X>().
+ */
+using ChannelStripEffect = FusedEffectChain<HighPassStage, PeakingEqStage<Nyth::Audio::Effects::ChannelStrip::EQ_BANDS>,
+                                            CompressorEffect, LimiterEffect>;
+
+struct ChannelStripStages {
+    static constexpr size_t HIGH_PASS = 0;
+    static constexpr size_t EQUALIZER = 1;
+    static constexpr size_t COMPRESSOR = 2;
+    static constexpr size_t LIMITER = 3;
+};
+
+}}} // namespace Nyth { namespace Audio { namespace FX
@@ -0,0 +1,191 @@
+#pragma once
+
+// C++17 standard headers
+#include "EffectBase.hpp"
+#include "../../common/config/EffectConstants.hpp"
+#include "../../common/dsp/BlockLfo.hpp"
+#include "../../common/dsp/FractionalDelayLine.hpp"
+#include "../config/EffectsLimits.h" // Source of truth for default values
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+namespace Nyth { namespace Audio { namespace FX {
+
+/**
+ * @brief Multi-voice chorus on modulated fractional delays
+ *
+ * Up to four voices read the same delay line per channel, each at
+ * baseDelay + depth * (1 + lfo) / 2 with the LFO phase spread evenly across
+ * voices; the right channel runs a quarter cycle later for width. LFO values
+ * for every voice are rendered once per MODULATION_BLOCK_SIZE sub-block from
+ * the shared BlockLfo, and the taps are Hermite reads from a line allocated in
+ * setSampleRate() for the maximum delay + depth.
+ */
+class ChorusEffect final : public IAudioEffect {
+public:
+    using IAudioEffect::processMono;   // évite le masquage des surcharges (templates span)
+    using IAudioEffect::processStereo; // idem
+
+    // Paramètres automatisables (scheduleParameter)
+    enum class Param : uint32_t { RATE_HZ = 0, DEPTH_MS, DELAY_MS, VOICES, MIX };
+
+    struct ChorusParameters {
+        float rateHz;
+        float depthMs;
+        float delayMs;
+        size_t voices;
+        float mix;
+    };
+
+    ChorusEffect() {
+        lfo_.setRate(rateHz_);
+        updateCoefficients();
+    }
+
+    void setParameters(double rateHz, double depthMs, double delayMs, size_t voices, double mix) noexcept {
+        rateHz_ = std::max(static_cast<double>(Nyth::Audio::Effects::Chorus::MIN_RATE_HZ),
+                           std::min(static_cast<double>(Nyth::Audio::Effects::Chorus::MAX_RATE_HZ), rateHz));
+        depthMs_ = std::max(static_cast<double>(Nyth::Audio::Effects::Chorus::MIN_DEPTH_MS),
+                            std::min(static_cast<double>(Nyth::Audio::Effects::Chorus::MAX_DEPTH_MS), depthMs));
+        delayMs_ = std::max(static_cast<double>(Nyth::Audio::Effects::Chorus::MIN_DELAY_MS),
+                            std::min(static_cast<double>(Nyth::Audio::Effects::Chorus::MAX_DELAY_MS), delayMs));
+        voices_ = std::max(Nyth::Audio::Effects::Chorus::MIN_VOICES,
+                           std::min(Nyth::Audio::Effects::Chorus::MAX_VOICES, voices));
+        mix_ = std::max(static_cast<double>(Nyth::Audio::Effects::Chorus::MIN_MIX),
+                        std::min(static_cast<double>(Nyth::Audio::Effects::Chorus::MAX_MIX), mix));
+        lfo_.setRate(rateHz_);
+        updateCoefficients();
+    }
+
+    [[nodiscard]] ChorusParameters getParameters() const noexcept {
+        return ChorusParameters{
+            .rateHz = static_cast<float>(rateHz_),
+            .depthMs = static_cast<float>(depthMs_),
+            .delayMs = static_cast<float>(delayMs_),
+            .voices = voices_,
+            .mix = static_cast<float>(mix_)
+        };
+    }
+
+    void setSampleRate(uint32_t sampleRate, int numChannels) noexcept override {
+        IAudioEffect::setSampleRate(sampleRate, numChannels);
+        lfo_.setSampleRate(static_cast<double>(sampleRate_));
+        lfo_.reset();
+        const double maxMs = static_cast<double>(Nyth::Audio::Effects::Chorus::MAX_DELAY_MS) +
+                             static_cast<double>(Nyth::Audio::Effects::Chorus::MAX_DEPTH_MS);
+        const size_t maxDelay =
+            static_cast<size_t>(std::ceil(maxMs * static_cast<double>(sampleRate_) / 1000.0)) + 1;
+        for (auto& line : lines_) {
+            line.prepare(maxDelay);
+        }
+        updateCoefficients();
+    }
+
+    void processMono(const float* input, float* output, size_t numSamples) override {
+        if (!isEnabled() || !input || !output || numSamples == 0 || !lines_[0].isPrepared()) {
+            if (output != input && input && output) {
+                std::copy_n(input, numSamples, output);
+            }
+            return;
+        }
+        for (size_t offset = 0; offset < numSamples; offset += BLOCK) {
+            const size_t n = std::min(BLOCK, numSamples - offset);
+            processChannel(0, 0.0, input + offset, output + offset, n);
+            lfo_.advance(n);
+        }
+    }
+
+    void processStereo(const float* inL, const float* inR, float* outL, float* outR, size_t numSamples) override {
+        if (!isEnabled() || !inL || !inR || !outL || !outR || numSamples == 0 || !lines_[0].isPrepared()) {
+            if (outL != inL && inL && outL)
+                std::copy_n(inL, numSamples, outL);
+            if (outR != inR && inR && outR)
+                std::copy_n(inR, numSamples, outR);
+            return;
+        }
+        for (size_t offset = 0; offset < numSamples; offset += BLOCK) {
+            const size_t n = std::min(BLOCK, numSamples - offset);
+            processChannel(0, 0.0, inL + offset, outL + offset, n);
+            processChannel(1, Nyth::Audio::FX::MODULATION_STEREO_PHASE, inR + offset, outR + offset, n);
+            lfo_.advance(n);
+        }
+    }
+
+protected:
+    void applyParameter(uint32_t paramId, float value) noexcept override {
+        switch (static_cast<Param>(paramId)) {
+            case Param::RATE_HZ:
+                setParameters(value, depthMs_, delayMs_, voices_, mix_);
+                break;
+            case Param::DEPTH_MS:
+                setParameters(rateHz_, value, delayMs_, voices_, mix_);
+                break;
+            case Param::DELAY_MS:
+                setParameters(rateHz_, depthMs_, value, voices_, mix_);
+                break;
+            case Param::VOICES:
+                setParameters(rateHz_, depthMs_, delayMs_, static_cast<size_t>(std::max(0.0f, value) + 0.5f), mix_);
+                break;
+            case Param::MIX:
+                setParameters(rateHz_, depthMs_, delayMs_, voices_, value);
+                break;
+        }
+    }
+
+private:
+    static constexpr size_t BLOCK = Nyth::Audio::FX::MODULATION_BLOCK_SIZE;
+    static constexpr size_t MAX_VOICES = Nyth::Audio::Effects::Chorus::MAX_VOICES;
+
+    void updateCoefficients() noexcept {
+        const float samplesPerMs = static_cast<float>(sampleRate_) / 1000.0f;
+        // Retard d'une voix : centre + demi-excursion . lfo, soit [base, base + profondeur]
+        halfDepth_ = 0.5f * static_cast<float>(depthMs_) * samplesPerMs;
+        center_ = static_cast<float>(delayMs_) * samplesPerMs + halfDepth_;
+        voiceGain_ = 1.0f / static_cast<float>(voices_);
+    }
+
+    // Toutes les voix lisent la ligne avant l'écriture de l'échantillon courant (in == out autorisé)
+    void processChannel(int channel, double phaseOffset, const float* x, float* y, size_t n) noexcept {
+        const size_t voices = voices_;
+        for (size_t v = 0; v < voices; ++v) {
+            lfo_.render(modulation_[v], n, phaseOffset + static_cast<double>(v) / static_cast<double>(voices));
+            for (size_t i = 0; i < n; ++i) {
+                modulation_[v][i] = center_ + halfDepth_ * modulation_[v][i];
+            }
+        }
+
+        FractionalDelayLine& line = lines_[channel];
+        const float wet = static_cast<float>(mix_) * voiceGain_;
+        const float dry = 1.0f - static_cast<float>(mix_);
+        for (size_t i = 0; i < n; ++i) {
+            float sum = 0.0f;
+            for (size_t v = 0; v < voices; ++v) {
+                sum += line.read(modulation_[v][i]);
+            }
+            const float in = x[i];
+            line.write(in);
+            y[i] = dry * in + wet * sum;
+        }
+    }
+
+    // params
+    double rateHz_ = Nyth::Audio::Effects::Chorus::DEFAULT_RATE_HZ;
+    double depthMs_ = Nyth::Audio::Effects::Chorus::DEFAULT_DEPTH_MS;
+    double delayMs_ = Nyth::Audio::Effects::Chorus::DEFAULT_DELAY_MS;
+    size_t voices_ = Nyth::Audio::Effects::Chorus::DEFAULT_VOICES;
+    double mix_ = Nyth::Audio::Effects::Chorus::DEFAULT_MIX;
+
+    // derived coefficients
+    float center_ = 0.0f;
+    float halfDepth_ = 0.0f;
+    float voiceGain_ = 1.0f;
+
+    // state
+    BlockLfo lfo_;
+    FractionalDelayLine lines_[Nyth::Audio::FX::STEREO_CHANNELS];
+    alignas(16) float modulation_[MAX_VOICES][BLOCK] = {};
+};
+
+}}} // namespace Nyth { namespace Audio { namespace FX
@@ -3,36 +3,60 @@
 // C++17 standard headers
 #include "EffectBase.hpp"
 #include "../../common/config/EffectConstants.hpp"
+#include "../../common/dsp/DynamicsDetector.hpp"
+#include "../../common/dsp/VectorMath.hpp"
 #include "../config/EffectsLimits.h" // Source of truth for default values
 #include <algorithm>
+#include <atomic>
 #include <cmath>
 #include <string>
 #include <type_traits>
 #include <vector>
 
-
-// Compatibilité macOS/Clang
-#ifdef __has_builtin
-#if __has_builtin(__builtin_prefetch)
-#define AUDIO_PREFETCH(addr, rw, locality) __builtin_prefetch(addr, rw, locality)
-#else
-#define AUDIO_PREFETCH(addr, rw, locality) ((void)0)
-#endif
-#else
-#ifdef __GNUC__
-#define AUDIO_PREFETCH(addr, rw, locality) __builtin_prefetch(addr, rw, locality)
-#else
-#define AUDIO_PREFETCH(addr, rw, locality) ((void)0)
-#endif
-#endif
-
 namespace Nyth { namespace Audio { namespace FX {
 
+/**
+ * @brief Feed-forward compressor with soft knee, lookahead and linked stereo detection
+ *
+ * Work is done per sub-block of COMPRESSOR_BLOCK_SIZE samples:
+ *  1. side-chain level (|x|, stereo max, or stereo power averaged over the
+ *     RMS window, Dynamics kernels),
+ *  2. level -> dB with the vectorized log2 kernel,
+ *  3. static soft-knee curve in dB (branch-free, vectorizable),
+ *  4. attack/release smoothing of the gain reduction in dB (only serial step),
+ *  5. dB -> linear gain with the vectorized exp2 kernel, applied to the
+ *     (optionally lookahead-delayed) signal.
+ * No per-sample transcendental calls remain on the audio path.
+ */
 class CompressorEffect final : public IAudioEffect {
 public:
     using IAudioEffect::processMono;   // évite le masquage des surcharges (templates span)
     using IAudioEffect::processStereo; // idem
 
+    // Combinaison des canaux pour la détection stéréo
+    enum class StereoLink {
+        MAX, // max(|L|, |R|) : aucun canal ne dépasse la courbe
+        RMS  // (L² + R²) / 2 moyennée sur la fenêtre RMS : image plus stable
+    };
+
+    // Paramètres automatisables (scheduleParameter)
+    // STEREO_LINK : valeur de StereoLink (0 = MAX, 1 = RMS)
+    enum class Param : uint32_t {
+        THRESHOLD_DB = 0,
+        RATIO,
+        ATTACK_MS,
+        RELEASE_MS,
+        MAKEUP_DB,
+        KNEE_DB,
+        LOOKAHEAD_MS,
+        STEREO_LINK,
+        RMS_WINDOW_MS
+    };
+
+    CompressorEffect() {
+        updateCoefficients();
+    }
+
     // === Structure des métriques ===
     struct CompressorMetrics {
         float inputLevel = 0.0f;      // Niveau d'entrée en dB
@@ -44,16 +68,21 @@ public:
         CompressorMetrics() = default;
     };
 
-    // === Accès aux métriques ===
+    // === Accès aux métriques (niveaux publiés par le thread audio à chaque bloc) ===
     CompressorMetrics getMetrics() const {
-        return CompressorMetrics{
-            .inputLevel = 20.0f * std::log10(std::max(envL_, Nyth::Audio::FX::EPSILON_DB)),
-            .outputLevel = 20.0f * std::log10(std::max(envL_ * gainL_, Nyth::Audio::FX::EPSILON_DB)),
-            .gainReduction = 20.0f * std::log10(std::max(gainL_, Nyth::Audio::FX::EPSILON_DB)),
-            .compressionRatio = ratio_,
-            .isActive = isEnabled() && (envL_ > thresholdDb_)
-        };
+        CompressorMetrics metrics;
+        metrics.inputLevel = meterLevelDb_.load(std::memory_order_relaxed);
+        metrics.outputLevel = meterOutputDb_.load(std::memory_order_relaxed);
+        metrics.gainReduction = getGainReductionDb();
+        metrics.compressionRatio = static_cast<float>(ratio_);
+        metrics.isActive = isEnabled() && (metrics.gainReduction < Nyth::Audio::FX::GAIN_REDUCTION_ACTIVE_DB);
+        return metrics;
     }
+
+    [[nodiscard]] float getGainReductionDb() const noexcept {
+        return meterGainReductionDb_.load(std::memory_order_relaxed);
+    }
+
     void setParameters(double thresholdDb, double ratio, double attackMs, double releaseMs, double makeupDb) noexcept {
         thresholdDb_ = thresholdDb;
         ratio_ = std::max(Nyth::Audio::FX::MIN_RATIO, ratio);
@@ -63,6 +92,36 @@ public:
         updateCoefficients();
     }
 
+    // Largeur du genou en dB (0 = genou dur)
+    void setKnee(double kneeDb) noexcept {
+        kneeDb_ = std::max(static_cast<double>(Nyth::Audio::Effects::Compressor::MIN_KNEE_DB),
+                           std::min(static_cast<double>(Nyth::Audio::Effects::Compressor::MAX_KNEE_DB), kneeDb));
+        updateCoefficients();
+    }
+
+    // Retard d'anticipation ; la ligne est déjà allouée au maximum, aucun realloc ici
+    void setLookahead(double lookaheadMs) noexcept {
+        lookaheadMs_ = std::max(static_cast<double>(Nyth::Audio::Effects::Compressor::MIN_LOOKAHEAD_MS),
+                                std::min(static_cast<double>(Nyth::Audio::Effects::Compressor::MAX_LOOKAHEAD_MS),
+                                         lookaheadMs));
+        updateLookahead();
+    }
+
+    void setStereoLink(StereoLink link) noexcept {
+        stereoLink_ = link;
+    }
+    [[nodiscard]] StereoLink getStereoLink() const noexcept {
+        return stereoLink_;
+    }
+
+    // Constante de temps de la moyenne de puissance en liaison RMS
+    void setRmsWindow(double rmsWindowMs) noexcept {
+        rmsWindowMs_ = std::max(static_cast<double>(Nyth::Audio::Effects::Compressor::MIN_RMS_WINDOW_MS),
+                                std::min(static_cast<double>(Nyth::Audio::Effects::Compressor::MAX_RMS_WINDOW_MS),
+                                         rmsWindowMs));
+        updateCoefficients();
+    }
+
     // Structure pour récupérer les paramètres actuels
     struct CompressorParameters {
         float thresholdDb;
@@ -70,6 +129,9 @@ public:
         float attackMs;
         float releaseMs;
         float makeupDb;
+        float kneeDb;
+        float lookaheadMs;
+        float rmsWindowMs;
     };
 
     // === Getter pour récupérer les paramètres actuels ===
@@ -79,15 +141,37 @@ public:
             .ratio = static_cast<float>(ratio_),
             .attackMs = static_cast<float>(attackMs_),
             .releaseMs = static_cast<float>(releaseMs_),
-            .makeupDb = static_cast<float>(makeupDb_)
+            .makeupDb = static_cast<float>(makeupDb_),
+            .kneeDb = static_cast<float>(kneeDb_),
+            .lookaheadMs = static_cast<float>(lookaheadMs_),
+            .rmsWindowMs = static_cast<float>(rmsWindowMs_)
         };
     }
 
     void setSampleRate(uint32_t sampleRate, int numChannels) noexcept override {
         IAudioEffect::setSampleRate(sampleRate, numChannels);
         updateCoefficients();
-        envL_ = envR_ = DEFAULT_ENVELOPE;
-        gainL_ = gainR_ = DEFAULT_GAIN;
+
+        // Ligne d'anticipation dimensionnée pour MAX_LOOKAHEAD_MS + un sous-bloc
+        const size_t maxLookahead = static_cast<size_t>(std::ceil(
+            Nyth::Audio::Effects::Compressor::MAX_LOOKAHEAD_MS * static_cast<double>(sampleRate_) /
+            Nyth::Audio::FX::MS_TO_SECONDS_COMPRESSOR));
+        for (auto& line : lookaheadLines_) {
+            line.assign(maxLookahead + Nyth::Audio::FX::COMPRESSOR_BLOCK_SIZE, 0.0f);
+        }
+        lookaheadWrite_ = 0;
+        updateLookahead();
+
+        gainReductionDb_ = 0.0f;
+        levelDb_ = Nyth::Audio::FX::SILENCE_LEVEL_DB;
+        makeupSmoothDb_ = static_cast<float>(makeupDb_);
+        rmsAverage_.reset();
+        publishMeters();
+    }
+
+    // Latence introduite par l'anticipation
+    [[nodiscard]] uint32_t getLatencySamples() const noexcept override {
+        return static_cast<uint32_t>(lookaheadSamples_);
     }
 
     // C++17 modernized processing methods
@@ -130,124 +214,88 @@ public:
             return;
         }
 
-        // Optimized processing with loop unrolling
-        size_t i = 0;
-
-        // Process samples in blocks for better pipelining
-        for (; i + (Nyth::Audio::FX::UNROLL_BLOCK_SIZE - 1) < numSamples; i += Nyth::Audio::FX::UNROLL_BLOCK_SIZE) {
-            // Prefetch next block
-            if (i + Nyth::Audio::FX::PREFETCH_DISTANCE < numSamples) {
-                AUDIO_PREFETCH(&input[i + Nyth::Audio::FX::PREFETCH_DISTANCE], 0, 1);
+        for (size_t offset = 0; offset < numSamples; offset += Nyth::Audio::FX::COMPRESSOR_BLOCK_SIZE) {
+            const size_t n = std::min(Nyth::Audio::FX::COMPRESSOR_BLOCK_SIZE, numSamples - offset);
+            const float* x = input + offset;
+            float* y = output + offset;
+
+            Dynamics::rectify(x, sidechain_, n);
+            delayBlock(0, x, y, n);
+            advanceLookahead(n);
+            computeGains(sidechain_, n, 1.0f);
+            for (size_t i = 0; i < n; ++i) {
+                y[i] *= sidechain_[i];
             }
-
-            // Process samples in current block
-            double x0 = static_cast<double>(input[i]);
-            double x1 = static_cast<double>(input[i + 1]);
-            double x2 = static_cast<double>(input[i + 2]);
-            double x3 = static_cast<double>(input[i + 3]);
-
-            double ax0 = std::abs(x0) + Nyth::Audio::FX::EPSILON_DB;
-            double ax1 = std::abs(x1) + Nyth::Audio::FX::EPSILON_DB;
-            double ax2 = std::abs(x2) + Nyth::Audio::FX::EPSILON_DB;
-            double ax3 = std::abs(x3) + Nyth::Audio::FX::EPSILON_DB;
-
-            // Envelope follower for each sample
-            double coeff0 = (ax0 > envL_) ? attackCoeff_ : releaseCoeff_;
-            envL_ = coeff0 * envL_ + (Nyth::Audio::FX::DEFAULT_GAIN - coeff0) * ax0;
-            double levelDb0 = Nyth::Audio::FX::DB_CONVERSION_FACTOR * std::log10(envL_);
-
-            double coeff1 = (ax1 > envL_) ? attackCoeff_ : releaseCoeff_;
-            envL_ = coeff1 * envL_ + (Nyth::Audio::FX::DEFAULT_GAIN - coeff1) * ax1;
-            double levelDb1 = Nyth::Audio::FX::DB_CONVERSION_FACTOR * std::log10(envL_);
-
-            double coeff2 = (ax2 > envL_) ? attackCoeff_ : releaseCoeff_;
-            envL_ = coeff2 * envL_ + (Nyth::Audio::FX::DEFAULT_GAIN - coeff2) * ax2;
-            double levelDb2 = Nyth::Audio::FX::DB_CONVERSION_FACTOR * std::log10(envL_);
-
-            double coeff3 = (ax3 > envL_) ? attackCoeff_ : releaseCoeff_;
-            envL_ = coeff3 * envL_ + (Nyth::Audio::FX::DEFAULT_GAIN - coeff3) * ax3;
-            double levelDb3 = Nyth::Audio::FX::DB_CONVERSION_FACTOR * std::log10(envL_);
-
-            // Apply compression curve
-            double outDb0 = (levelDb0 > thresholdDb_) ? thresholdDb_ + (levelDb0 - thresholdDb_) / ratio_ : levelDb0;
-            double outDb1 = (levelDb1 > thresholdDb_) ? thresholdDb_ + (levelDb1 - thresholdDb_) / ratio_ : levelDb1;
-            double outDb2 = (levelDb2 > thresholdDb_) ? thresholdDb_ + (levelDb2 - thresholdDb_) / ratio_ : levelDb2;
-            double outDb3 = (levelDb3 > thresholdDb_) ? thresholdDb_ + (levelDb3 - thresholdDb_) / ratio_ : levelDb3;
-
-            // Calculate gains
-            double gainDb0 = (outDb0 - levelDb0) + makeupDb_;
-            double gainDb1 = (outDb1 - levelDb1) + makeupDb_;
-            double gainDb2 = (outDb2 - levelDb2) + makeupDb_;
-            double gainDb3 = (outDb3 - levelDb3) + makeupDb_;
-
-            double gTarget0 = std::pow(Nyth::Audio::FX::POWER_CONVERSION_BASE, gainDb0 / Nyth::Audio::FX::DB_CONVERSION_FACTOR);
-            double gTarget1 = std::pow(Nyth::Audio::FX::POWER_CONVERSION_BASE, gainDb1 / Nyth::Audio::FX::DB_CONVERSION_FACTOR);
-            double gTarget2 = std::pow(Nyth::Audio::FX::POWER_CONVERSION_BASE, gainDb2 / Nyth::Audio::FX::DB_CONVERSION_FACTOR);
-            double gTarget3 = std::pow(Nyth::Audio::FX::POWER_CONVERSION_BASE, gainDb3 / Nyth::Audio::FX::DB_CONVERSION_FACTOR);
-
-            // Smooth gains
-            double gCoeff0 = (gTarget0 > gainL_) ? gainAttackCoeff_ : gainReleaseCoeff_;
-            gainL_ = gCoeff0 * gainL_ + (Nyth::Audio::FX::DEFAULT_GAIN - gCoeff0) * gTarget0;
-            output[i] = static_cast<float>(x0 * gainL_);
-
-            double gCoeff1 = (gTarget1 > gainL_) ? gainAttackCoeff_ : gainReleaseCoeff_;
-            gainL_ = gCoeff1 * gainL_ + (Nyth::Audio::FX::DEFAULT_GAIN - gCoeff1) * gTarget1;
-            output[i + 1] = static_cast<float>(x1 * gainL_);
-
-            double gCoeff2 = (gTarget2 > gainL_) ? gainAttackCoeff_ : gainReleaseCoeff_;
-            gainL_ = gCoeff2 * gainL_ + (Nyth::Audio::FX::DEFAULT_GAIN - gCoeff2) * gTarget2;
-            output[i + 2] = static_cast<float>(x2 * gainL_);
-
-            double gCoeff3 = (gTarget3 > gainL_) ? gainAttackCoeff_ : gainReleaseCoeff_;
-            gainL_ = gCoeff3 * gainL_ + (Nyth::Audio::FX::DEFAULT_GAIN - gCoeff3) * gTarget3;
-            output[i + 3] = static_cast<float>(x3 * gainL_);
-        }
-
-        // Process remaining samples
-        for (; i < numSamples; ++i) {
-            double x = static_cast<double>(input[i]);
-            double ax = std::abs(x) + Nyth::Audio::FX::EPSILON_DB;
-            double coeff = (ax > envL_) ? attackCoeff_ : releaseCoeff_;
-            envL_ = coeff * envL_ + (Nyth::Audio::FX::DEFAULT_GAIN - coeff) * ax;
-            double levelDb = Nyth::Audio::FX::DB_CONVERSION_FACTOR * std::log10(envL_);
-            double outDb = (levelDb > thresholdDb_) ? thresholdDb_ + (levelDb - thresholdDb_) / ratio_ : levelDb;
-            double gainDb = (outDb - levelDb) + makeupDb_;
-            double gTarget = std::pow(Nyth::Audio::FX::POWER_CONVERSION_BASE, gainDb / Nyth::Audio::FX::DB_CONVERSION_FACTOR);
-            double gCoeff = (gTarget > gainL_) ? gainAttackCoeff_ : gainReleaseCoeff_;
-            gainL_ = gCoeff * gainL_ + (Nyth::Audio::FX::DEFAULT_GAIN - gCoeff) * gTarget;
-            output[i] = static_cast<float>(x * gainL_);
         }
     }
 
     void processStereo(const float* inL, const float* inR, float* outL, float* outR, size_t numSamples) override {
         if (!isEnabled() || !inL || !inR || !outL || !outR || numSamples == 0) {
             if (outL != inL && inL && outL)
-                for (size_t i = 0; i < numSamples; ++i)
-                    outL[i] = inL[i];
+                std::copy_n(inL, numSamples, outL);
             if (outR != inR && inR && outR)
-                for (size_t i = 0; i < numSamples; ++i)
-                    outR[i] = inR[i];
+                std::copy_n(inR, numSamples, outR);
             return;
         }
-        for (size_t i = 0; i < numSamples; ++i) {
-            double xl = static_cast<double>(inL[i]);
-            double xr = static_cast<double>(inR[i]);
-            double ax = Nyth::Audio::FX::STEREO_AVERAGE_FACTOR * (std::abs(xl) + std::abs(xr)) + Nyth::Audio::FX::EPSILON_DB;
-            double coeff = (ax > envL_) ? attackCoeff_ : releaseCoeff_;
-            envL_ = coeff * envL_ + (Nyth::Audio::FX::DEFAULT_GAIN - coeff) * ax;
-            double levelDb = Nyth::Audio::FX::DB_CONVERSION_FACTOR * std::log10(envL_);
-            double outDb = levelDb;
-            if (levelDb > thresholdDb_)
-                outDb = thresholdDb_ + (levelDb - thresholdDb_) / ratio_;
-            double gainDb = (outDb - levelDb) + makeupDb_;
-            double gTarget = std::pow(Nyth::Audio::FX::POWER_CONVERSION_BASE, gainDb / Nyth::Audio::FX::DB_CONVERSION_FACTOR);
-            double gCoeff = (gTarget > gainL_) ? gainAttackCoeff_ : gainReleaseCoeff_;
-            gainL_ = gCoeff * gainL_ + (Nyth::Audio::FX::DEFAULT_GAIN - gCoeff) * gTarget;
-            // Use separate gain for right channel
-            gCoeff = (gTarget > gainR_) ? gainAttackCoeff_ : gainReleaseCoeff_;
-            gainR_ = gCoeff * gainR_ + (Nyth::Audio::FX::DEFAULT_GAIN - gCoeff) * gTarget;
-            outL[i] = static_cast<float>(xl * gainL_);
-            outR[i] = static_cast<float>(xr * gainR_);
+
+        for (size_t offset = 0; offset < numSamples; offset += Nyth::Audio::FX::COMPRESSOR_BLOCK_SIZE) {
+            const size_t n = std::min(Nyth::Audio::FX::COMPRESSOR_BLOCK_SIZE, numSamples - offset);
+            const float* xl = inL + offset;
+            const float* xr = inR + offset;
+            float* yl = outL + offset;
+            float* yr = outR + offset;
+
+            // Détection liée : une seule courbe de gain pour les deux canaux
+            float dbScale = 1.0f;
+            if (stereoLink_ == StereoLink::MAX) {
+                Dynamics::rectifyLinked(xl, xr, sidechain_, n);
+            } else {
+                // Puissance moyennée sur la fenêtre RMS ; la racine est prise dans le domaine log (x0.5)
+                Dynamics::meanSquareLinked(xl, xr, sidechain_, n);
+                rmsAverage_.process(sidechain_, sidechain_, n);
+                dbScale = 0.5f;
+            }
+            delayBlock(0, xl, yl, n);
+            delayBlock(1, xr, yr, n);
+            advanceLookahead(n);
+            computeGains(sidechain_, n, dbScale);
+            for (size_t i = 0; i < n; ++i) {
+                yl[i] *= sidechain_[i];
+                yr[i] *= sidechain_[i];
+            }
+        }
+    }
+
+protected:
+    void applyParameter(uint32_t paramId, float value) noexcept override {
+        switch (static_cast<Param>(paramId)) {
+            case Param::THRESHOLD_DB:
+                setParameters(value, ratio_, attackMs_, releaseMs_, makeupDb_);
+                break;
+            case Param::RATIO:
+                setParameters(thresholdDb_, value, attackMs_, releaseMs_, makeupDb_);
+                break;
+            case Param::ATTACK_MS:
+                setParameters(thresholdDb_, ratio_, value, releaseMs_, makeupDb_);
+                break;
+            case Param::RELEASE_MS:
+                setParameters(thresholdDb_, ratio_, attackMs_, value, makeupDb_);
+                break;
+            case Param::MAKEUP_DB:
+                setParameters(thresholdDb_, ratio_, attackMs_, releaseMs_, value);
+                break;
+            case Param::KNEE_DB:
+                setKnee(value);
+                break;
+            case Param::LOOKAHEAD_MS:
+                setLookahead(value);
+                break;
+            case Param::STEREO_LINK:
+                setStereoLink(value >= 0.5f ? StereoLink::RMS : StereoLink::MAX);
+                break;
+            case Param::RMS_WINDOW_MS:
+                setRmsWindow(value);
+                break;
         }
     }
 
@@ -256,13 +304,97 @@ private:
 
     void updateCoefficients() noexcept {
         auto coefForMs = [this](double ms) {
-            double T = std::max(Nyth::Audio::FX::MIN_TIME_MS, ms) / Nyth::Audio::FX::MS_TO_SECONDS_COMPRESSOR;
-            return std::exp(-Nyth::Audio::FX::DEFAULT_GAIN / (T * static_cast<double>(sampleRate_)));
+            return Dynamics::timeCoefficient(std::max(Nyth::Audio::FX::MIN_TIME_MS, ms),
+                                             static_cast<double>(sampleRate_));
         };
         attackCoeff_ = coefForMs(attackMs_);
         releaseCoeff_ = coefForMs(releaseMs_);
-        gainAttackCoeff_ = coefForMs(std::max(Nyth::Audio::FX::MIN_GAIN_ATTACK_MS, attackMs_ * Nyth::Audio::FX::GAIN_ATTACK_FACTOR));
-        gainReleaseCoeff_ = coefForMs(std::max(Nyth::Audio::FX::MIN_GAIN_RELEASE_MS, releaseMs_));
+        makeupCoeff_ = coefForMs(Nyth::Audio::FX::PARAMETER_SMOOTHING_MS);
+        // Moyenne glissante exponentielle : même constante à la montée et à la descente
+        const float rmsCoeff = coefForMs(rmsWindowMs_);
+        rmsAverage_.setCoefficients(rmsCoeff, rmsCoeff);
+        slope_ = static_cast<float>(1.0 / ratio_ - 1.0);
+        kneeWidth_ = std::max(static_cast<float>(kneeDb_), Nyth::Audio::FX::MIN_KNEE_WIDTH_DB);
+    }
+
+    void updateLookahead() noexcept {
+        const size_t capacity = lookaheadLines_[0].size();
+        const size_t wanted = static_cast<size_t>(
+            std::lround(lookaheadMs_ * static_cast<double>(sampleRate_) / Nyth::Audio::FX::MS_TO_SECONDS_COMPRESSOR));
+        lookaheadSamples_ = capacity > Nyth::Audio::FX::COMPRESSOR_BLOCK_SIZE
+                                ? std::min(wanted, capacity - Nyth::Audio::FX::COMPRESSOR_BLOCK_SIZE)
+                                : 0;
+    }
+
+    // Écrit n échantillons dans la ligne d'anticipation et lit le bloc retardé (in == out autorisé)
+    void delayBlock(int channel, const float* in, float* out, size_t n) noexcept {
+        if (lookaheadSamples_ == 0) {
+            if (out != in) {
+                std::copy_n(in, n, out);
+            }
+            return;
+        }
+        std::vector<float>& line = lookaheadLines_[channel];
+        const size_t capacity = line.size();
+        size_t first = std::min(n, capacity - lookaheadWrite_);
+        std::copy_n(in, first, line.data() + lookaheadWrite_);
+        std::copy_n(in + first, n - first, line.data());
+
+        const size_t read = (lookaheadWrite_ + capacity - lookaheadSamples_) % capacity;
+        first = std::min(n, capacity - read);
+        std::copy_n(line.data() + read, first, out);
+        std::copy_n(line.data(), n - first, out + first);
+    }
+
+    void advanceLookahead(size_t n) noexcept {
+        if (lookaheadSamples_ != 0) {
+            lookaheadWrite_ = (lookaheadWrite_ + n) % lookaheadLines_[0].size();
+        }
+    }
+
+    // Transforme, en place, le niveau de side-chain (linéaire) en gain linéaire
+    void computeGains(float* buffer, size_t n, float dbScale) noexcept {
+        VectorMath::linearToDb(buffer, buffer, n);
+
+        const float threshold = static_cast<float>(thresholdDb_);
+        const float halfKnee = 0.5f * kneeWidth_;
+        const float invTwoKnee = 0.5f / kneeWidth_;
+        const float slope = slope_;
+        float peakDb = Nyth::Audio::FX::SILENCE_LEVEL_DB;
+
+        // Courbe statique à genou doux, sans branchement
+        for (size_t i = 0; i < n; ++i) {
+            const float levelDb = buffer[i] * dbScale;
+            const float over = levelDb - threshold;
+            const float k = std::min(std::max(over + halfKnee, 0.0f), kneeWidth_);
+            buffer[i] = slope * (k * k * invTwoKnee + std::max(over - halfKnee, 0.0f));
+            peakDb = std::max(peakDb, levelDb);
+        }
+
+        // Lissage attaque/relâche de la réduction de gain (seule étape récursive) ;
+        // le gain de compensation glisse vers sa cible (changements automatisés sans clic)
+        float env = gainReductionDb_;
+        float makeup = makeupSmoothDb_;
+        const float makeupTarget = static_cast<float>(makeupDb_);
+        for (size_t i = 0; i < n; ++i) {
+            const float target = buffer[i];
+            const float coeff = (target < env) ? attackCoeff_ : releaseCoeff_;
+            env = target + coeff * (env - target);
+            makeup = makeupTarget + makeupCoeff_ * (makeup - makeupTarget);
+            buffer[i] = env + makeup;
+        }
+        gainReductionDb_ = env;
+        makeupSmoothDb_ = makeup;
+        levelDb_ = peakDb;
+        publishMeters();
+
+        VectorMath::dbToLinear(buffer, buffer, n);
+    }
+
+    void publishMeters() noexcept {
+        meterLevelDb_.store(levelDb_, std::memory_order_relaxed);
+        meterGainReductionDb_.store(gainReductionDb_, std::memory_order_relaxed);
+        meterOutputDb_.store(levelDb_ + gainReductionDb_ + makeupSmoothDb_, std::memory_order_relaxed);
     }
 
     // params
@@ -271,16 +403,30 @@ private:
     double attackMs_ = Nyth::Audio::Effects::Compressor::DEFAULT_ATTACK_MS;
     double releaseMs_ = Nyth::Audio::Effects::Compressor::DEFAULT_RELEASE_MS;
     double makeupDb_ = Nyth::Audio::Effects::Compressor::DEFAULT_MAKEUP_DB;
+    double kneeDb_ = Nyth::Audio::Effects::Compressor::DEFAULT_KNEE_DB;
+    double lookaheadMs_ = Nyth::Audio::Effects::Compressor::DEFAULT_LOOKAHEAD_MS;
+    StereoLink stereoLink_ = StereoLink::MAX;
+    double rmsWindowMs_ = Nyth::Audio::Effects::Compressor::DEFAULT_RMS_WINDOW_MS;
+
+    // derived coefficients
+    float attackCoeff_ = 0.0f;
+    float releaseCoeff_ = 0.0f;
+    float slope_ = 0.0f;
+    float kneeWidth_ = Nyth::Audio::Effects::Compressor::DEFAULT_KNEE_DB;
+    float makeupCoeff_ = 0.0f;
 
     // state
-    double envL_ = Nyth::Audio::FX::DEFAULT_ENVELOPE;
-    double envR_ = Nyth::Audio::FX::DEFAULT_ENVELOPE;
-    double gainL_ = Nyth::Audio::FX::DEFAULT_GAIN;
-    double gainR_ = Nyth::Audio::FX::DEFAULT_GAIN;
-    double attackCoeff_ = Nyth::Audio::FX::DEFAULT_ATTACK_COEFF;
-    double releaseCoeff_ = Nyth::Audio::FX::DEFAULT_RELEASE_COEFF;
-    double gainAttackCoeff_ = Nyth::Audio::FX::DEFAULT_GAIN_ATTACK_COEFF;
-    double gainReleaseCoeff_ = Nyth::Audio::FX::DEFAULT_GAIN_RELEASE_COEFF;
+    float gainReductionDb_ = 0.0f;
+    float levelDb_ = Nyth::Audio::FX::SILENCE_LEVEL_DB;
+    float makeupSmoothDb_ = static_cast<float>(Nyth::Audio::Effects::Compressor::DEFAULT_MAKEUP_DB);
+    Dynamics::AttackReleaseFilter rmsAverage_; // puissance liée (liaison RMS)
+    std::atomic<float> meterLevelDb_{Nyth::Audio::FX::SILENCE_LEVEL_DB};
+    std::atomic<float> meterGainReductionDb_{0.0f};
+    std::atomic<float> meterOutputDb_{Nyth::Audio::FX::SILENCE_LEVEL_DB};
+    alignas(16) float sidechain_[Nyth::Audio::FX::COMPRESSOR_BLOCK_SIZE] = {};
+    std::vector<float> lookaheadLines_[Nyth::Audio::FX::STEREO_CHANNELS];
+    size_t lookaheadWrite_ = 0;
+    size_t lookaheadSamples_ = 0;
 };
 
-} // namespace Nyth { namespace Audio { namespace FX
+}}} // namespace Nyth { namespace Audio { namespace FX
@@ -0,0 +1,465 @@
+#pragma once
+
+// C++17 standard headers
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "EffectBase.hpp"
+#include "../../common/config/EffectConstants.hpp"
+#include "../../common/dsp/PartitionedConvolver.hpp"
+#include "../../common/utils/SpscBlockQueue.hpp"
+#include "../../common/utils/WavReader.hpp"
+#include "../config/EffectsLimits.h" // Source of truth for default values
+
+namespace Nyth { namespace Audio { namespace FX {
+
+/**
+ * @brief Convolution reverb with non-uniform partitioning
+ *
+ * The impulse response is split into segments of growing partition size:
+ *   - head  [0, 2 * T0)           : CONVOLUTION_HEAD_SIZE partitions, audio thread
+ *   - stage s [2 * Ts, 2 * Ts+1)  : Ts = CONVOLUTION_TAIL_SIZES[s], worker thread
+ * A stage of partition size T starting at 2T in the IR receives an input block
+ * once T samples are collected and only has to deliver its output T samples
+ * later, so the worker gets a full block period to compute it. Blocks travel
+ * through wait-free SPSC queues tagged with their index; a block that misses its
+ * deadline is replaced by silence and counted in getLateBlockCount().
+ *
+ * The audio thread only runs the short head FFTs; the cost of the long tail is
+ * a few large FFTs per stage period on the worker. Latency is
+ * CONVOLUTION_HEAD_SIZE samples, for both the dry and the wet path.
+ *
+ * Loading an IR (WAV file or buffers) is non real-time: it rebuilds the
+ * convolvers under a mutex the audio thread only try-locks, passing the input
+ * through meanwhile.
+ */
+class ConvolutionReverbEffect final : public IAudioEffect {
+public:
+    using IAudioEffect::processMono;   // évite le masquage des surcharges (templates span)
+    using IAudioEffect::processStereo; // idem
+
+    // Paramètres automatisables (scheduleParameter)
+    enum class Param : uint32_t { WET_LEVEL = 0, DRY_LEVEL };
+
+    ConvolutionReverbEffect() = default;
+    ~ConvolutionReverbEffect() override {
+        stopWorker();
+    }
+
+    ConvolutionReverbEffect(const ConvolutionReverbEffect&) = delete;
+    ConvolutionReverbEffect& operator=(const ConvolutionReverbEffect&) = delete;
+
+    /**
+     * @brief Loads a mono or stereo IR from a WAV file (non real-time)
+     * @param error optional reason on failure
+     */
+    bool loadImpulseResponse(const std::string& path, std::string* error = nullptr) {
+        WavData wav;
+        if (!WavReader::readFile(path, wav, error)) {
+            return false;
+        }
+        if (!setImpulseResponse(wav.channels, wav.sampleRate)) {
+            if (error) {
+                *error = "invalid impulse response";
+            }
+            return false;
+        }
+        irPath_ = path;
+        return true;
+    }
+
+    /**
+     * @brief Sets the IR from deinterleaved buffers (non real-time)
+     *
+     * Extra channels beyond MAX_IR_CHANNELS are ignored. The IR is resampled to
+     * the processing rate, truncated to MAX_IR_SECONDS and normalized to unit
+     * energy on its loudest channel.
+     */
+    bool setImpulseResponse(const std::vector<std::vector<float>>& channels, uint32_t irSampleRate) {
+        if (channels.empty() || channels[0].empty() || irSampleRate == 0) {
+            return false;
+        }
+        const size_t numChannels = std::min(channels.size(), Nyth::Audio::Effects::Convolution::MAX_IR_CHANNELS);
+        sourceIr_.assign(channels.begin(), channels.begin() + numChannels);
+        sourceRate_ = irSampleRate;
+        irPath_.clear();
+        return rebuild();
+    }
+
+    void clearImpulseResponse() {
+        std::lock_guard<std::mutex> lock(engineMutex_);
+        stopWorker();
+        ready_ = false;
+        sourceIr_.clear();
+        irPath_.clear();
+        irLength_ = 0;
+    }
+
+    void setMix(double wetLevel, double dryLevel) noexcept {
+        wetLevel_ = static_cast<float>(std::max(0.0, std::min(1.0, wetLevel)));
+        dryLevel_ = static_cast<float>(std::max(0.0, std::min(1.0, dryLevel)));
+    }
+    [[nodiscard]] float getWetLevel() const noexcept {
+        return wetLevel_;
+    }
+    [[nodiscard]] float getDryLevel() const noexcept {
+        return dryLevel_;
+    }
+
+    [[nodiscard]] bool hasImpulseResponse() const noexcept {
+        return ready_.load(std::memory_order_acquire);
+    }
+    [[nodiscard]] const std::string& getImpulseResponsePath() const noexcept {
+        return irPath_;
+    }
+    // Longueur de la RI au taux de traitement, en échantillons
+    [[nodiscard]] size_t getImpulseResponseLength() const noexcept {
+        return irLength_;
+    }
+    // Blocs de queue arrivés après leur échéance (remplacés par du silence)
+    [[nodiscard]] uint64_t getLateBlockCount() const noexcept {
+        return lateBlocks_.load(std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] uint32_t getLatencySamples() const noexcept override {
+        return ready_.load(std::memory_order_acquire) ? static_cast<uint32_t>(HEAD_SIZE) : 0;
+    }
+
+    void setSampleRate(uint32_t sampleRate, int numChannels) noexcept override {
+        IAudioEffect::setSampleRate(sampleRate, numChannels);
+        if (!sourceIr_.empty()) {
+            rebuild();
+        }
+    }
+
+    void processMono(const float* input, float* output, size_t numSamples) override {
+        std::unique_lock<std::mutex> lock(engineMutex_, std::try_to_lock);
+        if (!lock.owns_lock() || !ready_ || !isEnabled() || !input || !output || numSamples == 0) {
+            if (output != input && input && output) {
+                std::copy_n(input, numSamples, output);
+            }
+            return;
+        }
+
+        for (size_t done = 0; done < numSamples;) {
+            const size_t chunk = std::min(numSamples - done, HEAD_SIZE - framePos_);
+            // Entrée copiée avant d'écrire la sortie : input et output peuvent se recouvrir
+            std::copy_n(input + done, chunk, frameIn_[0] + framePos_);
+            std::copy_n(frameOut_[0] + framePos_, chunk, output + done);
+            advance(chunk, 1);
+            done += chunk;
+        }
+    }
+
+    void processStereo(const float* inL, const float* inR, float* outL, float* outR, size_t numSamples) override {
+        std::unique_lock<std::mutex> lock(engineMutex_, std::try_to_lock);
+        if (!lock.owns_lock() || !ready_ || !isEnabled() || !inL || !inR || !outL || !outR || numSamples == 0) {
+            if (outL != inL && inL && outL)
+                std::copy_n(inL, numSamples, outL);
+            if (outR != inR && inR && outR)
+                std::copy_n(inR, numSamples, outR);
+            return;
+        }
+
+        for (size_t done = 0; done < numSamples;) {
+            const size_t chunk = std::min(numSamples - done, HEAD_SIZE - framePos_);
+            if (numChannels_ == 1) {
+                // Moteur mono : somme des canaux, même sortie des deux côtés
+                for (size_t i = 0; i < chunk; ++i) {
+                    frameIn_[0][framePos_ + i] = 0.5f * (inL[done + i] + inR[done + i]);
+                }
+                std::copy_n(frameOut_[0] + framePos_, chunk, outL + done);
+                std::copy_n(frameOut_[0] + framePos_, chunk, outR + done);
+            } else {
+                std::copy_n(inL + done, chunk, frameIn_[0] + framePos_);
+                std::copy_n(inR + done, chunk, frameIn_[1] + framePos_);
+                std::copy_n(frameOut_[0] + framePos_, chunk, outL + done);
+                std::copy_n(frameOut_[1] + framePos_, chunk, outR + done);
+            }
+            advance(chunk, numChannels_);
+            done += chunk;
+        }
+    }
+
+protected:
+    void applyParameter(uint32_t paramId, float value) noexcept override {
+        switch (static_cast<Param>(paramId)) {
+            case Param::WET_LEVEL:
+                setMix(value, dryLevel_);
+                break;
+            case Param::DRY_LEVEL:
+                setMix(wetLevel_, value);
+                break;
+        }
+    }
+
+private:
+    static constexpr size_t HEAD_SIZE = Nyth::Audio::FX::CONVOLUTION_HEAD_SIZE;
+    static constexpr size_t NUM_STAGES = Nyth::Audio::FX::CONVOLUTION_TAIL_STAGES;
+    static constexpr size_t MAX_CHANNELS = Nyth::Audio::FX::STEREO_CHANNELS;
+
+    // Étage de queue : blocs de blockSize échantillons, [canal][échantillon] dans chaque bloc
+    struct TailStage {
+        bool active = false;
+        size_t blockSize = 0;
+        // côté thread audio
+        std::vector<float> inBlock;
+        std::vector<float> outBlock;
+        size_t fill = 0;
+        uint64_t blockIndex = 0;
+        // côté thread de travail
+        PartitionedConvolver convolvers[MAX_CHANNELS];
+        std::vector<float> workIn;
+        std::vector<float> workOut;
+        // échanges
+        SpscBlockQueue toWorker;
+        SpscBlockQueue fromWorker;
+    };
+
+    void advance(size_t chunk, size_t activeChannels) noexcept {
+        framePos_ += chunk;
+        if (framePos_ == HEAD_SIZE) {
+            processFrame(activeChannels);
+            framePos_ = 0;
+        }
+    }
+
+    // Une trame de HEAD_SIZE échantillons : tête sur ce thread, échanges avec les étages de queue
+    void processFrame(size_t activeChannels) noexcept {
+        for (size_t ch = 0; ch < activeChannels; ++ch) {
+            head_[ch].process(frameIn_[ch], wet_[ch]);
+        }
+
+        bool pushed = false;
+        for (auto& stage : stages_) {
+            if (!stage.active) {
+                continue;
+            }
+            const size_t P = stage.blockSize;
+            if (stage.fill == 0) {
+                fetchTailBlock(stage);
+            }
+            for (size_t ch = 0; ch < activeChannels; ++ch) {
+                const float* tail = stage.outBlock.data() + ch * P + stage.fill;
+                for (size_t i = 0; i < HEAD_SIZE; ++i) {
+                    wet_[ch][i] += tail[i];
+                }
+                std::copy_n(frameIn_[ch], HEAD_SIZE, stage.inBlock.data() + ch * P + stage.fill);
+            }
+            stage.fill += HEAD_SIZE;
+            if (stage.fill == P) {
+                // File pleine (thread de travail bloqué) : le bloc sera compté en retard côté sortie
+                stage.toWorker.tryPush(stage.inBlock.data(), stage.blockIndex);
+                ++stage.blockIndex;
+                stage.fill = 0;
+                pushed = true;
+            }
+        }
+        if (pushed) {
+            workPending_.store(true, std::memory_order_release);
+            workCv_.notify_one();
+        }
+
+        const float wet = wetLevel_;
+        const float dry = dryLevel_;
+        for (size_t ch = 0; ch < activeChannels; ++ch) {
+            for (size_t i = 0; i < HEAD_SIZE; ++i) {
+                frameOut_[ch][i] = dry * frameIn_[ch][i] + wet * wet_[ch][i];
+            }
+        }
+    }
+
+    // Sortie du bloc d'entrée n - 2 : le bloc n - 1 est en cours de calcul sur le thread de travail
+    void fetchTailBlock(TailStage& stage) noexcept {
+        std::fill(stage.outBlock.begin(), stage.outBlock.end(), 0.0f);
+        if (stage.blockIndex < 2) {
+            return;
+        }
+        const uint64_t expected = stage.blockIndex - 2;
+        uint64_t tag = 0;
+        while (stage.fromWorker.peekTag(tag) && tag < expected) {
+            stage.fromWorker.tryPop(nullptr, tag); // arrivé trop tard, déjà remplacé par du silence
+        }
+        if (stage.fromWorker.peekTag(tag) && tag == expected) {
+            stage.fromWorker.tryPop(stage.outBlock.data(), tag);
+        } else {
+            lateBlocks_.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    void workerLoop() {
+        while (!stopRequested_.load(std::memory_order_acquire)) {
+            bool didWork = false;
+            // Petits étages d'abord : leur échéance est la plus proche
+            for (auto& stage : stages_) {
+                if (!stage.active) {
+                    continue;
+                }
+                const size_t P = stage.blockSize;
+                uint64_t tag = 0;
+                while (stage.toWorker.tryPop(stage.workIn.data(), tag)) {
+                    for (size_t ch = 0; ch < numChannels_; ++ch) {
+                        stage.convolvers[ch].process(stage.workIn.data() + ch * P, stage.workOut.data() + ch * P);
+                    }
+                    stage.fromWorker.tryPush(stage.workOut.data(), tag);
+                    didWork = true;
+                }
+            }
+            if (!didWork) {
+                // Attente bornée : notify_one sans verrou côté audio peut précéder le wait
+                std::unique_lock<std::mutex> lock(workMutex_);
+                workCv_.wait_for(lock, std::chrono::milliseconds(Nyth::Audio::FX::CONVOLUTION_WORKER_WAIT_MS), [this] {
+                    return workPending_.load(std::memory_order_acquire) ||
+                           stopRequested_.load(std::memory_order_acquire);
+                });
+                workPending_.store(false, std::memory_order_release);
+            }
+        }
+    }
+
+    void stopWorker() {
+        if (worker_.joinable()) {
+            {
+                std::lock_guard<std::mutex> lock(workMutex_);
+                stopRequested_.store(true, std::memory_order_release);
+            }
+            workCv_.notify_one();
+            worker_.join();
+        }
+        stopRequested_.store(false, std::memory_order_release);
+    }
+
+    // Reconstruit tous les convolueurs pour la RI source et le taux courant (non temps réel)
+    bool rebuild() noexcept {
+        std::lock_guard<std::mutex> lock(engineMutex_);
+        stopWorker();
+        ready_ = false;
+        try {
+            numChannels_ = channels_ >= 2 ? MAX_CHANNELS : 1;
+            std::vector<std::vector<float>> ir;
+            prepareImpulseResponse(ir);
+            irLength_ = ir[0].size();
+
+            // Tête : [0, 2 * T0)
+            const size_t headEnd = std::min(irLength_, 2 * Nyth::Audio::FX::CONVOLUTION_TAIL_SIZES[0]);
+            for (size_t ch = 0; ch < numChannels_; ++ch) {
+                head_[ch].prepare(HEAD_SIZE, ir[std::min(ch, ir.size() - 1)].data(), headEnd);
+            }
+
+            // Étages : [2 * Ts, 2 * Ts+1), le dernier jusqu'à la fin de la RI
+            bool anyStage = false;
+            for (size_t s = 0; s < NUM_STAGES; ++s) {
+                TailStage& stage = stages_[s];
+                const size_t P = Nyth::Audio::FX::CONVOLUTION_TAIL_SIZES[s];
+                const size_t begin = 2 * P;
+                const size_t end =
+                    s + 1 < NUM_STAGES ? std::min(irLength_, 2 * Nyth::Audio::FX::CONVOLUTION_TAIL_SIZES[s + 1])
+                                       : irLength_;
+                stage.active = begin < end;
+                stage.blockSize = P;
+                stage.fill = 0;
+                stage.blockIndex = 0;
+                if (!stage.active) {
+                    continue;
+                }
+                for (size_t ch = 0; ch < numChannels_; ++ch) {
+                    stage.convolvers[ch].prepare(P, ir[std::min(ch, ir.size() - 1)].data() + begin, end - begin);
+                }
+                stage.inBlock.assign(numChannels_ * P, 0.0f);
+                stage.outBlock.assign(numChannels_ * P, 0.0f);
+                stage.workIn.assign(numChannels_ * P, 0.0f);
+                stage.workOut.assign(numChannels_ * P, 0.0f);
+                stage.toWorker.prepare(Nyth::Audio::FX::CONVOLUTION_QUEUE_DEPTH, numChannels_ * P);
+                stage.fromWorker.prepare(Nyth::Audio::FX::CONVOLUTION_QUEUE_DEPTH, numChannels_ * P);
+                anyStage = true;
+            }
+
+            std::fill(&frameIn_[0][0], &frameIn_[0][0] + MAX_CHANNELS * HEAD_SIZE, 0.0f);
+            std::fill(&frameOut_[0][0], &frameOut_[0][0] + MAX_CHANNELS * HEAD_SIZE, 0.0f);
+            framePos_ = 0;
+            lateBlocks_.store(0, std::memory_order_relaxed);
+
+            if (anyStage) {
+                worker_ = std::thread(&ConvolutionReverbEffect::workerLoop, this);
+            }
+            ready_.store(true, std::memory_order_release);
+        } catch (const std::exception&) {
+            // Allocation ou création du thread impossible : l'effet reste transparent
+            ready_ = false;
+        }
+        return ready_.load(std::memory_order_acquire);
+    }
+
+    // Rééchantillonnage (interpolation linéaire), troncature et normalisation en énergie
+    void prepareImpulseResponse(std::vector<std::vector<float>>& ir) const {
+        const double ratio = static_cast<double>(sourceRate_) / static_cast<double>(sampleRate_);
+        const size_t sourceLength = sourceIr_[0].size();
+        const size_t maxLength =
+            static_cast<size_t>(Nyth::Audio::Effects::Convolution::MAX_IR_SECONDS * static_cast<float>(sampleRate_));
+        const size_t length =
+            std::max<size_t>(1, std::min(maxLength, static_cast<size_t>(static_cast<double>(sourceLength) / ratio)));
+
+        ir.assign(sourceIr_.size(), std::vector<float>(length, 0.0f));
+        double maxEnergy = 0.0;
+        for (size_t ch = 0; ch < sourceIr_.size(); ++ch) {
+            const std::vector<float>& src = sourceIr_[ch];
+            double energy = 0.0;
+            for (size_t i = 0; i < length; ++i) {
+                const double pos = static_cast<double>(i) * ratio;
+                const size_t i0 = std::min(static_cast<size_t>(pos), src.size() - 1);
+                const size_t i1 = std::min(i0 + 1, src.size() - 1);
+                const double frac = pos - static_cast<double>(i0);
+                const double v = src[i0] + frac * (src[i1] - src[i0]);
+                ir[ch][i] = static_cast<float>(v);
+                energy += v * v;
+            }
+            maxEnergy = std::max(maxEnergy, energy);
+        }
+        if (maxEnergy > 0.0) {
+            const float gain = static_cast<float>(1.0 / std::sqrt(maxEnergy));
+            for (auto& channel : ir) {
+                for (auto& v : channel) {
+                    v *= gain;
+                }
+            }
+        }
+    }
+
+    // params
+    float wetLevel_ = Nyth::Audio::Effects::Convolution::DEFAULT_WET_LEVEL;
+    float dryLevel_ = Nyth::Audio::Effects::Convolution::DEFAULT_DRY_LEVEL;
+    std::vector<std::vector<float>> sourceIr_;
+    uint32_t sourceRate_ = 0;
+    std::string irPath_;
+    size_t irLength_ = 0;
+
+    // moteur (protégé par engineMutex_, essayé sans blocage par le thread audio)
+    std::mutex engineMutex_;
+    std::atomic<bool> ready_{false};
+    size_t numChannels_ = 1;
+    PartitionedConvolver head_[MAX_CHANNELS];
+    TailStage stages_[NUM_STAGES];
+    alignas(16) float frameIn_[MAX_CHANNELS][HEAD_SIZE] = {};
+    alignas(16) float frameOut_[MAX_CHANNELS][HEAD_SIZE] = {};
+    alignas(16) float wet_[MAX_CHANNELS][HEAD_SIZE] = {};
+    size_t framePos_ = 0;
+    std::atomic<uint64_t> lateBlocks_{0};
+
+    // thread de travail
+    std::thread worker_;
+    std::mutex workMutex_;
+    std::condition_variable workCv_;
+    std::atomic<bool> workPending_{false};
+    std::atomic<bool> stopRequested_{false};
+};
+
+}}} // namespace Nyth { namespace Audio { namespace FX
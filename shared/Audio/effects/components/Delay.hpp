@@ -12,15 +12,46 @@
 
 #include "EffectBase.hpp"
 #include "../../common/config/EffectConstants.hpp"
+#include "../../common/dsp/FractionalDelayLine.hpp"
 #include "../config/EffectsLimits.h" // Source of truth for default values
 
 namespace Nyth { namespace Audio { namespace FX {
 
+/**
+ * @brief Feedback delay with fractional, smoothed and LFO-modulated read tap
+ *
+ * The lines are allocated once in setSampleRate() for MAX_DELAY_SECONDS plus
+ * the maximum modulation depth: changing the delay time never reallocates or
+ * clears the buffer. The tap glides towards the requested time (one-pole,
+ * DELAY_SMOOTHING_MS) and is read with Hermite interpolation, so sweeps behave
+ * like a tape delay instead of clicking. A sine LFO (quadrature oscillator,
+ * right channel 90° ahead) modulates the tap for chorus/flanger use.
+ *
+ * Modes: SINGLE (one tap), MULTI_TAP (up to MAX_TAPS extra echoes read from the
+ * same line, no extra memory) and PING_PONG (feedback crosses channels). The
+ * feedback path of the main tap goes through one-pole low-cut/high-cut
+ * damping filters.
+ */
 class DelayEffect final : public IAudioEffect {
 public:
     using IAudioEffect::processMono;   // évite le masquage des surcharges (templates span)
     using IAudioEffect::processStereo; // idem
 
+    enum class DelayMode {
+        SINGLE,    // un seul tap
+        MULTI_TAP, // tap principal + taps supplémentaires dans la même ligne
+        PING_PONG  // réinjection croisée gauche <-> droite
+    };
+
+    // Paramètres automatisables (scheduleParameter)
+    enum class Param : uint32_t { DELAY_MS = 0, FEEDBACK, MIX, MOD_RATE_HZ, MOD_DEPTH_MS, LOW_CUT_HZ, HIGH_CUT_HZ };
+
+    // Tap supplémentaire : retard et gain dans le signal traité
+    struct DelayTap {
+        float delayMs;
+        float gain;
+    };
+
     // === Structure des métriques ===
     struct DelayMetrics {
         float inputLevel = 0.0f;      // Niveau d'entrée en dB
@@ -37,18 +68,67 @@ public:
         return DelayMetrics{
             .inputLevel = 20.0f * std::log10(std::max(0.1f, 1.0f)), // Estimation
             .outputLevel = 20.0f * std::log10(std::max(0.1f, 1.0f)), // Estimation
-            .feedbackLevel = 20.0f * std::log10(std::max(static_cast<double>(Nyth::Audio::FX::EPSILON_DB), static_cast<double>(feedback_))),
+            .feedbackLevel = static_cast<float>(20.0 * std::log10(std::max(Nyth::Audio::FX::EPSILON_DB, feedback_))),
             .wetLevel = static_cast<float>(mix_),
             .isActive = isEnabled() && (mix_ > Nyth::Audio::FX::MIX_THRESHOLD)
         };
     }
+    // Aucun accès mémoire : la ligne est déjà dimensionnée au retard maximal
     void setParameters(double delayMs, double feedback, double mix) noexcept {
         delayMs_ = (delayMs > Nyth::Audio::FX::MIN_DELAY_VALUE) ? delayMs : Nyth::Audio::FX::MIN_DELAY_VALUE;
+        delayMs_ = std::min(delayMs_, maxDelayMs());
         feedback_ = (feedback < Nyth::Audio::FX::MIN_FEEDBACK)   ? Nyth::Audio::FX::MIN_FEEDBACK
                     : (feedback > Nyth::Audio::FX::MAX_FEEDBACK) ? Nyth::Audio::FX::MAX_FEEDBACK
                                                          : feedback;
         mix_ = (mix < Nyth::Audio::FX::MIN_MIX) ? Nyth::Audio::FX::MIN_MIX : (mix > Nyth::Audio::FX::MAX_MIX) ? Nyth::Audio::FX::MAX_MIX : mix;
-        updateBuffers();
+        updateDelayTarget();
+    }
+
+    // Modulation du retard par LFO sinusoïdal (profondeur crête en ms, 0 = désactivée)
+    void setModulation(double rateHz, double depthMs) noexcept {
+        modRateHz_ = std::max(static_cast<double>(Nyth::Audio::Effects::Delay::MIN_MOD_RATE_HZ),
+                              std::min(static_cast<double>(Nyth::Audio::Effects::Delay::MAX_MOD_RATE_HZ), rateHz));
+        modDepthMs_ = std::max(static_cast<double>(Nyth::Audio::Effects::Delay::MIN_MOD_DEPTH_MS),
+                               std::min(static_cast<double>(Nyth::Audio::Effects::Delay::MAX_MOD_DEPTH_MS), depthMs));
+        updateModulation();
+    }
+
+    void setMode(DelayMode mode) noexcept {
+        mode_ = mode;
+    }
+    [[nodiscard]] DelayMode getMode() const noexcept {
+        return mode_;
+    }
+
+    // Nombre de taps supplémentaires utilisés en mode MULTI_TAP
+    void setNumTaps(size_t numTaps) noexcept {
+        numTaps_ = std::min(numTaps, Nyth::Audio::Effects::Delay::MAX_TAPS);
+    }
+    [[nodiscard]] size_t getNumTaps() const noexcept {
+        return numTaps_;
+    }
+
+    void setTap(size_t index, double delayMs, double gain) noexcept {
+        if (index >= Nyth::Audio::Effects::Delay::MAX_TAPS) {
+            return;
+        }
+        taps_[index].delayMs = static_cast<float>(std::max(Nyth::Audio::FX::MIN_DELAY_VALUE,
+                                                           std::min(maxDelayMs(), delayMs)));
+        taps_[index].gain = static_cast<float>(std::max(static_cast<double>(Nyth::Audio::Effects::Delay::MIN_TAP_GAIN),
+                                                        std::min(static_cast<double>(Nyth::Audio::Effects::Delay::MAX_TAP_GAIN), gain)));
+        updateTapTargets();
+    }
+    [[nodiscard]] DelayTap getTap(size_t index) const noexcept {
+        return taps_[std::min(index, Nyth::Audio::Effects::Delay::MAX_TAPS - 1)];
+    }
+
+    // Filtres à un pôle dans la boucle : chaque répétition perd graves (lowCut) et aigus (highCut)
+    void setDamping(double lowCutHz, double highCutHz) noexcept {
+        lowCutHz_ = std::max(static_cast<double>(Nyth::Audio::Effects::Delay::MIN_LOW_CUT_HZ),
+                             std::min(static_cast<double>(Nyth::Audio::Effects::Delay::MAX_LOW_CUT_HZ), lowCutHz));
+        highCutHz_ = std::max(static_cast<double>(Nyth::Audio::Effects::Delay::MIN_HIGH_CUT_HZ),
+                              std::min(static_cast<double>(Nyth::Audio::Effects::Delay::MAX_HIGH_CUT_HZ), highCutHz));
+        updateDamping();
     }
 
     // Structure pour récupérer les paramètres actuels
@@ -56,6 +136,10 @@ public:
         float delayMs;
         float feedback;
         float mix;
+        float modRateHz;
+        float modDepthMs;
+        float lowCutHz;
+        float highCutHz;
     };
 
     // === Getter pour récupérer les paramètres actuels ===
@@ -63,13 +147,38 @@ public:
         return DelayParameters{
             .delayMs = static_cast<float>(delayMs_),
             .feedback = static_cast<float>(feedback_),
-            .mix = static_cast<float>(mix_)
+            .mix = static_cast<float>(mix_),
+            .modRateHz = static_cast<float>(modRateHz_),
+            .modDepthMs = static_cast<float>(modDepthMs_),
+            .lowCutHz = static_cast<float>(lowCutHz_),
+            .highCutHz = static_cast<float>(highCutHz_)
         };
     }
 
     void setSampleRate(uint32_t sampleRate, int numChannels) noexcept override {
         IAudioEffect::setSampleRate(sampleRate, numChannels);
-        updateBuffers();
+        const double samplesPerMs = static_cast<double>(sampleRate_) * Nyth::Audio::FX::MS_TO_SECONDS_DELAY;
+        const size_t maxDelaySamples = static_cast<size_t>(std::ceil(
+            (static_cast<double>(Nyth::Audio::FX::MAX_DELAY_SECONDS) / Nyth::Audio::FX::MS_TO_SECONDS_DELAY +
+             Nyth::Audio::Effects::Delay::MAX_MOD_DEPTH_MS) *
+            samplesPerMs));
+        for (auto& line : lines_) {
+            line.prepare(maxDelaySamples);
+        }
+        smoothingCoeff_ = static_cast<float>(
+            std::exp(-1.0 / (Nyth::Audio::FX::DELAY_SMOOTHING_MS * samplesPerMs)));
+        gainSmoothingCoeff_ = static_cast<float>(
+            std::exp(-1.0 / (Nyth::Audio::FX::PARAMETER_SMOOTHING_MS * samplesPerMs)));
+        updateDelayTarget();
+        updateTapTargets();
+        updateModulation();
+        updateDamping();
+        for (auto& state : damping_) {
+            state = DampingState{};
+        }
+        snapDelay_ = true; // le premier réglage s'applique sans glissement
+        lfoSin_ = 0.0f;
+        lfoCos_ = 1.0f;
     }
 
     // C++17 modernized processing methods
@@ -104,32 +213,39 @@ public:
 
     // Legacy methods (call the modern versions for C++17)
     void processMono(const float* input, float* output, size_t numSamples) override {
-        if (!isEnabled() || mix_ <= Nyth::Audio::FX::MIX_THRESHOLD || !input || !output || numSamples == 0) {
+        if (!isEnabled() || isDry() || !input || !output || numSamples == 0 || !lines_[0].isPrepared()) {
             if (output != input && input && output) {
                 std::copy_n(input, numSamples, output);
             }
             return;
         }
-        ensureState(1);
-        size_t maxN = buffer_[0].size();
-
-        // C++17 traditional loop processing
+        // En mono, le ping-pong se réduit à un delay simple
+        snapGains();
+        const float mixTarget = static_cast<float>(mix_);
+        const float feedbackTarget = static_cast<float>(feedback_);
+        float mixf = mixSmooth_;
+        float feedbackf = feedbackSmooth_;
+        const size_t numTaps = activeTaps();
+        activateTaps(numTaps);
         for (size_t i = 0; i < numSamples; ++i) {
-            float x = input[i];
-            float d = buffer_[0][readIndex_];
-            float mixf = static_cast<float>(mix_);
-            float y = (1.0f - mixf) * x + mixf * d;
-            output[i] = y;
-            // write with feedback
-            float feedbackf = static_cast<float>(feedback_);
-            float w = x + feedbackf * d;
-            buffer_[0][writeIndex_] = w;
-            incrementIndices(maxN);
+            const float x = input[i];
+            mixf = mixTarget + gainSmoothingCoeff_ * (mixf - mixTarget);
+            feedbackf = feedbackTarget + gainSmoothingCoeff_ * (feedbackf - feedbackTarget);
+            const float base = nextDelay(numTaps);
+            const float mod = modDepth_ * lfoSin_;
+            advanceLfo();
+            const float d = lines_[0].read(base + mod);
+            const float wet = d + readTaps(lines_[0], numTaps, mod);
+            output[i] = (1.0f - mixf) * x + mixf * wet;
+            lines_[0].write(x + feedbackf * damp(damping_[0], d));
         }
+        mixSmooth_ = mixf;
+        feedbackSmooth_ = feedbackf;
+        normalizeLfo();
     }
 
     void processStereo(const float* inL, const float* inR, float* outL, float* outR, size_t numSamples) override {
-        if (!isEnabled() || mix_ <= Nyth::Audio::FX::MIX_THRESHOLD || !inL || !inR || !outL || !outR || numSamples == 0) {
+        if (!isEnabled() || isDry() || !inL || !inR || !outL || !outR || numSamples == 0 || !lines_[0].isPrepared()) {
             if (outL != inL && inL && outL)
                 for (size_t i = 0; i < numSamples; ++i)
                     outL[i] = inL[i];
@@ -138,60 +254,180 @@ public:
                     outR[i] = inR[i];
             return;
         }
-        ensureState(2);
-        size_t maxN = buffer_[0].size();
-        float mixf = static_cast<float>(mix_);
-        float feedbackf = static_cast<float>(feedback_);
+        snapGains();
+        const float mixTarget = static_cast<float>(mix_);
+        const float feedbackTarget = static_cast<float>(feedback_);
+        float mixf = mixSmooth_;
+        float feedbackf = feedbackSmooth_;
+        const size_t numTaps = activeTaps();
+        activateTaps(numTaps);
+        const bool pingPong = mode_ == DelayMode::PING_PONG;
         for (size_t i = 0; i < numSamples; ++i) {
-            float xl = inL[i];
-            float xr = inR[i];
-            float dl = buffer_[0][readIndex_];
-            float dr = buffer_[1][readIndex_];
-            outL[i] = (1.0f - mixf) * xl + mixf * dl;
-            outR[i] = (1.0f - mixf) * xr + mixf * dr;
-            buffer_[0][writeIndex_] = xl + feedbackf * dl;
-            buffer_[1][writeIndex_] = xr + feedbackf * dr;
-            incrementIndices(maxN);
+            const float xl = inL[i];
+            const float xr = inR[i];
+            mixf = mixTarget + gainSmoothingCoeff_ * (mixf - mixTarget);
+            feedbackf = feedbackTarget + gainSmoothingCoeff_ * (feedbackf - feedbackTarget);
+            const float base = nextDelay(numTaps);
+            const float modL = modDepth_ * lfoSin_;
+            const float modR = modDepth_ * lfoCos_;
+            advanceLfo();
+            const float dl = lines_[0].read(base + modL);
+            const float dr = lines_[1].read(base + modR);
+            const float wetL = dl + readTaps(lines_[0], numTaps, modL);
+            const float wetR = dr + readTaps(lines_[1], numTaps, modR);
+            outL[i] = (1.0f - mixf) * xl + mixf * wetL;
+            outR[i] = (1.0f - mixf) * xr + mixf * wetR;
+
+            const float fl = feedbackf * damp(damping_[0], dl);
+            const float fr = feedbackf * damp(damping_[1], dr);
+            if (pingPong) {
+                // L'entrée (somme mono) part à gauche, chaque répétition change de côté
+                lines_[0].write(0.5f * (xl + xr) + fr);
+                lines_[1].write(fl);
+            } else {
+                lines_[0].write(xl + fl);
+                lines_[1].write(xr + fr);
+            }
+        }
+        mixSmooth_ = mixf;
+        feedbackSmooth_ = feedbackf;
+        normalizeLfo();
+    }
+
+protected:
+    void applyParameter(uint32_t paramId, float value) noexcept override {
+        switch (static_cast<Param>(paramId)) {
+            case Param::DELAY_MS:
+                setParameters(value, feedback_, mix_);
+                break;
+            case Param::FEEDBACK:
+                setParameters(delayMs_, value, mix_);
+                break;
+            case Param::MIX:
+                setParameters(delayMs_, feedback_, value);
+                break;
+            case Param::MOD_RATE_HZ:
+                setModulation(value, modDepthMs_);
+                break;
+            case Param::MOD_DEPTH_MS:
+                setModulation(modRateHz_, value);
+                break;
+            case Param::LOW_CUT_HZ:
+                setDamping(value, highCutHz_);
+                break;
+            case Param::HIGH_CUT_HZ:
+                setDamping(lowCutHz_, value);
+                break;
         }
     }
 
 private:
     // All constants are now centralized in EffectConstants.hpp
 
-    void updateBuffers() noexcept {
-        ensureState(channels_);
-        size_t maxDelaySamples =
-            static_cast<size_t>(std::round(delayMs_ * Nyth::Audio::FX::MS_TO_SECONDS_DELAY * static_cast<double>(sampleRate_)));
-        if (maxDelaySamples < Nyth::Audio::FX::MIN_DELAY_SAMPLES)
-            maxDelaySamples = Nyth::Audio::FX::MIN_DELAY_SAMPLES;
-        if (maxDelaySamples > Nyth::Audio::FX::MAX_DELAY_SECONDS * Nyth::Audio::FX::REFERENCE_SAMPLE_RATE)
-            maxDelaySamples = Nyth::Audio::FX::MAX_DELAY_SECONDS * Nyth::Audio::FX::REFERENCE_SAMPLE_RATE; // clamp 4s max
-        for (int ch = 0; ch < channels_; ++ch) {
-            buffer_[ch].assign(maxDelaySamples, Nyth::Audio::FX::BUFFER_INIT_VALUE);
+    // Sec tant que le mix (cible et valeur lissée) reste sous le seuil
+    [[nodiscard]] bool isDry() const noexcept {
+        return mix_ <= Nyth::Audio::FX::MIX_THRESHOLD && mixSmooth_ <= Nyth::Audio::FX::MIX_THRESHOLD;
+    }
+
+    // Premier bloc après setSampleRate() : mix et feedback partent de leur cible
+    void snapGains() noexcept {
+        if (snapDelay_) {
+            mixSmooth_ = static_cast<float>(mix_);
+            feedbackSmooth_ = static_cast<float>(feedback_);
+        }
+    }
+
+    void updateDelayTarget() noexcept {
+        targetDelay_ = static_cast<float>(delayMs_ * Nyth::Audio::FX::MS_TO_SECONDS_DELAY * static_cast<double>(sampleRate_));
+    }
+
+    [[nodiscard]] static double maxDelayMs() noexcept {
+        return static_cast<double>(Nyth::Audio::FX::MAX_DELAY_SECONDS) / Nyth::Audio::FX::MS_TO_SECONDS_DELAY;
+    }
+
+    void updateTapTargets() noexcept {
+        for (size_t k = 0; k < Nyth::Audio::Effects::Delay::MAX_TAPS; ++k) {
+            tapTargets_[k] = static_cast<float>(taps_[k].delayMs * Nyth::Audio::FX::MS_TO_SECONDS_DELAY *
+                                                static_cast<double>(sampleRate_));
+        }
+    }
+
+    // Coefficients a = 1 - exp(-2 pi fc / fs) ; 0 (passe-haut) et 1 (passe-bas) = filtre transparent
+    void updateDamping() noexcept {
+        auto onePole = [this](double hz) {
+            return static_cast<float>(1.0 - std::exp(-Nyth::Audio::FX::TWO_PI * hz / static_cast<double>(sampleRate_)));
+        };
+        lowCutCoeff_ = lowCutHz_ <= Nyth::Audio::Effects::Delay::MIN_LOW_CUT_HZ ? 0.0f : onePole(lowCutHz_);
+        highCutCoeff_ = highCutHz_ >= Nyth::Audio::Effects::Delay::MAX_HIGH_CUT_HZ ? 1.0f : onePole(highCutHz_);
+    }
+
+    [[nodiscard]] size_t activeTaps() const noexcept {
+        return mode_ == DelayMode::MULTI_TAP ? numTaps_ : 0;
+    }
+
+    // Somme des taps supplémentaires (retards lissés comme le tap principal)
+    inline float readTaps(const FractionalDelayLine& line, size_t numTaps, float mod) noexcept {
+        float sum = 0.0f;
+        for (size_t k = 0; k < numTaps; ++k) {
+            sum += taps_[k].gain * line.read(tapDelays_[k] + mod);
         }
-        // set read/write offset
-        writeIndex_ = Nyth::Audio::FX::DEFAULT_INDEX;
-        readIndex_ = (maxDelaySamples + writeIndex_ - Nyth::Audio::FX::MIN_DELAY_SAMPLES) %
-                     maxDelaySamples; // ~delay of N-1 samples initially
+        return sum;
+    }
+
+    struct DampingState {
+        float lowCut = 0.0f;  // passe-bas dont on retire la sortie
+        float highCut = 0.0f; // passe-bas de coupure haute
+    };
+
+    inline float damp(DampingState& state, float x) const noexcept {
+        state.highCut += highCutCoeff_ * (x - state.highCut);
+        state.lowCut += lowCutCoeff_ * (state.highCut - state.lowCut);
+        return state.highCut - state.lowCut;
+    }
+
+    void updateModulation() noexcept {
+        const double w = Nyth::Audio::FX::TWO_PI * modRateHz_ / static_cast<double>(sampleRate_);
+        lfoStepCos_ = static_cast<float>(std::cos(w));
+        lfoStepSin_ = static_cast<float>(std::sin(w));
+        modDepth_ = static_cast<float>(modDepthMs_ * Nyth::Audio::FX::MS_TO_SECONDS_DELAY * static_cast<double>(sampleRate_));
     }
 
-    void ensureState(int requiredChannels) {
-        if (static_cast<int>(buffer_.size()) != requiredChannels) {
-            buffer_.assign(static_cast<size_t>(requiredChannels), std::vector<float>());
-            writeIndex_ = readIndex_ = Nyth::Audio::FX::DEFAULT_INDEX;
+    // Les taps qui redeviennent actifs partent de leur cible : les taps inactifs
+    // ne sont pas lissés, leur retard courant est périmé
+    void activateTaps(size_t numTaps) noexcept {
+        if (numTaps > smoothedTaps_) {
+            std::copy(tapTargets_ + smoothedTaps_, tapTargets_ + numTaps, tapDelays_ + smoothedTaps_);
         }
-        for (auto& b : buffer_)
-            if (b.empty())
-                b.assign(Nyth::Audio::FX::DEFAULT_BUFFER_SIZE, Nyth::Audio::FX::BUFFER_INIT_VALUE);
+        smoothedTaps_ = numTaps;
     }
 
-    inline void incrementIndices(size_t maxN) noexcept {
-        writeIndex_++;
-        if (writeIndex_ >= maxN)
-            writeIndex_ = 0;
-        readIndex_++;
-        if (readIndex_ >= maxN)
-            readIndex_ = 0;
+    // Retard lissé (un pôle) vers la cible, en échantillons
+    // (seuls les numTaps taps lus par le mode courant suivent la même dynamique)
+    inline float nextDelay(size_t numTaps) noexcept {
+        if (snapDelay_) {
+            currentDelay_ = targetDelay_;
+            std::copy_n(tapTargets_, Nyth::Audio::Effects::Delay::MAX_TAPS, tapDelays_);
+            snapDelay_ = false;
+        }
+        currentDelay_ = targetDelay_ + smoothingCoeff_ * (currentDelay_ - targetDelay_);
+        for (size_t k = 0; k < numTaps; ++k) {
+            tapDelays_[k] = tapTargets_[k] + smoothingCoeff_ * (tapDelays_[k] - tapTargets_[k]);
+        }
+        return currentDelay_;
+    }
+
+    // Oscillateur en quadrature : rotation du vecteur (cos, sin)
+    inline void advanceLfo() noexcept {
+        const float s = lfoSin_ * lfoStepCos_ + lfoCos_ * lfoStepSin_;
+        lfoCos_ = lfoCos_ * lfoStepCos_ - lfoSin_ * lfoStepSin_;
+        lfoSin_ = s;
+    }
+
+    // Corrige la dérive d'amplitude de la récurrence une fois par bloc
+    void normalizeLfo() noexcept {
+        const float gain = 1.5f - 0.5f * (lfoSin_ * lfoSin_ + lfoCos_ * lfoCos_);
+        lfoSin_ *= gain;
+        lfoCos_ *= gain;
     }
 
     // params
@@ -199,10 +435,36 @@ private:
     double feedback_ = Nyth::Audio::Effects::Delay::DEFAULT_FEEDBACK;
     double mix_ = Nyth::Audio::Effects::Delay::DEFAULT_MIX;
 
+    double modRateHz_ = Nyth::Audio::Effects::Delay::DEFAULT_MOD_RATE_HZ;
+    double modDepthMs_ = Nyth::Audio::Effects::Delay::DEFAULT_MOD_DEPTH_MS;
+    double lowCutHz_ = Nyth::Audio::Effects::Delay::DEFAULT_LOW_CUT_HZ;
+    double highCutHz_ = Nyth::Audio::Effects::Delay::DEFAULT_HIGH_CUT_HZ;
+    DelayMode mode_ = DelayMode::SINGLE;
+    DelayTap taps_[Nyth::Audio::Effects::Delay::MAX_TAPS] = {};
+    size_t numTaps_ = 0;
+
+    // derived
+    float targetDelay_ = 0.0f;
+    float smoothingCoeff_ = 0.0f;
+    float gainSmoothingCoeff_ = 0.0f;
+    float modDepth_ = 0.0f;
+    float lfoStepCos_ = 1.0f;
+    float lfoStepSin_ = 0.0f;
+    float tapTargets_[Nyth::Audio::Effects::Delay::MAX_TAPS] = {};
+    float lowCutCoeff_ = 0.0f;
+    float highCutCoeff_ = 1.0f;
+
     // state
-    std::vector<std::vector<float>> buffer_;
-    size_t writeIndex_ = Nyth::Audio::FX::DEFAULT_INDEX;
-    size_t readIndex_ = Nyth::Audio::FX::DEFAULT_INDEX;
+    FractionalDelayLine lines_[Nyth::Audio::FX::STEREO_CHANNELS];
+    float currentDelay_ = 0.0f;
+    bool snapDelay_ = true;
+    float mixSmooth_ = 0.0f;
+    float feedbackSmooth_ = 0.0f;
+    float tapDelays_[Nyth::Audio::Effects::Delay::MAX_TAPS] = {};
+    size_t smoothedTaps_ = 0;
+    DampingState damping_[Nyth::Audio::FX::STEREO_CHANNELS];
+    float lfoSin_ = 0.0f;
+    float lfoCos_ = 1.0f;
 };
 
-} // namespace Nyth { namespace Audio { namespace FX
+}}} // namespace Nyth { namespace Audio { namespace FX
@@ -2,6 +2,7 @@
 
 // C++17 compatible headers
 #include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <sstream>
@@ -13,6 +14,7 @@
 
 #include "../../core/components/constant/CoreConstants.hpp"
 #include "../../common/config/EffectConstants.hpp"
+#include "../../common/utils/ParameterEventQueue.hpp"
 
 
 namespace Nyth { namespace Audio { namespace FX {
@@ -35,11 +37,12 @@ public:
                         : Nyth::Audio::FX::DEFAULT_CHANNELS;
     }
 
+    // Lu par le thread audio à chaque bloc : modifiable depuis le thread de contrôle
     virtual void setEnabled(bool enabled) noexcept {
-        enabled_ = enabled;
+        enabled_.store(enabled, std::memory_order_relaxed);
     }
     [[nodiscard]] bool isEnabled() const noexcept {
-        return enabled_;
+        return enabled_.load(std::memory_order_relaxed);
     }
 
     [[nodiscard]] uint32_t getSampleRate() const noexcept {
@@ -50,9 +53,76 @@ public:
         return channels_;
     }
 
+    // Latency introduced by the effect (lookahead, oversampling filters...), in samples
+    [[nodiscard]] virtual uint32_t getLatencySamples() const noexcept {
+        return 0;
+    }
+
+    // === Automation (événements horodatés, thread de contrôle -> thread audio) ===
+
+    /**
+     * @brief Queues a parameter change for sample position sampleTime (control thread, single producer)
+     *
+     * The change is applied by the audio thread inside processMonoAt() /
+     * processStereoAt(), which split the block at the event. Timed events must
+     * be queued in non-decreasing sampleTime; a past time applies at the start
+     * of the next block. sampleTime 0 means "now": such changes have their own
+     * queue, drained at the start of every block, so they never wait behind a
+     * timed event. Parameter ids are the effect's own Param enum.
+     * @return false if the queue is full (the event is dropped)
+     */
+    bool scheduleParameter(uint32_t paramId, float value, uint64_t sampleTime = 0) noexcept {
+        if (sampleTime == 0) {
+            return immediate_.tryPush(ParameterEvent{0, paramId, value});
+        }
+        return events_.tryPush(ParameterEvent{sampleTime, paramId, value});
+    }
+
+    // Changement immédiat, pour une instance qui n'est pas traitée par le thread audio
+    void setParameter(uint32_t paramId, float value) noexcept {
+        applyParameter(paramId, value);
+    }
+
+    // Traite un bloc débutant à la position blockTime en appliquant les événements à l'échantillon près
+    void processMonoAt(const float* input, float* output, size_t numSamples, uint64_t blockTime) {
+        applyImmediate();
+        uint64_t next = 0;
+        if (!events_.peekTime(next)) {
+            processMono(input, output, numSamples);
+            return;
+        }
+        forEachSegment(numSamples, blockTime,
+                       [&](size_t offset, size_t n) { processMono(input + offset, output + offset, n); });
+    }
+
+    void processStereoAt(const float* inL, const float* inR, float* outL, float* outR, size_t numSamples,
+                         uint64_t blockTime) {
+        applyImmediate();
+        uint64_t next = 0;
+        if (!events_.peekTime(next)) {
+            processStereo(inL, inR, outL, outR, numSamples);
+            return;
+        }
+        forEachSegment(numSamples, blockTime, [&](size_t offset, size_t n) {
+            processStereo(inL + offset, inR + offset, outL + offset, outR + offset, n);
+        });
+    }
+
+    void processInterleavedAt(const float* input, float* output, size_t numFrames, uint64_t blockTime) {
+        applyImmediate();
+        uint64_t next = 0;
+        if (!events_.peekTime(next)) {
+            processInterleaved(input, output, numFrames);
+            return;
+        }
+        forEachSegment(numFrames, blockTime, [&](size_t offset, size_t n) {
+            processInterleaved(input + offset * 2, output + offset * 2, n);
+        });
+    }
+
     // Legacy methods for backward compatibility
     virtual void processMono(const float* input, float* output, size_t numSamples) {
-        if (!enabled_ || !input || !output || numSamples == Nyth::Audio::FX::ZERO_SAMPLES) {
+        if (!isEnabled() || !input || !output || numSamples == Nyth::Audio::FX::ZERO_SAMPLES) {
             if (output && input && output != input) {
                 std::copy_n(input, numSamples, output);
             }
@@ -65,7 +135,7 @@ public:
     }
 
     virtual void processStereo(const float* inL, const float* inR, float* outL, float* outR, size_t numSamples) {
-        if (!enabled_ || !inL || !inR || !outL || !outR || numSamples == Nyth::Audio::FX::ZERO_SAMPLES) {
+        if (!isEnabled() || !inL || !inR || !outL || !outR || numSamples == Nyth::Audio::FX::ZERO_SAMPLES) {
             if (outL && inL && outL != inL) {
                 std::copy_n(inL, numSamples, outL);
             }
@@ -81,6 +151,46 @@ public:
             std::copy_n(inR, numSamples, outR);
     }
 
+    /**
+     * @brief Stereo interleaved block (L0 R0 L1 R1 ...), in place allowed
+     *
+     * Default: deinterleaves INTERLEAVED_BLOCK_SIZE frames at a time on the
+     * stack and runs processStereo() in place. Effects that work on the
+     * interleaved layout directly override it along with isInterleavedNative().
+     */
+    virtual void processInterleaved(const float* input, float* output, size_t numFrames) {
+        if (!input || !output || numFrames == Nyth::Audio::FX::ZERO_SAMPLES) {
+            return;
+        }
+        if (!isEnabled()) {
+            if (output != input) {
+                std::copy_n(input, numFrames * 2, output);
+            }
+            return;
+        }
+        alignas(16) float left[Nyth::Audio::FX::INTERLEAVED_BLOCK_SIZE];
+        alignas(16) float right[Nyth::Audio::FX::INTERLEAVED_BLOCK_SIZE];
+        for (size_t offset = 0; offset < numFrames; offset += Nyth::Audio::FX::INTERLEAVED_BLOCK_SIZE) {
+            const size_t n = std::min(Nyth::Audio::FX::INTERLEAVED_BLOCK_SIZE, numFrames - offset);
+            const float* in = input + offset * 2;
+            for (size_t i = 0; i < n; ++i) {
+                left[i] = in[i * 2];
+                right[i] = in[i * 2 + 1];
+            }
+            processStereo(left, right, left, right, n);
+            float* out = output + offset * 2;
+            for (size_t i = 0; i < n; ++i) {
+                out[i * 2] = left[i];
+                out[i * 2 + 1] = right[i];
+            }
+        }
+    }
+
+    // Vrai si processInterleaved() ne désentrelace pas : le graphe lui passe alors le tampon entrelacé tel quel
+    [[nodiscard]] virtual bool isInterleavedNative() const noexcept {
+        return false;
+    }
+
     // C++17 modernized processing methods
     template <typename T = float>
     typename std::enable_if<std::is_floating_point<T>::value>::type processMono(
@@ -118,7 +228,7 @@ public:
         }
 
         // Pure C++17 implementation - passthrough by default
-        if (!enabled_ || inputL.empty()) {
+        if (!isEnabled() || inputL.empty()) {
             if (outputL.data() != inputL.data()) {
                 std::copy(inputL.begin(), inputL.end(), outputL.begin());
             }
@@ -148,9 +258,46 @@ public:
     }
 
 protected:
+    // Application d'un événement (thread audio) ; sans effet pour un effet sans paramètre automatisable
+    virtual void applyParameter(uint32_t paramId, float value) noexcept {
+        (void)paramId;
+        (void)value;
+    }
+
     uint32_t sampleRate_ = Nyth::Audio::FX::DEFAULT_SAMPLE_RATE;
     int channels_ = Nyth::Audio::FX::DEFAULT_CHANNELS;
-    bool enabled_ = Nyth::Audio::FX::DEFAULT_ENABLED_STATE;
+    std::atomic<bool> enabled_{Nyth::Audio::FX::DEFAULT_ENABLED_STATE};
+
+private:
+    // Changements immédiats : tous appliqués en début de bloc, dans l'ordre d'envoi
+    void applyImmediate() noexcept {
+        ParameterEvent event;
+        while (immediate_.popDue(0, event)) {
+            applyParameter(event.paramId, event.value);
+        }
+    }
+
+    // Découpe [blockTime, blockTime + numSamples) aux événements ; ceux qui sont dus sont appliqués avant chaque segment
+    template <typename Segment>
+    void forEachSegment(size_t numSamples, uint64_t blockTime, Segment&& segment) {
+        const uint64_t end = blockTime + numSamples;
+        uint64_t now = blockTime;
+        while (now < end) {
+            ParameterEvent event;
+            while (events_.popDue(now, event)) {
+                applyParameter(event.paramId, event.value);
+            }
+            uint64_t next = end;
+            if (!events_.peekTime(next) || next > end) {
+                next = end;
+            }
+            segment(static_cast<size_t>(now - blockTime), static_cast<size_t>(next - now));
+            now = next;
+        }
+    }
+
+    ParameterEventQueue<Nyth::Audio::FX::PARAMETER_EVENT_QUEUE_CAPACITY> events_;
+    ParameterEventQueue<Nyth::Audio::FX::PARAMETER_EVENT_QUEUE_CAPACITY> immediate_;
 };
 
-} // namespace Nyth { namespace Audio { namespace FX
+}}} // namespace Nyth { namespace Audio { namespace FX
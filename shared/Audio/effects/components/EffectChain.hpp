@@ -193,4 +193,4 @@ private:
     std::vector<float> scratch_;
 };
 
-} // namespace Nyth { namespace Audio { namespace FX
+}}} // namespace Nyth { namespace Audio { namespace FX
@@ -0,0 +1,828 @@
+#pragma once
+
+// C++17 standard headers
+#include "EffectBase.hpp"
+#include "../../common/config/EffectConstants.hpp"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace Nyth { namespace Audio { namespace FX {
+
+using GraphNodeId = uint32_t;
+
+/**
+ * @brief Directed acyclic graph of effects with latency compensation and a lock-free plan swap
+ *
+ * Nodes are effects or plain summing buses; weighted edges carry audio from
+ * the graph input (INPUT_NODE) to the graph output (OUTPUT_NODE). A node sums
+ * all its incoming edges, so one node feeding several others forms parallel
+ * branches, and a send/return is a gain edge into a bus or an effect plus an
+ * edge back to the output:
+ *
+ *     graph.connect(EffectGraph::INPUT_NODE, EffectGraph::OUTPUT_NODE);     // dry
+ *     graph.connect(EffectGraph::INPUT_NODE, reverb, 0.3f);                 // send
+ *     graph.connect(reverb, EffectGraph::OUTPUT_NODE);                      // return
+ *
+ * Topology edits only touch the control-side description. commit() compiles it
+ * into an immutable ExecutionPlan (nodes in topological order grouped by
+ * depth, one buffer per node, every allocation done) and publishes it through
+ * an atomic pointer; the audio thread picks it up at the start of its next
+ * block, with no lock. Retired plans go back to the control thread through a
+ * small ring of slots, which it empties (freeing the effects removed since) on
+ * the next commit() or collectGarbage(): the audio thread never allocates nor
+ * frees. Every commit() empties the ring before publishing, and at most two
+ * plans can be adopted between two commits (the one still pending, then the
+ * new one), so with two slots a published plan is always adopted on the next
+ * block, even when no collectGarbage() follows.
+ *
+ * Delay compensation: each edge is delayed by the difference between the
+ * latest arrival at its destination and its own path latency (sum of
+ * getLatencySamples() of the enabled effects upstream), so parallel branches
+ * stay sample-aligned. Latencies are sampled at commit(), from the node's
+ * control mirror when one is set (setControlMirror): commit again after a
+ * change that alters an effect's latency or enabled state.
+ *
+ * Parameter events queued on the effects (IAudioEffect::scheduleParameter)
+ * are timed against getSamplePosition(), the count of samples processed by
+ * the real-time stream: each node splits its sub-block at the events due in
+ * it. renderOffline() does not consume events.
+ *
+ * Control methods must all be called from one (non real-time) thread;
+ * processMono()/processStereo()/processInterleaved() from the audio thread
+ * only. renderOffline() runs the nodes of each depth level on a pool of
+ * worker threads, with the real-time stream stopped.
+ */
+class EffectGraph {
+public:
+    static constexpr GraphNodeId INPUT_NODE = 0;
+    static constexpr GraphNodeId OUTPUT_NODE = 1;
+    static constexpr GraphNodeId INVALID_NODE = std::numeric_limits<GraphNodeId>::max();
+
+    EffectGraph() {
+        nodes_.resize(2);
+        nodes_[INPUT_NODE].alive = true;
+        nodes_[OUTPUT_NODE].alive = true;
+    }
+
+    // Le flux audio doit être arrêté
+    ~EffectGraph() {
+        delete pending_.load(std::memory_order_acquire);
+        collectGarbage();
+        delete active_;
+    }
+
+    EffectGraph(const EffectGraph&) = delete;
+    EffectGraph& operator=(const EffectGraph&) = delete;
+
+    void setEnabled(bool enabled) noexcept {
+        enabled_.store(enabled, std::memory_order_relaxed);
+    }
+    [[nodiscard]] bool isEnabled() const noexcept {
+        return enabled_.load(std::memory_order_relaxed);
+    }
+
+    // Hors temps réel : prépare tous les effets puis recompile (les latences changent avec la fréquence)
+    void setSampleRate(uint32_t sampleRate, int numChannels) noexcept {
+        sampleRate_ = sampleRate >= Nyth::Audio::FX::MIN_SAMPLE_RATE ? sampleRate : Nyth::Audio::FX::DEFAULT_SAMPLE_RATE;
+        channels_ = (numChannels == Nyth::Audio::FX::MONO_CHANNELS || numChannels == Nyth::Audio::FX::STEREO_CHANNELS)
+                        ? numChannels
+                        : Nyth::Audio::FX::DEFAULT_CHANNELS;
+        for (auto& node : nodes_) {
+            if (node.alive && node.effect)
+                node.effect->setSampleRate(sampleRate_, channels_);
+        }
+        commit();
+    }
+
+    // === Topologie (thread de contrôle, effet au prochain commit()) ===
+
+    GraphNodeId addEffect(std::unique_ptr<IAudioEffect> effect) {
+        if (!effect) {
+            return INVALID_NODE;
+        }
+        effect->setSampleRate(sampleRate_, channels_);
+        Node node;
+        node.effect = std::shared_ptr<IAudioEffect>(std::move(effect));
+        node.alive = true;
+        nodes_.push_back(std::move(node));
+        return static_cast<GraphNodeId>(nodes_.size() - 1);
+    }
+
+    // Instance tenue par le thread de contrôle dont la latence et l'activation sont
+    // lues au commit() : l'effet du nœud ne voit ses paramètres qu'une fois sa file
+    // d'événements vidée par le thread audio. Doit survivre au nœud ou être retirée.
+    void setControlMirror(GraphNodeId id, const IAudioEffect* mirror) noexcept {
+        if (isAlive(id)) {
+            nodes_[id].mirror = mirror;
+        }
+    }
+
+    // Remplace l'effet du nœud par une instance préparée hors du thread audio (changement
+    // structurel : nombre de bandes, de taps, RI...) ; arêtes et miroir sont conservés.
+    // L'ancienne instance traite l'audio jusqu'au prochain commit(), puis est libérée avec
+    // son plan ; les événements encore dans sa file sont perdus.
+    bool replaceEffect(GraphNodeId id, std::unique_ptr<IAudioEffect> effect) {
+        if (!effect || !isAlive(id) || !nodes_[id].effect) {
+            return false;
+        }
+        if (effect->getSampleRate() != sampleRate_ || effect->getChannels() != channels_) {
+            effect->setSampleRate(sampleRate_, channels_);
+        }
+        nodes_[id].effect = std::shared_ptr<IAudioEffect>(std::move(effect));
+        return true;
+    }
+
+    // Nœud de sommation sans effet (retour d'envoi, sous-groupe)
+    GraphNodeId addBus() {
+        Node node;
+        node.alive = true;
+        nodes_.push_back(std::move(node));
+        return static_cast<GraphNodeId>(nodes_.size() - 1);
+    }
+
+    // L'effet reste vivant tant qu'un plan publié le référence
+    bool removeNode(GraphNodeId id) {
+        if (id == INPUT_NODE || id == OUTPUT_NODE || !isAlive(id)) {
+            return false;
+        }
+        nodes_[id].alive = false;
+        nodes_[id].effect.reset();
+        nodes_[id].mirror = nullptr;
+        edges_.erase(std::remove_if(edges_.begin(), edges_.end(),
+                                    [id](const Edge& e) { return e.from == id || e.to == id; }),
+                     edges_.end());
+        return true;
+    }
+
+    [[nodiscard]] IAudioEffect* getEffect(GraphNodeId id) const noexcept {
+        return isAlive(id) ? nodes_[id].effect.get() : nullptr;
+    }
+
+    // Crée l'arête ou met à jour son gain ; les cycles sont refusés par commit()
+    bool connect(GraphNodeId from, GraphNodeId to, float gain = 1.0f) {
+        if (!isAlive(from) || !isAlive(to) || from == to || from == OUTPUT_NODE || to == INPUT_NODE) {
+            return false;
+        }
+        for (auto& edge : edges_) {
+            if (edge.from == from && edge.to == to) {
+                edge.gain = gain;
+                return true;
+            }
+        }
+        edges_.push_back(Edge{from, to, gain});
+        return true;
+    }
+
+    bool disconnect(GraphNodeId from, GraphNodeId to) {
+        const auto it = std::find_if(edges_.begin(), edges_.end(),
+                                     [&](const Edge& e) { return e.from == from && e.to == to; });
+        if (it == edges_.end()) {
+            return false;
+        }
+        edges_.erase(it);
+        return true;
+    }
+
+    void disconnectAll() noexcept {
+        edges_.clear();
+    }
+
+    // Retire tous les nœuds d'effet et de bus (les identifiants ne sont jamais réutilisés)
+    void clear() noexcept {
+        for (GraphNodeId id = OUTPUT_NODE + 1; id < nodes_.size(); ++id) {
+            nodes_[id].alive = false;
+            nodes_[id].effect.reset();
+            nodes_[id].mirror = nullptr;
+        }
+        edges_.clear();
+    }
+
+    /**
+     * @brief Compiles the current topology and publishes it to the audio thread
+     * @return false if the graph has a cycle or allocation failed (the running plan is kept)
+     */
+    bool commit() noexcept {
+        collectGarbage();
+        try {
+            std::unique_ptr<ExecutionPlan> plan = compile(Nyth::Audio::FX::EFFECT_GRAPH_BLOCK_SIZE);
+            if (!plan) {
+                return false;
+            }
+            latency_ = plan->latency;
+            // Un plan encore en attente n'a jamais été vu par le thread audio
+            delete pending_.exchange(plan.release(), std::memory_order_acq_rel);
+            return true;
+        } catch (const std::exception&) {
+            return false;
+        }
+    }
+
+    // Libère les plans rendus par le thread audio (appelé aussi par commit())
+    void collectGarbage() noexcept {
+        for (std::atomic<ExecutionPlan*>& slot : retired_) {
+            delete slot.exchange(nullptr, std::memory_order_acq_rel);
+        }
+    }
+
+    // Latence entrée -> sortie du dernier plan compilé, en échantillons
+    [[nodiscard]] uint32_t getLatencySamples() const noexcept {
+        return latency_;
+    }
+
+    // Échantillons traités par le flux temps réel : base de temps des événements de paramètres
+    [[nodiscard]] uint64_t getSamplePosition() const noexcept {
+        return samplePosition_.load(std::memory_order_relaxed);
+    }
+
+    // === Traitement temps réel (sans verrou ni allocation) ===
+
+    void processMono(const float* input, float* output, size_t numSamples) {
+        ExecutionPlan* plan = acquirePlan();
+        const uint64_t position = samplePosition_.load(std::memory_order_relaxed);
+        samplePosition_.store(position + numSamples, std::memory_order_relaxed);
+        if (!plan || !isEnabled() || !input || !output || numSamples == 0) {
+            if (output != input && input && output) {
+                std::copy_n(input, numSamples, output);
+            }
+            return;
+        }
+        for (size_t offset = 0; offset < numSamples; offset += plan->blockSize) {
+            const size_t n = std::min(plan->blockSize, numSamples - offset);
+            std::copy_n(input + offset, n, plan->buffer(0, 0));
+            runSteps(*plan, n, false, nullptr, position + offset);
+            std::copy_n(plan->buffer(plan->outputBuffer, 0), n, output + offset);
+        }
+    }
+
+    void processStereo(const float* inL, const float* inR, float* outL, float* outR, size_t numSamples) {
+        ExecutionPlan* plan = acquirePlan();
+        const uint64_t position = samplePosition_.load(std::memory_order_relaxed);
+        samplePosition_.store(position + numSamples, std::memory_order_relaxed);
+        if (!plan || !isEnabled() || !inL || !inR || !outL || !outR || numSamples == 0) {
+            if (outL != inL && inL && outL)
+                std::copy_n(inL, numSamples, outL);
+            if (outR != inR && inR && outR)
+                std::copy_n(inR, numSamples, outR);
+            return;
+        }
+        for (size_t offset = 0; offset < numSamples; offset += plan->blockSize) {
+            const size_t n = std::min(plan->blockSize, numSamples - offset);
+            std::copy_n(inL + offset, n, plan->buffer(0, 0));
+            std::copy_n(inR + offset, n, plan->buffer(0, 1));
+            runSteps(*plan, n, true, nullptr, position + offset);
+            std::copy_n(plan->buffer(plan->outputBuffer, 0), n, outL + offset);
+            std::copy_n(plan->buffer(plan->outputBuffer, 1), n, outR + offset);
+        }
+    }
+
+    /**
+     * @brief Stereo interleaved block (L0 R0 L1 R1 ...), in place allowed
+     *
+     * A plain series of effects that all process interleaved audio natively
+     * (IAudioEffect::isInterleavedNative()) runs straight on the caller's
+     * buffer. Any other plan deinterleaves into its own input buffers and
+     * interleaves from its output buffers, with no intermediate copy.
+     */
+    void processInterleaved(const float* input, float* output, size_t numFrames) {
+        ExecutionPlan* plan = acquirePlan();
+        const uint64_t position = samplePosition_.load(std::memory_order_relaxed);
+        samplePosition_.store(position + numFrames, std::memory_order_relaxed);
+        if (!plan || !isEnabled() || !input || !output || numFrames == 0) {
+            if (output != input && input && output) {
+                std::copy_n(input, numFrames * 2, output);
+            }
+            return;
+        }
+        if (plan->interleaved) {
+            if (output != input) {
+                std::copy_n(input, numFrames * 2, output);
+            }
+            for (IAudioEffect* effect : plan->chain) {
+                effect->processInterleavedAt(output, output, numFrames, position);
+            }
+            return;
+        }
+        for (size_t offset = 0; offset < numFrames; offset += plan->blockSize) {
+            const size_t n = std::min(plan->blockSize, numFrames - offset);
+            const float* in = input + offset * 2;
+            float* left = plan->buffer(0, 0);
+            float* right = plan->buffer(0, 1);
+            for (size_t i = 0; i < n; ++i) {
+                left[i] = in[i * 2];
+                right[i] = in[i * 2 + 1];
+            }
+            runSteps(*plan, n, true, nullptr, position + offset);
+            const float* outL = plan->buffer(plan->outputBuffer, 0);
+            const float* outR = plan->buffer(plan->outputBuffer, 1);
+            float* out = output + offset * 2;
+            for (size_t i = 0; i < n; ++i) {
+                out[i * 2] = outL[i];
+                out[i * 2 + 1] = outR[i];
+            }
+        }
+    }
+
+    /**
+     * @brief Renders a whole buffer with independent nodes spread across worker threads
+     *
+     * Uses a private plan (fresh compensation lines) over the same effect
+     * instances, so the real-time stream must be stopped. The graph latency is
+     * removed: output[i] lines up with input[i]. inR/outR null = mono.
+     * @param numThreads 0 = hardware concurrency (capped to the widest level)
+     * @return false on a cycle, invalid buffers or allocation / thread failure
+     */
+    bool renderOffline(const float* inL, const float* inR, float* outL, float* outR, size_t numSamples,
+                       size_t numThreads = 0) {
+        if (!inL || !outL || (inR == nullptr) != (outR == nullptr)) {
+            return false;
+        }
+        try {
+            std::unique_ptr<ExecutionPlan> plan = compile(Nyth::Audio::FX::EFFECT_GRAPH_OFFLINE_BLOCK_SIZE);
+            if (!plan) {
+                return false;
+            }
+            if (numThreads == 0) {
+                numThreads = std::max<size_t>(1, std::thread::hardware_concurrency());
+            }
+            numThreads = std::max<size_t>(1, std::min(numThreads, plan->maxWidth));
+            GraphWorkers workers(numThreads - 1);
+            GraphWorkers* pool = numThreads > 1 ? &workers : nullptr;
+
+            const bool stereo = inR != nullptr;
+            const size_t latency = plan->latency;
+            const size_t total = numSamples + latency;
+            for (size_t position = 0; position < total; position += plan->blockSize) {
+                const size_t n = std::min(plan->blockSize, total - position);
+                // Entrée prolongée de zéros pour vider la latence
+                const size_t available = position < numSamples ? std::min(n, numSamples - position) : 0;
+                for (int ch = 0; ch < (stereo ? 2 : 1); ++ch) {
+                    const float* in = ch == 0 ? inL : inR;
+                    float* dst = plan->buffer(0, ch);
+                    std::copy_n(in + position, available, dst);
+                    std::fill(dst + available, dst + n, 0.0f);
+                }
+                runSteps(*plan, n, stereo, pool, NO_AUTOMATION);
+
+                // Les latency premiers échantillons de sortie sont écartés
+                const size_t skip = position < latency ? std::min(n, latency - position) : 0;
+                const size_t dstStart = position + skip - latency;
+                for (int ch = 0; ch < (stereo ? 2 : 1); ++ch) {
+                    float* out = ch == 0 ? outL : outR;
+                    std::copy_n(plan->buffer(plan->outputBuffer, ch) + skip, n - skip, out + dstStart);
+                }
+            }
+            return true;
+        } catch (const std::exception&) {
+            return false;
+        }
+    }
+
+private:
+    static constexpr uint64_t NO_AUTOMATION = std::numeric_limits<uint64_t>::max();
+
+    struct Node {
+        std::shared_ptr<IAudioEffect> effect; // nullptr : entrée, sortie ou bus
+        const IAudioEffect* mirror = nullptr;  // état de contrôle (setControlMirror)
+        bool alive = false;
+    };
+
+    struct Edge {
+        GraphNodeId from;
+        GraphNodeId to;
+        float gain;
+    };
+
+    // Retard entier de compensation (ligne de exactement delay échantillons)
+    struct CompensationDelay {
+        std::vector<float> line;
+        size_t position = 0;
+
+        // y = (overwrite ? 0 : y) + gain . x[n - delay]
+        void mixInto(const float* x, float* y, size_t n, float gain, bool overwrite) noexcept {
+            float* data = line.data();
+            const size_t size = line.size();
+            size_t pos = position;
+            for (size_t i = 0; i < n; ++i) {
+                const float delayed = data[pos];
+                data[pos] = x[i];
+                y[i] = (overwrite ? 0.0f : y[i]) + gain * delayed;
+                if (++pos == size)
+                    pos = 0;
+            }
+            position = pos;
+        }
+    };
+
+    struct PlanInput {
+        uint32_t source; // tampon amont (0 = entrée du graphe)
+        float gain;
+        int32_t delay;   // paire de lignes dans delays, -1 sans compensation
+    };
+
+    struct PlanStep {
+        IAudioEffect* effect = nullptr; // nullptr : bus ou sortie (somme seule)
+        uint32_t buffer = 0;
+        uint32_t firstInput = 0;
+        uint32_t numInputs = 0;
+    };
+
+    // Immuable une fois publié, hormis le contenu des tampons et des lignes
+    struct ExecutionPlan {
+        std::vector<std::shared_ptr<IAudioEffect>> effects; // maintient les instances en vie
+        std::vector<PlanStep> steps;                        // par niveau de profondeur, la sortie en dernier
+        std::vector<uint32_t> levels;                       // début de chaque niveau dans steps, puis la fin
+        std::vector<PlanInput> inputs;
+        std::vector<CompensationDelay> delays; // 2 lignes (G, D) par arête compensée
+        std::vector<float> buffers;            // (étapes + 1) tampons x 2 canaux x blockSize
+        std::vector<IAudioEffect*> chain;      // effets de la série si interleaved
+        bool interleaved = false;              // série simple d'effets entrelacés natifs (processInterleaved)
+        size_t blockSize = 0;
+        size_t maxWidth = 1; // nombre maximal d'étapes indépendantes d'un niveau
+        uint32_t outputBuffer = 0;
+        uint32_t latency = 0;
+
+        float* buffer(uint32_t index, int channel) noexcept {
+            return buffers.data() + (static_cast<size_t>(index) * 2 + static_cast<size_t>(channel)) * blockSize;
+        }
+    };
+
+    // Exécute task(i), i < count, réparti statiquement entre l'appelant et les fils (rendu hors ligne)
+    class GraphWorkers {
+    public:
+        explicit GraphWorkers(size_t numWorkers) : stride_(numWorkers + 1) {
+            try {
+                threads_.reserve(numWorkers);
+                for (size_t w = 0; w < numWorkers; ++w) {
+                    threads_.emplace_back(&GraphWorkers::workerLoop, this, w + 1);
+                }
+            } catch (...) {
+                stop();
+                throw;
+            }
+        }
+        ~GraphWorkers() {
+            stop();
+        }
+
+        GraphWorkers(const GraphWorkers&) = delete;
+        GraphWorkers& operator=(const GraphWorkers&) = delete;
+
+        void run(size_t count, const std::function<void(size_t)>& task) {
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                task_ = &task;
+                count_ = count;
+                finished_ = 0;
+                ++generation_;
+            }
+            wakeCv_.notify_all();
+            runShare(0, task, count);
+            std::unique_lock<std::mutex> lock(mutex_);
+            doneCv_.wait(lock, [this] { return finished_ == threads_.size(); });
+        }
+
+    private:
+        void runShare(size_t share, const std::function<void(size_t)>& task, size_t count) const {
+            for (size_t i = share; i < count; i += stride_) {
+                task(i);
+            }
+        }
+
+        void workerLoop(size_t share) {
+            uint64_t seen = 0;
+            for (;;) {
+                const std::function<void(size_t)>* task = nullptr;
+                size_t count = 0;
+                {
+                    std::unique_lock<std::mutex> lock(mutex_);
+                    wakeCv_.wait(lock, [&] { return stopRequested_ || generation_ != seen; });
+                    if (stopRequested_)
+                        return;
+                    seen = generation_;
+                    task = task_;
+                    count = count_;
+                }
+                runShare(share, *task, count);
+                {
+                    std::lock_guard<std::mutex> lock(mutex_);
+                    ++finished_;
+                }
+                doneCv_.notify_one();
+            }
+        }
+
+        void stop() noexcept {
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                stopRequested_ = true;
+            }
+            wakeCv_.notify_all();
+            for (auto& thread : threads_) {
+                if (thread.joinable())
+                    thread.join();
+            }
+        }
+
+        const size_t stride_;
+        std::vector<std::thread> threads_;
+        std::mutex mutex_;
+        std::condition_variable wakeCv_;
+        std::condition_variable doneCv_;
+        const std::function<void(size_t)>* task_ = nullptr;
+        size_t count_ = 0;
+        size_t finished_ = 0;
+        uint64_t generation_ = 0;
+        bool stopRequested_ = false;
+    };
+
+    [[nodiscard]] bool isAlive(GraphNodeId id) const noexcept {
+        return id < nodes_.size() && nodes_[id].alive;
+    }
+
+    [[nodiscard]] uint32_t nodeLatency(GraphNodeId id) const noexcept {
+        const IAudioEffect* effect = nodes_[id].mirror ? nodes_[id].mirror : nodes_[id].effect.get();
+        return effect && effect->isEnabled() ? effect->getLatencySamples() : 0;
+    }
+
+    // Thread de contrôle : toutes les allocations du plan sont faites ici
+    std::unique_ptr<ExecutionPlan> compile(size_t blockSize) const {
+        const size_t count = nodes_.size();
+        std::vector<std::vector<size_t>> outgoing(count);
+        std::vector<std::vector<size_t>> incoming(count);
+        for (size_t e = 0; e < edges_.size(); ++e) {
+            outgoing[edges_[e].from].push_back(e);
+            incoming[edges_[e].to].push_back(e);
+        }
+
+        // Nœuds utiles : atteints depuis l'entrée et menant à la sortie
+        std::vector<char> fromInput(count, 0);
+        std::vector<char> toOutput(count, 0);
+        std::vector<GraphNodeId> stack{INPUT_NODE};
+        fromInput[INPUT_NODE] = 1;
+        while (!stack.empty()) {
+            const GraphNodeId id = stack.back();
+            stack.pop_back();
+            for (size_t e : outgoing[id]) {
+                const GraphNodeId next = edges_[e].to;
+                if (!fromInput[next]) {
+                    fromInput[next] = 1;
+                    stack.push_back(next);
+                }
+            }
+        }
+        stack.push_back(OUTPUT_NODE);
+        toOutput[OUTPUT_NODE] = 1;
+        while (!stack.empty()) {
+            const GraphNodeId id = stack.back();
+            stack.pop_back();
+            for (size_t e : incoming[id]) {
+                const GraphNodeId prev = edges_[e].from;
+                if (!toOutput[prev]) {
+                    toOutput[prev] = 1;
+                    stack.push_back(prev);
+                }
+            }
+        }
+        std::vector<char> useful(count, 0);
+        size_t usefulCount = 0;
+        for (size_t id = 0; id < count; ++id) {
+            useful[id] = (nodes_[id].alive && fromInput[id] && toOutput[id]) || id == INPUT_NODE || id == OUTPUT_NODE;
+            usefulCount += useful[id] ? 1 : 0;
+        }
+
+        // Kahn : ordre topologique, profondeur et latence d'arrivée de chaque nœud
+        std::vector<uint32_t> pendingInputs(count, 0);
+        for (const auto& edge : edges_) {
+            if (useful[edge.from] && useful[edge.to])
+                ++pendingInputs[edge.to];
+        }
+        std::vector<size_t> depth(count, 0);
+        std::vector<uint32_t> inLatency(count, 0);
+        std::vector<uint32_t> outLatency(count, 0);
+        std::vector<GraphNodeId> order;
+        order.reserve(usefulCount);
+        for (GraphNodeId id = 0; id < count; ++id) {
+            if (useful[id] && pendingInputs[id] == 0)
+                stack.push_back(id);
+        }
+        while (!stack.empty()) {
+            const GraphNodeId id = stack.back();
+            stack.pop_back();
+            order.push_back(id);
+            outLatency[id] = inLatency[id] + nodeLatency(id);
+            for (size_t e : outgoing[id]) {
+                const GraphNodeId next = edges_[e].to;
+                if (!useful[next])
+                    continue;
+                depth[next] = std::max(depth[next], depth[id] + 1);
+                inLatency[next] = std::max(inLatency[next], outLatency[id]);
+                if (--pendingInputs[next] == 0)
+                    stack.push_back(next);
+            }
+        }
+        if (order.size() != usefulCount) {
+            return nullptr; // cycle
+        }
+
+        // Tout nœud utile mène à la sortie : elle est seule au niveau le plus profond
+        order.erase(std::remove(order.begin(), order.end(), INPUT_NODE), order.end());
+        std::stable_sort(order.begin(), order.end(),
+                         [&](GraphNodeId a, GraphNodeId b) { return depth[a] < depth[b]; });
+
+        auto plan = std::make_unique<ExecutionPlan>();
+        plan->blockSize = blockSize;
+        plan->latency = inLatency[OUTPUT_NODE];
+        std::vector<uint32_t> bufferOf(count, 0);
+        for (size_t s = 0; s < order.size(); ++s) {
+            bufferOf[order[s]] = static_cast<uint32_t>(s + 1);
+        }
+
+        plan->steps.reserve(order.size());
+        for (size_t s = 0; s < order.size(); ++s) {
+            const GraphNodeId id = order[s];
+            if (s == 0 || depth[id] != depth[order[s - 1]]) {
+                plan->levels.push_back(static_cast<uint32_t>(s));
+            }
+            PlanStep step;
+            step.effect = nodes_[id].effect.get();
+            step.buffer = bufferOf[id];
+            step.firstInput = static_cast<uint32_t>(plan->inputs.size());
+            if (nodes_[id].effect) {
+                plan->effects.push_back(nodes_[id].effect);
+            }
+            for (size_t e : incoming[id]) {
+                const Edge& edge = edges_[e];
+                if (!useful[edge.from])
+                    continue;
+                PlanInput input{bufferOf[edge.from], edge.gain, -1};
+                const uint32_t compensation = inLatency[id] - outLatency[edge.from];
+                if (compensation > 0) {
+                    input.delay = static_cast<int32_t>(plan->delays.size() / 2);
+                    for (int ch = 0; ch < 2; ++ch) {
+                        CompensationDelay line;
+                        line.line.assign(compensation, 0.0f);
+                        plan->delays.push_back(std::move(line));
+                    }
+                }
+                plan->inputs.push_back(input);
+            }
+            step.numInputs = static_cast<uint32_t>(plan->inputs.size()) - step.firstInput;
+            plan->steps.push_back(step);
+        }
+        plan->levels.push_back(static_cast<uint32_t>(order.size()));
+        for (size_t l = 0; l + 1 < plan->levels.size(); ++l) {
+            plan->maxWidth = std::max<size_t>(plan->maxWidth, plan->levels[l + 1] - plan->levels[l]);
+        }
+        plan->outputBuffer = bufferOf[OUTPUT_NODE];
+        plan->buffers.assign((order.size() + 1) * 2 * blockSize, 0.0f);
+        markInterleavedChain(*plan);
+        return plan;
+    }
+
+    // Série entrée -> effets -> sortie, sans gain, somme ni compensation, dont chaque effet traite l'entrelacé
+    static void markInterleavedChain(ExecutionPlan& plan) {
+        uint32_t previous = 0;
+        for (const PlanStep& step : plan.steps) {
+            if (step.numInputs != 1) {
+                return;
+            }
+            const PlanInput& input = plan.inputs[step.firstInput];
+            if (input.source != previous || input.gain != 1.0f || input.delay >= 0) {
+                return;
+            }
+            if (step.effect && !step.effect->isInterleavedNative()) {
+                return;
+            }
+            previous = step.buffer;
+        }
+        for (const PlanStep& step : plan.steps) {
+            if (step.effect) {
+                plan.chain.push_back(step.effect);
+            }
+        }
+        plan.interleaved = true;
+    }
+
+    // Thread audio : adopte le plan en attente s'il reste un emplacement pour rendre l'actuel
+    ExecutionPlan* acquirePlan() noexcept {
+        if (pending_.load(std::memory_order_relaxed) == nullptr) {
+            return active_;
+        }
+        // Seul le thread audio remplit un emplacement : vide ici, il le reste jusqu'au store
+        for (std::atomic<ExecutionPlan*>& slot : retired_) {
+            if (slot.load(std::memory_order_acquire) == nullptr) {
+                ExecutionPlan* next = pending_.exchange(nullptr, std::memory_order_acq_rel);
+                if (next) {
+                    slot.store(active_, std::memory_order_release);
+                    active_ = next;
+                }
+                break;
+            }
+        }
+        return active_;
+    }
+
+    // blockTime : position du sous-bloc pour les événements de paramètres (NO_AUTOMATION : hors ligne)
+    static void runSteps(ExecutionPlan& plan, size_t n, bool stereo, GraphWorkers* workers, uint64_t blockTime) {
+        for (size_t l = 0; l + 1 < plan.levels.size(); ++l) {
+            const uint32_t begin = plan.levels[l];
+            const uint32_t end = plan.levels[l + 1];
+            if (workers && end - begin > 1) {
+                workers->run(end - begin,
+                             [&](size_t i) { runStep(plan, begin + static_cast<uint32_t>(i), n, stereo, blockTime); });
+            } else {
+                for (uint32_t s = begin; s < end; ++s) {
+                    runStep(plan, s, n, stereo, blockTime);
+                }
+            }
+        }
+    }
+
+    static void runStep(ExecutionPlan& plan, uint32_t index, size_t n, bool stereo, uint64_t blockTime) {
+        const PlanStep& step = plan.steps[index];
+        float* dstL = plan.buffer(step.buffer, 0);
+        float* dstR = plan.buffer(step.buffer, 1);
+
+        // Entrée unique, gain unité, sans compensation : l'effet lit directement le tampon amont
+        if (step.effect && step.numInputs == 1) {
+            const PlanInput& input = plan.inputs[step.firstInput];
+            if (input.delay < 0 && input.gain == 1.0f) {
+                processEffect(*step.effect, plan.buffer(input.source, 0), plan.buffer(input.source, 1), dstL, dstR, n,
+                              stereo, blockTime);
+                return;
+            }
+        }
+
+        mixInputs(plan, step, n, stereo ? 2 : 1);
+        if (step.effect) {
+            processEffect(*step.effect, dstL, dstR, dstL, dstR, n, stereo, blockTime);
+        }
+    }
+
+    static void processEffect(IAudioEffect& effect, const float* inL, const float* inR, float* outL, float* outR,
+                              size_t n, bool stereo, uint64_t blockTime) {
+        if (blockTime == NO_AUTOMATION) {
+            if (stereo) {
+                effect.processStereo(inL, inR, outL, outR, n);
+            } else {
+                effect.processMono(inL, outL, n);
+            }
+        } else if (stereo) {
+            effect.processStereoAt(inL, inR, outL, outR, n, blockTime);
+        } else {
+            effect.processMonoAt(inL, outL, n, blockTime);
+        }
+    }
+
+    static void mixInputs(ExecutionPlan& plan, const PlanStep& step, size_t n, int channels) noexcept {
+        for (int ch = 0; ch < channels; ++ch) {
+            float* dst = plan.buffer(step.buffer, ch);
+            if (step.numInputs == 0) {
+                std::fill_n(dst, n, 0.0f);
+                continue;
+            }
+            for (uint32_t k = 0; k < step.numInputs; ++k) {
+                const PlanInput& input = plan.inputs[step.firstInput + k];
+                const float* src = plan.buffer(input.source, ch);
+                const float gain = input.gain;
+                if (input.delay >= 0) {
+                    plan.delays[static_cast<size_t>(input.delay) * 2 + static_cast<size_t>(ch)].mixInto(src, dst, n, gain,
+                                                                                                       k == 0);
+                } else if (k == 0) {
+                    for (size_t i = 0; i < n; ++i)
+                        dst[i] = gain * src[i];
+                } else {
+                    for (size_t i = 0; i < n; ++i)
+                        dst[i] += gain * src[i];
+                }
+            }
+        }
+    }
+
+    // description (thread de contrôle)
+    std::vector<Node> nodes_;
+    std::vector<Edge> edges_;
+    uint32_t sampleRate_ = Nyth::Audio::FX::DEFAULT_SAMPLE_RATE;
+    int channels_ = Nyth::Audio::FX::DEFAULT_CHANNELS;
+    uint32_t latency_ = 0;
+    std::atomic<bool> enabled_{Nyth::Audio::FX::DEFAULT_ENABLED};
+
+    // publication : contrôle -> pending_ -> audio (active_) -> retired_ -> contrôle
+    std::atomic<ExecutionPlan*> pending_{nullptr};
+    std::array<std::atomic<ExecutionPlan*>, Nyth::Audio::FX::EFFECT_GRAPH_RETIRED_SLOTS> retired_{};
+    ExecutionPlan* active_ = nullptr; // thread audio uniquement
+    std::atomic<uint64_t> samplePosition_{0}; // écrit par le thread audio uniquement
+};
+
+}}} // namespace Nyth { namespace Audio { namespace FX
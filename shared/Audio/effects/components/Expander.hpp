@@ -0,0 +1,207 @@
+#pragma once
+
+// C++17 standard headers
+#include "EffectBase.hpp"
+#include "../../common/config/EffectConstants.hpp"
+#include "../../common/dsp/DynamicsDetector.hpp"
+#include "../../common/dsp/VectorMath.hpp"
+#include "../config/EffectsLimits.h" // Source of truth for default values
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+namespace Nyth { namespace Audio { namespace FX {
+
+/**
+ * @brief Downward expander with soft knee and linked stereo detection
+ *
+ * Per sub-block of DYNAMICS_BLOCK_SIZE samples: Dynamics::LevelDetector gives
+ * the peak level in dB (vectorized rectify and log2), the static curve lowers
+ * signals under the threshold by (ratio - 1) dB per dB, down to rangeDb, then
+ * the gain in dB is smoothed (attack = opening, release = closing) and
+ * converted back with the vectorized exp2 kernel.
+ */
+class ExpanderEffect final : public IAudioEffect {
+public:
+    using IAudioEffect::processMono;   // évite le masquage des surcharges (templates span)
+    using IAudioEffect::processStereo; // idem
+
+    // Paramètres automatisables (scheduleParameter)
+    enum class Param : uint32_t { THRESHOLD_DB = 0, RATIO, RANGE_DB, KNEE_DB, ATTACK_MS, RELEASE_MS };
+
+    struct ExpanderParameters {
+        float thresholdDb;
+        float ratio;
+        float rangeDb;
+        float kneeDb;
+        float attackMs;
+        float releaseMs;
+    };
+
+    ExpanderEffect() {
+        updateCoefficients();
+    }
+
+    void setParameters(double thresholdDb, double ratio, double rangeDb, double kneeDb, double attackMs,
+                       double releaseMs) noexcept {
+        thresholdDb_ = std::max(static_cast<double>(Nyth::Audio::Effects::Expander::MIN_THRESHOLD_DB),
+                                std::min(static_cast<double>(Nyth::Audio::Effects::Expander::MAX_THRESHOLD_DB),
+                                         thresholdDb));
+        ratio_ = std::max(static_cast<double>(Nyth::Audio::Effects::Expander::MIN_RATIO),
+                          std::min(static_cast<double>(Nyth::Audio::Effects::Expander::MAX_RATIO), ratio));
+        rangeDb_ = std::max(static_cast<double>(Nyth::Audio::Effects::Expander::MIN_RANGE_DB),
+                            std::min(static_cast<double>(Nyth::Audio::Effects::Expander::MAX_RANGE_DB), rangeDb));
+        kneeDb_ = std::max(static_cast<double>(Nyth::Audio::Effects::Expander::MIN_KNEE_DB),
+                           std::min(static_cast<double>(Nyth::Audio::Effects::Expander::MAX_KNEE_DB), kneeDb));
+        attackMs_ = std::max(static_cast<double>(Nyth::Audio::Effects::Expander::MIN_ATTACK_MS),
+                             std::min(static_cast<double>(Nyth::Audio::Effects::Expander::MAX_ATTACK_MS), attackMs));
+        releaseMs_ = std::max(static_cast<double>(Nyth::Audio::Effects::Expander::MIN_RELEASE_MS),
+                              std::min(static_cast<double>(Nyth::Audio::Effects::Expander::MAX_RELEASE_MS),
+                                       releaseMs));
+        updateCoefficients();
+    }
+
+    [[nodiscard]] ExpanderParameters getParameters() const noexcept {
+        return ExpanderParameters{
+            .thresholdDb = static_cast<float>(thresholdDb_),
+            .ratio = static_cast<float>(ratio_),
+            .rangeDb = static_cast<float>(rangeDb_),
+            .kneeDb = static_cast<float>(kneeDb_),
+            .attackMs = static_cast<float>(attackMs_),
+            .releaseMs = static_cast<float>(releaseMs_)
+        };
+    }
+
+    // Atténuation courante en dB (<= 0), publiée par le thread audio à chaque bloc
+    [[nodiscard]] float getGainReductionDb() const noexcept {
+        return meterGainDb_.load(std::memory_order_relaxed);
+    }
+
+    void setSampleRate(uint32_t sampleRate, int numChannels) noexcept override {
+        IAudioEffect::setSampleRate(sampleRate, numChannels);
+        detector_.setTimes(Nyth::Audio::FX::DYNAMICS_DETECTOR_ATTACK_MS, Nyth::Audio::FX::DYNAMICS_DETECTOR_RELEASE_MS,
+                           static_cast<double>(sampleRate_));
+        detector_.reset();
+        updateCoefficients();
+        gainSmoother_.reset(0.0f);
+        meterGainDb_.store(0.0f, std::memory_order_relaxed);
+    }
+
+    void processMono(const float* input, float* output, size_t numSamples) override {
+        if (!isEnabled() || !input || !output || numSamples == 0) {
+            if (output != input && input && output) {
+                std::copy_n(input, numSamples, output);
+            }
+            return;
+        }
+        for (size_t offset = 0; offset < numSamples; offset += BLOCK) {
+            const size_t n = std::min(BLOCK, numSamples - offset);
+            const float* x = input + offset;
+            float* y = output + offset;
+            detector_.processMono(x, gain_, n);
+            computeGains(gain_, n);
+            for (size_t i = 0; i < n; ++i) {
+                y[i] = x[i] * gain_[i];
+            }
+        }
+    }
+
+    void processStereo(const float* inL, const float* inR, float* outL, float* outR, size_t numSamples) override {
+        if (!isEnabled() || !inL || !inR || !outL || !outR || numSamples == 0) {
+            if (outL != inL && inL && outL)
+                std::copy_n(inL, numSamples, outL);
+            if (outR != inR && inR && outR)
+                std::copy_n(inR, numSamples, outR);
+            return;
+        }
+        for (size_t offset = 0; offset < numSamples; offset += BLOCK) {
+            const size_t n = std::min(BLOCK, numSamples - offset);
+            const float* xl = inL + offset;
+            const float* xr = inR + offset;
+            float* yl = outL + offset;
+            float* yr = outR + offset;
+            // Détection liée : une seule courbe de gain pour les deux canaux
+            detector_.processStereo(xl, xr, gain_, n);
+            computeGains(gain_, n);
+            for (size_t i = 0; i < n; ++i) {
+                yl[i] = xl[i] * gain_[i];
+                yr[i] = xr[i] * gain_[i];
+            }
+        }
+    }
+
+protected:
+    void applyParameter(uint32_t paramId, float value) noexcept override {
+        switch (static_cast<Param>(paramId)) {
+            case Param::THRESHOLD_DB:
+                setParameters(value, ratio_, rangeDb_, kneeDb_, attackMs_, releaseMs_);
+                break;
+            case Param::RATIO:
+                setParameters(thresholdDb_, value, rangeDb_, kneeDb_, attackMs_, releaseMs_);
+                break;
+            case Param::RANGE_DB:
+                setParameters(thresholdDb_, ratio_, value, kneeDb_, attackMs_, releaseMs_);
+                break;
+            case Param::KNEE_DB:
+                setParameters(thresholdDb_, ratio_, rangeDb_, value, attackMs_, releaseMs_);
+                break;
+            case Param::ATTACK_MS:
+                setParameters(thresholdDb_, ratio_, rangeDb_, kneeDb_, value, releaseMs_);
+                break;
+            case Param::RELEASE_MS:
+                setParameters(thresholdDb_, ratio_, rangeDb_, kneeDb_, attackMs_, value);
+                break;
+        }
+    }
+
+private:
+    static constexpr size_t BLOCK = Nyth::Audio::FX::DYNAMICS_BLOCK_SIZE;
+
+    void updateCoefficients() noexcept {
+        gainSmoother_.setTimes(attackMs_, releaseMs_, static_cast<double>(sampleRate_));
+        slope_ = static_cast<float>(ratio_ - 1.0);
+        kneeWidth_ = std::max(static_cast<float>(kneeDb_), Nyth::Audio::FX::MIN_KNEE_WIDTH_DB);
+    }
+
+    // Transforme, en place, le niveau détecté (dB) en gain linéaire
+    void computeGains(float* buffer, size_t n) noexcept {
+        const float threshold = static_cast<float>(thresholdDb_);
+        const float range = static_cast<float>(rangeDb_);
+        const float halfKnee = 0.5f * kneeWidth_;
+        const float invTwoKnee = 0.5f / kneeWidth_;
+        const float slope = slope_;
+
+        // Courbe statique à genou doux (miroir de celle du compresseur), sans branchement
+        for (size_t i = 0; i < n; ++i) {
+            const float under = threshold - buffer[i];
+            const float k = std::min(std::max(under + halfKnee, 0.0f), kneeWidth_);
+            const float gainDb = -slope * (k * k * invTwoKnee + std::max(under - halfKnee, 0.0f));
+            buffer[i] = std::max(gainDb, range);
+        }
+        gainSmoother_.process(buffer, buffer, n);
+        meterGainDb_.store(gainSmoother_.value(), std::memory_order_relaxed);
+        VectorMath::dbToLinear(buffer, buffer, n);
+    }
+
+    // params
+    double thresholdDb_ = Nyth::Audio::Effects::Expander::DEFAULT_THRESHOLD_DB;
+    double ratio_ = Nyth::Audio::Effects::Expander::DEFAULT_RATIO;
+    double rangeDb_ = Nyth::Audio::Effects::Expander::DEFAULT_RANGE_DB;
+    double kneeDb_ = Nyth::Audio::Effects::Expander::DEFAULT_KNEE_DB;
+    double attackMs_ = Nyth::Audio::Effects::Expander::DEFAULT_ATTACK_MS;
+    double releaseMs_ = Nyth::Audio::Effects::Expander::DEFAULT_RELEASE_MS;
+
+    // derived
+    float slope_ = 0.0f;
+    float kneeWidth_ = Nyth::Audio::Effects::Expander::DEFAULT_KNEE_DB;
+
+    // state
+    Dynamics::LevelDetector detector_;
+    Dynamics::AttackReleaseFilter gainSmoother_; // gain en dB
+    std::atomic<float> meterGainDb_{0.0f};
+    alignas(16) float gain_[BLOCK] = {};
+};
+
+}}} // namespace Nyth { namespace Audio { namespace FX
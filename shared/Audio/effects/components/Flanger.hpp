@@ -0,0 +1,186 @@
+#pragma once
+
+// C++17 standard headers
+#include "EffectBase.hpp"
+#include "../../common/config/EffectConstants.hpp"
+#include "../../common/dsp/BlockLfo.hpp"
+#include "../../common/dsp/FractionalDelayLine.hpp"
+#include "../config/EffectsLimits.h" // Source of truth for default values
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+namespace Nyth { namespace Audio { namespace FX {
+
+/**
+ * @brief Flanger: short modulated delay with feedback
+ *
+ * One Hermite tap per channel sweeps baseDelay + depth * (1 + lfo) / 2 (a
+ * triangle LFO by default, the classic linear comb sweep), and the tap is fed
+ * back into the line. Negative feedback moves the comb notches onto the odd
+ * harmonics. LFO values come from the shared BlockLfo once per
+ * MODULATION_BLOCK_SIZE sub-block; the right channel runs a quarter cycle
+ * later. Lines are allocated in setSampleRate().
+ */
+class FlangerEffect final : public IAudioEffect {
+public:
+    using IAudioEffect::processMono;   // évite le masquage des surcharges (templates span)
+    using IAudioEffect::processStereo; // idem
+
+    // Paramètres automatisables (scheduleParameter)
+    enum class Param : uint32_t { RATE_HZ = 0, DEPTH_MS, DELAY_MS, FEEDBACK, MIX };
+
+    struct FlangerParameters {
+        float rateHz;
+        float depthMs;
+        float delayMs;
+        float feedback;
+        float mix;
+    };
+
+    FlangerEffect() {
+        lfo_.setShape(LfoShape::TRIANGLE);
+        lfo_.setRate(rateHz_);
+        updateCoefficients();
+    }
+
+    void setParameters(double rateHz, double depthMs, double delayMs, double feedback, double mix) noexcept {
+        rateHz_ = std::max(static_cast<double>(Nyth::Audio::Effects::Flanger::MIN_RATE_HZ),
+                           std::min(static_cast<double>(Nyth::Audio::Effects::Flanger::MAX_RATE_HZ), rateHz));
+        depthMs_ = std::max(static_cast<double>(Nyth::Audio::Effects::Flanger::MIN_DEPTH_MS),
+                            std::min(static_cast<double>(Nyth::Audio::Effects::Flanger::MAX_DEPTH_MS), depthMs));
+        delayMs_ = std::max(static_cast<double>(Nyth::Audio::Effects::Flanger::MIN_DELAY_MS),
+                            std::min(static_cast<double>(Nyth::Audio::Effects::Flanger::MAX_DELAY_MS), delayMs));
+        feedback_ = std::max(static_cast<double>(Nyth::Audio::Effects::Flanger::MIN_FEEDBACK),
+                             std::min(static_cast<double>(Nyth::Audio::Effects::Flanger::MAX_FEEDBACK), feedback));
+        mix_ = std::max(static_cast<double>(Nyth::Audio::Effects::Flanger::MIN_MIX),
+                        std::min(static_cast<double>(Nyth::Audio::Effects::Flanger::MAX_MIX), mix));
+        lfo_.setRate(rateHz_);
+        updateCoefficients();
+    }
+
+    [[nodiscard]] FlangerParameters getParameters() const noexcept {
+        return FlangerParameters{
+            .rateHz = static_cast<float>(rateHz_),
+            .depthMs = static_cast<float>(depthMs_),
+            .delayMs = static_cast<float>(delayMs_),
+            .feedback = static_cast<float>(feedback_),
+            .mix = static_cast<float>(mix_)
+        };
+    }
+
+    void setLfoShape(LfoShape shape) noexcept {
+        lfo_.setShape(shape);
+    }
+
+    void setSampleRate(uint32_t sampleRate, int numChannels) noexcept override {
+        IAudioEffect::setSampleRate(sampleRate, numChannels);
+        lfo_.setSampleRate(static_cast<double>(sampleRate_));
+        lfo_.reset();
+        const double maxMs = static_cast<double>(Nyth::Audio::Effects::Flanger::MAX_DELAY_MS) +
+                             static_cast<double>(Nyth::Audio::Effects::Flanger::MAX_DEPTH_MS);
+        const size_t maxDelay =
+            static_cast<size_t>(std::ceil(maxMs * static_cast<double>(sampleRate_) / 1000.0)) + 1;
+        for (auto& line : lines_) {
+            line.prepare(maxDelay);
+        }
+        updateCoefficients();
+    }
+
+    void processMono(const float* input, float* output, size_t numSamples) override {
+        if (!isEnabled() || !input || !output || numSamples == 0 || !lines_[0].isPrepared()) {
+            if (output != input && input && output) {
+                std::copy_n(input, numSamples, output);
+            }
+            return;
+        }
+        for (size_t offset = 0; offset < numSamples; offset += BLOCK) {
+            const size_t n = std::min(BLOCK, numSamples - offset);
+            processChannel(0, 0.0, input + offset, output + offset, n);
+            lfo_.advance(n);
+        }
+    }
+
+    void processStereo(const float* inL, const float* inR, float* outL, float* outR, size_t numSamples) override {
+        if (!isEnabled() || !inL || !inR || !outL || !outR || numSamples == 0 || !lines_[0].isPrepared()) {
+            if (outL != inL && inL && outL)
+                std::copy_n(inL, numSamples, outL);
+            if (outR != inR && inR && outR)
+                std::copy_n(inR, numSamples, outR);
+            return;
+        }
+        for (size_t offset = 0; offset < numSamples; offset += BLOCK) {
+            const size_t n = std::min(BLOCK, numSamples - offset);
+            processChannel(0, 0.0, inL + offset, outL + offset, n);
+            processChannel(1, Nyth::Audio::FX::MODULATION_STEREO_PHASE, inR + offset, outR + offset, n);
+            lfo_.advance(n);
+        }
+    }
+
+protected:
+    void applyParameter(uint32_t paramId, float value) noexcept override {
+        switch (static_cast<Param>(paramId)) {
+            case Param::RATE_HZ:
+                setParameters(value, depthMs_, delayMs_, feedback_, mix_);
+                break;
+            case Param::DEPTH_MS:
+                setParameters(rateHz_, value, delayMs_, feedback_, mix_);
+                break;
+            case Param::DELAY_MS:
+                setParameters(rateHz_, depthMs_, value, feedback_, mix_);
+                break;
+            case Param::FEEDBACK:
+                setParameters(rateHz_, depthMs_, delayMs_, value, mix_);
+                break;
+            case Param::MIX:
+                setParameters(rateHz_, depthMs_, delayMs_, feedback_, value);
+                break;
+        }
+    }
+
+private:
+    static constexpr size_t BLOCK = Nyth::Audio::FX::MODULATION_BLOCK_SIZE;
+
+    void updateCoefficients() noexcept {
+        const float samplesPerMs = static_cast<float>(sampleRate_) / 1000.0f;
+        halfDepth_ = 0.5f * static_cast<float>(depthMs_) * samplesPerMs;
+        center_ = static_cast<float>(delayMs_) * samplesPerMs + halfDepth_;
+    }
+
+    void processChannel(int channel, double phaseOffset, const float* x, float* y, size_t n) noexcept {
+        lfo_.render(modulation_, n, phaseOffset);
+        for (size_t i = 0; i < n; ++i) {
+            modulation_[i] = center_ + halfDepth_ * modulation_[i];
+        }
+
+        FractionalDelayLine& line = lines_[channel];
+        const float feedback = static_cast<float>(feedback_);
+        const float wet = static_cast<float>(mix_);
+        const float dry = 1.0f - wet;
+        for (size_t i = 0; i < n; ++i) {
+            const float tap = line.read(modulation_[i]);
+            const float in = x[i];
+            line.write(in + feedback * tap);
+            y[i] = dry * in + wet * tap;
+        }
+    }
+
+    // params
+    double rateHz_ = Nyth::Audio::Effects::Flanger::DEFAULT_RATE_HZ;
+    double depthMs_ = Nyth::Audio::Effects::Flanger::DEFAULT_DEPTH_MS;
+    double delayMs_ = Nyth::Audio::Effects::Flanger::DEFAULT_DELAY_MS;
+    double feedback_ = Nyth::Audio::Effects::Flanger::DEFAULT_FEEDBACK;
+    double mix_ = Nyth::Audio::Effects::Flanger::DEFAULT_MIX;
+
+    // derived coefficients
+    float center_ = 0.0f;
+    float halfDepth_ = 0.0f;
+
+    // state
+    BlockLfo lfo_;
+    FractionalDelayLine lines_[Nyth::Audio::FX::STEREO_CHANNELS];
+    alignas(16) float modulation_[BLOCK] = {};
+};
+
+}}} // namespace Nyth { namespace Audio { namespace FX
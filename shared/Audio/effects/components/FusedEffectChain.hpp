@@ -0,0 +1,204 @@
+#pragma once
+
+// C++17 standard headers
+#include "EffectBase.hpp"
+#include "../../common/config/EffectConstants.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace Nyth { namespace Audio { namespace FX {
+
+namespace FusedChainDetail {
+
+// Étage par échantillon : expose static constexpr bool PER_SAMPLE = true, prepare(double),
+// reset(), float processSample(int channel, float x) et setParameter(uint32_t, float)
+template <typename Stage, typename = void>
+struct IsSampleStage : std::false_type {};
+
+template <typename Stage>
+struct IsSampleStage<Stage, std::void_t<decltype(Stage::PER_SAMPLE)>> : std::bool_constant<Stage::PER_SAMPLE> {};
+
+} // namespace FusedChainDetail
+
+/**
+ * @brief Fixed chain of stages composed at compile time and run as one fused pass
+ *
+ * The host buffer is walked once, in sub-blocks of FUSED_CHAIN_BLOCK_SIZE
+ * samples copied to an aligned scratch that stays in L1 while every stage
+ * processes it in place; output is written back once. Two kinds of stage:
+ *  - per-sample stages (PER_SAMPLE, e.g. biquads): each run of consecutive
+ *    ones is expanded into a single loop, the stages inlined one after the
+ *    other on values held in registers, left and right interleaved,
+ *  - block stages: any final IAudioEffect (CompressorEffect, LimiterEffect...),
+ *    called on the sub-block through its static type, so the call is direct
+ *    and inlinable instead of going through the vtable.
+ * The chain itself is an IAudioEffect: EffectManager and EffectGraph see one
+ * effect. Latency is the sum of the block stages' latencies. Stage parameters
+ * are automated through the chain's own queues: stageParameter(stage, param)
+ * is the id to schedule, applied to the stage by the audio thread.
+ */
+template <typename... Stages>
+class FusedEffectChain final : public IAudioEffect {
+    static_assert(sizeof...(Stages) > 0, "FusedEffectChain needs at least one stage");
+
+public:
+    using IAudioEffect::processMono;   // évite le masquage des surcharges (templates span)
+    using IAudioEffect::processStereo; // idem
+
+    static constexpr size_t NUM_STAGES = sizeof...(Stages);
+
+    template <size_t Index>
+    [[nodiscard]] auto& stage() noexcept {
+        return std::get<Index>(stages_);
+    }
+    template <size_t Index>
+    [[nodiscard]] const auto& stage() const noexcept {
+        return std::get<Index>(stages_);
+    }
+
+    // Identifiant de scheduleParameter pour le paramètre param (enum Param de l'étage) de l'étage stage
+    static constexpr uint32_t stageParameter(size_t stage, uint32_t param) noexcept {
+        return static_cast<uint32_t>(stage) * PARAMS_PER_STAGE + param;
+    }
+
+    void setSampleRate(uint32_t sampleRate, int numChannels) noexcept override {
+        IAudioEffect::setSampleRate(sampleRate, numChannels);
+        std::apply([this](auto&... stages) { (prepareStage(stages), ...); }, stages_);
+    }
+
+    [[nodiscard]] uint32_t getLatencySamples() const noexcept override {
+        return std::apply([](const auto&... stages) { return (stageLatency(stages) + ...); }, stages_);
+    }
+
+    void processMono(const float* input, float* output, size_t numSamples) override {
+        if (!isEnabled() || !input || !output || numSamples == 0) {
+            if (output != input && input && output) {
+                std::copy_n(input, numSamples, output);
+            }
+            return;
+        }
+        for (size_t offset = 0; offset < numSamples; offset += BLOCK) {
+            const size_t n = std::min(BLOCK, numSamples - offset);
+            std::copy_n(input + offset, n, block_[0]);
+            runStages<0>(block_[0], nullptr, n);
+            std::copy_n(block_[0], n, output + offset);
+        }
+    }
+
+    void processStereo(const float* inL, const float* inR, float* outL, float* outR, size_t numSamples) override {
+        if (!isEnabled() || !inL || !inR || !outL || !outR || numSamples == 0) {
+            if (outL != inL && inL && outL)
+                std::copy_n(inL, numSamples, outL);
+            if (outR != inR && inR && outR)
+                std::copy_n(inR, numSamples, outR);
+            return;
+        }
+        for (size_t offset = 0; offset < numSamples; offset += BLOCK) {
+            const size_t n = std::min(BLOCK, numSamples - offset);
+            std::copy_n(inL + offset, n, block_[0]);
+            std::copy_n(inR + offset, n, block_[1]);
+            runStages<0>(block_[0], block_[1], n);
+            std::copy_n(block_[0], n, outL + offset);
+            std::copy_n(block_[1], n, outR + offset);
+        }
+    }
+
+protected:
+    void applyParameter(uint32_t paramId, float value) noexcept override {
+        applyStageParameter<0>(paramId / PARAMS_PER_STAGE, paramId % PARAMS_PER_STAGE, value);
+    }
+
+private:
+    static constexpr size_t BLOCK = Nyth::Audio::FX::FUSED_CHAIN_BLOCK_SIZE;
+    static constexpr uint32_t PARAMS_PER_STAGE = Nyth::Audio::FX::FUSED_CHAIN_PARAMS_PER_STAGE;
+    static constexpr bool SAMPLE_STAGE[NUM_STAGES] = {FusedChainDetail::IsSampleStage<Stages>::value...};
+
+    // Fin de la suite d'étages par échantillon commençant à index
+    static constexpr size_t sampleRunEnd(size_t index) noexcept {
+        return index < NUM_STAGES && SAMPLE_STAGE[index] ? sampleRunEnd(index + 1) : index;
+    }
+
+    template <typename Stage>
+    void prepareStage(Stage& stage) noexcept {
+        if constexpr (FusedChainDetail::IsSampleStage<Stage>::value) {
+            stage.prepare(static_cast<double>(sampleRate_));
+        } else {
+            static_assert(std::is_base_of<IAudioEffect, Stage>::value && std::is_final<Stage>::value,
+                          "block stages must be final IAudioEffect classes (direct calls)");
+            stage.setSampleRate(sampleRate_, channels_);
+        }
+    }
+
+    template <typename Stage>
+    static uint32_t stageLatency(const Stage& stage) noexcept {
+        if constexpr (FusedChainDetail::IsSampleStage<Stage>::value) {
+            return 0;
+        } else {
+            return stage.isEnabled() ? stage.getLatencySamples() : 0;
+        }
+    }
+
+    template <size_t Index>
+    void applyStageParameter(size_t stage, uint32_t param, float value) noexcept {
+        if constexpr (Index < NUM_STAGES) {
+            if (stage == Index) {
+                std::get<Index>(stages_).setParameter(param, value);
+            } else {
+                applyStageParameter<Index + 1>(stage, param, value);
+            }
+        }
+    }
+
+    // right == nullptr : mono
+    template <size_t Index>
+    void runStages(float* left, float* right, size_t n) noexcept {
+        if constexpr (Index < NUM_STAGES) {
+            if constexpr (SAMPLE_STAGE[Index]) {
+                constexpr size_t end = sampleRunEnd(Index);
+                runSampleStages<Index>(left, right, n, std::make_index_sequence<end - Index>{});
+                runStages<end>(left, right, n);
+            } else {
+                auto& stage = std::get<Index>(stages_);
+                if (right) {
+                    stage.processStereo(left, right, left, right, n);
+                } else {
+                    stage.processMono(left, left, n);
+                }
+                runStages<Index + 1>(left, right, n);
+            }
+        }
+    }
+
+    // Une seule boucle pour toute la suite : les étages sont déroulés sur l'échantillon courant
+    template <size_t First, size_t... Offsets>
+    void runSampleStages(float* left, float* right, size_t n, std::index_sequence<Offsets...>) noexcept {
+        auto& stages = stages_;
+        if (right) {
+            for (size_t i = 0; i < n; ++i) {
+                float l = left[i];
+                float r = right[i];
+                ((l = std::get<First + Offsets>(stages).processSample(0, l),
+                  r = std::get<First + Offsets>(stages).processSample(1, r)),
+                 ...);
+                left[i] = l;
+                right[i] = r;
+            }
+        } else {
+            for (size_t i = 0; i < n; ++i) {
+                float x = left[i];
+                ((x = std::get<First + Offsets>(stages).processSample(0, x)), ...);
+                left[i] = x;
+            }
+        }
+    }
+
+    // state
+    std::tuple<Stages...> stages_;
+    alignas(16) float block_[Nyth::Audio::FX::STEREO_CHANNELS][BLOCK] = {};
+};
+
+}}} // namespace Nyth { namespace Audio { namespace FX
@@ -0,0 +1,227 @@
+#pragma once
+
+// C++17 standard headers
+#include "EffectBase.hpp"
+#include "../../common/config/EffectConstants.hpp"
+#include "../../common/dsp/DynamicsDetector.hpp"
+#include "../../common/dsp/VectorMath.hpp"
+#include "../config/EffectsLimits.h" // Source of truth for default values
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+namespace Nyth { namespace Audio { namespace FX {
+
+/**
+ * @brief Noise gate with hysteresis, hold and linked stereo detection
+ *
+ * The gate opens when the detected peak level reaches thresholdDb and only
+ * closes once it has stayed under thresholdDb - hysteresisDb for holdMs, so a
+ * level hovering around the threshold does not chatter. The open/closed
+ * target (unity or rangeDb) is smoothed in the linear domain: attackMs to
+ * open, releaseMs to close. Detection runs on the shared vectorized
+ * Dynamics::LevelDetector, one sub-block at a time.
+ */
+class GateEffect final : public IAudioEffect {
+public:
+    using IAudioEffect::processMono;   // évite le masquage des surcharges (templates span)
+    using IAudioEffect::processStereo; // idem
+
+    // Paramètres automatisables (scheduleParameter)
+    enum class Param : uint32_t { THRESHOLD_DB = 0, HYSTERESIS_DB, HOLD_MS, ATTACK_MS, RELEASE_MS, RANGE_DB };
+
+    struct GateParameters {
+        float thresholdDb;
+        float hysteresisDb;
+        float holdMs;
+        float attackMs;
+        float releaseMs;
+        float rangeDb;
+    };
+
+    GateEffect() {
+        updateCoefficients();
+    }
+
+    void setParameters(double thresholdDb, double hysteresisDb, double holdMs, double attackMs, double releaseMs,
+                       double rangeDb) noexcept {
+        thresholdDb_ = std::max(static_cast<double>(Nyth::Audio::Effects::Gate::MIN_THRESHOLD_DB),
+                                std::min(static_cast<double>(Nyth::Audio::Effects::Gate::MAX_THRESHOLD_DB),
+                                         thresholdDb));
+        hysteresisDb_ = std::max(static_cast<double>(Nyth::Audio::Effects::Gate::MIN_HYSTERESIS_DB),
+                                 std::min(static_cast<double>(Nyth::Audio::Effects::Gate::MAX_HYSTERESIS_DB),
+                                          hysteresisDb));
+        holdMs_ = std::max(static_cast<double>(Nyth::Audio::Effects::Gate::MIN_HOLD_MS),
+                           std::min(static_cast<double>(Nyth::Audio::Effects::Gate::MAX_HOLD_MS), holdMs));
+        attackMs_ = std::max(static_cast<double>(Nyth::Audio::Effects::Gate::MIN_ATTACK_MS),
+                             std::min(static_cast<double>(Nyth::Audio::Effects::Gate::MAX_ATTACK_MS), attackMs));
+        releaseMs_ = std::max(static_cast<double>(Nyth::Audio::Effects::Gate::MIN_RELEASE_MS),
+                              std::min(static_cast<double>(Nyth::Audio::Effects::Gate::MAX_RELEASE_MS), releaseMs));
+        rangeDb_ = std::max(static_cast<double>(Nyth::Audio::Effects::Gate::MIN_RANGE_DB),
+                            std::min(static_cast<double>(Nyth::Audio::Effects::Gate::MAX_RANGE_DB), rangeDb));
+        updateCoefficients();
+    }
+
+    [[nodiscard]] GateParameters getParameters() const noexcept {
+        return GateParameters{
+            .thresholdDb = static_cast<float>(thresholdDb_),
+            .hysteresisDb = static_cast<float>(hysteresisDb_),
+            .holdMs = static_cast<float>(holdMs_),
+            .attackMs = static_cast<float>(attackMs_),
+            .releaseMs = static_cast<float>(releaseMs_),
+            .rangeDb = static_cast<float>(rangeDb_)
+        };
+    }
+
+    // Mesures publiées par le thread audio à chaque bloc
+    [[nodiscard]] bool isOpen() const noexcept {
+        return meterOpen_.load(std::memory_order_relaxed);
+    }
+
+    // Atténuation courante en dB (<= 0)
+    [[nodiscard]] float getGainReductionDb() const noexcept {
+        return static_cast<float>(
+            20.0 * std::log10(std::max(meterGain_.load(std::memory_order_relaxed), VectorMath::MIN_LINEAR)));
+    }
+
+    void setSampleRate(uint32_t sampleRate, int numChannels) noexcept override {
+        IAudioEffect::setSampleRate(sampleRate, numChannels);
+        detector_.setTimes(Nyth::Audio::FX::DYNAMICS_DETECTOR_ATTACK_MS, Nyth::Audio::FX::DYNAMICS_DETECTOR_RELEASE_MS,
+                           static_cast<double>(sampleRate_));
+        detector_.reset();
+        updateCoefficients();
+        // Démarre fermé : pas de bouffée de bruit avant la première détection
+        open_ = false;
+        holdCounter_ = 0;
+        gainSmoother_.reset(rangeLinear_);
+        meterOpen_.store(false, std::memory_order_relaxed);
+        meterGain_.store(rangeLinear_, std::memory_order_relaxed);
+    }
+
+    void processMono(const float* input, float* output, size_t numSamples) override {
+        if (!isEnabled() || !input || !output || numSamples == 0) {
+            if (output != input && input && output) {
+                std::copy_n(input, numSamples, output);
+            }
+            return;
+        }
+        for (size_t offset = 0; offset < numSamples; offset += BLOCK) {
+            const size_t n = std::min(BLOCK, numSamples - offset);
+            const float* x = input + offset;
+            float* y = output + offset;
+            detector_.processMono(x, gain_, n);
+            computeGains(gain_, n);
+            for (size_t i = 0; i < n; ++i) {
+                y[i] = x[i] * gain_[i];
+            }
+        }
+    }
+
+    void processStereo(const float* inL, const float* inR, float* outL, float* outR, size_t numSamples) override {
+        if (!isEnabled() || !inL || !inR || !outL || !outR || numSamples == 0) {
+            if (outL != inL && inL && outL)
+                std::copy_n(inL, numSamples, outL);
+            if (outR != inR && inR && outR)
+                std::copy_n(inR, numSamples, outR);
+            return;
+        }
+        for (size_t offset = 0; offset < numSamples; offset += BLOCK) {
+            const size_t n = std::min(BLOCK, numSamples - offset);
+            const float* xl = inL + offset;
+            const float* xr = inR + offset;
+            float* yl = outL + offset;
+            float* yr = outR + offset;
+            detector_.processStereo(xl, xr, gain_, n);
+            computeGains(gain_, n);
+            for (size_t i = 0; i < n; ++i) {
+                yl[i] = xl[i] * gain_[i];
+                yr[i] = xr[i] * gain_[i];
+            }
+        }
+    }
+
+protected:
+    void applyParameter(uint32_t paramId, float value) noexcept override {
+        switch (static_cast<Param>(paramId)) {
+            case Param::THRESHOLD_DB:
+                setParameters(value, hysteresisDb_, holdMs_, attackMs_, releaseMs_, rangeDb_);
+                break;
+            case Param::HYSTERESIS_DB:
+                setParameters(thresholdDb_, value, holdMs_, attackMs_, releaseMs_, rangeDb_);
+                break;
+            case Param::HOLD_MS:
+                setParameters(thresholdDb_, hysteresisDb_, value, attackMs_, releaseMs_, rangeDb_);
+                break;
+            case Param::ATTACK_MS:
+                setParameters(thresholdDb_, hysteresisDb_, holdMs_, value, releaseMs_, rangeDb_);
+                break;
+            case Param::RELEASE_MS:
+                setParameters(thresholdDb_, hysteresisDb_, holdMs_, attackMs_, value, rangeDb_);
+                break;
+            case Param::RANGE_DB:
+                setParameters(thresholdDb_, hysteresisDb_, holdMs_, attackMs_, releaseMs_, value);
+                break;
+        }
+    }
+
+private:
+    static constexpr size_t BLOCK = Nyth::Audio::FX::DYNAMICS_BLOCK_SIZE;
+
+    void updateCoefficients() noexcept {
+        gainSmoother_.setTimes(attackMs_, releaseMs_, static_cast<double>(sampleRate_));
+        holdSamples_ = static_cast<size_t>(std::lround(holdMs_ * 0.001 * static_cast<double>(sampleRate_)));
+        rangeLinear_ = static_cast<float>(std::pow(10.0, rangeDb_ / 20.0));
+    }
+
+    // Transforme, en place, le niveau détecté (dB) en gain linéaire
+    void computeGains(float* buffer, size_t n) noexcept {
+        const float openDb = static_cast<float>(thresholdDb_);
+        const float closeDb = static_cast<float>(thresholdDb_ - hysteresisDb_);
+        bool open = open_;
+        size_t hold = holdCounter_;
+
+        // Seule étape séquentielle : hystérésis et maintien
+        for (size_t i = 0; i < n; ++i) {
+            const float level = buffer[i];
+            if (level >= openDb || (open && level >= closeDb)) {
+                open = true;
+                hold = holdSamples_;
+            } else if (hold > 0) {
+                --hold;
+            } else {
+                open = false;
+            }
+            buffer[i] = open ? 1.0f : rangeLinear_;
+        }
+        open_ = open;
+        holdCounter_ = hold;
+        gainSmoother_.process(buffer, buffer, n);
+        meterOpen_.store(open, std::memory_order_relaxed);
+        meterGain_.store(gainSmoother_.value(), std::memory_order_relaxed);
+    }
+
+    // params
+    double thresholdDb_ = Nyth::Audio::Effects::Gate::DEFAULT_THRESHOLD_DB;
+    double hysteresisDb_ = Nyth::Audio::Effects::Gate::DEFAULT_HYSTERESIS_DB;
+    double holdMs_ = Nyth::Audio::Effects::Gate::DEFAULT_HOLD_MS;
+    double attackMs_ = Nyth::Audio::Effects::Gate::DEFAULT_ATTACK_MS;
+    double releaseMs_ = Nyth::Audio::Effects::Gate::DEFAULT_RELEASE_MS;
+    double rangeDb_ = Nyth::Audio::Effects::Gate::DEFAULT_RANGE_DB;
+
+    // derived
+    size_t holdSamples_ = 0;
+    float rangeLinear_ = 0.0f;
+
+    // state
+    Dynamics::LevelDetector detector_;
+    Dynamics::AttackReleaseFilter gainSmoother_; // gain linéaire
+    bool open_ = false;
+    size_t holdCounter_ = 0;
+    std::atomic<bool> meterOpen_{false};
+    std::atomic<float> meterGain_{0.0f}; // gain linéaire
+    alignas(16) float gain_[BLOCK] = {};
+};
+
+}}} // namespace Nyth { namespace Audio { namespace FX
@@ -0,0 +1,286 @@
+#pragma once
+
+// C++17 standard headers
+#include "EffectBase.hpp"
+#include "../../common/config/EffectConstants.hpp"
+#include "../../common/dsp/HalfbandFilter.hpp"
+#include "../../common/dsp/SlidingWindowMax.hpp"
+#include "../config/EffectsLimits.h" // Source of truth for default values
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+namespace Nyth { namespace Audio { namespace FX {
+
+/**
+ * @brief True-peak brickwall limiter with lookahead
+ *
+ * Per sub-block of LIMITER_BLOCK_SIZE samples:
+ *  1. each channel is upsampled 4x by the half-band cascade and the largest
+ *     |x| of the 4 phases is the sample's true peak (stereo: max of channels),
+ *  2. a monotonic-deque running maximum over the lookahead window gives the
+ *     loudest peak about to be played, in O(1) amortized per sample,
+ *  3. the gain needed for that peak drops instantly and recovers with the
+ *     release time; a moving average over the lookahead then turns the drop
+ *     into a smooth attack ramp that has fully settled when the peak plays,
+ *  4. the audio, delayed by lookahead + detector latency, is multiplied by
+ *     the gain (clamped against the peak of the sample actually output as a
+ *     last safety net).
+ * Like any 4x true-peak meter (ITU-R BS.1770), detection under-reads content
+ * close to Nyquist by a fraction of a dB: keep the ceiling around -1 dBTP.
+ * Everything is allocated in setSampleRate(); latency is reported through
+ * getLatencySamples().
+ */
+class LimiterEffect final : public IAudioEffect {
+public:
+    using IAudioEffect::processMono;   // évite le masquage des surcharges (templates span)
+    using IAudioEffect::processStereo; // idem
+
+    // Paramètres automatisables (scheduleParameter)
+    enum class Param : uint32_t { CEILING_DB = 0, LOOKAHEAD_MS, RELEASE_MS };
+
+    struct LimiterParameters {
+        float ceilingDb;
+        float lookaheadMs;
+        float releaseMs;
+    };
+
+    LimiterEffect() {
+        updateCoefficients();
+    }
+
+    void setParameters(double ceilingDb, double lookaheadMs, double releaseMs) noexcept {
+        ceilingDb_ = std::max(static_cast<double>(Nyth::Audio::Effects::Limiter::MIN_CEILING_DB),
+                              std::min(static_cast<double>(Nyth::Audio::Effects::Limiter::MAX_CEILING_DB), ceilingDb));
+        lookaheadMs_ =
+            std::max(static_cast<double>(Nyth::Audio::Effects::Limiter::MIN_LOOKAHEAD_MS),
+                     std::min(static_cast<double>(Nyth::Audio::Effects::Limiter::MAX_LOOKAHEAD_MS), lookaheadMs));
+        releaseMs_ = std::max(static_cast<double>(Nyth::Audio::Effects::Limiter::MIN_RELEASE_MS),
+                              std::min(static_cast<double>(Nyth::Audio::Effects::Limiter::MAX_RELEASE_MS), releaseMs));
+        updateCoefficients();
+    }
+
+    [[nodiscard]] LimiterParameters getParameters() const noexcept {
+        return LimiterParameters{
+            .ceilingDb = static_cast<float>(ceilingDb_),
+            .lookaheadMs = static_cast<float>(lookaheadMs_),
+            .releaseMs = static_cast<float>(releaseMs_)
+        };
+    }
+
+    // Réduction de gain courante en dB (<= 0)
+    [[nodiscard]] float getGainReductionDb() const noexcept {
+        const float gain = lastGain_.load(std::memory_order_relaxed);
+        return gain < 1.0f ? 20.0f * std::log10(std::max(gain, 1e-6f)) : 0.0f;
+    }
+
+    void setSampleRate(uint32_t sampleRate, int numChannels) noexcept override {
+        IAudioEffect::setSampleRate(sampleRate, numChannels);
+
+        for (auto& oversampler : oversamplers_) {
+            oversampler.prepare(Nyth::Audio::FX::LIMITER_OVERSAMPLING_FACTOR, Nyth::Audio::FX::LIMITER_BLOCK_SIZE);
+        }
+        // Retard de groupe de l'interpolation seule (moitié de l'aller-retour, 9.25 échantillons en 4x) :
+        // arrondi inférieur, l'échantillon et ses voisins à +-0.5 tombent sur 2 instants du détecteur
+        detectorDelay_ = static_cast<size_t>(std::floor(0.5 * oversamplers_[0].getLatencySamples()));
+
+        // Dimensionné pour MAX_LOOKAHEAD_MS : changer l'anticipation ne réalloue pas
+        const size_t maxLookahead = msToSamples(Nyth::Audio::Effects::Limiter::MAX_LOOKAHEAD_MS);
+        for (auto& line : delayLines_) {
+            line.assign(maxLookahead + detectorDelay_ + 1, 0.0f);
+        }
+        peakHistory_.assign(maxLookahead + 2, 0.0f);
+        attackRamp_.assign(std::max<size_t>(1, maxLookahead), 1.0f);
+        window_.prepare(maxLookahead + 2);
+        windowStale_ = true;
+
+        updateCoefficients();
+    }
+
+    [[nodiscard]] uint32_t getLatencySamples() const noexcept override {
+        return static_cast<uint32_t>(lookaheadSamples_ + detectorDelay_);
+    }
+
+    void processMono(const float* input, float* output, size_t numSamples) override {
+        if (!isEnabled() || !input || !output || numSamples == 0 || delayLines_[0].empty()) {
+            if (output != input && input && output) {
+                std::copy_n(input, numSamples, output);
+            }
+            return;
+        }
+
+        for (size_t offset = 0; offset < numSamples; offset += Nyth::Audio::FX::LIMITER_BLOCK_SIZE) {
+            const size_t n = std::min(Nyth::Audio::FX::LIMITER_BLOCK_SIZE, numSamples - offset);
+            std::fill_n(peaks_, n, 0.0f);
+            detectPeaks(0, input + offset, n);
+            computeGains(n);
+            applyGains(0, input + offset, output + offset, n);
+            advance(n);
+        }
+    }
+
+    void processStereo(const float* inL, const float* inR, float* outL, float* outR, size_t numSamples) override {
+        if (!isEnabled() || !inL || !inR || !outL || !outR || numSamples == 0 || delayLines_[0].empty()) {
+            if (outL != inL && inL && outL)
+                std::copy_n(inL, numSamples, outL);
+            if (outR != inR && inR && outR)
+                std::copy_n(inR, numSamples, outR);
+            return;
+        }
+
+        for (size_t offset = 0; offset < numSamples; offset += Nyth::Audio::FX::LIMITER_BLOCK_SIZE) {
+            const size_t n = std::min(Nyth::Audio::FX::LIMITER_BLOCK_SIZE, numSamples - offset);
+            // Détection liée : un seul gain pour préserver l'image stéréo
+            std::fill_n(peaks_, n, 0.0f);
+            detectPeaks(0, inL + offset, n);
+            detectPeaks(1, inR + offset, n);
+            computeGains(n);
+            applyGains(0, inL + offset, outL + offset, n);
+            applyGains(1, inR + offset, outR + offset, n);
+            advance(n);
+        }
+    }
+
+protected:
+    void applyParameter(uint32_t paramId, float value) noexcept override {
+        switch (static_cast<Param>(paramId)) {
+            case Param::CEILING_DB:
+                setParameters(value, lookaheadMs_, releaseMs_);
+                break;
+            case Param::LOOKAHEAD_MS:
+                setParameters(ceilingDb_, value, releaseMs_);
+                break;
+            case Param::RELEASE_MS:
+                setParameters(ceilingDb_, lookaheadMs_, value);
+                break;
+        }
+    }
+
+private:
+    static constexpr size_t OVERSAMPLING = Nyth::Audio::FX::LIMITER_OVERSAMPLING_FACTOR;
+
+    size_t msToSamples(double ms) const noexcept {
+        return static_cast<size_t>(
+            std::lround(ms * static_cast<double>(sampleRate_) / Nyth::Audio::FX::MS_TO_SECONDS_COMPRESSOR));
+    }
+
+    void updateCoefficients() noexcept {
+        ceiling_ = static_cast<float>(std::pow(10.0, ceilingDb_ / 20.0));
+
+        const size_t capacity = peakHistory_.size();
+        const size_t lookahead = capacity >= 2 ? std::min(msToSamples(lookaheadMs_), capacity - 2) : 0;
+        if (lookahead != lookaheadSamples_ || windowStale_) {
+            // Nouvelle anticipation : historique vidé (changer seulement plafond ou relâche ne le touche pas)
+            lookaheadSamples_ = lookahead;
+            // +2 : le pic vrai d'un échantillon est vu par le détecteur sur deux instants consécutifs
+            window_.setWindow(lookaheadSamples_ + 2);
+            rampLength_ = std::max<size_t>(1, std::min(lookaheadSamples_, attackRamp_.size()));
+            std::fill(attackRamp_.begin(), attackRamp_.end(), 1.0f);
+            rampSum_ = static_cast<double>(rampLength_);
+            rampPos_ = 0;
+            windowStale_ = false;
+        }
+
+        releaseCoeff_ = static_cast<float>(
+            std::exp(-1.0 / (releaseMs_ / Nyth::Audio::FX::MS_TO_SECONDS_COMPRESSOR * static_cast<double>(sampleRate_))));
+    }
+
+    // Pic vrai (max des 4 phases suréchantillonnées) accumulé dans peaks_
+    void detectPeaks(int channel, const float* x, size_t n) noexcept {
+        oversamplers_[channel].upsample(x, upsampled_, n);
+        for (size_t i = 0; i < n; ++i) {
+            const float* phases = upsampled_ + i * OVERSAMPLING;
+            float peak = peaks_[i];
+            for (size_t k = 0; k < OVERSAMPLING; ++k) {
+                peak = std::max(peak, std::abs(phases[k]));
+            }
+            peaks_[i] = peak;
+        }
+    }
+
+    // peaks_ -> gains_ : maximum glissant, relâche, rampe d'attaque puis plafond strict
+    void computeGains(size_t n) noexcept {
+        const size_t historySize = peakHistory_.size();
+        const float ceiling = ceiling_;
+        const double invRamp = 1.0 / static_cast<double>(rampLength_);
+        float held = gain_;
+        size_t pos = historyPos_;
+        for (size_t i = 0; i < n; ++i) {
+            const float peak = peaks_[i];
+            peakHistory_[pos] = peak;
+
+            // Le maximum reste dans la fenêtre lookahead + 2 échantillons : la moyenne des
+            // rampLength_ derniers gains maintenus ne dépasse jamais celui requis par le pic
+            const float windowPeak = window_.process(peak);
+            const float target = windowPeak > ceiling ? ceiling / windowPeak : 1.0f;
+            held = target < held ? target : target + releaseCoeff_ * (held - target);
+
+            rampSum_ += static_cast<double>(held) - static_cast<double>(attackRamp_[rampPos_]);
+            attackRamp_[rampPos_] = held;
+            rampPos_ = rampPos_ + 1 == rampLength_ ? 0 : rampPos_ + 1;
+            const float gain = static_cast<float>(rampSum_ * invRamp);
+
+            // Pics de l'échantillon qui sort de la ligne de retard à cet instant
+            const size_t older = (pos + historySize - lookaheadSamples_ - 1) % historySize;
+            const size_t newer = older + 1 == historySize ? 0 : older + 1;
+            const float outputPeak = std::max(peakHistory_[older], peakHistory_[newer]);
+            gains_[i] = outputPeak * gain > ceiling ? ceiling / outputPeak : gain;
+
+            pos = pos + 1 == historySize ? 0 : pos + 1;
+        }
+        gain_ = held;
+        historyPos_ = pos;
+        lastGain_.store(gains_[n - 1], std::memory_order_relaxed);
+    }
+
+    // Retard de lookahead + latence du détecteur, puis gain (in == out autorisé)
+    void applyGains(int channel, const float* x, float* y, size_t n) noexcept {
+        std::vector<float>& line = delayLines_[channel];
+        const size_t capacity = line.size();
+        size_t write = writePos_;
+        size_t read = (writePos_ + capacity - (lookaheadSamples_ + detectorDelay_)) % capacity;
+        for (size_t i = 0; i < n; ++i) {
+            line[write] = x[i];
+            y[i] = line[read] * gains_[i];
+            write = write + 1 == capacity ? 0 : write + 1;
+            read = read + 1 == capacity ? 0 : read + 1;
+        }
+    }
+
+    void advance(size_t n) noexcept {
+        writePos_ = (writePos_ + n) % delayLines_[0].size();
+    }
+
+    // params
+    double ceilingDb_ = Nyth::Audio::Effects::Limiter::DEFAULT_CEILING_DB;
+    double lookaheadMs_ = Nyth::Audio::Effects::Limiter::DEFAULT_LOOKAHEAD_MS;
+    double releaseMs_ = Nyth::Audio::Effects::Limiter::DEFAULT_RELEASE_MS;
+
+    // derived coefficients
+    float ceiling_ = 1.0f;
+    float releaseCoeff_ = 0.0f;
+    size_t lookaheadSamples_ = 0;
+    size_t detectorDelay_ = 0;
+
+    // state
+    PolyphaseOversampler oversamplers_[Nyth::Audio::FX::STEREO_CHANNELS];
+    SlidingWindowMax window_;
+    std::vector<float> delayLines_[Nyth::Audio::FX::STEREO_CHANNELS];
+    std::vector<float> peakHistory_;
+    std::vector<float> attackRamp_;
+    double rampSum_ = 0.0;
+    size_t rampLength_ = 1;
+    size_t rampPos_ = 0;
+    bool windowStale_ = true;
+    size_t writePos_ = 0;
+    size_t historyPos_ = 0;
+    float gain_ = 1.0f;
+    std::atomic<float> lastGain_{1.0f}; // mesure publiée à chaque bloc
+    alignas(16) float upsampled_[Nyth::Audio::FX::LIMITER_BLOCK_SIZE * OVERSAMPLING] = {};
+    alignas(16) float peaks_[Nyth::Audio::FX::LIMITER_BLOCK_SIZE] = {};
+    alignas(16) float gains_[Nyth::Audio::FX::LIMITER_BLOCK_SIZE] = {};
+};
+
+}}} // namespace Nyth { namespace Audio { namespace FX
@@ -0,0 +1,307 @@
+#pragma once
+
+// C++17 standard headers
+#include "EffectBase.hpp"
+#include "../../common/config/EffectConstants.hpp"
+#include "../../common/dsp/CrossoverFilterBank.hpp"
+#include "../../common/dsp/VectorMath.hpp"
+#include "../config/EffectsLimits.h" // Source of truth for default values
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <iterator>
+
+namespace Nyth { namespace Audio { namespace FX {
+
+/**
+ * @brief 3 to 5 band compressor on phase-coherent Linkwitz-Riley crossovers
+ *
+ * The input is split once by a CrossoverFilterBank (every band computed in SIMD
+ * lanes), so there is no per-band buffer copy. Detector state and parameters
+ * are stored band-wise in SoA arrays of CrossoverConstants::LANES floats: the
+ * soft-knee curve and attack/release smoothing update all bands together.
+ * Bands are weighted by their gain and summed into the output in the same pass.
+ * With every band at unity gain the output is an all-pass version of the input.
+ */
+class MultibandCompressorEffect final : public IAudioEffect {
+public:
+    using IAudioEffect::processMono;   // évite le masquage des surcharges (templates span)
+    using IAudioEffect::processStereo; // idem
+
+    // Paramètres automatisables (scheduleParameter). Les paramètres de bande
+    // s'adressent par bandParameter(param, band) ; CROSSOVER_HZ par crossover
+    enum class Param : uint32_t { KNEE_DB = 0, CROSSOVER_HZ, THRESHOLD_DB, RATIO, ATTACK_MS, RELEASE_MS, MAKEUP_DB };
+    static constexpr uint32_t PARAMS_PER_BAND = 8;
+
+    [[nodiscard]] static constexpr uint32_t bandParameter(Param param, size_t band) noexcept {
+        return static_cast<uint32_t>(param) + PARAMS_PER_BAND * static_cast<uint32_t>(band);
+    }
+
+    // Paramètres d'une bande
+    struct BandParameters {
+        float thresholdDb;
+        float ratio;
+        float attackMs;
+        float releaseMs;
+        float makeupDb;
+    };
+
+    MultibandCompressorEffect() {
+        std::copy_n(Nyth::Audio::Effects::Multiband::DEFAULT_CROSSOVERS_HZ, CrossoverConstants::MAX_CROSSOVERS,
+                    crossoversHz_);
+        for (size_t band = 0; band < CrossoverConstants::LANES; ++band) {
+            bands_[band] = BandParameters{Nyth::Audio::Effects::Compressor::DEFAULT_THRESHOLD_DB,
+                                          Nyth::Audio::Effects::Compressor::DEFAULT_RATIO,
+                                          Nyth::Audio::Effects::Compressor::DEFAULT_ATTACK_MS,
+                                          Nyth::Audio::Effects::Compressor::DEFAULT_RELEASE_MS,
+                                          Nyth::Audio::Effects::Compressor::DEFAULT_MAKEUP_DB};
+        }
+        updateCrossovers();
+        updateCoefficients();
+    }
+
+    // Nombre de bandes (MIN_BANDS..MAX_BANDS) ; recalcul des filtres sans allocation
+    void setNumBands(size_t numBands) noexcept {
+        numBands_ = std::max(Nyth::Audio::Effects::Multiband::MIN_BANDS,
+                             std::min(Nyth::Audio::Effects::Multiband::MAX_BANDS, numBands));
+        updateCrossovers();
+    }
+    [[nodiscard]] size_t getNumBands() const noexcept {
+        return numBands_;
+    }
+
+    // Fréquence du crossover index (entre la bande index et index + 1)
+    void setCrossover(size_t index, float frequencyHz) noexcept {
+        if (index >= CrossoverConstants::MAX_CROSSOVERS) {
+            return;
+        }
+        crossoversHz_[index] = std::max(Nyth::Audio::Effects::Multiband::MIN_CROSSOVER_HZ,
+                                        std::min(Nyth::Audio::Effects::Multiband::MAX_CROSSOVER_HZ, frequencyHz));
+        updateCrossovers();
+    }
+    // Valeur effective (croissante, bornée par Nyquist)
+    [[nodiscard]] float getCrossover(size_t index) const noexcept {
+        return banks_[0].getCrossover(index);
+    }
+
+    void setBandParameters(size_t band, double thresholdDb, double ratio, double attackMs, double releaseMs,
+                           double makeupDb) noexcept {
+        if (band >= Nyth::Audio::Effects::Multiband::MAX_BANDS) {
+            return;
+        }
+        bands_[band].thresholdDb = static_cast<float>(thresholdDb);
+        bands_[band].ratio = static_cast<float>(std::max(Nyth::Audio::FX::MIN_RATIO, ratio));
+        bands_[band].attackMs = static_cast<float>(std::max(Nyth::Audio::FX::MIN_TIME_MS, attackMs));
+        bands_[band].releaseMs = static_cast<float>(std::max(Nyth::Audio::FX::MIN_TIME_MS, releaseMs));
+        bands_[band].makeupDb = static_cast<float>(makeupDb);
+        updateCoefficients();
+    }
+    [[nodiscard]] BandParameters getBandParameters(size_t band) const noexcept {
+        return bands_[std::min(band, Nyth::Audio::Effects::Multiband::MAX_BANDS - 1)];
+    }
+
+    // Genou commun à toutes les bandes
+    void setKnee(double kneeDb) noexcept {
+        kneeDb_ = std::max(static_cast<double>(Nyth::Audio::Effects::Compressor::MIN_KNEE_DB),
+                           std::min(static_cast<double>(Nyth::Audio::Effects::Compressor::MAX_KNEE_DB), kneeDb));
+        updateCoefficients();
+    }
+    [[nodiscard]] double getKnee() const noexcept {
+        return kneeDb_;
+    }
+
+    // Réduction de gain courante d'une bande, en dB (<= 0), publiée à chaque bloc
+    [[nodiscard]] float getBandGainReduction(size_t band) const noexcept {
+        return band < Nyth::Audio::Effects::Multiband::MAX_BANDS ? meterGainReductionDb_[band].load(std::memory_order_relaxed)
+                                                                 : 0.0f;
+    }
+
+    void setSampleRate(uint32_t sampleRate, int numChannels) noexcept override {
+        IAudioEffect::setSampleRate(sampleRate, numChannels);
+        updateCrossovers();
+        updateCoefficients();
+        for (auto& bank : banks_) {
+            bank.reset();
+        }
+        std::fill(std::begin(gainReductionDb_), std::end(gainReductionDb_), 0.0f);
+        for (auto& meter : meterGainReductionDb_) {
+            meter.store(0.0f, std::memory_order_relaxed);
+        }
+    }
+
+    void processMono(const float* input, float* output, size_t numSamples) override {
+        if (!isEnabled() || !input || !output || numSamples == 0) {
+            if (output != input && input && output) {
+                std::copy_n(input, numSamples, output);
+            }
+            return;
+        }
+
+        for (size_t offset = 0; offset < numSamples; offset += Nyth::Audio::FX::MULTIBAND_BLOCK_SIZE) {
+            const size_t n = std::min(Nyth::Audio::FX::MULTIBAND_BLOCK_SIZE, numSamples - offset);
+            banks_[0].process(input + offset, bandsL_, n);
+            for (size_t i = 0; i < n * CrossoverConstants::LANES; ++i) {
+                gains_[i] = std::abs(bandsL_[i]);
+            }
+            computeGains(n);
+            sumBands(bandsL_, output + offset, n);
+        }
+    }
+
+    void processStereo(const float* inL, const float* inR, float* outL, float* outR, size_t numSamples) override {
+        if (!isEnabled() || !inL || !inR || !outL || !outR || numSamples == 0) {
+            if (outL != inL && inL && outL)
+                std::copy_n(inL, numSamples, outL);
+            if (outR != inR && inR && outR)
+                std::copy_n(inR, numSamples, outR);
+            return;
+        }
+
+        for (size_t offset = 0; offset < numSamples; offset += Nyth::Audio::FX::MULTIBAND_BLOCK_SIZE) {
+            const size_t n = std::min(Nyth::Audio::FX::MULTIBAND_BLOCK_SIZE, numSamples - offset);
+            banks_[0].process(inL + offset, bandsL_, n);
+            banks_[1].process(inR + offset, bandsR_, n);
+            // Détection liée par bande : max(|L|, |R|)
+            for (size_t i = 0; i < n * CrossoverConstants::LANES; ++i) {
+                gains_[i] = std::max(std::abs(bandsL_[i]), std::abs(bandsR_[i]));
+            }
+            computeGains(n);
+            sumBands(bandsL_, outL + offset, n);
+            sumBands(bandsR_, outR + offset, n);
+        }
+    }
+
+protected:
+    void applyParameter(uint32_t paramId, float value) noexcept override {
+        const size_t band = paramId / PARAMS_PER_BAND;
+        if (band >= Nyth::Audio::Effects::Multiband::MAX_BANDS) {
+            return;
+        }
+        const BandParameters p = bands_[band];
+        switch (static_cast<Param>(paramId % PARAMS_PER_BAND)) {
+            case Param::KNEE_DB:
+                setKnee(value);
+                break;
+            case Param::CROSSOVER_HZ:
+                setCrossover(band, value);
+                break;
+            case Param::THRESHOLD_DB:
+                setBandParameters(band, value, p.ratio, p.attackMs, p.releaseMs, p.makeupDb);
+                break;
+            case Param::RATIO:
+                setBandParameters(band, p.thresholdDb, value, p.attackMs, p.releaseMs, p.makeupDb);
+                break;
+            case Param::ATTACK_MS:
+                setBandParameters(band, p.thresholdDb, p.ratio, value, p.releaseMs, p.makeupDb);
+                break;
+            case Param::RELEASE_MS:
+                setBandParameters(band, p.thresholdDb, p.ratio, p.attackMs, value, p.makeupDb);
+                break;
+            case Param::MAKEUP_DB:
+                setBandParameters(band, p.thresholdDb, p.ratio, p.attackMs, p.releaseMs, value);
+                break;
+        }
+    }
+
+private:
+    static constexpr size_t LANES = CrossoverConstants::LANES;
+
+    void updateCrossovers() noexcept {
+        for (auto& bank : banks_) {
+            bank.configure(numBands_, crossoversHz_, static_cast<double>(sampleRate_));
+        }
+    }
+
+    // Paramètres par bande -> tableaux SoA utilisés par le calcul de gain
+    void updateCoefficients() noexcept {
+        auto coefForMs = [this](double ms) {
+            double T = std::max(Nyth::Audio::FX::MIN_TIME_MS, ms) / Nyth::Audio::FX::MS_TO_SECONDS_COMPRESSOR;
+            return static_cast<float>(std::exp(-1.0 / (T * static_cast<double>(sampleRate_))));
+        };
+        kneeWidth_ = std::max(static_cast<float>(kneeDb_), Nyth::Audio::FX::MIN_KNEE_WIDTH_DB);
+        for (size_t band = 0; band < LANES; ++band) {
+            threshold_[band] = bands_[band].thresholdDb;
+            slope_[band] = 1.0f / bands_[band].ratio - 1.0f;
+            attackCoeff_[band] = coefForMs(bands_[band].attackMs);
+            releaseCoeff_[band] = coefForMs(bands_[band].releaseMs);
+            makeup_[band] = bands_[band].makeupDb;
+        }
+    }
+
+    // gains_ : niveau de side-chain linéaire en entrée, gain linéaire en sortie (n * LANES)
+    void computeGains(size_t n) noexcept {
+        const size_t count = n * LANES;
+        VectorMath::linearToDb(gains_, gains_, count);
+
+        // Courbe statique à genou doux, toutes les bandes d'un échantillon à la fois
+        const float halfKnee = 0.5f * kneeWidth_;
+        const float invTwoKnee = 0.5f / kneeWidth_;
+        const float knee = kneeWidth_;
+        for (size_t i = 0; i < n; ++i) {
+            float* g = gains_ + i * LANES;
+            for (size_t b = 0; b < LANES; ++b) {
+                const float over = g[b] - threshold_[b];
+                const float k = std::min(std::max(over + halfKnee, 0.0f), knee);
+                g[b] = slope_[b] * (k * k * invTwoKnee + std::max(over - halfKnee, 0.0f));
+            }
+        }
+
+        // Lissage attaque/relâche : récursif dans le temps, parallèle entre bandes
+        alignas(16) float env[LANES];
+        std::copy_n(gainReductionDb_, LANES, env);
+        for (size_t i = 0; i < n; ++i) {
+            float* g = gains_ + i * LANES;
+            for (size_t b = 0; b < LANES; ++b) {
+                const float target = g[b];
+                const float coeff = (target < env[b]) ? attackCoeff_[b] : releaseCoeff_[b];
+                env[b] = target + coeff * (env[b] - target);
+                g[b] = env[b] + makeup_[b];
+            }
+        }
+        std::copy_n(env, LANES, gainReductionDb_);
+        // Bandes inutilisées : réduction nulle
+        for (size_t b = 0; b < Nyth::Audio::Effects::Multiband::MAX_BANDS; ++b) {
+            meterGainReductionDb_[b].store(b < numBands_ ? env[b] : 0.0f, std::memory_order_relaxed);
+        }
+
+        VectorMath::dbToLinear(gains_, gains_, count);
+    }
+
+    // Somme pondérée des bandes actives, écrite directement dans la sortie
+    void sumBands(const float* bands, float* output, size_t n) const noexcept {
+        for (size_t i = 0; i < n; ++i) {
+            const float* x = bands + i * LANES;
+            const float* g = gains_ + i * LANES;
+            float sum = 0.0f;
+            for (size_t b = 0; b < numBands_; ++b) {
+                sum += x[b] * g[b];
+            }
+            output[i] = sum;
+        }
+    }
+
+    // params
+    size_t numBands_ = Nyth::Audio::Effects::Multiband::DEFAULT_BANDS;
+    float crossoversHz_[CrossoverConstants::MAX_CROSSOVERS] = {};
+    BandParameters bands_[LANES] = {};
+    double kneeDb_ = Nyth::Audio::Effects::Compressor::DEFAULT_KNEE_DB;
+
+    // derived coefficients (SoA, une voie par bande)
+    alignas(16) float threshold_[LANES] = {};
+    alignas(16) float slope_[LANES] = {};
+    alignas(16) float attackCoeff_[LANES] = {};
+    alignas(16) float releaseCoeff_[LANES] = {};
+    alignas(16) float makeup_[LANES] = {};
+    float kneeWidth_ = Nyth::Audio::Effects::Compressor::DEFAULT_KNEE_DB;
+
+    // state
+    CrossoverFilterBank banks_[Nyth::Audio::FX::STEREO_CHANNELS];
+    alignas(16) float gainReductionDb_[LANES] = {};
+    std::atomic<float> meterGainReductionDb_[Nyth::Audio::Effects::Multiband::MAX_BANDS] = {};
+    alignas(16) float bandsL_[Nyth::Audio::FX::MULTIBAND_BLOCK_SIZE * LANES] = {};
+    alignas(16) float bandsR_[Nyth::Audio::FX::MULTIBAND_BLOCK_SIZE * LANES] = {};
+    alignas(16) float gains_[Nyth::Audio::FX::MULTIBAND_BLOCK_SIZE * LANES] = {};
+};
+
+}}} // namespace Nyth { namespace Audio { namespace FX
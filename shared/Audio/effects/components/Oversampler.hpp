@@ -0,0 +1,123 @@
+#pragma once
+
+// C++17 standard headers
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "EffectBase.hpp"
+#include "../../common/config/EffectConstants.hpp"
+#include "../../common/dsp/HalfbandFilter.hpp"
+
+namespace Nyth { namespace Audio { namespace FX {
+
+/**
+ * @brief Runs any IAudioEffect at 2x/4x/8x the host sample rate
+ *
+ * Non-linear stages (saturation, clipping, fast limiting) generate harmonics
+ * above Nyquist that fold back as aliasing at base rate. The wrapped effect is
+ * fed a polyphase half-band interpolated signal, then decimated back.
+ * All buffers are allocated in setSampleRate()/setFactor(); processing is
+ * allocation-free and works in OVERSAMPLING_BLOCK_SIZE sub-blocks.
+ */
+class OversampledEffect final : public IAudioEffect {
+public:
+    using IAudioEffect::processMono;   // évite le masquage des surcharges (templates span)
+    using IAudioEffect::processStereo; // idem
+
+    explicit OversampledEffect(std::unique_ptr<IAudioEffect> inner,
+                               size_t factor = Nyth::Audio::FX::DEFAULT_OVERSAMPLING_FACTOR)
+        : inner_(std::move(inner)) {
+        setFactor(factor);
+    }
+
+    /**
+     * @brief Changes the oversampling factor (reallocates, not real-time safe)
+     */
+    void setFactor(size_t factor) {
+        factor_ = std::max(Nyth::Audio::FX::MIN_OVERSAMPLING_FACTOR,
+                           std::min(Nyth::Audio::FX::MAX_OVERSAMPLING_FACTOR, factor));
+        prepare();
+    }
+
+    [[nodiscard]] size_t getFactor() const noexcept {
+        return oversamplers_[0].getFactor();
+    }
+
+    [[nodiscard]] IAudioEffect* getInnerEffect() const noexcept {
+        return inner_.get();
+    }
+
+    void setSampleRate(uint32_t sampleRate, int numChannels) noexcept override {
+        IAudioEffect::setSampleRate(sampleRate, numChannels);
+        prepare();
+    }
+
+    [[nodiscard]] uint32_t getLatencySamples() const noexcept override {
+        const uint32_t innerLatency = inner_ ? inner_->getLatencySamples() : 0;
+        const double factor = static_cast<double>(getFactor());
+        return static_cast<uint32_t>(std::lround(oversamplers_[0].getLatencySamples() + innerLatency / factor));
+    }
+
+    void processMono(const float* input, float* output, size_t numSamples) override {
+        if (!isEnabled() || !inner_ || !input || !output || numSamples == 0) {
+            if (output != input && input && output) {
+                std::copy_n(input, numSamples, output);
+            }
+            return;
+        }
+
+        for (size_t offset = 0; offset < numSamples; offset += Nyth::Audio::FX::OVERSAMPLING_BLOCK_SIZE) {
+            const size_t n = std::min(Nyth::Audio::FX::OVERSAMPLING_BLOCK_SIZE, numSamples - offset);
+            const size_t nUp = n * getFactor();
+            oversamplers_[0].upsample(input + offset, upL_.data(), n);
+            inner_->processMono(upL_.data(), upL_.data(), nUp);
+            oversamplers_[0].downsample(upL_.data(), output + offset, n);
+        }
+    }
+
+    void processStereo(const float* inL, const float* inR, float* outL, float* outR, size_t numSamples) override {
+        if (!isEnabled() || !inner_ || !inL || !inR || !outL || !outR || numSamples == 0) {
+            if (outL != inL && inL && outL)
+                std::copy_n(inL, numSamples, outL);
+            if (outR != inR && inR && outR)
+                std::copy_n(inR, numSamples, outR);
+            return;
+        }
+
+        for (size_t offset = 0; offset < numSamples; offset += Nyth::Audio::FX::OVERSAMPLING_BLOCK_SIZE) {
+            const size_t n = std::min(Nyth::Audio::FX::OVERSAMPLING_BLOCK_SIZE, numSamples - offset);
+            const size_t nUp = n * getFactor();
+            oversamplers_[0].upsample(inL + offset, upL_.data(), n);
+            oversamplers_[1].upsample(inR + offset, upR_.data(), n);
+            inner_->processStereo(upL_.data(), upR_.data(), upL_.data(), upR_.data(), nUp);
+            oversamplers_[0].downsample(upL_.data(), outL + offset, n);
+            oversamplers_[1].downsample(upR_.data(), outR + offset, n);
+        }
+    }
+
+private:
+    void prepare() {
+        for (auto& os : oversamplers_) {
+            os.prepare(factor_, Nyth::Audio::FX::OVERSAMPLING_BLOCK_SIZE);
+        }
+        const size_t upSize = Nyth::Audio::FX::OVERSAMPLING_BLOCK_SIZE * oversamplers_[0].getFactor();
+        upL_.assign(upSize, 0.0f);
+        upR_.assign(upSize, 0.0f);
+        if (inner_) {
+            inner_->setSampleRate(sampleRate_ * static_cast<uint32_t>(oversamplers_[0].getFactor()), channels_);
+        }
+    }
+
+    std::unique_ptr<IAudioEffect> inner_;
+    size_t factor_ = Nyth::Audio::FX::DEFAULT_OVERSAMPLING_FACTOR;
+    PolyphaseOversampler oversamplers_[Nyth::Audio::FX::STEREO_CHANNELS];
+    std::vector<float> upL_;
+    std::vector<float> upR_;
+};
+
+}}} // namespace Nyth { namespace Audio { namespace FX
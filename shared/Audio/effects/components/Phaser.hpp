@@ -0,0 +1,215 @@
+#pragma once
+
+// C++17 standard headers
+#include "EffectBase.hpp"
+#include "../../common/config/EffectConstants.hpp"
+#include "../../common/dsp/BlockLfo.hpp"
+#include "../../common/dsp/BranchFreeAlgorithms.hpp"
+#include "../config/EffectsLimits.h" // Source of truth for default values
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+namespace Nyth { namespace Audio { namespace FX {
+
+/**
+ * @brief Phaser: swept cascade of first-order all-pass stages with feedback
+ *
+ * Each channel runs 2 to 12 BranchFreeAllPass stages sharing one coefficient;
+ * mixed with the dry signal, every pair of stages adds a notch. The break
+ * frequency sweeps exponentially between minFreqHz and maxFreqHz. The LFO is
+ * evaluated once per MODULATION_BLOCK_SIZE sub-block (block rate): the
+ * coefficient for the end of the sub-block costs one exp2 and one tan, and
+ * is linearly interpolated across it, so no transcendental runs per sample.
+ * The right channel runs a quarter cycle later.
+ */
+class PhaserEffect final : public IAudioEffect {
+public:
+    using IAudioEffect::processMono;   // évite le masquage des surcharges (templates span)
+    using IAudioEffect::processStereo; // idem
+
+    // Paramètres automatisables (scheduleParameter) ; une borne de balayage
+    // qui croise l'autre l'entraîne avec elle
+    enum class Param : uint32_t { RATE_HZ = 0, STAGES, MIN_FREQ_HZ, MAX_FREQ_HZ, FEEDBACK, MIX };
+
+    struct PhaserParameters {
+        float rateHz;
+        size_t stages;
+        float minFreqHz;
+        float maxFreqHz;
+        float feedback;
+        float mix;
+    };
+
+    PhaserEffect() {
+        lfo_.setRate(rateHz_);
+    }
+
+    void setParameters(double rateHz, size_t stages, double minFreqHz, double maxFreqHz, double feedback,
+                       double mix) noexcept {
+        rateHz_ = std::max(static_cast<double>(Nyth::Audio::Effects::Phaser::MIN_RATE_HZ),
+                           std::min(static_cast<double>(Nyth::Audio::Effects::Phaser::MAX_RATE_HZ), rateHz));
+        // Nombre pair d'étages : un creux par paire
+        stages_ = std::max(Nyth::Audio::Effects::Phaser::MIN_STAGES,
+                           std::min(Nyth::Audio::Effects::Phaser::MAX_STAGES, stages)) & ~static_cast<size_t>(1);
+        const double lo = std::max(static_cast<double>(Nyth::Audio::Effects::Phaser::MIN_FREQ_HZ),
+                                   std::min(static_cast<double>(Nyth::Audio::Effects::Phaser::MAX_FREQ_HZ), minFreqHz));
+        const double hi = std::max(static_cast<double>(Nyth::Audio::Effects::Phaser::MIN_FREQ_HZ),
+                                   std::min(static_cast<double>(Nyth::Audio::Effects::Phaser::MAX_FREQ_HZ), maxFreqHz));
+        minFreqHz_ = std::min(lo, hi);
+        maxFreqHz_ = std::max(lo, hi);
+        sweepOctaves_ = std::log2(maxFreqHz_ / minFreqHz_);
+        feedback_ = std::max(static_cast<double>(Nyth::Audio::Effects::Phaser::MIN_FEEDBACK),
+                             std::min(static_cast<double>(Nyth::Audio::Effects::Phaser::MAX_FEEDBACK), feedback));
+        mix_ = std::max(static_cast<double>(Nyth::Audio::Effects::Phaser::MIN_MIX),
+                        std::min(static_cast<double>(Nyth::Audio::Effects::Phaser::MAX_MIX), mix));
+        lfo_.setRate(rateHz_);
+    }
+
+    [[nodiscard]] PhaserParameters getParameters() const noexcept {
+        return PhaserParameters{
+            .rateHz = static_cast<float>(rateHz_),
+            .stages = stages_,
+            .minFreqHz = static_cast<float>(minFreqHz_),
+            .maxFreqHz = static_cast<float>(maxFreqHz_),
+            .feedback = static_cast<float>(feedback_),
+            .mix = static_cast<float>(mix_)
+        };
+    }
+
+    void setSampleRate(uint32_t sampleRate, int numChannels) noexcept override {
+        IAudioEffect::setSampleRate(sampleRate, numChannels);
+        lfo_.setSampleRate(static_cast<double>(sampleRate_));
+        lfo_.reset();
+        for (int ch = 0; ch < Nyth::Audio::FX::STEREO_CHANNELS; ++ch) {
+            for (auto& stage : allPass_[ch]) {
+                stage = BranchFree::BranchFreeAllPass();
+            }
+            lastOutput_[ch] = 0.0f;
+            coefficient_[ch] = coefficientFor(lfoAt(0.0, ch == 0 ? 0.0 : Nyth::Audio::FX::MODULATION_STEREO_PHASE));
+        }
+    }
+
+    void processMono(const float* input, float* output, size_t numSamples) override {
+        if (!isEnabled() || !input || !output || numSamples == 0) {
+            if (output != input && input && output) {
+                std::copy_n(input, numSamples, output);
+            }
+            return;
+        }
+        for (size_t offset = 0; offset < numSamples; offset += BLOCK) {
+            const size_t n = std::min(BLOCK, numSamples - offset);
+            processChannel(0, 0.0, input + offset, output + offset, n);
+            lfo_.advance(n);
+        }
+    }
+
+    void processStereo(const float* inL, const float* inR, float* outL, float* outR, size_t numSamples) override {
+        if (!isEnabled() || !inL || !inR || !outL || !outR || numSamples == 0) {
+            if (outL != inL && inL && outL)
+                std::copy_n(inL, numSamples, outL);
+            if (outR != inR && inR && outR)
+                std::copy_n(inR, numSamples, outR);
+            return;
+        }
+        for (size_t offset = 0; offset < numSamples; offset += BLOCK) {
+            const size_t n = std::min(BLOCK, numSamples - offset);
+            processChannel(0, 0.0, inL + offset, outL + offset, n);
+            processChannel(1, Nyth::Audio::FX::MODULATION_STEREO_PHASE, inR + offset, outR + offset, n);
+            lfo_.advance(n);
+        }
+    }
+
+protected:
+    void applyParameter(uint32_t paramId, float value) noexcept override {
+        switch (static_cast<Param>(paramId)) {
+            case Param::RATE_HZ:
+                setParameters(value, stages_, minFreqHz_, maxFreqHz_, feedback_, mix_);
+                break;
+            case Param::STAGES:
+                setParameters(rateHz_, static_cast<size_t>(std::max(0.0f, value) + 0.5f), minFreqHz_, maxFreqHz_, feedback_, mix_);
+                break;
+            case Param::MIN_FREQ_HZ:
+                setParameters(rateHz_, stages_, value, std::max(static_cast<double>(value), maxFreqHz_), feedback_, mix_);
+                break;
+            case Param::MAX_FREQ_HZ:
+                setParameters(rateHz_, stages_, std::min(static_cast<double>(value), minFreqHz_), value, feedback_, mix_);
+                break;
+            case Param::FEEDBACK:
+                setParameters(rateHz_, stages_, minFreqHz_, maxFreqHz_, value, mix_);
+                break;
+            case Param::MIX:
+                setParameters(rateHz_, stages_, minFreqHz_, maxFreqHz_, feedback_, value);
+                break;
+        }
+    }
+
+private:
+    static constexpr size_t BLOCK = Nyth::Audio::FX::MODULATION_BLOCK_SIZE;
+    static constexpr size_t MAX_STAGES = Nyth::Audio::Effects::Phaser::MAX_STAGES;
+
+    // Valeur du LFO count échantillons après la phase courante
+    float lfoAt(double count, double phaseOffset) const noexcept {
+        float value = 0.0f;
+        lfo_.render(&value, 1, phaseOffset + count * lfo_.getIncrement());
+        return value;
+    }
+
+    // Coupure exponentielle entre min et max, puis a = (1 - tan(pi f / fs)) / (1 + tan(pi f / fs))
+    float coefficientFor(float lfo) const noexcept {
+        const double position = 0.5 * (static_cast<double>(lfo) + 1.0);
+        const double nyquist = 0.5 * static_cast<double>(sampleRate_);
+        const double freq = std::min(minFreqHz_ * std::exp2(position * sweepOctaves_),
+                                     Nyth::Audio::FX::PHASER_MAX_NORMALIZED_FREQ * nyquist);
+        const double t = std::tan(Nyth::Audio::FX::PI * freq / static_cast<double>(sampleRate_));
+        return static_cast<float>((1.0 - t) / (1.0 + t));
+    }
+
+    void processChannel(int channel, double phaseOffset, const float* x, float* y, size_t n) noexcept {
+        // Coefficient de fin de sous-bloc, rampe linéaire depuis le précédent
+        const float start = coefficient_[channel];
+        const float end = coefficientFor(lfoAt(static_cast<double>(n), phaseOffset));
+        const float step = (end - start) / static_cast<float>(n);
+
+        BranchFree::BranchFreeAllPass* stages = allPass_[channel];
+        const size_t numStages = stages_;
+        const float feedback = static_cast<float>(feedback_);
+        const float wet = static_cast<float>(mix_);
+        const float dry = 1.0f - wet;
+        float last = lastOutput_[channel];
+        for (size_t i = 0; i < n; ++i) {
+            const float a = start + step * static_cast<float>(i + 1);
+            const float in = x[i];
+            float s = in + feedback * last;
+            for (size_t k = 0; k < numStages; ++k) {
+                stages[k].setCoefficient(a);
+                s = stages[k].process(s);
+            }
+            last = s;
+            y[i] = dry * in + wet * s;
+        }
+        lastOutput_[channel] = last;
+        coefficient_[channel] = end;
+    }
+
+    // params
+    double rateHz_ = Nyth::Audio::Effects::Phaser::DEFAULT_RATE_HZ;
+    size_t stages_ = Nyth::Audio::Effects::Phaser::DEFAULT_STAGES;
+    double minFreqHz_ = Nyth::Audio::Effects::Phaser::DEFAULT_MIN_FREQ_HZ;
+    double maxFreqHz_ = Nyth::Audio::Effects::Phaser::DEFAULT_MAX_FREQ_HZ;
+    double feedback_ = Nyth::Audio::Effects::Phaser::DEFAULT_FEEDBACK;
+    double mix_ = Nyth::Audio::Effects::Phaser::DEFAULT_MIX;
+
+    // derived coefficients
+    double sweepOctaves_ = std::log2(static_cast<double>(Nyth::Audio::Effects::Phaser::DEFAULT_MAX_FREQ_HZ) /
+                                     static_cast<double>(Nyth::Audio::Effects::Phaser::DEFAULT_MIN_FREQ_HZ));
+
+    // state
+    BlockLfo lfo_;
+    BranchFree::BranchFreeAllPass allPass_[Nyth::Audio::FX::STEREO_CHANNELS][MAX_STAGES];
+    float lastOutput_[Nyth::Audio::FX::STEREO_CHANNELS] = {};
+    float coefficient_[Nyth::Audio::FX::STEREO_CHANNELS] = {};
+};
+
+}}} // namespace Nyth { namespace Audio { namespace FX
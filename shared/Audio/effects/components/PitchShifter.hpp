@@ -0,0 +1,339 @@
+#pragma once
+
+// C++17 standard headers
+#include "EffectBase.hpp"
+#include "../../common/config/EffectConstants.hpp"
+#include "../../common/dsp/TimeStretcher.hpp"
+#include "../config/EffectsLimits.h" // Source of truth for default values
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+namespace Nyth { namespace Audio { namespace FX {
+
+/**
+ * @brief Real-time pitch shifter: time-stretch by the pitch ratio, then resample
+ *
+ * Each channel runs a TimeStretcher whose output is stretch = 2^(semitones/12)
+ * times longer than its input; a 4-point Hermite resampler reads it back at
+ * that same speed, so the duration is unchanged and every frequency is scaled
+ * by the ratio. Two cores are available:
+ *  - PHASE_VOCODER: STFT with identity phase locking, ~40 ms frames, best on
+ *    music and polyphonic material,
+ *  - WSOLA: time-domain grains of 20 ms, lower latency and no phasiness on
+ *    speech.
+ * Both stretchers of each channel are allocated in setSampleRate(), so
+ * switching algorithm or pitch never allocates; a switch restarts the
+ * stretcher (short gap). Processing runs in sub-blocks of
+ * PITCH_SHIFT_BLOCK_SIZE samples. The dry path of the mix is not delayed: mix
+ * below 1 is meant for harmonies, not for phase-coherent blends.
+ */
+class PitchShiftEffect final : public IAudioEffect {
+public:
+    using IAudioEffect::processMono;   // évite le masquage des surcharges (templates span)
+    using IAudioEffect::processStereo; // idem
+
+    // Paramètres automatisables (scheduleParameter) ; ALGORITHM prend la valeur
+    // numérique de StretchAlgorithm
+    enum class Param : uint32_t { SEMITONES = 0, MIX, ALGORITHM };
+
+    struct PitchShiftParameters {
+        float semitones;
+        float mix;
+        StretchAlgorithm algorithm;
+    };
+
+    PitchShiftEffect() {
+        updateRatio();
+    }
+
+    void setParameters(double semitones, double mix) noexcept {
+        semitones_ = std::max(static_cast<double>(Nyth::Audio::Effects::PitchShift::MIN_SEMITONES),
+                              std::min(static_cast<double>(Nyth::Audio::Effects::PitchShift::MAX_SEMITONES), semitones));
+        mix_ = std::max(static_cast<double>(Nyth::Audio::Effects::PitchShift::MIN_MIX),
+                        std::min(static_cast<double>(Nyth::Audio::Effects::PitchShift::MAX_MIX), mix));
+        updateRatio();
+    }
+
+    // Pris en compte au bloc suivant par le thread audio (les deux cœurs sont déjà alloués)
+    void setAlgorithm(StretchAlgorithm algorithm) noexcept {
+        algorithm_ = algorithm;
+    }
+
+    [[nodiscard]] PitchShiftParameters getParameters() const noexcept {
+        return PitchShiftParameters{
+            .semitones = static_cast<float>(semitones_),
+            .mix = static_cast<float>(mix_),
+            .algorithm = algorithm_
+        };
+    }
+
+    void setSampleRate(uint32_t sampleRate, int numChannels) noexcept override {
+        IAudioEffect::setSampleRate(sampleRate, numChannels);
+        for (auto& channel : channels_) {
+            channel.stretchers[algorithmIndex(StretchAlgorithm::PHASE_VOCODER)].prepare(
+                StretchAlgorithm::PHASE_VOCODER, sampleRate_);
+            channel.stretchers[algorithmIndex(StretchAlgorithm::WSOLA)].prepare(StretchAlgorithm::WSOLA, sampleRate_);
+            for (auto& stretcher : channel.stretchers) {
+                stretcher.reserveOutput(maxBacklog(stretcher));
+            }
+        }
+        restart(algorithm_);
+    }
+
+    /**
+     * @brief Exact latency for the current pitch and algorithm
+     *
+     * The resampler starts on the input sample that completes the primed
+     * output, whatever the host block size, and its first position is aligned
+     * so that the delay is a whole number of samples (see startResampler()).
+     * Input sample i maps to stretched sample N/2 + (i - N/2) . ratio around
+     * the grain centres (N = frame size).
+     */
+    [[nodiscard]] uint32_t getLatencySamples() const noexcept override {
+        const TimeStretcher& stretcher = channels_[0].stretchers[algorithmIndex(activeAlgorithm_)];
+        if (!stretcher.isPrepared()) {
+            return 0;
+        }
+        const double step = TimeStretcher::clampStretch(ratio_);
+        const size_t half = stretcher.getFrameSize() / 2;
+        const size_t start = stretcher.getInputForOutput(primeSamples(stretcher), step) - 1;
+        return static_cast<uint32_t>(start - half + resamplerOffset(half, step));
+    }
+
+    void processMono(const float* input, float* output, size_t numSamples) override {
+        if (!isEnabled() || !input || !output || numSamples == 0 || !channels_[0].stretchers[0].isPrepared()) {
+            if (output != input && input && output) {
+                std::copy_n(input, numSamples, output);
+            }
+            return;
+        }
+        syncAlgorithm();
+        for (size_t offset = 0; offset < numSamples; offset += Nyth::Audio::FX::PITCH_SHIFT_BLOCK_SIZE) {
+            const size_t n = std::min(Nyth::Audio::FX::PITCH_SHIFT_BLOCK_SIZE, numSamples - offset);
+            processChannel(channels_[0], input + offset, output + offset, n);
+        }
+    }
+
+    void processStereo(const float* inL, const float* inR, float* outL, float* outR, size_t numSamples) override {
+        if (!isEnabled() || !inL || !inR || !outL || !outR || numSamples == 0 ||
+            !channels_[0].stretchers[0].isPrepared()) {
+            if (outL != inL && inL && outL)
+                std::copy_n(inL, numSamples, outL);
+            if (outR != inR && inR && outR)
+                std::copy_n(inR, numSamples, outR);
+            return;
+        }
+        syncAlgorithm();
+        for (size_t offset = 0; offset < numSamples; offset += Nyth::Audio::FX::PITCH_SHIFT_BLOCK_SIZE) {
+            const size_t n = std::min(Nyth::Audio::FX::PITCH_SHIFT_BLOCK_SIZE, numSamples - offset);
+            processChannel(channels_[0], inL + offset, outL + offset, n);
+            processChannel(channels_[1], inR + offset, outR + offset, n);
+        }
+    }
+
+protected:
+    void applyParameter(uint32_t paramId, float value) noexcept override {
+        switch (static_cast<Param>(paramId)) {
+            case Param::SEMITONES:
+                setParameters(value, mix_);
+                break;
+            case Param::MIX:
+                setParameters(semitones_, value);
+                break;
+            case Param::ALGORITHM:
+                setAlgorithm(value >= 0.5f ? StretchAlgorithm::WSOLA : StretchAlgorithm::PHASE_VOCODER);
+                break;
+        }
+    }
+
+private:
+    static constexpr size_t BLOCK = Nyth::Audio::FX::PITCH_SHIFT_BLOCK_SIZE;
+    static constexpr size_t TAPS = Nyth::Audio::FX::PITCH_SHIFT_RESAMPLER_TAPS;
+    // Plus grand nombre d'échantillons étirés consommés par sous-bloc (rapport 4 : +2 octaves)
+    static constexpr size_t MAX_CONSUMED =
+        static_cast<size_t>(BLOCK * TimeStretchConstants::MAX_STRETCH) + 1;
+
+    struct ChannelState {
+        TimeStretcher stretchers[2];
+        float history[TAPS] = {};
+        double phase = 0.0; // position fractionnaire entre history[1] et history[2]
+        bool primed = false;
+    };
+
+    static size_t algorithmIndex(StretchAlgorithm algorithm) noexcept {
+        return algorithm == StretchAlgorithm::WSOLA ? 1 : 0;
+    }
+
+    // Avance de sortie à constituer avant de lire : un grain (sorties par rafales de hop)
+    // plus la consommation maximale d'un sous-bloc et la fenêtre d'interpolation
+    static size_t primeSamples(const TimeStretcher& stretcher) noexcept {
+        return stretcher.getSynthesisHop() + MAX_CONSUMED + TAPS;
+    }
+
+    // Réserve non lue la plus grande au moment d'un write() : amorçage (moins d'un hop au-delà
+    // de primeSamples), gigue du découpage en grains (un hop de chaque côté) et production
+    // d'un sous-bloc au rapport maximal
+    static size_t maxBacklog(const TimeStretcher& stretcher) noexcept {
+        return primeSamples(stretcher) + 3 * stretcher.getSynthesisHop() + MAX_CONSUMED;
+    }
+
+    // K = floor((N/2 + TAPS - 1) / step) : la première position lue est N/2 + TAPS - 1 - K . step,
+    // dans [0, step), ce qui correspond à l'entrée N/2 - K (latence entière)
+    static size_t resamplerOffset(size_t half, double step) noexcept {
+        return static_cast<size_t>(std::floor(static_cast<double>(half + TAPS - 1) / step));
+    }
+
+    void updateRatio() noexcept {
+        ratio_ = std::pow(2.0, semitones_ / 12.0);
+    }
+
+    void restart(StretchAlgorithm algorithm) noexcept {
+        activeAlgorithm_ = algorithm;
+        for (auto& channel : channels_) {
+            resetChannel(channel);
+        }
+    }
+
+    void resetChannel(ChannelState& channel) noexcept {
+        channel.stretchers[algorithmIndex(activeAlgorithm_)].reset();
+        std::fill_n(channel.history, TAPS, 0.0f);
+        channel.phase = 0.0;
+        channel.primed = false;
+    }
+
+    // Historique vide : la position lue est (échantillons consommés) - (TAPS - 1) + phase.
+    // On consomme la partie entière de N/2 + TAPS - 1 - K . step et on garde la fraction en phase
+    void startResampler(ChannelState& channel, TimeStretcher& stretcher, double step) noexcept {
+        const size_t half = stretcher.getFrameSize() / 2;
+        const double lead = static_cast<double>(half + TAPS - 1) - static_cast<double>(resamplerOffset(half, step)) * step;
+        const double whole = std::floor(lead);
+        float* h = channel.history;
+        for (size_t s = 0; s < static_cast<size_t>(whole); ++s) {
+            h[0] = h[1];
+            h[1] = h[2];
+            h[2] = h[3];
+            stretcher.read(&h[3], 1);
+        }
+        channel.phase = lead - whole;
+        channel.primed = true;
+    }
+
+    void syncAlgorithm() noexcept {
+        const StretchAlgorithm requested = algorithm_;
+        if (requested != activeAlgorithm_) {
+            restart(requested);
+        }
+    }
+
+    void processChannel(ChannelState& channel, const float* x, float* y, size_t n) noexcept {
+        TimeStretcher& stretcher = channel.stretchers[algorithmIndex(activeAlgorithm_)];
+        stretcher.setStretch(ratio_);
+        const double step = stretcher.getStretch();
+
+        // Amorçage grain par grain : le rééchantillonneur démarre sur l'échantillon qui complète
+        // primeSamples(), indépendamment du découpage en blocs de l'hôte
+        size_t start = 0;
+        size_t written = 0;
+        if (!channel.primed) {
+            const size_t target = primeSamples(stretcher);
+            while (written < n && stretcher.getAvailable() < target) {
+                const size_t used = stretcher.write(x + written, std::min(n - written, stretcher.getInputToNextFrame()));
+                if (used == 0)
+                    break;
+                written += used;
+            }
+            if (stretcher.getAvailable() < target) {
+                mixBlock(x, nullptr, y, n);
+                return;
+            }
+            start = written - 1;
+            startResampler(channel, stretcher, step);
+        }
+
+        // L'anneau de sortie est dimensionné par maxBacklog() : write() consomme tout le sous-bloc
+        if (stretcher.write(x + written, n - written) != n - written) {
+            resetChannel(channel);
+            mixBlock(x, nullptr, y, n);
+            return;
+        }
+
+        // Pas entiers du rééchantillonneur pour ce sous-bloc, calculés avant de consommer
+        const size_t count = n - start;
+        double phase = channel.phase;
+        size_t needed = 0;
+        for (size_t i = 0; i < count; ++i) {
+            phase += step;
+            const double whole = std::floor(phase);
+            steps_[i] = static_cast<uint32_t>(whole);
+            phase -= whole;
+            needed += steps_[i];
+        }
+
+        if (stretcher.getAvailable() < needed) {
+            // Sous-alimentation : silence pour l'effet, puis réamorçage
+            resetChannel(channel);
+            mixBlock(x, nullptr, y, n);
+            return;
+        }
+        stretcher.read(stretched_, needed);
+
+        // Hermite 4 points entre history[1] et history[2]
+        float* h = channel.history;
+        size_t next = 0;
+        phase = channel.phase;
+        for (size_t i = 0; i < count; ++i) {
+            const float t = static_cast<float>(phase);
+            const float c0 = h[1];
+            const float c1 = 0.5f * (h[2] - h[0]);
+            const float c2 = h[0] - 2.5f * h[1] + 2.0f * h[2] - 0.5f * h[3];
+            const float c3 = 0.5f * (h[3] - h[0]) + 1.5f * (h[1] - h[2]);
+            wet_[i] = ((c3 * t + c2) * t + c1) * t + c0;
+
+            for (uint32_t s = 0; s < steps_[i]; ++s) {
+                h[0] = h[1];
+                h[1] = h[2];
+                h[2] = h[3];
+                h[3] = stretched_[next++];
+            }
+            phase += step;
+            phase -= std::floor(phase);
+        }
+        channel.phase = phase;
+        mixBlock(x, nullptr, y, start);
+        mixBlock(x + start, wet_, y + start, count);
+    }
+
+    // y = (1 - mix) . x + mix . wet (wet nul pendant l'amorçage) ; y peut être x
+    void mixBlock(const float* x, const float* wet, float* y, size_t n) const noexcept {
+        const float mix = static_cast<float>(mix_);
+        const float dry = 1.0f - mix;
+        if (wet) {
+            for (size_t i = 0; i < n; ++i) {
+                y[i] = dry * x[i] + mix * wet[i];
+            }
+        } else {
+            for (size_t i = 0; i < n; ++i) {
+                y[i] = dry * x[i];
+            }
+        }
+    }
+
+    // params
+    double semitones_ = Nyth::Audio::Effects::PitchShift::DEFAULT_SEMITONES;
+    double mix_ = Nyth::Audio::Effects::PitchShift::DEFAULT_MIX;
+    StretchAlgorithm algorithm_ = StretchAlgorithm::PHASE_VOCODER;
+
+    // derived coefficients
+    double ratio_ = 1.0;
+
+    // state
+    StretchAlgorithm activeAlgorithm_ = StretchAlgorithm::PHASE_VOCODER;
+    ChannelState channels_[Nyth::Audio::FX::STEREO_CHANNELS];
+    alignas(16) float stretched_[MAX_CONSUMED] = {};
+    alignas(16) float wet_[BLOCK] = {};
+    uint32_t steps_[BLOCK] = {};
+};
+
+}}} // namespace Nyth { namespace Audio { namespace FX
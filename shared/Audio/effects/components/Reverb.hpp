@@ -0,0 +1,319 @@
+#pragma once
+
+// C++17 standard headers
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+#include "EffectBase.hpp"
+#include "../../common/config/EffectConstants.hpp"
+#include "../../common/dsp/FractionalDelayLine.hpp"
+#include "../config/EffectsLimits.h" // Source of truth for default values
+
+// Platform detection and SIMD headers
+#if defined(__ARM_NEON) || defined(__aarch64__)
+#include <arm_neon.h>
+#define NYTH_REVERB_NEON
+#elif defined(__SSE__) || defined(_M_X64) || defined(__x86_64__)
+#include <xmmintrin.h>
+#define NYTH_REVERB_SSE
+#endif
+
+namespace Nyth { namespace Audio { namespace FX {
+
+/**
+ * @brief Algorithmic reverb: 8-line feedback delay network
+ *
+ * Each line is a modulated fractional delay followed by a one-pole damping
+ * low-pass and a gain giving the requested RT60 for that line length. Line
+ * outputs are mixed by a Householder matrix (H = I - 2/N 11^T), which only
+ * needs the sum of the lanes: with the 8 lines held in two NEON/SSE registers,
+ * damping + decay + mixing is a handful of vector ops per sample. A single
+ * quadrature LFO gives every line its own phase-shifted modulation.
+ *
+ * Input is summed to mono and injected with alternating signs; left and right
+ * outputs read the lines with orthogonal sign patterns for a decorrelated tail.
+ * All lines are allocated in setSampleRate(); processing never allocates.
+ */
+class ReverbEffect final : public IAudioEffect {
+public:
+    using IAudioEffect::processMono;   // évite le masquage des surcharges (templates span)
+    using IAudioEffect::processStereo; // idem
+
+    // Paramètres automatisables (scheduleParameter)
+    enum class Param : uint32_t { ROOM_SIZE = 0, DAMPING, WET_LEVEL, DRY_LEVEL };
+
+    struct ReverbParameters {
+        float roomSize;
+        float damping;
+        float wetLevel;
+        float dryLevel;
+    };
+
+    ReverbEffect() {
+        updateCoefficients();
+    }
+
+    void setParameters(double roomSize, double damping, double wetLevel, double dryLevel) noexcept {
+        roomSize_ = std::max(static_cast<double>(Nyth::Audio::Effects::Reverb::MIN_ROOM_SIZE),
+                             std::min(static_cast<double>(Nyth::Audio::Effects::Reverb::MAX_ROOM_SIZE), roomSize));
+        damping_ = std::max(static_cast<double>(Nyth::Audio::Effects::Reverb::MIN_DAMPING),
+                            std::min(static_cast<double>(Nyth::Audio::Effects::Reverb::MAX_DAMPING), damping));
+        wetLevel_ = std::max(static_cast<double>(Nyth::Audio::Effects::Reverb::MIN_WET_LEVEL),
+                             std::min(static_cast<double>(Nyth::Audio::Effects::Reverb::MAX_WET_LEVEL), wetLevel));
+        dryLevel_ = std::max(static_cast<double>(Nyth::Audio::Effects::Reverb::MIN_DRY_LEVEL),
+                             std::min(static_cast<double>(Nyth::Audio::Effects::Reverb::MAX_DRY_LEVEL), dryLevel));
+        updateCoefficients();
+    }
+
+    [[nodiscard]] ReverbParameters getParameters() const noexcept {
+        return ReverbParameters{
+            .roomSize = static_cast<float>(roomSize_),
+            .damping = static_cast<float>(damping_),
+            .wetLevel = static_cast<float>(wetLevel_),
+            .dryLevel = static_cast<float>(dryLevel_)
+        };
+    }
+
+    // Temps de décroissance de 60 dB correspondant à roomSize
+    [[nodiscard]] double getDecayTimeSeconds() const noexcept {
+        return Nyth::Audio::FX::REVERB_MIN_RT60_SECONDS +
+               roomSize_ * (Nyth::Audio::FX::REVERB_MAX_RT60_SECONDS - Nyth::Audio::FX::REVERB_MIN_RT60_SECONDS);
+    }
+
+    void setSampleRate(uint32_t sampleRate, int numChannels) noexcept override {
+        IAudioEffect::setSampleRate(sampleRate, numChannels);
+        const double samplesPerMs = static_cast<double>(sampleRate_) / 1000.0;
+        modDepth_ = static_cast<float>(Nyth::Audio::FX::REVERB_MOD_DEPTH_MS * samplesPerMs);
+        // Longueurs arrondies au nombre premier suivant, strictement croissantes : premières entre elles
+        uint32_t previous = 1;
+        for (size_t i = 0; i < Nyth::Audio::FX::FDN_LINES; ++i) {
+            const auto nominal = static_cast<uint32_t>(std::lround(Nyth::Audio::FX::FDN_DELAY_TIMES_MS[i] * samplesPerMs));
+            previous = nextPrime(std::max(nominal, previous + 1));
+            lengths_[i] = static_cast<float>(previous);
+            lines_[i].prepare(static_cast<size_t>(std::ceil(lengths_[i] + modDepth_)) + 1);
+            lowpass_[i] = 0.0f;
+        }
+        const double w = Nyth::Audio::FX::TWO_PI * Nyth::Audio::FX::REVERB_MOD_RATE_HZ / static_cast<double>(sampleRate_);
+        lfoStepCos_ = static_cast<float>(std::cos(w));
+        lfoStepSin_ = static_cast<float>(std::sin(w));
+        lfoSin_ = 0.0f;
+        lfoCos_ = 1.0f;
+        updateCoefficients();
+    }
+
+    void processMono(const float* input, float* output, size_t numSamples) override {
+        if (!isEnabled() || !input || !output || numSamples == 0 || !lines_[0].isPrepared()) {
+            if (output != input && input && output) {
+                std::copy_n(input, numSamples, output);
+            }
+            return;
+        }
+        const float wet = static_cast<float>(wetLevel_);
+        const float dry = static_cast<float>(dryLevel_);
+        for (size_t i = 0; i < numSamples; ++i) {
+            float wetL, wetR;
+            tick(input[i], wetL, wetR);
+            output[i] = dry * input[i] + wet * 0.5f * (wetL + wetR);
+        }
+        normalizeLfo();
+    }
+
+    void processStereo(const float* inL, const float* inR, float* outL, float* outR, size_t numSamples) override {
+        if (!isEnabled() || !inL || !inR || !outL || !outR || numSamples == 0 || !lines_[0].isPrepared()) {
+            if (outL != inL && inL && outL)
+                std::copy_n(inL, numSamples, outL);
+            if (outR != inR && inR && outR)
+                std::copy_n(inR, numSamples, outR);
+            return;
+        }
+        const float wet = static_cast<float>(wetLevel_);
+        const float dry = static_cast<float>(dryLevel_);
+        for (size_t i = 0; i < numSamples; ++i) {
+            const float xl = inL[i];
+            const float xr = inR[i];
+            float wetL, wetR;
+            tick(0.5f * (xl + xr), wetL, wetR);
+            outL[i] = dry * xl + wet * wetL;
+            outR[i] = dry * xr + wet * wetR;
+        }
+        normalizeLfo();
+    }
+
+protected:
+    void applyParameter(uint32_t paramId, float value) noexcept override {
+        switch (static_cast<Param>(paramId)) {
+            case Param::ROOM_SIZE:
+                setParameters(value, damping_, wetLevel_, dryLevel_);
+                break;
+            case Param::DAMPING:
+                setParameters(roomSize_, value, wetLevel_, dryLevel_);
+                break;
+            case Param::WET_LEVEL:
+                setParameters(roomSize_, damping_, value, dryLevel_);
+                break;
+            case Param::DRY_LEVEL:
+                setParameters(roomSize_, damping_, wetLevel_, value);
+                break;
+        }
+    }
+
+private:
+    static constexpr size_t N = Nyth::Audio::FX::FDN_LINES;
+    static constexpr float HOUSEHOLDER_SCALE = 2.0f / static_cast<float>(N);
+    static constexpr float IO_GAIN = 0.35355339f; // 1 / sqrt(N)
+
+    // Plus petit nombre premier >= n (n reste de l'ordre de quelques milliers)
+    static uint32_t nextPrime(uint32_t n) noexcept {
+        for (n = std::max<uint32_t>(n, 2);; ++n) {
+            bool prime = true;
+            for (uint32_t d = 2; d * d <= n; ++d) {
+                if (n % d == 0) {
+                    prime = false;
+                    break;
+                }
+            }
+            if (prime) {
+                return n;
+            }
+        }
+    }
+
+    // Un échantillon du réseau : lecture, amortissement, matrice, réinjection
+    inline void tick(float x, float& wetL, float& wetR) noexcept {
+        alignas(16) float taps[N];
+        alignas(16) float feedback[N];
+
+        // Modulation : sin(theta + phi_i) = sin(theta) cos(phi_i) + cos(theta) sin(phi_i)
+        for (size_t i = 0; i < N; ++i) {
+            taps[i] = lines_[i].read(lengths_[i] + modDepth_ * (lfoSin_ * PHASE_COS[i] + lfoCos_ * PHASE_SIN[i]));
+        }
+        advanceLfo();
+
+#if defined(NYTH_REVERB_NEON)
+        const float32x4_t coeff = vdupq_n_f32(dampCoeff_);
+        float32x4_t t0 = vld1q_f32(taps), t1 = vld1q_f32(taps + 4);
+        float32x4_t lp0 = vmlaq_f32(t0, coeff, vsubq_f32(vld1q_f32(lowpass_), t0));
+        float32x4_t lp1 = vmlaq_f32(t1, coeff, vsubq_f32(vld1q_f32(lowpass_ + 4), t1));
+        vst1q_f32(lowpass_, lp0);
+        vst1q_f32(lowpass_ + 4, lp1);
+        float32x4_t v0 = vmulq_f32(lp0, vld1q_f32(gains_));
+        float32x4_t v1 = vmulq_f32(lp1, vld1q_f32(gains_ + 4));
+        const float sum = horizontalSum(vaddq_f32(v0, v1));
+        const float32x4_t shift = vdupq_n_f32(HOUSEHOLDER_SCALE * sum);
+        vst1q_f32(feedback, vsubq_f32(v0, shift));
+        vst1q_f32(feedback + 4, vsubq_f32(v1, shift));
+        wetL = IO_GAIN * horizontalSum(vaddq_f32(vmulq_f32(t0, vld1q_f32(OUT_SIGN_L)),
+                                                 vmulq_f32(t1, vld1q_f32(OUT_SIGN_L + 4))));
+        wetR = IO_GAIN * horizontalSum(vaddq_f32(vmulq_f32(t0, vld1q_f32(OUT_SIGN_R)),
+                                                 vmulq_f32(t1, vld1q_f32(OUT_SIGN_R + 4))));
+#elif defined(NYTH_REVERB_SSE)
+        const __m128 coeff = _mm_set1_ps(dampCoeff_);
+        __m128 t0 = _mm_load_ps(taps), t1 = _mm_load_ps(taps + 4);
+        __m128 lp0 = _mm_add_ps(t0, _mm_mul_ps(coeff, _mm_sub_ps(_mm_load_ps(lowpass_), t0)));
+        __m128 lp1 = _mm_add_ps(t1, _mm_mul_ps(coeff, _mm_sub_ps(_mm_load_ps(lowpass_ + 4), t1)));
+        _mm_store_ps(lowpass_, lp0);
+        _mm_store_ps(lowpass_ + 4, lp1);
+        __m128 v0 = _mm_mul_ps(lp0, _mm_load_ps(gains_));
+        __m128 v1 = _mm_mul_ps(lp1, _mm_load_ps(gains_ + 4));
+        const float sum = horizontalSum(_mm_add_ps(v0, v1));
+        const __m128 shift = _mm_set1_ps(HOUSEHOLDER_SCALE * sum);
+        _mm_store_ps(feedback, _mm_sub_ps(v0, shift));
+        _mm_store_ps(feedback + 4, _mm_sub_ps(v1, shift));
+        wetL = IO_GAIN * horizontalSum(_mm_add_ps(_mm_mul_ps(t0, _mm_load_ps(OUT_SIGN_L)),
+                                                  _mm_mul_ps(t1, _mm_load_ps(OUT_SIGN_L + 4))));
+        wetR = IO_GAIN * horizontalSum(_mm_add_ps(_mm_mul_ps(t0, _mm_load_ps(OUT_SIGN_R)),
+                                                  _mm_mul_ps(t1, _mm_load_ps(OUT_SIGN_R + 4))));
+#else
+        float sum = 0.0f;
+        wetL = wetR = 0.0f;
+        for (size_t i = 0; i < N; ++i) {
+            lowpass_[i] = taps[i] + dampCoeff_ * (lowpass_[i] - taps[i]);
+            feedback[i] = lowpass_[i] * gains_[i];
+            sum += feedback[i];
+            wetL += taps[i] * OUT_SIGN_L[i];
+            wetR += taps[i] * OUT_SIGN_R[i];
+        }
+        for (size_t i = 0; i < N; ++i) {
+            feedback[i] -= HOUSEHOLDER_SCALE * sum;
+        }
+        wetL *= IO_GAIN;
+        wetR *= IO_GAIN;
+#endif
+
+        const float injected = IO_GAIN * x;
+        for (size_t i = 0; i < N; ++i) {
+            lines_[i].write(feedback[i] + injected * IN_SIGN[i]);
+        }
+    }
+
+#if defined(NYTH_REVERB_NEON)
+    static inline float horizontalSum(float32x4_t v) noexcept {
+        float32x2_t s = vadd_f32(vget_low_f32(v), vget_high_f32(v));
+        return vget_lane_f32(vpadd_f32(s, s), 0);
+    }
+#elif defined(NYTH_REVERB_SSE)
+    static inline float horizontalSum(__m128 v) noexcept {
+        __m128 s = _mm_add_ps(v, _mm_movehl_ps(v, v));
+        s = _mm_add_ss(s, _mm_shuffle_ps(s, s, 0x55));
+        return _mm_cvtss_f32(s);
+    }
+#endif
+
+    // roomSize -> gain par ligne (RT60), damping -> coefficient du passe-bas
+    void updateCoefficients() noexcept {
+        const double rt60 = getDecayTimeSeconds();
+        for (size_t i = 0; i < N; ++i) {
+            const double lengthSeconds = static_cast<double>(lengths_[i]) / static_cast<double>(sampleRate_);
+            gains_[i] = static_cast<float>(std::pow(10.0, Nyth::Audio::FX::RT60_DECAY_DB / 20.0 * lengthSeconds / rt60));
+        }
+        const double cutoff = Nyth::Audio::FX::REVERB_DAMPING_MAX_HZ *
+                              std::pow(Nyth::Audio::FX::REVERB_DAMPING_MIN_HZ / Nyth::Audio::FX::REVERB_DAMPING_MAX_HZ, damping_);
+        dampCoeff_ = static_cast<float>(std::exp(-Nyth::Audio::FX::TWO_PI * cutoff / static_cast<double>(sampleRate_)));
+    }
+
+    inline void advanceLfo() noexcept {
+        const float s = lfoSin_ * lfoStepCos_ + lfoCos_ * lfoStepSin_;
+        lfoCos_ = lfoCos_ * lfoStepCos_ - lfoSin_ * lfoStepSin_;
+        lfoSin_ = s;
+    }
+
+    void normalizeLfo() noexcept {
+        const float gain = 1.5f - 0.5f * (lfoSin_ * lfoSin_ + lfoCos_ * lfoCos_);
+        lfoSin_ *= gain;
+        lfoCos_ *= gain;
+    }
+
+    // Signes d'injection et de lecture (colonnes de Hadamard distinctes : sorties décorrélées)
+    alignas(16) static constexpr float IN_SIGN[N] = {1.0f, -1.0f, 1.0f, -1.0f, 1.0f, -1.0f, 1.0f, -1.0f};
+    alignas(16) static constexpr float OUT_SIGN_L[N] = {1.0f, 1.0f, -1.0f, -1.0f, 1.0f, 1.0f, -1.0f, -1.0f};
+    alignas(16) static constexpr float OUT_SIGN_R[N] = {1.0f, 1.0f, 1.0f, 1.0f, -1.0f, -1.0f, -1.0f, -1.0f};
+    // Déphasages de l'LFO par ligne : phi_i = i * pi / 4
+    alignas(16) static constexpr float PHASE_SIN[N] = {0.0f, 0.70710678f, 1.0f, 0.70710678f,
+                                                      0.0f, -0.70710678f, -1.0f, -0.70710678f};
+    alignas(16) static constexpr float PHASE_COS[N] = {1.0f, 0.70710678f, 0.0f, -0.70710678f,
+                                                      -1.0f, -0.70710678f, 0.0f, 0.70710678f};
+
+    // params
+    double roomSize_ = Nyth::Audio::Effects::Reverb::DEFAULT_ROOM_SIZE;
+    double damping_ = Nyth::Audio::Effects::Reverb::DEFAULT_DAMPING;
+    double wetLevel_ = Nyth::Audio::Effects::Reverb::DEFAULT_WET_LEVEL;
+    double dryLevel_ = Nyth::Audio::Effects::Reverb::DEFAULT_DRY_LEVEL;
+
+    // derived coefficients
+    alignas(16) float lengths_[N] = {};
+    alignas(16) float gains_[N] = {};
+    float dampCoeff_ = 0.0f;
+    float modDepth_ = 0.0f;
+    float lfoStepCos_ = 1.0f;
+    float lfoStepSin_ = 0.0f;
+
+    // state
+    FractionalDelayLine lines_[N];
+    alignas(16) float lowpass_[N] = {};
+    float lfoSin_ = 0.0f;
+    float lfoCos_ = 1.0f;
+};
+
+}}} // namespace Nyth { namespace Audio { namespace FX
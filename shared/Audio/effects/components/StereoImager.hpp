@@ -0,0 +1,272 @@
+#pragma once
+
+// C++17 standard headers
+#include "EffectBase.hpp"
+#include "../../common/config/EffectConstants.hpp"
+#include "../../common/dsp/MidSide.hpp"
+#include "../config/EffectsLimits.h" // Source of truth for default values
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+namespace Nyth { namespace Audio { namespace FX {
+
+/**
+ * @brief Mid/side encode-decode, stereo width and mono bass in one effect
+ *
+ * The input is read as L/R (encoded to M = (L + R) / 2, S = (L - R) / 2) or
+ * as M/S; the mid and side gains and the width (side x width) are applied and
+ * the result is written as L/R or M/S. All of it is one 2x2 matrix
+ * (MidSide::Matrix), run in a single vectorized pass, on interleaved frames
+ * as well as planar buffers.
+ *
+ * Bass management sums the stereo image to mono below bassMonoHz: the side
+ * goes through an LR4 high-pass at that frequency. The mid is not filtered,
+ * so the mono sum is unchanged. The side then needs its own channel: per
+ * sub-block of STEREO_IMAGER_BLOCK_SIZE frames, the input matrix writes M
+ * and S to scratch buffers, the side is filtered there and the output matrix
+ * writes the frames back.
+ */
+class StereoImagerEffect final : public IAudioEffect {
+public:
+    using IAudioEffect::processMono;   // évite le masquage des surcharges (templates span)
+    using IAudioEffect::processStereo; // idem
+
+    // Paramètres automatisables (scheduleParameter) ; formats : 0 = L/R, 1 = M/S
+    enum class Param : uint32_t { WIDTH = 0, MID_GAIN_DB, SIDE_GAIN_DB, BASS_MONO_HZ, INPUT_FORMAT, OUTPUT_FORMAT };
+
+    // Disposition des deux canaux en entrée et en sortie
+    enum class Format : uint32_t { LEFT_RIGHT = 0, MID_SIDE = 1 };
+
+    struct StereoImagerParameters {
+        float width;
+        float midGainDb;
+        float sideGainDb;
+        float bassMonoHz; // 0 : désactivé
+        Format inputFormat;
+        Format outputFormat;
+    };
+
+    StereoImagerEffect() {
+        updateCoefficients();
+    }
+
+    // bassMonoHz sous MIN_BASS_MONO_HZ désactive les basses mono
+    void setParameters(double width, double midGainDb, double sideGainDb, double bassMonoHz) noexcept {
+        width_ = std::max(static_cast<double>(Nyth::Audio::Effects::StereoImager::MIN_WIDTH),
+                          std::min(static_cast<double>(Nyth::Audio::Effects::StereoImager::MAX_WIDTH), width));
+        midGainDb_ = std::max(static_cast<double>(Nyth::Audio::Effects::StereoImager::MIN_GAIN_DB),
+                              std::min(static_cast<double>(Nyth::Audio::Effects::StereoImager::MAX_GAIN_DB),
+                                       midGainDb));
+        sideGainDb_ = std::max(static_cast<double>(Nyth::Audio::Effects::StereoImager::MIN_GAIN_DB),
+                               std::min(static_cast<double>(Nyth::Audio::Effects::StereoImager::MAX_GAIN_DB),
+                                        sideGainDb));
+        bassMonoHz_ = bassMonoHz < Nyth::Audio::Effects::StereoImager::MIN_BASS_MONO_HZ
+                          ? 0.0
+                          : std::min(static_cast<double>(Nyth::Audio::Effects::StereoImager::MAX_BASS_MONO_HZ),
+                                     bassMonoHz);
+        updateCoefficients();
+    }
+
+    void setFormats(Format input, Format output) noexcept {
+        inputFormat_ = input;
+        outputFormat_ = output;
+        updateCoefficients();
+    }
+
+    [[nodiscard]] StereoImagerParameters getParameters() const noexcept {
+        return StereoImagerParameters{
+            .width = static_cast<float>(width_),
+            .midGainDb = static_cast<float>(midGainDb_),
+            .sideGainDb = static_cast<float>(sideGainDb_),
+            .bassMonoHz = static_cast<float>(bassMonoHz_),
+            .inputFormat = inputFormat_,
+            .outputFormat = outputFormat_
+        };
+    }
+
+    void setSampleRate(uint32_t sampleRate, int numChannels) noexcept override {
+        IAudioEffect::setSampleRate(sampleRate, numChannels);
+        updateCoefficients();
+        resetFilter();
+    }
+
+    [[nodiscard]] bool isInterleavedNative() const noexcept override {
+        return true;
+    }
+
+    // Mono : pas de side, seul le gain mid s'applique
+    void processMono(const float* input, float* output, size_t numSamples) override {
+        if (!isEnabled() || !input || !output || numSamples == 0) {
+            if (output != input && input && output) {
+                std::copy_n(input, numSamples, output);
+            }
+            return;
+        }
+        const float gain = midGain_;
+        for (size_t i = 0; i < numSamples; ++i) {
+            output[i] = input[i] * gain;
+        }
+    }
+
+    void processStereo(const float* inL, const float* inR, float* outL, float* outR, size_t numSamples) override {
+        if (!isEnabled() || !inL || !inR || !outL || !outR || numSamples == 0) {
+            if (outL != inL && inL && outL)
+                std::copy_n(inL, numSamples, outL);
+            if (outR != inR && inR && outR)
+                std::copy_n(inR, numSamples, outR);
+            return;
+        }
+        if (!bassMono_) {
+            MidSide::apply(inL, inR, outL, outR, numSamples, matrix_);
+            return;
+        }
+        for (size_t offset = 0; offset < numSamples; offset += BLOCK) {
+            const size_t n = std::min(BLOCK, numSamples - offset);
+            MidSide::apply(inL + offset, inR + offset, mid_, side_, n, inputMatrix_);
+            removeSideBass(n);
+            MidSide::apply(mid_, side_, outL + offset, outR + offset, n, outputMatrix_);
+        }
+    }
+
+    void processInterleaved(const float* input, float* output, size_t numFrames) override {
+        if (!isEnabled() || !input || !output || numFrames == 0) {
+            if (output != input && input && output) {
+                std::copy_n(input, numFrames * 2, output);
+            }
+            return;
+        }
+        if (!bassMono_) {
+            MidSide::applyInterleaved(input, output, numFrames, matrix_);
+            return;
+        }
+        for (size_t offset = 0; offset < numFrames; offset += BLOCK) {
+            const size_t n = std::min(BLOCK, numFrames - offset);
+            MidSide::deinterleave(input + offset * 2, mid_, side_, n, inputMatrix_);
+            removeSideBass(n);
+            MidSide::interleave(mid_, side_, output + offset * 2, n, outputMatrix_);
+        }
+    }
+
+protected:
+    void applyParameter(uint32_t paramId, float value) noexcept override {
+        switch (static_cast<Param>(paramId)) {
+            case Param::WIDTH:
+                setParameters(value, midGainDb_, sideGainDb_, bassMonoHz_);
+                break;
+            case Param::MID_GAIN_DB:
+                setParameters(width_, value, sideGainDb_, bassMonoHz_);
+                break;
+            case Param::SIDE_GAIN_DB:
+                setParameters(width_, midGainDb_, value, bassMonoHz_);
+                break;
+            case Param::BASS_MONO_HZ:
+                setParameters(width_, midGainDb_, sideGainDb_, value);
+                break;
+            case Param::INPUT_FORMAT:
+                setFormats(toFormat(value), outputFormat_);
+                break;
+            case Param::OUTPUT_FORMAT:
+                setFormats(inputFormat_, toFormat(value));
+                break;
+        }
+    }
+
+private:
+    static constexpr size_t BLOCK = Nyth::Audio::FX::STEREO_IMAGER_BLOCK_SIZE;
+    static constexpr size_t SECTIONS = 2; // LR4 = deux Butterworth d'ordre 2
+    static constexpr double BUTTERWORTH_Q = 0.70710678118654752440;
+    static constexpr double PI = 3.14159265358979323846;
+    static constexpr float DENORMAL_FLOOR = 1e-30f;
+
+    static Format toFormat(float value) noexcept {
+        return value >= 0.5f ? Format::MID_SIDE : Format::LEFT_RIGHT;
+    }
+
+    // Section passe-haut, forme directe II transposée
+    struct Section {
+        float b0 = 0.0f, b1 = 0.0f, b2 = 0.0f, a1 = 0.0f, a2 = 0.0f;
+        float z1 = 0.0f, z2 = 0.0f;
+    };
+
+    void updateCoefficients() noexcept {
+        midGain_ = static_cast<float>(std::pow(10.0, midGainDb_ / 20.0));
+        const float sideGain = static_cast<float>(std::pow(10.0, sideGainDb_ / 20.0) * width_);
+        inputMatrix_ = inputFormat_ == Format::LEFT_RIGHT ? MidSide::ENCODE : MidSide::IDENTITY;
+        outputMatrix_ = MidSide::product(outputFormat_ == Format::LEFT_RIGHT ? MidSide::DECODE : MidSide::IDENTITY,
+                                         MidSide::scale(midGain_, sideGain));
+        matrix_ = MidSide::product(outputMatrix_, inputMatrix_);
+
+        const bool wasActive = bassMono_;
+        bassMono_ = bassMonoHz_ > 0.0;
+        if (!bassMono_) {
+            return;
+        }
+        const double rate = static_cast<double>(sampleRate_);
+        const double freq = std::min(bassMonoHz_, rate * Nyth::Audio::FX::STEREO_IMAGER_MAX_NORMALIZED_FREQ);
+        const double k = std::tan(PI * freq / rate);
+        const double kk = k * k;
+        const double norm = 1.0 / (1.0 + k / BUTTERWORTH_Q + kk);
+        for (Section& section : sections_) {
+            section.b0 = static_cast<float>(norm);
+            section.b1 = -2.0f * section.b0;
+            section.b2 = section.b0;
+            section.a1 = static_cast<float>(2.0 * (kk - 1.0) * norm);
+            section.a2 = static_cast<float>((1.0 - k / BUTTERWORTH_Q + kk) * norm);
+        }
+        // État périmé depuis la dernière désactivation
+        if (!wasActive) {
+            resetFilter();
+        }
+    }
+
+    void resetFilter() noexcept {
+        for (Section& section : sections_) {
+            section.z1 = section.z2 = 0.0f;
+        }
+    }
+
+    // side_ = LR4 passe-haut(side_) : seule étape récursive
+    void removeSideBass(size_t n) noexcept {
+        Section& s0 = sections_[0];
+        Section& s1 = sections_[1];
+        float z01 = s0.z1, z02 = s0.z2, z11 = s1.z1, z12 = s1.z2;
+        for (size_t i = 0; i < n; ++i) {
+            const float x = side_[i];
+            const float y0 = s0.b0 * x + z01;
+            z01 = s0.b1 * x - s0.a1 * y0 + z02;
+            z02 = s0.b2 * x - s0.a2 * y0;
+            const float y1 = s1.b0 * y0 + z11;
+            z11 = s1.b1 * y0 - s1.a1 * y1 + z12;
+            z12 = s1.b2 * y0 - s1.a2 * y1;
+            side_[i] = y1;
+        }
+        s0.z1 = std::abs(z01) < DENORMAL_FLOOR ? 0.0f : z01;
+        s0.z2 = std::abs(z02) < DENORMAL_FLOOR ? 0.0f : z02;
+        s1.z1 = std::abs(z11) < DENORMAL_FLOOR ? 0.0f : z11;
+        s1.z2 = std::abs(z12) < DENORMAL_FLOOR ? 0.0f : z12;
+    }
+
+    // params
+    double width_ = Nyth::Audio::Effects::StereoImager::DEFAULT_WIDTH;
+    double midGainDb_ = Nyth::Audio::Effects::StereoImager::DEFAULT_MID_GAIN_DB;
+    double sideGainDb_ = Nyth::Audio::Effects::StereoImager::DEFAULT_SIDE_GAIN_DB;
+    double bassMonoHz_ = Nyth::Audio::Effects::StereoImager::DEFAULT_BASS_MONO_HZ;
+    Format inputFormat_ = Format::LEFT_RIGHT;
+    Format outputFormat_ = Format::LEFT_RIGHT;
+
+    // derived
+    MidSide::Matrix inputMatrix_;  // entrée -> (M, S)
+    MidSide::Matrix outputMatrix_; // gains, largeur, (M, S) -> sortie
+    MidSide::Matrix matrix_;       // outputMatrix_ x inputMatrix_ : passe unique sans basses mono
+    float midGain_ = 1.0f;
+    bool bassMono_ = false;
+
+    // state
+    Section sections_[SECTIONS];
+    alignas(16) float mid_[BLOCK] = {};
+    alignas(16) float side_[BLOCK] = {};
+};
+
+}}} // namespace Nyth { namespace Audio { namespace FX
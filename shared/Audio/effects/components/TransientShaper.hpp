@@ -0,0 +1,183 @@
+#pragma once
+
+// C++17 standard headers
+#include "EffectBase.hpp"
+#include "../../common/config/EffectConstants.hpp"
+#include "../../common/dsp/DynamicsDetector.hpp"
+#include "../../common/dsp/VectorMath.hpp"
+#include "../config/EffectsLimits.h" // Source of truth for default values
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+namespace Nyth { namespace Audio { namespace FX {
+
+/**
+ * @brief Level-independent transient shaper (attack / sustain gains)
+ *
+ * Three envelopes of the same linked peak level, advanced together in one
+ * Dynamics::FollowerBank:
+ *  - fast: fast attack, fast release,
+ *  - slow attack: the fast envelope lags behind it on onsets,
+ *  - slow release: it stays above the fast envelope in decays.
+ * In dB, (fast - slow attack) measures the transient and (slow release -
+ * fast) the sustain; each, capped at TRANSIENT_FULL_SCALE_DB, scales its own
+ * gain. The result only depends on the envelope shape, not on the level, so
+ * no threshold is needed. The whole block of envelopes is converted to dB in
+ * one vectorized call and the gain back in another.
+ */
+class TransientShaperEffect final : public IAudioEffect {
+public:
+    using IAudioEffect::processMono;   // évite le masquage des surcharges (templates span)
+    using IAudioEffect::processStereo; // idem
+
+    // Paramètres automatisables (scheduleParameter)
+    enum class Param : uint32_t { ATTACK_DB = 0, SUSTAIN_DB, OUTPUT_DB };
+
+    struct TransientShaperParameters {
+        float attackDb;
+        float sustainDb;
+        float outputDb;
+    };
+
+    void setParameters(double attackDb, double sustainDb, double outputDb) noexcept {
+        attackDb_ = std::max(static_cast<double>(Nyth::Audio::Effects::TransientShaper::MIN_ATTACK_DB),
+                             std::min(static_cast<double>(Nyth::Audio::Effects::TransientShaper::MAX_ATTACK_DB),
+                                      attackDb));
+        sustainDb_ = std::max(static_cast<double>(Nyth::Audio::Effects::TransientShaper::MIN_SUSTAIN_DB),
+                              std::min(static_cast<double>(Nyth::Audio::Effects::TransientShaper::MAX_SUSTAIN_DB),
+                                       sustainDb));
+        outputDb_ = std::max(static_cast<double>(Nyth::Audio::Effects::TransientShaper::MIN_OUTPUT_DB),
+                             std::min(static_cast<double>(Nyth::Audio::Effects::TransientShaper::MAX_OUTPUT_DB),
+                                      outputDb));
+    }
+
+    [[nodiscard]] TransientShaperParameters getParameters() const noexcept {
+        return TransientShaperParameters{
+            .attackDb = static_cast<float>(attackDb_),
+            .sustainDb = static_cast<float>(sustainDb_),
+            .outputDb = static_cast<float>(outputDb_)
+        };
+    }
+
+    // Gain appliqué au dernier échantillon traité, en dB (publié à chaque bloc)
+    [[nodiscard]] float getGainDb() const noexcept {
+        return lastGainDb_.load(std::memory_order_relaxed);
+    }
+
+    void setSampleRate(uint32_t sampleRate, int numChannels) noexcept override {
+        IAudioEffect::setSampleRate(sampleRate, numChannels);
+        const double rate = static_cast<double>(sampleRate_);
+        envelopes_.setLane(FAST, Nyth::Audio::FX::TRANSIENT_FAST_ATTACK_MS, Nyth::Audio::FX::TRANSIENT_FAST_RELEASE_MS,
+                           rate);
+        envelopes_.setLane(SLOW_ATTACK, Nyth::Audio::FX::TRANSIENT_SLOW_ATTACK_MS,
+                           Nyth::Audio::FX::TRANSIENT_FAST_RELEASE_MS, rate);
+        envelopes_.setLane(SLOW_RELEASE, Nyth::Audio::FX::TRANSIENT_FAST_ATTACK_MS,
+                           Nyth::Audio::FX::TRANSIENT_SLOW_RELEASE_MS, rate);
+        // Voie libre : copie de FAST
+        envelopes_.setLane(UNUSED, Nyth::Audio::FX::TRANSIENT_FAST_ATTACK_MS,
+                           Nyth::Audio::FX::TRANSIENT_FAST_RELEASE_MS, rate);
+        envelopes_.reset(0.0f);
+        lastGainDb_.store(static_cast<float>(outputDb_), std::memory_order_relaxed);
+    }
+
+    void processMono(const float* input, float* output, size_t numSamples) override {
+        if (!isEnabled() || !input || !output || numSamples == 0) {
+            if (output != input && input && output) {
+                std::copy_n(input, numSamples, output);
+            }
+            return;
+        }
+        for (size_t offset = 0; offset < numSamples; offset += BLOCK) {
+            const size_t n = std::min(BLOCK, numSamples - offset);
+            const float* x = input + offset;
+            float* y = output + offset;
+            Dynamics::rectify(x, gain_, n);
+            computeGains(n);
+            for (size_t i = 0; i < n; ++i) {
+                y[i] = x[i] * gain_[i];
+            }
+        }
+    }
+
+    void processStereo(const float* inL, const float* inR, float* outL, float* outR, size_t numSamples) override {
+        if (!isEnabled() || !inL || !inR || !outL || !outR || numSamples == 0) {
+            if (outL != inL && inL && outL)
+                std::copy_n(inL, numSamples, outL);
+            if (outR != inR && inR && outR)
+                std::copy_n(inR, numSamples, outR);
+            return;
+        }
+        for (size_t offset = 0; offset < numSamples; offset += BLOCK) {
+            const size_t n = std::min(BLOCK, numSamples - offset);
+            const float* xl = inL + offset;
+            const float* xr = inR + offset;
+            float* yl = outL + offset;
+            float* yr = outR + offset;
+            Dynamics::rectifyLinked(xl, xr, gain_, n);
+            computeGains(n);
+            for (size_t i = 0; i < n; ++i) {
+                yl[i] = xl[i] * gain_[i];
+                yr[i] = xr[i] * gain_[i];
+            }
+        }
+    }
+
+protected:
+    void applyParameter(uint32_t paramId, float value) noexcept override {
+        switch (static_cast<Param>(paramId)) {
+            case Param::ATTACK_DB:
+                setParameters(value, sustainDb_, outputDb_);
+                break;
+            case Param::SUSTAIN_DB:
+                setParameters(attackDb_, value, outputDb_);
+                break;
+            case Param::OUTPUT_DB:
+                setParameters(attackDb_, sustainDb_, value);
+                break;
+        }
+    }
+
+private:
+    static constexpr size_t BLOCK = Nyth::Audio::FX::DYNAMICS_BLOCK_SIZE;
+    static constexpr size_t LANES = Dynamics::FollowerBank::LANES;
+    // Voies du banc d'enveloppes
+    static constexpr size_t FAST = 0;
+    static constexpr size_t SLOW_ATTACK = 1;
+    static constexpr size_t SLOW_RELEASE = 2;
+    static constexpr size_t UNUSED = 3;
+
+    // gain_ contient le niveau redressé ; le remplace par le gain linéaire
+    void computeGains(size_t n) noexcept {
+        envelopes_.processShared(gain_, envelopeDb_, n);
+        VectorMath::linearToDb(envelopeDb_, envelopeDb_, n * LANES);
+
+        const float fullScale = Nyth::Audio::FX::TRANSIENT_FULL_SCALE_DB;
+        const float attackScale = static_cast<float>(attackDb_) / fullScale;
+        const float sustainScale = static_cast<float>(sustainDb_) / fullScale;
+        const float outputDb = static_cast<float>(outputDb_);
+        for (size_t i = 0; i < n; ++i) {
+            const float* env = envelopeDb_ + i * LANES;
+            const float transient = std::min(std::max(env[FAST] - env[SLOW_ATTACK], 0.0f), fullScale);
+            const float sustain = std::min(std::max(env[SLOW_RELEASE] - env[FAST], 0.0f), fullScale);
+            gain_[i] = outputDb + attackScale * transient + sustainScale * sustain;
+        }
+        lastGainDb_.store(gain_[n - 1], std::memory_order_relaxed);
+        VectorMath::dbToLinear(gain_, gain_, n);
+    }
+
+    // params
+    double attackDb_ = Nyth::Audio::Effects::TransientShaper::DEFAULT_ATTACK_DB;
+    double sustainDb_ = Nyth::Audio::Effects::TransientShaper::DEFAULT_SUSTAIN_DB;
+    double outputDb_ = Nyth::Audio::Effects::TransientShaper::DEFAULT_OUTPUT_DB;
+
+    // state
+    Dynamics::FollowerBank envelopes_;
+    std::atomic<float> lastGainDb_{0.0f};
+    alignas(16) float gain_[BLOCK] = {};
+    alignas(16) float envelopeDb_[BLOCK * Dynamics::FollowerBank::LANES] = {};
+};
+
+}}} // namespace Nyth { namespace Audio { namespace FX
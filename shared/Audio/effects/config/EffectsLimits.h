@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 
 namespace Nyth {
@@ -56,8 +57,33 @@ constexpr float DEFAULT_RELEASE_MS = 100.0f;
 constexpr float MIN_MAKEUP_DB = -20.0f;
 constexpr float MAX_MAKEUP_DB = 20.0f;
 constexpr float DEFAULT_MAKEUP_DB = 0.0f;
+
+constexpr float MIN_KNEE_DB = 0.0f;
+constexpr float MAX_KNEE_DB = 24.0f;
+constexpr float DEFAULT_KNEE_DB = 6.0f;
+
+constexpr float MIN_LOOKAHEAD_MS = 0.0f;
+constexpr float MAX_LOOKAHEAD_MS = 10.0f;
+constexpr float DEFAULT_LOOKAHEAD_MS = 0.0f;
+
+// Fenêtre de moyenne de la puissance en liaison stéréo RMS
+constexpr float MIN_RMS_WINDOW_MS = 1.0f;
+constexpr float MAX_RMS_WINDOW_MS = 300.0f;
+constexpr float DEFAULT_RMS_WINDOW_MS = 10.0f;
 } // namespace Compressor
 
+// === Compresseur multibande ===
+namespace Multiband {
+constexpr size_t MIN_BANDS = 3;
+constexpr size_t MAX_BANDS = 5;
+constexpr size_t DEFAULT_BANDS = 3;
+
+constexpr float MIN_CROSSOVER_HZ = 20.0f;
+constexpr float MAX_CROSSOVER_HZ = 20000.0f;
+// Les N-1 premières valeurs sont utilisées pour N bandes
+constexpr float DEFAULT_CROSSOVERS_HZ[MAX_BANDS - 1] = {200.0f, 2000.0f, 6000.0f, 12000.0f};
+} // namespace Multiband
+
 // === Delay ===
 namespace Delay {
 constexpr float MIN_DELAY_MS = 1.0f;
@@ -71,8 +97,114 @@ constexpr float DEFAULT_FEEDBACK = 0.3f;
 constexpr float MIN_MIX = 0.0f;
 constexpr float MAX_MIX = 1.0f;
 constexpr float DEFAULT_MIX = 0.2f;
+
+constexpr float MIN_MOD_RATE_HZ = 0.01f;
+constexpr float MAX_MOD_RATE_HZ = 10.0f;
+constexpr float DEFAULT_MOD_RATE_HZ = 0.5f;
+
+constexpr float MIN_MOD_DEPTH_MS = 0.0f;
+constexpr float MAX_MOD_DEPTH_MS = 20.0f;
+constexpr float DEFAULT_MOD_DEPTH_MS = 0.0f;
+
+// Taps supplémentaires (mode multi-tap), lus dans la même ligne que le tap principal
+constexpr size_t MAX_TAPS = 8;
+constexpr float MIN_TAP_GAIN = 0.0f;
+constexpr float MAX_TAP_GAIN = 1.0f;
+
+// Amortissement dans la boucle de réinjection ; les valeurs extrêmes désactivent le filtre
+constexpr float MIN_LOW_CUT_HZ = 20.0f;
+constexpr float MAX_LOW_CUT_HZ = 2000.0f;
+constexpr float DEFAULT_LOW_CUT_HZ = MIN_LOW_CUT_HZ;
+
+constexpr float MIN_HIGH_CUT_HZ = 1000.0f;
+constexpr float MAX_HIGH_CUT_HZ = 20000.0f;
+constexpr float DEFAULT_HIGH_CUT_HZ = MAX_HIGH_CUT_HZ;
 } // namespace Delay
 
+// === Limiter ===
+namespace Limiter {
+constexpr float MIN_CEILING_DB = -24.0f;
+constexpr float MAX_CEILING_DB = 0.0f;
+constexpr float DEFAULT_CEILING_DB = -1.0f; // dBTP
+
+constexpr float MIN_LOOKAHEAD_MS = 0.5f;
+constexpr float MAX_LOOKAHEAD_MS = 10.0f;
+constexpr float DEFAULT_LOOKAHEAD_MS = 5.0f;
+
+constexpr float MIN_RELEASE_MS = 1.0f;
+constexpr float MAX_RELEASE_MS = 1000.0f;
+constexpr float DEFAULT_RELEASE_MS = 100.0f;
+} // namespace Limiter
+
+// === Expander (downward) ===
+namespace Expander {
+constexpr float MIN_THRESHOLD_DB = -80.0f;
+constexpr float MAX_THRESHOLD_DB = 0.0f;
+constexpr float DEFAULT_THRESHOLD_DB = -40.0f;
+
+constexpr float MIN_RATIO = 1.0f;
+constexpr float MAX_RATIO = 10.0f;
+constexpr float DEFAULT_RATIO = 2.0f;
+
+constexpr float MIN_RANGE_DB = -90.0f; // atténuation maximale
+constexpr float MAX_RANGE_DB = 0.0f;
+constexpr float DEFAULT_RANGE_DB = -40.0f;
+
+constexpr float MIN_KNEE_DB = 0.0f;
+constexpr float MAX_KNEE_DB = 24.0f;
+constexpr float DEFAULT_KNEE_DB = 6.0f;
+
+constexpr float MIN_ATTACK_MS = 0.1f;
+constexpr float MAX_ATTACK_MS = 100.0f;
+constexpr float DEFAULT_ATTACK_MS = 1.0f;
+
+constexpr float MIN_RELEASE_MS = 5.0f;
+constexpr float MAX_RELEASE_MS = 2000.0f;
+constexpr float DEFAULT_RELEASE_MS = 100.0f;
+} // namespace Expander
+
+// === Gate ===
+namespace Gate {
+constexpr float MIN_THRESHOLD_DB = -80.0f; // seuil d'ouverture
+constexpr float MAX_THRESHOLD_DB = 0.0f;
+constexpr float DEFAULT_THRESHOLD_DB = -45.0f;
+
+constexpr float MIN_HYSTERESIS_DB = 0.0f; // fermeture à threshold - hysteresis
+constexpr float MAX_HYSTERESIS_DB = 20.0f;
+constexpr float DEFAULT_HYSTERESIS_DB = 6.0f;
+
+constexpr float MIN_HOLD_MS = 0.0f;
+constexpr float MAX_HOLD_MS = 500.0f;
+constexpr float DEFAULT_HOLD_MS = 50.0f;
+
+constexpr float MIN_ATTACK_MS = 0.05f;
+constexpr float MAX_ATTACK_MS = 100.0f;
+constexpr float DEFAULT_ATTACK_MS = 0.5f;
+
+constexpr float MIN_RELEASE_MS = 5.0f;
+constexpr float MAX_RELEASE_MS = 2000.0f;
+constexpr float DEFAULT_RELEASE_MS = 100.0f;
+
+constexpr float MIN_RANGE_DB = -90.0f; // atténuation gate fermé
+constexpr float MAX_RANGE_DB = 0.0f;
+constexpr float DEFAULT_RANGE_DB = -80.0f;
+} // namespace Gate
+
+// === Transient shaper ===
+namespace TransientShaper {
+constexpr float MIN_ATTACK_DB = -24.0f; // gain sur les attaques
+constexpr float MAX_ATTACK_DB = 24.0f;
+constexpr float DEFAULT_ATTACK_DB = 0.0f;
+
+constexpr float MIN_SUSTAIN_DB = -24.0f; // gain sur les queues
+constexpr float MAX_SUSTAIN_DB = 24.0f;
+constexpr float DEFAULT_SUSTAIN_DB = 0.0f;
+
+constexpr float MIN_OUTPUT_DB = -24.0f;
+constexpr float MAX_OUTPUT_DB = 24.0f;
+constexpr float DEFAULT_OUTPUT_DB = 0.0f;
+} // namespace TransientShaper
+
 // === Reverb ===
 namespace Reverb {
 constexpr float MIN_ROOM_SIZE = 0.0f;
@@ -92,13 +224,140 @@ constexpr float MAX_DRY_LEVEL = 1.0f;
 constexpr float DEFAULT_DRY_LEVEL = 0.7f;
 } // namespace Reverb
 
+// === Convolution Reverb ===
+namespace Convolution {
+constexpr float MAX_IR_SECONDS = 10.0f; // au-delà, la réponse impulsionnelle est tronquée
+constexpr size_t MAX_IR_CHANNELS = 2;
+
+constexpr float DEFAULT_WET_LEVEL = 0.3f;
+constexpr float DEFAULT_DRY_LEVEL = 0.7f;
+} // namespace Convolution
+
+// === Pitch Shift ===
+namespace PitchShift {
+constexpr float MIN_SEMITONES = -24.0f; // 2 octaves : rapport 0.25 à 4 du time-stretch
+constexpr float MAX_SEMITONES = 24.0f;
+constexpr float DEFAULT_SEMITONES = 0.0f;
+
+constexpr float MIN_MIX = 0.0f;
+constexpr float MAX_MIX = 1.0f;
+constexpr float DEFAULT_MIX = 1.0f;
+} // namespace PitchShift
+
+// === Chorus ===
+namespace Chorus {
+constexpr float MIN_RATE_HZ = 0.05f;
+constexpr float MAX_RATE_HZ = 5.0f;
+constexpr float DEFAULT_RATE_HZ = 0.8f;
+
+constexpr float MIN_DEPTH_MS = 0.0f;
+constexpr float MAX_DEPTH_MS = 10.0f;
+constexpr float DEFAULT_DEPTH_MS = 3.0f;
+
+constexpr float MIN_DELAY_MS = 5.0f; // retard de base, la modulation s'y ajoute
+constexpr float MAX_DELAY_MS = 30.0f;
+constexpr float DEFAULT_DELAY_MS = 15.0f;
+
+constexpr size_t MIN_VOICES = 1;
+constexpr size_t MAX_VOICES = 4;
+constexpr size_t DEFAULT_VOICES = 3;
+
+constexpr float MIN_MIX = 0.0f;
+constexpr float MAX_MIX = 1.0f;
+constexpr float DEFAULT_MIX = 0.5f;
+} // namespace Chorus
+
+// === Flanger ===
+namespace Flanger {
+constexpr float MIN_RATE_HZ = 0.05f;
+constexpr float MAX_RATE_HZ = 5.0f;
+constexpr float DEFAULT_RATE_HZ = 0.25f;
+
+constexpr float MIN_DEPTH_MS = 0.0f;
+constexpr float MAX_DEPTH_MS = 5.0f;
+constexpr float DEFAULT_DEPTH_MS = 2.0f;
+
+constexpr float MIN_DELAY_MS = 0.1f;
+constexpr float MAX_DELAY_MS = 10.0f;
+constexpr float DEFAULT_DELAY_MS = 1.0f;
+
+constexpr float MIN_FEEDBACK = -0.95f; // négatif : creux sur les harmoniques impaires
+constexpr float MAX_FEEDBACK = 0.95f;
+constexpr float DEFAULT_FEEDBACK = 0.5f;
+
+constexpr float MIN_MIX = 0.0f;
+constexpr float MAX_MIX = 1.0f;
+constexpr float DEFAULT_MIX = 0.5f;
+} // namespace Flanger
+
+// === Phaser ===
+namespace Phaser {
+constexpr float MIN_RATE_HZ = 0.05f;
+constexpr float MAX_RATE_HZ = 5.0f;
+constexpr float DEFAULT_RATE_HZ = 0.5f;
+
+constexpr size_t MIN_STAGES = 2; // passe-tout du 1er ordre, par paires (un creux par paire)
+constexpr size_t MAX_STAGES = 12;
+constexpr size_t DEFAULT_STAGES = 6;
+
+constexpr float MIN_FREQ_HZ = 20.0f;
+constexpr float MAX_FREQ_HZ = 18000.0f;
+constexpr float DEFAULT_MIN_FREQ_HZ = 300.0f;
+constexpr float DEFAULT_MAX_FREQ_HZ = 3000.0f;
+
+constexpr float MIN_FEEDBACK = -0.95f;
+constexpr float MAX_FEEDBACK = 0.95f;
+constexpr float DEFAULT_FEEDBACK = 0.5f;
+
+constexpr float MIN_MIX = 0.0f;
+constexpr float MAX_MIX = 1.0f;
+constexpr float DEFAULT_MIX = 0.5f;
+} // namespace Phaser
+
+// === Channel strip (HPF -> EQ -> compresseur -> limiteur fusionnés) ===
+namespace ChannelStrip {
+constexpr float MIN_HIGHPASS_HZ = 20.0f;
+constexpr float MAX_HIGHPASS_HZ = 500.0f;
+constexpr float DEFAULT_HIGHPASS_HZ = 80.0f;
+
+constexpr size_t EQ_BANDS = 4; // cloches (peaking)
+constexpr float MIN_EQ_FREQ_HZ = 20.0f;
+constexpr float MAX_EQ_FREQ_HZ = 20000.0f;
+constexpr float MIN_EQ_GAIN_DB = -18.0f;
+constexpr float MAX_EQ_GAIN_DB = 18.0f;
+constexpr float DEFAULT_EQ_GAIN_DB = 0.0f;
+constexpr float MIN_EQ_Q = 0.1f;
+constexpr float MAX_EQ_Q = 10.0f;
+constexpr float DEFAULT_EQ_Q = 1.0f;
+constexpr float DEFAULT_EQ_FREQS_HZ[EQ_BANDS] = {120.0f, 500.0f, 2500.0f, 8000.0f};
+} // namespace ChannelStrip
+
+// === Stereo imager (mid/side, largeur, basses mono) ===
+namespace StereoImager {
+constexpr float MIN_WIDTH = 0.0f; // 0 : mono
+constexpr float MAX_WIDTH = 2.0f;
+constexpr float DEFAULT_WIDTH = 1.0f;
+
+constexpr float MIN_GAIN_DB = -24.0f; // gains mid et side
+constexpr float MAX_GAIN_DB = 12.0f;
+constexpr float DEFAULT_MID_GAIN_DB = 0.0f;
+constexpr float DEFAULT_SIDE_GAIN_DB = 0.0f;
+
+constexpr float MIN_BASS_MONO_HZ = 20.0f; // en dessous : basses mono désactivées
+constexpr float MAX_BASS_MONO_HZ = 500.0f;
+constexpr float DEFAULT_BASS_MONO_HZ = 0.0f;
+} // namespace StereoImager
+
 // === Limites de performance ===
 constexpr size_t MAX_ACTIVE_EFFECTS = 10;
 constexpr size_t MAX_PROCESSING_BLOCK_SIZE = 4096;
 constexpr size_t MIN_PROCESSING_BLOCK_SIZE = 64;
 
 // === Types d'effets ===
-enum class EffectType { UNKNOWN = 0, COMPRESSOR = 1, DELAY = 2, REVERB = 3, EQUALIZER = 4, FILTER = 5, LIMITER = 6 };
+enum class EffectType { UNKNOWN = 0, COMPRESSOR = 1, DELAY = 2, REVERB = 3, EQUALIZER = 4, FILTER = 5, LIMITER = 6,
+                        MULTIBAND_COMPRESSOR = 7, CONVOLUTION_REVERB = 8, PITCH_SHIFT = 9,
+                        CHORUS = 10, FLANGER = 11, PHASER = 12, CHANNEL_STRIP = 13, EXPANDER = 14, GATE = 15,
+                        TRANSIENT_SHAPER = 16, STEREO_IMAGER = 17 };
 
 // === États des effets ===
 enum class EffectState { UNINITIALIZED = 0, INITIALIZED = 1, PROCESSING = 2, BYPASSED = 3, ERROR = 4 };
@@ -242,6 +242,28 @@ EffectType EffectsJSIConverter::stringToEffectType(const std::string& typeStr) {
         return EffectType::FILTER;
     } else if (typeStr == "limiter") {
         return EffectType::LIMITER;
+    } else if (typeStr == "multiband") {
+        return EffectType::MULTIBAND_COMPRESSOR;
+    } else if (typeStr == "convolution") {
+        return EffectType::CONVOLUTION_REVERB;
+    } else if (typeStr == "pitch") {
+        return EffectType::PITCH_SHIFT;
+    } else if (typeStr == "chorus") {
+        return EffectType::CHORUS;
+    } else if (typeStr == "flanger") {
+        return EffectType::FLANGER;
+    } else if (typeStr == "phaser") {
+        return EffectType::PHASER;
+    } else if (typeStr == "strip") {
+        return EffectType::CHANNEL_STRIP;
+    } else if (typeStr == "expander") {
+        return EffectType::EXPANDER;
+    } else if (typeStr == "gate") {
+        return EffectType::GATE;
+    } else if (typeStr == "transient") {
+        return EffectType::TRANSIENT_SHAPER;
+    } else if (typeStr == "imager") {
+        return EffectType::STEREO_IMAGER;
     }
     return EffectType::UNKNOWN;
 }
@@ -260,6 +282,28 @@ std::string EffectsJSIConverter::effectTypeToString(EffectType type) {
             return "filter";
         case EffectType::LIMITER:
             return "limiter";
+        case EffectType::MULTIBAND_COMPRESSOR:
+            return "multiband";
+        case EffectType::CONVOLUTION_REVERB:
+            return "convolution";
+        case EffectType::PITCH_SHIFT:
+            return "pitch";
+        case EffectType::CHORUS:
+            return "chorus";
+        case EffectType::FLANGER:
+            return "flanger";
+        case EffectType::PHASER:
+            return "phaser";
+        case EffectType::CHANNEL_STRIP:
+            return "strip";
+        case EffectType::EXPANDER:
+            return "expander";
+        case EffectType::GATE:
+            return "gate";
+        case EffectType::TRANSIENT_SHAPER:
+            return "transient";
+        case EffectType::STEREO_IMAGER:
+            return "imager";
         default:
             return "unknown";
     }
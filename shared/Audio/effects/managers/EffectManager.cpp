@@ -1,12 +1,48 @@
 #include "EffectManager.h"
+#include "../components/ChannelStrip.hpp"
+#include "../components/Chorus.hpp"
 #include "../components/Compressor.hpp"
 #include "../components/Delay.hpp"
-#include "../components/EffectChain.hpp"
+#include "../components/Limiter.hpp"
+#include "../components/EffectGraph.hpp"
+#include "../components/Expander.hpp"
+#include "../components/Flanger.hpp"
+#include "../components/Gate.hpp"
+#include "../components/MultibandCompressor.hpp"
+#include "../components/ConvolutionReverb.hpp"
+#include "../components/Phaser.hpp"
+#include "../components/PitchShifter.hpp"
+#include "../components/Reverb.hpp"
+#include "../components/StereoImager.hpp"
+#include "../components/TransientShaper.hpp"
 #include "../config/EffectsLimits.h"
 
 namespace facebook {
 namespace react {
 
+namespace {
+
+// Valeurs continues d'une instance traitée par le thread audio : transmises par sa file
+// d'événements (appliquées au début du prochain bloc) plutôt qu'écrites depuis ce thread
+template <typename Param>
+void scheduleNow(Nyth::Audio::FX::IAudioEffect* effect, std::initializer_list<std::pair<Param, double>> values) {
+    for (const auto& [param, value] : values) {
+        effect->scheduleParameter(static_cast<uint32_t>(param), static_cast<float>(value));
+    }
+}
+
+// Instance neuve pour un changement structurel : configurée ici, hors du thread audio,
+// puis substituée à celle du graphe par replaceChainEffect()
+template <typename Effect>
+std::unique_ptr<Effect> makePrepared(const Nyth::Audio::FX::IAudioEffect& model) {
+    auto effect = std::make_unique<Effect>();
+    effect->setSampleRate(model.getSampleRate(), model.getChannels());
+    effect->setEnabled(model.isEnabled());
+    return effect;
+}
+
+} // namespace
+
 EffectManager::EffectManager(std::shared_ptr<JSICallbackManager> callbackManager) : callbackManager_(callbackManager) {}
 
 EffectManager::~EffectManager() {
@@ -22,11 +58,15 @@ bool EffectManager::initialize(const Nyth::Audio::EffectsConfig& config) {
     try {
         config_ = config;
 
-        // Initialiser la chaîne d'effets
-        effectChain_.setSampleRate(config.sampleRate, config.channels);
-        effectChain_.setEnabled(true);
-        workBufferL_.clear();
-        workBufferR_.clear();
+        // Initialiser le graphe d'effets (entrée -> sortie tant qu'aucun effet n'existe)
+        effectGraph_.setEnabled(true);
+        effectGraph_.setSampleRate(config.sampleRate, config.channels);
+        {
+            std::lock_guard<std::mutex> lock(effectsMutex_);
+            if (!rebuildRouting()) {
+                return false;
+            }
+        }
 
         isInitialized_.store(true);
         return true;
@@ -43,8 +83,14 @@ bool EffectManager::isInitialized() const {
 void EffectManager::release() {
     std::lock_guard<std::mutex> lock(effectsMutex_);
 
-    // Libérer tous les effets
+    // Libérer tous les effets ; ceux du plan en cours restent vivants jusqu'à son retour
     activeEffects_.clear();
+    idToChainEffect_.clear();
+    idToNode_.clear();
+    chainOrder_.clear();
+    effectGraph_.clear();
+    rebuildRouting();
+    activeEffectsCount_.store(0, std::memory_order_relaxed);
     nextEffectId_.store(1);
 
     isInitialized_.store(false);
@@ -69,35 +115,27 @@ int EffectManager::createEffect(EffectType type) {
             return -1;
         }
 
-        // Associer l'effet à la chaîne pour qu'il soit réellement utilisé
-        Nyth::Audio::FX::IAudioEffect* rawPtr = nullptr;
-        switch (type) {
-            case EffectType::COMPRESSOR: {
-                rawPtr = effectChain_.emplaceEffect<Nyth::Audio::FX::CompressorEffect>();
-                break;
-            }
-            case EffectType::DELAY: {
-                rawPtr = effectChain_.emplaceEffect<Nyth::Audio::FX::DelayEffect>();
-                break;
-            }
-            default: {
-                // Types non gérés pour l'instant
-                break;
-            }
+        // Instance traitée par le graphe ; l'instance principale reste hors du thread audio
+        auto chainEffect = createEffectByType(type);
+        if (!chainEffect) {
+            return -1;
         }
+        chainEffect->setEnabled(true);
+        Nyth::Audio::FX::IAudioEffect* rawPtr = chainEffect.get();
+        const Nyth::Audio::FX::GraphNodeId nodeId = effectGraph_.addEffect(std::move(chainEffect));
 
         int effectId = nextEffectId_.fetch_add(1);
         // Conserver l'instance principale dans activeEffects_
         activeEffects_[effectId] = std::move(effect);
-        if (rawPtr) {
-            idToChainEffect_[effectId] = rawPtr;
-        }
+        idToChainEffect_[effectId] = rawPtr;
+        idToNode_[effectId] = nodeId;
+        chainOrder_.push_back(effectId);
+        activeEffectsCount_.store(activeEffects_.size(), std::memory_order_relaxed);
+        // Latence et activation lues sur l'instance principale, à jour avant la file du nœud
+        effectGraph_.setControlMirror(nodeId, activeEffects_[effectId].get());
 
-        // S'assurer que l'effet dans la chaîne a le même SR/channels et enabled
-        if (rawPtr) {
-            rawPtr->setSampleRate(config_.sampleRate, config_.channels);
-            rawPtr->setEnabled(true);
-        }
+        // Publier le nouveau plan : le thread audio l'adopte au bloc suivant, sans attendre
+        rebuildRouting();
 
         return effectId;
 
@@ -111,13 +149,17 @@ bool EffectManager::destroyEffect(int effectId) {
 
     auto it = activeEffects_.find(effectId);
     if (it != activeEffects_.end()) {
-        auto jt = idToChainEffect_.find(effectId);
-        if (jt != idToChainEffect_.end() && jt->second) {
-            // Désactiver l'effet dans la chaîne pour ne plus l'appliquer
-            jt->second->setEnabled(false);
-            idToChainEffect_.erase(jt);
+        // Retirer le nœud du graphe ; l'instance est libérée quand le plan courant est rendu
+        auto nt = idToNode_.find(effectId);
+        if (nt != idToNode_.end()) {
+            effectGraph_.removeNode(nt->second);
+            idToNode_.erase(nt);
         }
+        idToChainEffect_.erase(effectId);
+        chainOrder_.erase(std::remove(chainOrder_.begin(), chainOrder_.end(), effectId), chainOrder_.end());
         activeEffects_.erase(it);
+        activeEffectsCount_.store(activeEffects_.size(), std::memory_order_relaxed);
+        rebuildRouting();
         return true;
     }
 
@@ -150,6 +192,42 @@ size_t EffectManager::getEffectCount() const {
 // === Configuration des effets ===
 bool EffectManager::setEffectConfig(jsi::Runtime& rt, int effectId, const jsi::Object& config) {
     std::lock_guard<std::mutex> lock(effectsMutex_);
+
+    // Instance principale : celle de la chaîne n'a pas encore vidé sa file d'événements
+    auto latencyOf = [this](int id) -> uint32_t {
+        auto it = activeEffects_.find(id);
+        if (it == activeEffects_.end() || !it->second->isEnabled()) {
+            return 0;
+        }
+        return it->second->getLatencySamples();
+    };
+    const uint32_t latencyBefore = latencyOf(effectId);
+    if (!applyEffectConfig(rt, effectId, config)) {
+        return false;
+    }
+    // Latence ou activation modifiée : recompiler pour réaligner les branches du graphe
+    if (latencyOf(effectId) != latencyBefore) {
+        effectGraph_.commit();
+    }
+    return true;
+}
+
+// Substitue une instance préparée à celle du graphe et publie le plan qui la référence ;
+// l'ancienne instance est libérée avec le plan que le thread audio rend
+bool EffectManager::replaceChainEffect(int effectId, std::unique_ptr<Nyth::Audio::FX::IAudioEffect> effect) {
+    auto nt = idToNode_.find(effectId);
+    if (nt == idToNode_.end() || !effect) {
+        return false;
+    }
+    Nyth::Audio::FX::IAudioEffect* rawPtr = effect.get();
+    if (!effectGraph_.replaceEffect(nt->second, std::move(effect))) {
+        return false;
+    }
+    idToChainEffect_[effectId] = rawPtr;
+    return effectGraph_.commit();
+}
+
+bool EffectManager::applyEffectConfig(jsi::Runtime& rt, int effectId, const jsi::Object& config) {
     auto it = activeEffects_.find(effectId);
     if (it == activeEffects_.end()) {
         return false;
@@ -163,6 +241,10 @@ bool EffectManager::setEffectConfig(jsi::Runtime& rt, int effectId, const jsi::O
         float attackMs = 10.0f;
         float releaseMs = 100.0f;
         float makeupDb = 0.0f;
+        float kneeDb = Nyth::Audio::Effects::Compressor::DEFAULT_KNEE_DB;
+        float lookaheadMs = Nyth::Audio::Effects::Compressor::DEFAULT_LOOKAHEAD_MS;
+        float rmsWindowMs = Nyth::Audio::Effects::Compressor::DEFAULT_RMS_WINDOW_MS;
+        bool rmsLink = false;
         if (config.hasProperty(rt, "compressor")) {
             auto compObj = config.getProperty(rt, "compressor").asObject(rt);
             if (compObj.hasProperty(rt, "thresholdDb")) thresholdDb = compObj.getProperty(rt, "thresholdDb").asNumber();
@@ -170,8 +252,20 @@ bool EffectManager::setEffectConfig(jsi::Runtime& rt, int effectId, const jsi::O
             if (compObj.hasProperty(rt, "attackMs")) attackMs = compObj.getProperty(rt, "attackMs").asNumber();
             if (compObj.hasProperty(rt, "releaseMs")) releaseMs = compObj.getProperty(rt, "releaseMs").asNumber();
             if (compObj.hasProperty(rt, "makeupDb")) makeupDb = compObj.getProperty(rt, "makeupDb").asNumber();
+            if (compObj.hasProperty(rt, "kneeDb")) kneeDb = compObj.getProperty(rt, "kneeDb").asNumber();
+            if (compObj.hasProperty(rt, "lookaheadMs")) lookaheadMs = compObj.getProperty(rt, "lookaheadMs").asNumber();
+            if (compObj.hasProperty(rt, "stereoLink")) {
+                rmsLink = compObj.getProperty(rt, "stereoLink").asString(rt).utf8(rt) == "rms";
+            }
+            if (compObj.hasProperty(rt, "rmsWindowMs")) rmsWindowMs = compObj.getProperty(rt, "rmsWindowMs").asNumber();
         }
+        const auto link = rmsLink ? Nyth::Audio::FX::CompressorEffect::StereoLink::RMS
+                                  : Nyth::Audio::FX::CompressorEffect::StereoLink::MAX;
         compressor->setParameters(thresholdDb, ratio, attackMs, releaseMs, makeupDb);
+        compressor->setKnee(kneeDb);
+        compressor->setLookahead(lookaheadMs);
+        compressor->setStereoLink(link);
+        compressor->setRmsWindow(rmsWindowMs);
         if (config.hasProperty(rt, "enabled")) {
             bool enabled = config.getProperty(rt, "enabled").asBool();
             compressor->setEnabled(enabled);
@@ -180,7 +274,17 @@ bool EffectManager::setEffectConfig(jsi::Runtime& rt, int effectId, const jsi::O
         auto cit = idToChainEffect_.find(effectId);
         if (cit != idToChainEffect_.end()) {
             if (auto* c2 = dynamic_cast<Nyth::Audio::FX::CompressorEffect*>(cit->second)) {
-                c2->setParameters(thresholdDb, ratio, attackMs, releaseMs, makeupDb);
+                using Param = Nyth::Audio::FX::CompressorEffect::Param;
+                scheduleNow<Param>(c2, {{Param::THRESHOLD_DB, thresholdDb},
+                                        {Param::RATIO, ratio},
+                                        {Param::ATTACK_MS, attackMs},
+                                        {Param::RELEASE_MS, releaseMs},
+                                        {Param::MAKEUP_DB, makeupDb},
+                                        {Param::KNEE_DB, kneeDb},
+                                        {Param::LOOKAHEAD_MS, lookaheadMs},
+                                        {Param::STEREO_LINK, rmsLink ? 1.0 : 0.0},
+                                        {Param::RMS_WINDOW_MS, rmsWindowMs}});
+                // Changement de latence : setEffectConfig recompile le graphe
                 if (config.hasProperty(rt, "enabled")) {
                     bool enabled = config.getProperty(rt, "enabled").asBool();
                     c2->setEnabled(enabled);
@@ -191,27 +295,665 @@ bool EffectManager::setEffectConfig(jsi::Runtime& rt, int effectId, const jsi::O
     }
 
     if (auto* delay = dynamic_cast<Nyth::Audio::FX::DelayEffect*>(effect)) {
+        using DelayEffect = Nyth::Audio::FX::DelayEffect;
         float delayMs = 250.0f;
         float feedback = 0.3f;
         float mix = 0.2f;
+        float modRateHz = Nyth::Audio::Effects::Delay::DEFAULT_MOD_RATE_HZ;
+        float modDepthMs = Nyth::Audio::Effects::Delay::DEFAULT_MOD_DEPTH_MS;
+        float lowCutHz = Nyth::Audio::Effects::Delay::DEFAULT_LOW_CUT_HZ;
+        float highCutHz = Nyth::Audio::Effects::Delay::DEFAULT_HIGH_CUT_HZ;
+        DelayEffect::DelayMode mode = DelayEffect::DelayMode::SINGLE;
+        DelayEffect::DelayTap taps[Nyth::Audio::Effects::Delay::MAX_TAPS] = {};
+        size_t numTaps = 0;
         if (config.hasProperty(rt, "delay")) {
             auto delObj = config.getProperty(rt, "delay").asObject(rt);
             if (delObj.hasProperty(rt, "delayMs")) delayMs = delObj.getProperty(rt, "delayMs").asNumber();
             if (delObj.hasProperty(rt, "feedback")) feedback = delObj.getProperty(rt, "feedback").asNumber();
             if (delObj.hasProperty(rt, "mix")) mix = delObj.getProperty(rt, "mix").asNumber();
+            if (delObj.hasProperty(rt, "modRateHz")) modRateHz = delObj.getProperty(rt, "modRateHz").asNumber();
+            if (delObj.hasProperty(rt, "modDepthMs")) modDepthMs = delObj.getProperty(rt, "modDepthMs").asNumber();
+            if (delObj.hasProperty(rt, "lowCutHz")) lowCutHz = delObj.getProperty(rt, "lowCutHz").asNumber();
+            if (delObj.hasProperty(rt, "highCutHz")) highCutHz = delObj.getProperty(rt, "highCutHz").asNumber();
+            if (delObj.hasProperty(rt, "mode")) {
+                std::string modeStr = delObj.getProperty(rt, "mode").asString(rt).utf8(rt);
+                if (modeStr == "multitap") {
+                    mode = DelayEffect::DelayMode::MULTI_TAP;
+                } else if (modeStr == "pingpong") {
+                    mode = DelayEffect::DelayMode::PING_PONG;
+                }
+            }
+            if (delObj.hasProperty(rt, "taps")) {
+                auto tapArray = delObj.getProperty(rt, "taps").asObject(rt).asArray(rt);
+                numTaps = std::min(tapArray.size(rt), Nyth::Audio::Effects::Delay::MAX_TAPS);
+                for (size_t i = 0; i < numTaps; ++i) {
+                    auto tapObj = tapArray.getValueAtIndex(rt, i).asObject(rt);
+                    taps[i].delayMs = tapObj.hasProperty(rt, "delayMs") ? tapObj.getProperty(rt, "delayMs").asNumber() : delayMs;
+                    taps[i].gain = tapObj.hasProperty(rt, "gain") ? tapObj.getProperty(rt, "gain").asNumber() : 1.0;
+                }
+            }
         }
-        delay->setParameters(delayMs, feedback, mix);
-        if (config.hasProperty(rt, "enabled")) {
-            bool enabled = config.getProperty(rt, "enabled").asBool();
-            delay->setEnabled(enabled);
+        // Même configuration appliquée à l'instance principale et à celle de la chaîne ;
+        // les valeurs continues de cette dernière passent par sa file d'événements, un
+        // changement de mode ou de taps remplace l'instance par une instance préparée
+        auto structure = [](const DelayEffect* target) {
+            std::vector<float> state{static_cast<float>(target->getMode()), static_cast<float>(target->getNumTaps())};
+            for (size_t i = 0; i < target->getNumTaps(); ++i) {
+                state.push_back(target->getTap(i).delayMs);
+                state.push_back(target->getTap(i).gain);
+            }
+            return state;
+        };
+        const auto structureBefore = structure(delay);
+        auto apply = [&](DelayEffect* target, bool live) {
+            if (live) {
+                using Param = DelayEffect::Param;
+                scheduleNow<Param>(target, {{Param::DELAY_MS, delayMs},
+                                            {Param::FEEDBACK, feedback},
+                                            {Param::MIX, mix},
+                                            {Param::MOD_RATE_HZ, modRateHz},
+                                            {Param::MOD_DEPTH_MS, modDepthMs},
+                                            {Param::LOW_CUT_HZ, lowCutHz},
+                                            {Param::HIGH_CUT_HZ, highCutHz}});
+            } else {
+                target->setParameters(delayMs, feedback, mix);
+                target->setModulation(modRateHz, modDepthMs);
+                target->setDamping(lowCutHz, highCutHz);
+                target->setMode(mode);
+                for (size_t i = 0; i < numTaps; ++i) {
+                    target->setTap(i, taps[i].delayMs, taps[i].gain);
+                }
+                target->setNumTaps(numTaps);
+            }
+            if (config.hasProperty(rt, "enabled")) {
+                target->setEnabled(config.getProperty(rt, "enabled").asBool());
+            }
+        };
+        apply(delay, false);
+        if (structure(delay) != structureBefore) {
+            auto prepared = makePrepared<DelayEffect>(*delay);
+            apply(prepared.get(), false);
+            return replaceChainEffect(effectId, std::move(prepared));
         }
         auto dit = idToChainEffect_.find(effectId);
         if (dit != idToChainEffect_.end()) {
-            if (auto* d2 = dynamic_cast<Nyth::Audio::FX::DelayEffect*>(dit->second)) {
-                d2->setParameters(delayMs, feedback, mix);
+            if (auto* d2 = dynamic_cast<DelayEffect*>(dit->second)) {
+                apply(d2, true);
+            }
+        }
+        return true;
+    }
+
+    if (auto* reverb = dynamic_cast<Nyth::Audio::FX::ReverbEffect*>(effect)) {
+        auto params = reverb->getParameters();
+        if (config.hasProperty(rt, "reverb")) {
+            auto revObj = config.getProperty(rt, "reverb").asObject(rt);
+            if (revObj.hasProperty(rt, "roomSize")) params.roomSize = revObj.getProperty(rt, "roomSize").asNumber();
+            if (revObj.hasProperty(rt, "damping")) params.damping = revObj.getProperty(rt, "damping").asNumber();
+            if (revObj.hasProperty(rt, "wetLevel")) params.wetLevel = revObj.getProperty(rt, "wetLevel").asNumber();
+            if (revObj.hasProperty(rt, "dryLevel")) params.dryLevel = revObj.getProperty(rt, "dryLevel").asNumber();
+        }
+        auto apply = [&](Nyth::Audio::FX::ReverbEffect* target, bool live) {
+            if (live) {
+                using Param = Nyth::Audio::FX::ReverbEffect::Param;
+                scheduleNow<Param>(target, {{Param::ROOM_SIZE, params.roomSize},
+                                            {Param::DAMPING, params.damping},
+                                            {Param::WET_LEVEL, params.wetLevel},
+                                            {Param::DRY_LEVEL, params.dryLevel}});
+            } else {
+                target->setParameters(params.roomSize, params.damping, params.wetLevel, params.dryLevel);
+            }
+            if (config.hasProperty(rt, "enabled")) {
+                target->setEnabled(config.getProperty(rt, "enabled").asBool());
+            }
+        };
+        apply(reverb, false);
+        auto rit = idToChainEffect_.find(effectId);
+        if (rit != idToChainEffect_.end()) {
+            if (auto* r2 = dynamic_cast<Nyth::Audio::FX::ReverbEffect*>(rit->second)) {
+                apply(r2, true);
+            }
+        }
+        return true;
+    }
+
+    if (auto* limiter = dynamic_cast<Nyth::Audio::FX::LimiterEffect*>(effect)) {
+        auto params = limiter->getParameters();
+        if (config.hasProperty(rt, "limiter")) {
+            auto limObj = config.getProperty(rt, "limiter").asObject(rt);
+            if (limObj.hasProperty(rt, "ceilingDb")) params.ceilingDb = limObj.getProperty(rt, "ceilingDb").asNumber();
+            if (limObj.hasProperty(rt, "lookaheadMs"))
+                params.lookaheadMs = limObj.getProperty(rt, "lookaheadMs").asNumber();
+            if (limObj.hasProperty(rt, "releaseMs")) params.releaseMs = limObj.getProperty(rt, "releaseMs").asNumber();
+        }
+        auto apply = [&](Nyth::Audio::FX::LimiterEffect* target, bool live) {
+            if (live) {
+                // Changement de lookahead : setEffectConfig recompile le graphe
+                using Param = Nyth::Audio::FX::LimiterEffect::Param;
+                scheduleNow<Param>(target, {{Param::CEILING_DB, params.ceilingDb},
+                                            {Param::LOOKAHEAD_MS, params.lookaheadMs},
+                                            {Param::RELEASE_MS, params.releaseMs}});
+            } else {
+                target->setParameters(params.ceilingDb, params.lookaheadMs, params.releaseMs);
+            }
+            if (config.hasProperty(rt, "enabled")) {
+                target->setEnabled(config.getProperty(rt, "enabled").asBool());
+            }
+        };
+        apply(limiter, false);
+        auto lit = idToChainEffect_.find(effectId);
+        if (lit != idToChainEffect_.end()) {
+            if (auto* l2 = dynamic_cast<Nyth::Audio::FX::LimiterEffect*>(lit->second)) {
+                apply(l2, true);
+            }
+        }
+        return true;
+    }
+
+    if (auto* pitch = dynamic_cast<Nyth::Audio::FX::PitchShiftEffect*>(effect)) {
+        auto params = pitch->getParameters();
+        if (config.hasProperty(rt, "pitch")) {
+            auto pitchObj = config.getProperty(rt, "pitch").asObject(rt);
+            if (pitchObj.hasProperty(rt, "semitones"))
+                params.semitones = pitchObj.getProperty(rt, "semitones").asNumber();
+            if (pitchObj.hasProperty(rt, "mix")) params.mix = pitchObj.getProperty(rt, "mix").asNumber();
+            if (pitchObj.hasProperty(rt, "algorithm")) {
+                const std::string algorithm = pitchObj.getProperty(rt, "algorithm").asString(rt).utf8(rt);
+                params.algorithm = algorithm == "wsola" ? Nyth::Audio::FX::StretchAlgorithm::WSOLA
+                                                        : Nyth::Audio::FX::StretchAlgorithm::PHASE_VOCODER;
+            }
+        }
+        auto apply = [&](Nyth::Audio::FX::PitchShiftEffect* target, bool live) {
+            if (live) {
+                using Param = Nyth::Audio::FX::PitchShiftEffect::Param;
+                scheduleNow<Param>(target, {{Param::SEMITONES, params.semitones},
+                                            {Param::MIX, params.mix},
+                                            {Param::ALGORITHM, static_cast<double>(params.algorithm)}});
+            } else {
+                target->setParameters(params.semitones, params.mix);
+                target->setAlgorithm(params.algorithm);
+            }
+            if (config.hasProperty(rt, "enabled")) {
+                target->setEnabled(config.getProperty(rt, "enabled").asBool());
+            }
+        };
+        apply(pitch, false);
+        auto pit = idToChainEffect_.find(effectId);
+        if (pit != idToChainEffect_.end()) {
+            if (auto* p2 = dynamic_cast<Nyth::Audio::FX::PitchShiftEffect*>(pit->second)) {
+                apply(p2, true);
+            }
+        }
+        return true;
+    }
+
+    if (auto* chorus = dynamic_cast<Nyth::Audio::FX::ChorusEffect*>(effect)) {
+        auto params = chorus->getParameters();
+        if (config.hasProperty(rt, "chorus")) {
+            auto chObj = config.getProperty(rt, "chorus").asObject(rt);
+            if (chObj.hasProperty(rt, "rateHz")) params.rateHz = chObj.getProperty(rt, "rateHz").asNumber();
+            if (chObj.hasProperty(rt, "depthMs")) params.depthMs = chObj.getProperty(rt, "depthMs").asNumber();
+            if (chObj.hasProperty(rt, "delayMs")) params.delayMs = chObj.getProperty(rt, "delayMs").asNumber();
+            if (chObj.hasProperty(rt, "voices"))
+                params.voices = static_cast<size_t>(std::max(0.0, chObj.getProperty(rt, "voices").asNumber()));
+            if (chObj.hasProperty(rt, "mix")) params.mix = chObj.getProperty(rt, "mix").asNumber();
+        }
+        auto apply = [&](Nyth::Audio::FX::ChorusEffect* target, bool live) {
+            if (live) {
+                using Param = Nyth::Audio::FX::ChorusEffect::Param;
+                scheduleNow<Param>(target, {{Param::RATE_HZ, params.rateHz},
+                                            {Param::DEPTH_MS, params.depthMs},
+                                            {Param::DELAY_MS, params.delayMs},
+                                            {Param::VOICES, static_cast<double>(params.voices)},
+                                            {Param::MIX, params.mix}});
+            } else {
+                target->setParameters(params.rateHz, params.depthMs, params.delayMs, params.voices, params.mix);
+            }
+            if (config.hasProperty(rt, "enabled")) {
+                target->setEnabled(config.getProperty(rt, "enabled").asBool());
+            }
+        };
+        apply(chorus, false);
+        auto cit = idToChainEffect_.find(effectId);
+        if (cit != idToChainEffect_.end()) {
+            if (auto* c2 = dynamic_cast<Nyth::Audio::FX::ChorusEffect*>(cit->second)) {
+                apply(c2, true);
+            }
+        }
+        return true;
+    }
+
+    if (auto* flanger = dynamic_cast<Nyth::Audio::FX::FlangerEffect*>(effect)) {
+        auto params = flanger->getParameters();
+        if (config.hasProperty(rt, "flanger")) {
+            auto flObj = config.getProperty(rt, "flanger").asObject(rt);
+            if (flObj.hasProperty(rt, "rateHz")) params.rateHz = flObj.getProperty(rt, "rateHz").asNumber();
+            if (flObj.hasProperty(rt, "depthMs")) params.depthMs = flObj.getProperty(rt, "depthMs").asNumber();
+            if (flObj.hasProperty(rt, "delayMs")) params.delayMs = flObj.getProperty(rt, "delayMs").asNumber();
+            if (flObj.hasProperty(rt, "feedback")) params.feedback = flObj.getProperty(rt, "feedback").asNumber();
+            if (flObj.hasProperty(rt, "mix")) params.mix = flObj.getProperty(rt, "mix").asNumber();
+        }
+        auto apply = [&](Nyth::Audio::FX::FlangerEffect* target, bool live) {
+            if (live) {
+                using Param = Nyth::Audio::FX::FlangerEffect::Param;
+                scheduleNow<Param>(target, {{Param::RATE_HZ, params.rateHz},
+                                            {Param::DEPTH_MS, params.depthMs},
+                                            {Param::DELAY_MS, params.delayMs},
+                                            {Param::FEEDBACK, params.feedback},
+                                            {Param::MIX, params.mix}});
+            } else {
+                target->setParameters(params.rateHz, params.depthMs, params.delayMs, params.feedback, params.mix);
+            }
+            if (config.hasProperty(rt, "enabled")) {
+                target->setEnabled(config.getProperty(rt, "enabled").asBool());
+            }
+        };
+        apply(flanger, false);
+        auto fit = idToChainEffect_.find(effectId);
+        if (fit != idToChainEffect_.end()) {
+            if (auto* f2 = dynamic_cast<Nyth::Audio::FX::FlangerEffect*>(fit->second)) {
+                apply(f2, true);
+            }
+        }
+        return true;
+    }
+
+    if (auto* phaser = dynamic_cast<Nyth::Audio::FX::PhaserEffect*>(effect)) {
+        auto params = phaser->getParameters();
+        if (config.hasProperty(rt, "phaser")) {
+            auto phObj = config.getProperty(rt, "phaser").asObject(rt);
+            if (phObj.hasProperty(rt, "rateHz")) params.rateHz = phObj.getProperty(rt, "rateHz").asNumber();
+            if (phObj.hasProperty(rt, "stages"))
+                params.stages = static_cast<size_t>(std::max(0.0, phObj.getProperty(rt, "stages").asNumber()));
+            if (phObj.hasProperty(rt, "minFreqHz")) params.minFreqHz = phObj.getProperty(rt, "minFreqHz").asNumber();
+            if (phObj.hasProperty(rt, "maxFreqHz")) params.maxFreqHz = phObj.getProperty(rt, "maxFreqHz").asNumber();
+            if (phObj.hasProperty(rt, "feedback")) params.feedback = phObj.getProperty(rt, "feedback").asNumber();
+            if (phObj.hasProperty(rt, "mix")) params.mix = phObj.getProperty(rt, "mix").asNumber();
+        }
+        auto apply = [&](Nyth::Audio::FX::PhaserEffect* target, bool live) {
+            if (live) {
+                using Param = Nyth::Audio::FX::PhaserEffect::Param;
+                scheduleNow<Param>(target, {{Param::RATE_HZ, params.rateHz},
+                                            {Param::STAGES, static_cast<double>(params.stages)},
+                                            {Param::MIN_FREQ_HZ, params.minFreqHz},
+                                            {Param::MAX_FREQ_HZ, params.maxFreqHz},
+                                            {Param::FEEDBACK, params.feedback},
+                                            {Param::MIX, params.mix}});
+            } else {
+                target->setParameters(params.rateHz, params.stages, params.minFreqHz, params.maxFreqHz, params.feedback,
+                                      params.mix);
+            }
+            if (config.hasProperty(rt, "enabled")) {
+                target->setEnabled(config.getProperty(rt, "enabled").asBool());
+            }
+        };
+        apply(phaser, false);
+        auto phit = idToChainEffect_.find(effectId);
+        if (phit != idToChainEffect_.end()) {
+            if (auto* p2 = dynamic_cast<Nyth::Audio::FX::PhaserEffect*>(phit->second)) {
+                apply(p2, true);
+            }
+        }
+        return true;
+    }
+
+    if (auto* expander = dynamic_cast<Nyth::Audio::FX::ExpanderEffect*>(effect)) {
+        auto params = expander->getParameters();
+        if (config.hasProperty(rt, "expander")) {
+            auto exObj = config.getProperty(rt, "expander").asObject(rt);
+            if (exObj.hasProperty(rt, "thresholdDb")) params.thresholdDb = exObj.getProperty(rt, "thresholdDb").asNumber();
+            if (exObj.hasProperty(rt, "ratio")) params.ratio = exObj.getProperty(rt, "ratio").asNumber();
+            if (exObj.hasProperty(rt, "rangeDb")) params.rangeDb = exObj.getProperty(rt, "rangeDb").asNumber();
+            if (exObj.hasProperty(rt, "kneeDb")) params.kneeDb = exObj.getProperty(rt, "kneeDb").asNumber();
+            if (exObj.hasProperty(rt, "attackMs")) params.attackMs = exObj.getProperty(rt, "attackMs").asNumber();
+            if (exObj.hasProperty(rt, "releaseMs")) params.releaseMs = exObj.getProperty(rt, "releaseMs").asNumber();
+        }
+        auto apply = [&](Nyth::Audio::FX::ExpanderEffect* target, bool live) {
+            if (live) {
+                using Param = Nyth::Audio::FX::ExpanderEffect::Param;
+                scheduleNow<Param>(target, {{Param::THRESHOLD_DB, params.thresholdDb},
+                                            {Param::RATIO, params.ratio},
+                                            {Param::RANGE_DB, params.rangeDb},
+                                            {Param::KNEE_DB, params.kneeDb},
+                                            {Param::ATTACK_MS, params.attackMs},
+                                            {Param::RELEASE_MS, params.releaseMs}});
+            } else {
+                target->setParameters(params.thresholdDb, params.ratio, params.rangeDb, params.kneeDb, params.attackMs,
+                                      params.releaseMs);
+            }
+            if (config.hasProperty(rt, "enabled")) {
+                target->setEnabled(config.getProperty(rt, "enabled").asBool());
+            }
+        };
+        apply(expander, false);
+        auto eit = idToChainEffect_.find(effectId);
+        if (eit != idToChainEffect_.end()) {
+            if (auto* e2 = dynamic_cast<Nyth::Audio::FX::ExpanderEffect*>(eit->second)) {
+                apply(e2, true);
+            }
+        }
+        return true;
+    }
+
+    if (auto* gate = dynamic_cast<Nyth::Audio::FX::GateEffect*>(effect)) {
+        auto params = gate->getParameters();
+        if (config.hasProperty(rt, "gate")) {
+            auto gateObj = config.getProperty(rt, "gate").asObject(rt);
+            if (gateObj.hasProperty(rt, "thresholdDb")) params.thresholdDb = gateObj.getProperty(rt, "thresholdDb").asNumber();
+            if (gateObj.hasProperty(rt, "hysteresisDb"))
+                params.hysteresisDb = gateObj.getProperty(rt, "hysteresisDb").asNumber();
+            if (gateObj.hasProperty(rt, "holdMs")) params.holdMs = gateObj.getProperty(rt, "holdMs").asNumber();
+            if (gateObj.hasProperty(rt, "attackMs")) params.attackMs = gateObj.getProperty(rt, "attackMs").asNumber();
+            if (gateObj.hasProperty(rt, "releaseMs")) params.releaseMs = gateObj.getProperty(rt, "releaseMs").asNumber();
+            if (gateObj.hasProperty(rt, "rangeDb")) params.rangeDb = gateObj.getProperty(rt, "rangeDb").asNumber();
+        }
+        auto apply = [&](Nyth::Audio::FX::GateEffect* target, bool live) {
+            if (live) {
+                using Param = Nyth::Audio::FX::GateEffect::Param;
+                scheduleNow<Param>(target, {{Param::THRESHOLD_DB, params.thresholdDb},
+                                            {Param::HYSTERESIS_DB, params.hysteresisDb},
+                                            {Param::HOLD_MS, params.holdMs},
+                                            {Param::ATTACK_MS, params.attackMs},
+                                            {Param::RELEASE_MS, params.releaseMs},
+                                            {Param::RANGE_DB, params.rangeDb}});
+            } else {
+                target->setParameters(params.thresholdDb, params.hysteresisDb, params.holdMs, params.attackMs,
+                                      params.releaseMs, params.rangeDb);
+            }
+            if (config.hasProperty(rt, "enabled")) {
+                target->setEnabled(config.getProperty(rt, "enabled").asBool());
+            }
+        };
+        apply(gate, false);
+        auto git = idToChainEffect_.find(effectId);
+        if (git != idToChainEffect_.end()) {
+            if (auto* g2 = dynamic_cast<Nyth::Audio::FX::GateEffect*>(git->second)) {
+                apply(g2, true);
+            }
+        }
+        return true;
+    }
+
+    if (auto* shaper = dynamic_cast<Nyth::Audio::FX::TransientShaperEffect*>(effect)) {
+        auto params = shaper->getParameters();
+        if (config.hasProperty(rt, "transient")) {
+            auto trObj = config.getProperty(rt, "transient").asObject(rt);
+            if (trObj.hasProperty(rt, "attackDb")) params.attackDb = trObj.getProperty(rt, "attackDb").asNumber();
+            if (trObj.hasProperty(rt, "sustainDb")) params.sustainDb = trObj.getProperty(rt, "sustainDb").asNumber();
+            if (trObj.hasProperty(rt, "outputDb")) params.outputDb = trObj.getProperty(rt, "outputDb").asNumber();
+        }
+        auto apply = [&](Nyth::Audio::FX::TransientShaperEffect* target, bool live) {
+            if (live) {
+                using Param = Nyth::Audio::FX::TransientShaperEffect::Param;
+                scheduleNow<Param>(target, {{Param::ATTACK_DB, params.attackDb},
+                                            {Param::SUSTAIN_DB, params.sustainDb},
+                                            {Param::OUTPUT_DB, params.outputDb}});
+            } else {
+                target->setParameters(params.attackDb, params.sustainDb, params.outputDb);
+            }
+            if (config.hasProperty(rt, "enabled")) {
+                target->setEnabled(config.getProperty(rt, "enabled").asBool());
+            }
+        };
+        apply(shaper, false);
+        auto tit = idToChainEffect_.find(effectId);
+        if (tit != idToChainEffect_.end()) {
+            if (auto* t2 = dynamic_cast<Nyth::Audio::FX::TransientShaperEffect*>(tit->second)) {
+                apply(t2, true);
+            }
+        }
+        return true;
+    }
+
+    if (auto* imager = dynamic_cast<Nyth::Audio::FX::StereoImagerEffect*>(effect)) {
+        using Format = Nyth::Audio::FX::StereoImagerEffect::Format;
+        auto params = imager->getParameters();
+        auto readFormat = [&](const jsi::Object& obj, const char* name, Format current) {
+            if (!obj.hasProperty(rt, name)) {
+                return current;
+            }
+            const std::string value = obj.getProperty(rt, name).asString(rt).utf8(rt);
+            return value == "ms" ? Format::MID_SIDE : value == "lr" ? Format::LEFT_RIGHT : current;
+        };
+        if (config.hasProperty(rt, "imager")) {
+            auto imObj = config.getProperty(rt, "imager").asObject(rt);
+            if (imObj.hasProperty(rt, "width")) params.width = imObj.getProperty(rt, "width").asNumber();
+            if (imObj.hasProperty(rt, "midGainDb")) params.midGainDb = imObj.getProperty(rt, "midGainDb").asNumber();
+            if (imObj.hasProperty(rt, "sideGainDb")) params.sideGainDb = imObj.getProperty(rt, "sideGainDb").asNumber();
+            if (imObj.hasProperty(rt, "bassMonoHz")) params.bassMonoHz = imObj.getProperty(rt, "bassMonoHz").asNumber();
+            params.inputFormat = readFormat(imObj, "inputFormat", params.inputFormat);
+            params.outputFormat = readFormat(imObj, "outputFormat", params.outputFormat);
+        }
+        auto apply = [&](Nyth::Audio::FX::StereoImagerEffect* target, bool live) {
+            if (live) {
+                using Param = Nyth::Audio::FX::StereoImagerEffect::Param;
+                scheduleNow<Param>(target, {{Param::WIDTH, params.width},
+                                            {Param::MID_GAIN_DB, params.midGainDb},
+                                            {Param::SIDE_GAIN_DB, params.sideGainDb},
+                                            {Param::BASS_MONO_HZ, params.bassMonoHz},
+                                            {Param::INPUT_FORMAT, static_cast<double>(params.inputFormat)},
+                                            {Param::OUTPUT_FORMAT, static_cast<double>(params.outputFormat)}});
+            } else {
+                target->setParameters(params.width, params.midGainDb, params.sideGainDb, params.bassMonoHz);
+                target->setFormats(params.inputFormat, params.outputFormat);
+            }
+            if (config.hasProperty(rt, "enabled")) {
+                target->setEnabled(config.getProperty(rt, "enabled").asBool());
+            }
+        };
+        apply(imager, false);
+        auto iit = idToChainEffect_.find(effectId);
+        if (iit != idToChainEffect_.end()) {
+            if (auto* i2 = dynamic_cast<Nyth::Audio::FX::StereoImagerEffect*>(iit->second)) {
+                apply(i2, true);
+            }
+        }
+        return true;
+    }
+
+    if (auto* strip = dynamic_cast<Nyth::Audio::FX::ChannelStripEffect*>(effect)) {
+        using Stages = Nyth::Audio::FX::ChannelStripStages;
+        auto& eqStage = strip->stage<Stages::EQUALIZER>();
+        double highPassHz = strip->stage<Stages::HIGH_PASS>().getFrequency();
+        Nyth::Audio::FX::PeakingEqStage<Nyth::Audio::Effects::ChannelStrip::EQ_BANDS>::Band
+            bands[Nyth::Audio::Effects::ChannelStrip::EQ_BANDS];
+        for (size_t b = 0; b < Nyth::Audio::Effects::ChannelStrip::EQ_BANDS; ++b) {
+            bands[b] = eqStage.getBand(b);
+        }
+        auto comp = strip->stage<Stages::COMPRESSOR>().getParameters();
+        auto lim = strip->stage<Stages::LIMITER>().getParameters();
+        if (config.hasProperty(rt, "strip")) {
+            auto stripObj = config.getProperty(rt, "strip").asObject(rt);
+            if (stripObj.hasProperty(rt, "highPassHz")) highPassHz = stripObj.getProperty(rt, "highPassHz").asNumber();
+            if (stripObj.hasProperty(rt, "eq")) {
+                auto eqArray = stripObj.getProperty(rt, "eq").asObject(rt).asArray(rt);
+                const size_t count = std::min(eqArray.size(rt), Nyth::Audio::Effects::ChannelStrip::EQ_BANDS);
+                for (size_t b = 0; b < count; ++b) {
+                    auto bandObj = eqArray.getValueAtIndex(rt, b).asObject(rt);
+                    if (bandObj.hasProperty(rt, "frequencyHz")) bands[b].frequencyHz = bandObj.getProperty(rt, "frequencyHz").asNumber();
+                    if (bandObj.hasProperty(rt, "gainDb")) bands[b].gainDb = bandObj.getProperty(rt, "gainDb").asNumber();
+                    if (bandObj.hasProperty(rt, "q")) bands[b].q = bandObj.getProperty(rt, "q").asNumber();
+                }
+            }
+            if (stripObj.hasProperty(rt, "compressor")) {
+                auto compObj = stripObj.getProperty(rt, "compressor").asObject(rt);
+                if (compObj.hasProperty(rt, "thresholdDb")) comp.thresholdDb = compObj.getProperty(rt, "thresholdDb").asNumber();
+                if (compObj.hasProperty(rt, "ratio")) comp.ratio = compObj.getProperty(rt, "ratio").asNumber();
+                if (compObj.hasProperty(rt, "attackMs")) comp.attackMs = compObj.getProperty(rt, "attackMs").asNumber();
+                if (compObj.hasProperty(rt, "releaseMs")) comp.releaseMs = compObj.getProperty(rt, "releaseMs").asNumber();
+                if (compObj.hasProperty(rt, "makeupDb")) comp.makeupDb = compObj.getProperty(rt, "makeupDb").asNumber();
+                if (compObj.hasProperty(rt, "kneeDb")) comp.kneeDb = compObj.getProperty(rt, "kneeDb").asNumber();
+            }
+            if (stripObj.hasProperty(rt, "limiter")) {
+                auto limObj = stripObj.getProperty(rt, "limiter").asObject(rt);
+                if (limObj.hasProperty(rt, "ceilingDb")) lim.ceilingDb = limObj.getProperty(rt, "ceilingDb").asNumber();
+                if (limObj.hasProperty(rt, "lookaheadMs")) lim.lookaheadMs = limObj.getProperty(rt, "lookaheadMs").asNumber();
+                if (limObj.hasProperty(rt, "releaseMs")) lim.releaseMs = limObj.getProperty(rt, "releaseMs").asNumber();
+            }
+        }
+        // Étages de l'instance de la chaîne : paramètres transmis par sa file d'événements
+        // (stageParameter), appliqués par le thread audio en début de bloc
+        auto apply = [&](Nyth::Audio::FX::ChannelStripEffect* target, bool live) {
+            using Strip = Nyth::Audio::FX::ChannelStripEffect;
+            if (live) {
+                using HighPass = Nyth::Audio::FX::HighPassStage;
+                using Eq = Nyth::Audio::FX::PeakingEqStage<Nyth::Audio::Effects::ChannelStrip::EQ_BANDS>;
+                using CompParam = Nyth::Audio::FX::CompressorEffect::Param;
+                using LimParam = Nyth::Audio::FX::LimiterEffect::Param;
+                auto send = [target](size_t stage, uint32_t param, double value) {
+                    target->scheduleParameter(Strip::stageParameter(stage, param), static_cast<float>(value));
+                };
+                send(Stages::HIGH_PASS, static_cast<uint32_t>(HighPass::Param::FREQUENCY_HZ), highPassHz);
+                for (size_t b = 0; b < Nyth::Audio::Effects::ChannelStrip::EQ_BANDS; ++b) {
+                    send(Stages::EQUALIZER, Eq::bandParameter(Eq::Param::FREQUENCY_HZ, b), bands[b].frequencyHz);
+                    send(Stages::EQUALIZER, Eq::bandParameter(Eq::Param::GAIN_DB, b), bands[b].gainDb);
+                    send(Stages::EQUALIZER, Eq::bandParameter(Eq::Param::Q, b), bands[b].q);
+                }
+                send(Stages::COMPRESSOR, static_cast<uint32_t>(CompParam::THRESHOLD_DB), comp.thresholdDb);
+                send(Stages::COMPRESSOR, static_cast<uint32_t>(CompParam::RATIO), comp.ratio);
+                send(Stages::COMPRESSOR, static_cast<uint32_t>(CompParam::ATTACK_MS), comp.attackMs);
+                send(Stages::COMPRESSOR, static_cast<uint32_t>(CompParam::RELEASE_MS), comp.releaseMs);
+                send(Stages::COMPRESSOR, static_cast<uint32_t>(CompParam::MAKEUP_DB), comp.makeupDb);
+                send(Stages::COMPRESSOR, static_cast<uint32_t>(CompParam::KNEE_DB), comp.kneeDb);
+                // Changement de lookahead : setEffectConfig recompile le graphe
+                send(Stages::LIMITER, static_cast<uint32_t>(LimParam::CEILING_DB), lim.ceilingDb);
+                send(Stages::LIMITER, static_cast<uint32_t>(LimParam::LOOKAHEAD_MS), lim.lookaheadMs);
+                send(Stages::LIMITER, static_cast<uint32_t>(LimParam::RELEASE_MS), lim.releaseMs);
+            } else {
+                target->stage<Stages::HIGH_PASS>().setFrequency(highPassHz);
+                for (size_t b = 0; b < Nyth::Audio::Effects::ChannelStrip::EQ_BANDS; ++b) {
+                    target->stage<Stages::EQUALIZER>().setBand(b, bands[b].frequencyHz, bands[b].gainDb, bands[b].q);
+                }
+                auto& compressor = target->stage<Stages::COMPRESSOR>();
+                compressor.setParameters(comp.thresholdDb, comp.ratio, comp.attackMs, comp.releaseMs, comp.makeupDb);
+                compressor.setKnee(comp.kneeDb);
+                target->stage<Stages::LIMITER>().setParameters(lim.ceilingDb, lim.lookaheadMs, lim.releaseMs);
+            }
+            if (config.hasProperty(rt, "enabled")) {
+                target->setEnabled(config.getProperty(rt, "enabled").asBool());
+            }
+        };
+        apply(strip, false);
+        auto sit = idToChainEffect_.find(effectId);
+        if (sit != idToChainEffect_.end()) {
+            if (auto* s2 = dynamic_cast<Nyth::Audio::FX::ChannelStripEffect*>(sit->second)) {
+                apply(s2, true);
+            }
+        }
+        return true;
+    }
+
+    if (auto* convolution = dynamic_cast<Nyth::Audio::FX::ConvolutionReverbEffect*>(effect)) {
+        using ConvolutionEffect = Nyth::Audio::FX::ConvolutionReverbEffect;
+        double wet = convolution->getWetLevel();
+        double dry = convolution->getDryLevel();
+        std::string irPath;
+        if (config.hasProperty(rt, "convolution")) {
+            auto convObj = config.getProperty(rt, "convolution").asObject(rt);
+            if (convObj.hasProperty(rt, "wetLevel")) wet = convObj.getProperty(rt, "wetLevel").asNumber();
+            if (convObj.hasProperty(rt, "dryLevel")) dry = convObj.getProperty(rt, "dryLevel").asNumber();
+            if (convObj.hasProperty(rt, "irPath")) irPath = convObj.getProperty(rt, "irPath").asString(rt).utf8(rt);
+        }
+        convolution->setMix(wet, dry);
+        if (config.hasProperty(rt, "enabled")) {
+            convolution->setEnabled(config.getProperty(rt, "enabled").asBool());
+        }
+        if (!irPath.empty()) {
+            // Nouvelle RI chargée hors temps réel dans une instance préparée, publiée par un
+            // nouveau plan : l'instance du graphe n'est jamais reconstruite en place
+            if (!convolution->loadImpulseResponse(irPath)) {
+                return false;
+            }
+            auto prepared = makePrepared<ConvolutionEffect>(*convolution);
+            prepared->setMix(wet, dry);
+            if (!prepared->loadImpulseResponse(irPath)) {
+                return false;
+            }
+            return replaceChainEffect(effectId, std::move(prepared));
+        }
+        auto cit = idToChainEffect_.find(effectId);
+        if (cit != idToChainEffect_.end()) {
+            if (auto* c2 = dynamic_cast<ConvolutionEffect*>(cit->second)) {
+                using Param = ConvolutionEffect::Param;
+                scheduleNow<Param>(c2, {{Param::WET_LEVEL, wet}, {Param::DRY_LEVEL, dry}});
                 if (config.hasProperty(rt, "enabled")) {
-                    bool enabled = config.getProperty(rt, "enabled").asBool();
-                    d2->setEnabled(enabled);
+                    c2->setEnabled(config.getProperty(rt, "enabled").asBool());
+                }
+            }
+        }
+        return true;
+    }
+
+    if (auto* multiband = dynamic_cast<Nyth::Audio::FX::MultibandCompressorEffect*>(effect)) {
+        using MultibandEffect = Nyth::Audio::FX::MultibandCompressorEffect;
+        // Instance principale configurée directement ; son état complet est ensuite
+        // transmis à l'instance de la chaîne par sa file d'événements
+        if (config.hasProperty(rt, "multiband")) {
+            auto mbObj = config.getProperty(rt, "multiband").asObject(rt);
+            if (mbObj.hasProperty(rt, "numBands")) {
+                multiband->setNumBands(static_cast<size_t>(mbObj.getProperty(rt, "numBands").asNumber()));
+            }
+            if (mbObj.hasProperty(rt, "kneeDb")) multiband->setKnee(mbObj.getProperty(rt, "kneeDb").asNumber());
+            if (mbObj.hasProperty(rt, "crossovers")) {
+                auto crossovers = mbObj.getProperty(rt, "crossovers").asObject(rt).asArray(rt);
+                for (size_t i = 0; i < crossovers.size(rt); ++i) {
+                    multiband->setCrossover(i, static_cast<float>(crossovers.getValueAtIndex(rt, i).asNumber()));
+                }
+            }
+            if (mbObj.hasProperty(rt, "bands")) {
+                auto bands = mbObj.getProperty(rt, "bands").asObject(rt).asArray(rt);
+                for (size_t i = 0; i < bands.size(rt); ++i) {
+                    auto bandObj = bands.getValueAtIndex(rt, i).asObject(rt);
+                    auto p = multiband->getBandParameters(i);
+                    if (bandObj.hasProperty(rt, "thresholdDb")) p.thresholdDb = bandObj.getProperty(rt, "thresholdDb").asNumber();
+                    if (bandObj.hasProperty(rt, "ratio")) p.ratio = bandObj.getProperty(rt, "ratio").asNumber();
+                    if (bandObj.hasProperty(rt, "attackMs")) p.attackMs = bandObj.getProperty(rt, "attackMs").asNumber();
+                    if (bandObj.hasProperty(rt, "releaseMs")) p.releaseMs = bandObj.getProperty(rt, "releaseMs").asNumber();
+                    if (bandObj.hasProperty(rt, "makeupDb")) p.makeupDb = bandObj.getProperty(rt, "makeupDb").asNumber();
+                    multiband->setBandParameters(i, p.thresholdDb, p.ratio, p.attackMs, p.releaseMs, p.makeupDb);
+                }
+            }
+        }
+        if (config.hasProperty(rt, "enabled")) {
+            multiband->setEnabled(config.getProperty(rt, "enabled").asBool());
+        }
+        // Copie de l'état de l'instance principale : directe pour une instance préparée,
+        // par la file d'événements pour celle que traite le thread audio
+        auto copyState = [multiband](MultibandEffect* target, bool live) {
+            using Param = MultibandEffect::Param;
+            auto set = [target, live](uint32_t paramId, float value) {
+                if (live) {
+                    target->scheduleParameter(paramId, value);
+                } else {
+                    target->setParameter(paramId, value);
+                }
+            };
+            set(static_cast<uint32_t>(Param::KNEE_DB), static_cast<float>(multiband->getKnee()));
+            for (size_t i = 0; i < Nyth::Audio::Effects::Multiband::MAX_BANDS - 1; ++i) {
+                set(MultibandEffect::bandParameter(Param::CROSSOVER_HZ, i), multiband->getCrossover(i));
+            }
+            for (size_t i = 0; i < Nyth::Audio::Effects::Multiband::MAX_BANDS; ++i) {
+                const auto p = multiband->getBandParameters(i);
+                set(MultibandEffect::bandParameter(Param::THRESHOLD_DB, i), p.thresholdDb);
+                set(MultibandEffect::bandParameter(Param::RATIO, i), p.ratio);
+                set(MultibandEffect::bandParameter(Param::ATTACK_MS, i), p.attackMs);
+                set(MultibandEffect::bandParameter(Param::RELEASE_MS, i), p.releaseMs);
+                set(MultibandEffect::bandParameter(Param::MAKEUP_DB, i), p.makeupDb);
+            }
+        };
+        auto mit = idToChainEffect_.find(effectId);
+        if (mit != idToChainEffect_.end()) {
+            if (auto* m2 = dynamic_cast<MultibandEffect*>(mit->second)) {
+                // Nombre de bandes modifié : instance préparée publiée par un nouveau plan
+                if (m2->getNumBands() != multiband->getNumBands()) {
+                    auto prepared = makePrepared<MultibandEffect>(*multiband);
+                    prepared->setNumBands(multiband->getNumBands());
+                    copyState(prepared.get(), false);
+                    return replaceChainEffect(effectId, std::move(prepared));
+                }
+                copyState(m2, true);
+                if (config.hasProperty(rt, "enabled")) {
+                    m2->setEnabled(config.getProperty(rt, "enabled").asBool());
                 }
             }
         }
@@ -227,6 +969,14 @@ jsi::Object EffectManager::getEffectConfig(jsi::Runtime& rt, int effectId) const
         return jsi::Object(rt);
     }
     auto* effect = it->second.get();
+    // Les mesures (réduction de gain, état du gate...) sont publiées par l'instance
+    // du graphe, seule à traiter l'audio ; les paramètres viennent de l'instance principale
+    auto cit = idToChainEffect_.find(effectId);
+    Nyth::Audio::FX::IAudioEffect* live = (cit != idToChainEffect_.end()) ? cit->second : effect;
+    auto meters = [live](auto* model) {
+        auto* instance = dynamic_cast<decltype(model)>(live);
+        return instance ? instance : model;
+    };
 
     jsi::Object result(rt);
     result.setProperty(rt, "enabled", jsi::Value(effect->isEnabled()));
@@ -237,6 +987,128 @@ jsi::Object EffectManager::getEffectConfig(jsi::Runtime& rt, int effectId) const
         result.setProperty(rt, "type", jsi::String::createFromUtf8(rt, "compressor"));
     } else if (dynamic_cast<Nyth::Audio::FX::DelayEffect*>(effect)) {
         result.setProperty(rt, "type", jsi::String::createFromUtf8(rt, "delay"));
+    } else if (dynamic_cast<Nyth::Audio::FX::ReverbEffect*>(effect)) {
+        result.setProperty(rt, "type", jsi::String::createFromUtf8(rt, "reverb"));
+    } else if (auto* limiter = dynamic_cast<Nyth::Audio::FX::LimiterEffect*>(effect)) {
+        auto params = limiter->getParameters();
+        result.setProperty(rt, "type", jsi::String::createFromUtf8(rt, "limiter"));
+        result.setProperty(rt, "ceilingDb", jsi::Value(params.ceilingDb));
+        result.setProperty(rt, "lookaheadMs", jsi::Value(params.lookaheadMs));
+        result.setProperty(rt, "releaseMs", jsi::Value(params.releaseMs));
+        result.setProperty(rt, "gainReductionDb", jsi::Value(meters(limiter)->getGainReductionDb()));
+    } else if (auto* pitch = dynamic_cast<Nyth::Audio::FX::PitchShiftEffect*>(effect)) {
+        auto params = pitch->getParameters();
+        result.setProperty(rt, "type", jsi::String::createFromUtf8(rt, "pitch"));
+        result.setProperty(rt, "semitones", jsi::Value(params.semitones));
+        result.setProperty(rt, "mix", jsi::Value(params.mix));
+        result.setProperty(rt, "algorithm",
+                           jsi::String::createFromUtf8(
+                               rt, params.algorithm == Nyth::Audio::FX::StretchAlgorithm::WSOLA ? "wsola" : "vocoder"));
+        result.setProperty(rt, "latencySamples", jsi::Value(static_cast<double>(pitch->getLatencySamples())));
+    } else if (auto* chorus = dynamic_cast<Nyth::Audio::FX::ChorusEffect*>(effect)) {
+        auto params = chorus->getParameters();
+        result.setProperty(rt, "type", jsi::String::createFromUtf8(rt, "chorus"));
+        result.setProperty(rt, "rateHz", jsi::Value(params.rateHz));
+        result.setProperty(rt, "depthMs", jsi::Value(params.depthMs));
+        result.setProperty(rt, "delayMs", jsi::Value(params.delayMs));
+        result.setProperty(rt, "voices", jsi::Value(static_cast<int>(params.voices)));
+        result.setProperty(rt, "mix", jsi::Value(params.mix));
+    } else if (auto* flanger = dynamic_cast<Nyth::Audio::FX::FlangerEffect*>(effect)) {
+        auto params = flanger->getParameters();
+        result.setProperty(rt, "type", jsi::String::createFromUtf8(rt, "flanger"));
+        result.setProperty(rt, "rateHz", jsi::Value(params.rateHz));
+        result.setProperty(rt, "depthMs", jsi::Value(params.depthMs));
+        result.setProperty(rt, "delayMs", jsi::Value(params.delayMs));
+        result.setProperty(rt, "feedback", jsi::Value(params.feedback));
+        result.setProperty(rt, "mix", jsi::Value(params.mix));
+    } else if (auto* phaser = dynamic_cast<Nyth::Audio::FX::PhaserEffect*>(effect)) {
+        auto params = phaser->getParameters();
+        result.setProperty(rt, "type", jsi::String::createFromUtf8(rt, "phaser"));
+        result.setProperty(rt, "rateHz", jsi::Value(params.rateHz));
+        result.setProperty(rt, "stages", jsi::Value(static_cast<int>(params.stages)));
+        result.setProperty(rt, "minFreqHz", jsi::Value(params.minFreqHz));
+        result.setProperty(rt, "maxFreqHz", jsi::Value(params.maxFreqHz));
+        result.setProperty(rt, "feedback", jsi::Value(params.feedback));
+        result.setProperty(rt, "mix", jsi::Value(params.mix));
+    } else if (auto* expander = dynamic_cast<Nyth::Audio::FX::ExpanderEffect*>(effect)) {
+        auto params = expander->getParameters();
+        result.setProperty(rt, "type", jsi::String::createFromUtf8(rt, "expander"));
+        result.setProperty(rt, "thresholdDb", jsi::Value(params.thresholdDb));
+        result.setProperty(rt, "ratio", jsi::Value(params.ratio));
+        result.setProperty(rt, "rangeDb", jsi::Value(params.rangeDb));
+        result.setProperty(rt, "kneeDb", jsi::Value(params.kneeDb));
+        result.setProperty(rt, "attackMs", jsi::Value(params.attackMs));
+        result.setProperty(rt, "releaseMs", jsi::Value(params.releaseMs));
+        result.setProperty(rt, "gainReductionDb", jsi::Value(meters(expander)->getGainReductionDb()));
+    } else if (auto* gate = dynamic_cast<Nyth::Audio::FX::GateEffect*>(effect)) {
+        auto params = gate->getParameters();
+        result.setProperty(rt, "type", jsi::String::createFromUtf8(rt, "gate"));
+        result.setProperty(rt, "thresholdDb", jsi::Value(params.thresholdDb));
+        result.setProperty(rt, "hysteresisDb", jsi::Value(params.hysteresisDb));
+        result.setProperty(rt, "holdMs", jsi::Value(params.holdMs));
+        result.setProperty(rt, "attackMs", jsi::Value(params.attackMs));
+        result.setProperty(rt, "releaseMs", jsi::Value(params.releaseMs));
+        result.setProperty(rt, "rangeDb", jsi::Value(params.rangeDb));
+        result.setProperty(rt, "open", jsi::Value(meters(gate)->isOpen()));
+        result.setProperty(rt, "gainReductionDb", jsi::Value(meters(gate)->getGainReductionDb()));
+    } else if (auto* shaper = dynamic_cast<Nyth::Audio::FX::TransientShaperEffect*>(effect)) {
+        auto params = shaper->getParameters();
+        result.setProperty(rt, "type", jsi::String::createFromUtf8(rt, "transient"));
+        result.setProperty(rt, "attackDb", jsi::Value(params.attackDb));
+        result.setProperty(rt, "sustainDb", jsi::Value(params.sustainDb));
+        result.setProperty(rt, "outputDb", jsi::Value(params.outputDb));
+        result.setProperty(rt, "gainDb", jsi::Value(meters(shaper)->getGainDb()));
+    } else if (auto* imager = dynamic_cast<Nyth::Audio::FX::StereoImagerEffect*>(effect)) {
+        using Format = Nyth::Audio::FX::StereoImagerEffect::Format;
+        auto params = imager->getParameters();
+        result.setProperty(rt, "type", jsi::String::createFromUtf8(rt, "imager"));
+        result.setProperty(rt, "width", jsi::Value(params.width));
+        result.setProperty(rt, "midGainDb", jsi::Value(params.midGainDb));
+        result.setProperty(rt, "sideGainDb", jsi::Value(params.sideGainDb));
+        result.setProperty(rt, "bassMonoHz", jsi::Value(params.bassMonoHz));
+        result.setProperty(rt, "inputFormat",
+                           jsi::String::createFromUtf8(rt, params.inputFormat == Format::MID_SIDE ? "ms" : "lr"));
+        result.setProperty(rt, "outputFormat",
+                           jsi::String::createFromUtf8(rt, params.outputFormat == Format::MID_SIDE ? "ms" : "lr"));
+    } else if (auto* strip = dynamic_cast<Nyth::Audio::FX::ChannelStripEffect*>(effect)) {
+        using Stages = Nyth::Audio::FX::ChannelStripStages;
+        result.setProperty(rt, "type", jsi::String::createFromUtf8(rt, "strip"));
+        result.setProperty(rt, "highPassHz", jsi::Value(strip->stage<Stages::HIGH_PASS>().getFrequency()));
+        jsi::Array eq(rt, Nyth::Audio::Effects::ChannelStrip::EQ_BANDS);
+        for (size_t b = 0; b < Nyth::Audio::Effects::ChannelStrip::EQ_BANDS; ++b) {
+            auto band = strip->stage<Stages::EQUALIZER>().getBand(b);
+            jsi::Object bandObj(rt);
+            bandObj.setProperty(rt, "frequencyHz", jsi::Value(band.frequencyHz));
+            bandObj.setProperty(rt, "gainDb", jsi::Value(band.gainDb));
+            bandObj.setProperty(rt, "q", jsi::Value(band.q));
+            eq.setValueAtIndex(rt, b, bandObj);
+        }
+        result.setProperty(rt, "eq", eq);
+        result.setProperty(rt, "gainReductionDb",
+                           jsi::Value(meters(strip)->stage<Stages::COMPRESSOR>().getGainReductionDb() +
+                                      meters(strip)->stage<Stages::LIMITER>().getGainReductionDb()));
+        result.setProperty(rt, "latencySamples", jsi::Value(static_cast<double>(strip->getLatencySamples())));
+    } else if (auto* convolution = dynamic_cast<Nyth::Audio::FX::ConvolutionReverbEffect*>(effect)) {
+        result.setProperty(rt, "type", jsi::String::createFromUtf8(rt, "convolution"));
+        result.setProperty(rt, "irPath", jsi::String::createFromUtf8(rt, convolution->getImpulseResponsePath()));
+        result.setProperty(rt, "irLengthSamples",
+                           jsi::Value(static_cast<double>(convolution->getImpulseResponseLength())));
+        result.setProperty(rt, "wetLevel", jsi::Value(convolution->getWetLevel()));
+        result.setProperty(rt, "dryLevel", jsi::Value(convolution->getDryLevel()));
+        result.setProperty(rt, "lateBlocks", jsi::Value(static_cast<double>(meters(convolution)->getLateBlockCount())));
+    } else if (auto* multiband = dynamic_cast<Nyth::Audio::FX::MultibandCompressorEffect*>(effect)) {
+        result.setProperty(rt, "type", jsi::String::createFromUtf8(rt, "multiband"));
+        result.setProperty(rt, "numBands", jsi::Value(static_cast<int>(multiband->getNumBands())));
+        jsi::Array crossovers(rt, multiband->getNumBands() - 1);
+        for (size_t i = 0; i + 1 < multiband->getNumBands(); ++i) {
+            crossovers.setValueAtIndex(rt, i, jsi::Value(multiband->getCrossover(i)));
+        }
+        result.setProperty(rt, "crossovers", crossovers);
+        jsi::Array reductions(rt, multiband->getNumBands());
+        for (size_t b = 0; b < multiband->getNumBands(); ++b) {
+            reductions.setValueAtIndex(rt, b, jsi::Value(meters(multiband)->getBandGainReduction(b)));
+        }
+        result.setProperty(rt, "gainReductionDb", reductions);
     } else {
         result.setProperty(rt, "type", jsi::String::createFromUtf8(rt, "unknown"));
     }
@@ -249,10 +1121,15 @@ bool EffectManager::enableEffect(int effectId, bool enabled) {
     auto it = activeEffects_.find(effectId);
     if (it != activeEffects_.end()) {
         if (it->second) {
+            const bool changed = it->second->isEnabled() != enabled;
             it->second->setEnabled(enabled);
             auto jt = idToChainEffect_.find(effectId);
             if (jt != idToChainEffect_.end() && jt->second) {
                 jt->second->setEnabled(enabled);
+                // Un effet désactivé n'apporte plus sa latence : compensation à recalculer
+                if (changed && it->second->getLatencySamples() > 0) {
+                    effectGraph_.commit();
+                }
             }
             return true;
         }
@@ -304,14 +1181,7 @@ bool EffectManager::processAudio(const float* input, float* output, size_t frame
         return true;
     }
 
-    std::lock_guard<std::mutex> lock(effectsMutex_);
-
-    if (activeEffects_.empty() || idToChainEffect_.empty()) {
-        if (input != output) {
-            std::copy(input, input + frameCount * channels, output);
-        }
-        return true;
-    }
+    // Pas de verrou : le graphe lit son plan courant par pointeur atomique
 
     try {
         // Appliquer les niveaux maître d'entrée
@@ -320,36 +1190,13 @@ bool EffectManager::processAudio(const float* input, float* output, size_t frame
             // TODO: Appliquer le gain d'entrée si nécessaire
         }
 
-        // Traiter avec la chaîne d'effets
+        // Traiter avec le graphe d'effets
         if (channels == 1) {
             // Mono
-            std::vector<float> inputVec(input, input + frameCount);
-            std::vector<float> outputVec(frameCount);
-
-            effectChain_.processMono(inputVec, outputVec);
-
-            if (output) {
-                std::copy(outputVec.begin(), outputVec.end(), output);
-            }
+            effectGraph_.processMono(input, output, frameCount);
         } else if (channels == 2) {
-            // Stereo interleaved input -> deinterleave for chain API
-            std::vector<float> inputVecL(frameCount);
-            std::vector<float> inputVecR(frameCount);
-            for (size_t i = 0; i < frameCount; ++i) {
-                inputVecL[i] = input[i * 2];
-                inputVecR[i] = input[i * 2 + 1];
-            }
-            std::vector<float> outputVecL(frameCount);
-            std::vector<float> outputVecR(frameCount);
-
-            effectChain_.processStereo(inputVecL, inputVecR, outputVecL, outputVecR);
-
-            if (output) {
-                for (size_t i = 0; i < frameCount; ++i) {
-                    output[i * 2] = outputVecL[i];
-                    output[i * 2 + 1] = outputVecR[i];
-                }
-            }
+            // Stéréo entrelacée : le graphe désentrelace dans ses propres tampons, ou pas du tout
+            effectGraph_.processInterleaved(input, output, frameCount);
         }
 
         // Appliquer les niveaux maître de sortie
@@ -358,7 +1205,7 @@ bool EffectManager::processAudio(const float* input, float* output, size_t frame
             // TODO: Appliquer le gain de sortie si nécessaire
         }
 
-        updateMetrics();
+        updateMetrics(frameCount, channels);
         return true;
 
     } catch (const std::exception& e) {
@@ -378,18 +1225,6 @@ bool EffectManager::processAudioStereo(const float* inputL, const float* inputR,
         return true;
     }
 
-    std::lock_guard<std::mutex> lock(effectsMutex_);
-
-    if (activeEffects_.empty()) {
-        if (inputL != outputL) {
-            std::copy(inputL, inputL + frameCount, outputL);
-        }
-        if (inputR != outputR) {
-            std::copy(inputR, inputR + frameCount, outputR);
-        }
-        return true;
-    }
-
     try {
         // Appliquer les niveaux maître d'entrée
         float inputLevel = masterInputLevel_.load();
@@ -397,20 +1232,8 @@ bool EffectManager::processAudioStereo(const float* inputL, const float* inputR,
             // TODO: Appliquer le gain d'entrée si nécessaire
         }
 
-        // Traiter avec la chaîne d'effets
-        std::vector<float> inputVecL(inputL, inputL + frameCount);
-        std::vector<float> inputVecR(inputR, inputR + frameCount);
-        std::vector<float> outputVecL(frameCount);
-        std::vector<float> outputVecR(frameCount);
-
-        effectChain_.processStereo(inputVecL, inputVecR, outputVecL, outputVecR);
-
-        if (outputL) {
-            std::copy(outputVecL.begin(), outputVecL.end(), outputL);
-        }
-        if (outputR) {
-            std::copy(outputVecR.begin(), outputVecR.end(), outputR);
-        }
+        // Traiter avec le graphe d'effets (sans verrou ni copie intermédiaire)
+        effectGraph_.processStereo(inputL, inputR, outputL, outputR, frameCount);
 
         // Appliquer les niveaux maître de sortie
         float outputLevel = masterOutputLevel_.load();
@@ -418,7 +1241,7 @@ bool EffectManager::processAudioStereo(const float* inputL, const float* inputR,
             // TODO: Appliquer le gain de sortie si nécessaire
         }
 
-        updateMetrics();
+        updateMetrics(frameCount, 2);
         return true;
 
     } catch (const std::exception& e) {
@@ -428,8 +1251,20 @@ bool EffectManager::processAudioStereo(const float* inputL, const float* inputR,
 
 // === Métriques et statistiques ===
 EffectManager::ProcessingMetrics EffectManager::getMetrics() const {
-    std::lock_guard<std::mutex> lock(metricsMutex_);
-    return currentMetrics_;
+    ProcessingMetrics metrics;
+    metrics.processedFrames = processedFrames_.load(std::memory_order_relaxed);
+    metrics.processedSamples = processedSamples_.load(std::memory_order_relaxed);
+    metrics.activeEffectsCount = activeEffectsCount_.load(std::memory_order_relaxed);
+    return metrics;
+}
+
+void EffectManager::dispatchMetrics() {
+    const uint64_t frames = processedFrames_.load(std::memory_order_relaxed);
+    // Rien de nouveau depuis le dernier envoi
+    if (dispatchedFrames_.exchange(frames, std::memory_order_relaxed) == frames) {
+        return;
+    }
+    notifyProcessingCallback(getMetrics());
 }
 
 // === Informations ===
@@ -442,8 +1277,10 @@ size_t EffectManager::getMaxEffects() const {
 }
 
 uint32_t EffectManager::getLatency() const {
-    // TODO: Calculer la latence totale de tous les effets actifs
-    return 0;
+    std::lock_guard<std::mutex> lock(effectsMutex_);
+
+    // Chemin le plus long du graphe, calculé à la compilation du plan
+    return effectGraph_.getLatencySamples();
 }
 
 // === Callbacks ===
@@ -477,6 +1314,32 @@ EffectType EffectManager::getEffectType(int effectId) const {
             return EffectType::COMPRESSOR;
         } else if (dynamic_cast<Nyth::Audio::FX::DelayEffect*>(it->second.get())) {
             return EffectType::DELAY;
+        } else if (dynamic_cast<Nyth::Audio::FX::ReverbEffect*>(it->second.get())) {
+            return EffectType::REVERB;
+        } else if (dynamic_cast<Nyth::Audio::FX::MultibandCompressorEffect*>(it->second.get())) {
+            return EffectType::MULTIBAND_COMPRESSOR;
+        } else if (dynamic_cast<Nyth::Audio::FX::ConvolutionReverbEffect*>(it->second.get())) {
+            return EffectType::CONVOLUTION_REVERB;
+        } else if (dynamic_cast<Nyth::Audio::FX::LimiterEffect*>(it->second.get())) {
+            return EffectType::LIMITER;
+        } else if (dynamic_cast<Nyth::Audio::FX::PitchShiftEffect*>(it->second.get())) {
+            return EffectType::PITCH_SHIFT;
+        } else if (dynamic_cast<Nyth::Audio::FX::ChorusEffect*>(it->second.get())) {
+            return EffectType::CHORUS;
+        } else if (dynamic_cast<Nyth::Audio::FX::FlangerEffect*>(it->second.get())) {
+            return EffectType::FLANGER;
+        } else if (dynamic_cast<Nyth::Audio::FX::PhaserEffect*>(it->second.get())) {
+            return EffectType::PHASER;
+        } else if (dynamic_cast<Nyth::Audio::FX::ChannelStripEffect*>(it->second.get())) {
+            return EffectType::CHANNEL_STRIP;
+        } else if (dynamic_cast<Nyth::Audio::FX::ExpanderEffect*>(it->second.get())) {
+            return EffectType::EXPANDER;
+        } else if (dynamic_cast<Nyth::Audio::FX::GateEffect*>(it->second.get())) {
+            return EffectType::GATE;
+        } else if (dynamic_cast<Nyth::Audio::FX::TransientShaperEffect*>(it->second.get())) {
+            return EffectType::TRANSIENT_SHAPER;
+        } else if (dynamic_cast<Nyth::Audio::FX::StereoImagerEffect*>(it->second.get())) {
+            return EffectType::STEREO_IMAGER;
         } else {
             return EffectType::UNKNOWN; // Type non déterminé
         }
@@ -504,19 +1367,9 @@ uint32_t EffectManager::getEffectLatency(int effectId) const {
     std::lock_guard<std::mutex> lock(effectsMutex_);
 
     auto it = activeEffects_.find(effectId);
-    if (it != activeEffects_.end()) {
-        // Estimation de la latence basée sur le type d'effet
-        auto effectType = getEffectType(effectId);
-        switch (effectType) {
-            case EffectType::COMPRESSOR:
-                return 1; // Très faible latence
-            case EffectType::DELAY:
-                return 5; // Latence due au buffer de delay
-            case EffectType::REVERB:
-                return 10; // Latence due aux algorithmes de réverbération
-            default:
-                return 0;
-        }
+    if (it != activeEffects_.end() && it->second) {
+        // Latence réelle déclarée par l'effet (lookahead, suréchantillonnage...)
+        return it->second->getLatencySamples();
     }
 
     return 0;
@@ -537,6 +1390,28 @@ std::string EffectManager::effectTypeToString(EffectType type) const {
             return "equalizer";
         case EffectType::LIMITER:
             return "limiter";
+        case EffectType::MULTIBAND_COMPRESSOR:
+            return "multiband";
+        case EffectType::CONVOLUTION_REVERB:
+            return "convolution";
+        case EffectType::PITCH_SHIFT:
+            return "pitch";
+        case EffectType::CHORUS:
+            return "chorus";
+        case EffectType::FLANGER:
+            return "flanger";
+        case EffectType::PHASER:
+            return "phaser";
+        case EffectType::CHANNEL_STRIP:
+            return "strip";
+        case EffectType::EXPANDER:
+            return "expander";
+        case EffectType::GATE:
+            return "gate";
+        case EffectType::TRANSIENT_SHAPER:
+            return "transient";
+        case EffectType::STEREO_IMAGER:
+            return "imager";
         default:
             return "unknown";
     }
@@ -565,6 +1440,18 @@ bool EffectManager::validateEffectType(EffectType type) const {
         case EffectType::COMPRESSOR:
         case EffectType::DELAY:
         case EffectType::REVERB:
+        case EffectType::MULTIBAND_COMPRESSOR:
+        case EffectType::CONVOLUTION_REVERB:
+        case EffectType::LIMITER:
+        case EffectType::PITCH_SHIFT:
+        case EffectType::CHORUS:
+        case EffectType::FLANGER:
+        case EffectType::PHASER:
+        case EffectType::CHANNEL_STRIP:
+        case EffectType::EXPANDER:
+        case EffectType::GATE:
+        case EffectType::TRANSIENT_SHAPER:
+        case EffectType::STEREO_IMAGER:
             return true;
         default:
             return false;
@@ -588,10 +1475,87 @@ std::unique_ptr<Nyth::Audio::FX::IAudioEffect> EffectManager::createEffectByType
                 return delay;
             }
 
+            case EffectType::MULTIBAND_COMPRESSOR: {
+                // Créer un compresseur multibande
+                auto multiband = std::make_unique<Nyth::Audio::FX::MultibandCompressorEffect>();
+                multiband->setSampleRate(config_.sampleRate, config_.channels);
+                return multiband;
+            }
+
             case EffectType::REVERB: {
-                // TODO: Implémenter l'effet de réverbération
-                // Pour l'instant, retourner nullptr
-                break;
+                // Créer une réverbération FDN
+                auto reverb = std::make_unique<Nyth::Audio::FX::ReverbEffect>();
+                reverb->setSampleRate(config_.sampleRate, config_.channels);
+                return reverb;
+            }
+
+            case EffectType::CONVOLUTION_REVERB: {
+                // Réverbération à convolution (RI chargée ensuite via setEffectConfig)
+                auto convolution = std::make_unique<Nyth::Audio::FX::ConvolutionReverbEffect>();
+                convolution->setSampleRate(config_.sampleRate, config_.channels);
+                return convolution;
+            }
+
+            case EffectType::LIMITER: {
+                // Créer un limiteur true-peak
+                auto limiter = std::make_unique<Nyth::Audio::FX::LimiterEffect>();
+                limiter->setSampleRate(config_.sampleRate, config_.channels);
+                return limiter;
+            }
+
+            case EffectType::PITCH_SHIFT: {
+                // Pitch shifter (vocodeur de phase ou WSOLA, alloués tous deux ici)
+                auto pitch = std::make_unique<Nyth::Audio::FX::PitchShiftEffect>();
+                pitch->setSampleRate(config_.sampleRate, config_.channels);
+                return pitch;
+            }
+
+            case EffectType::CHORUS: {
+                auto chorus = std::make_unique<Nyth::Audio::FX::ChorusEffect>();
+                chorus->setSampleRate(config_.sampleRate, config_.channels);
+                return chorus;
+            }
+
+            case EffectType::FLANGER: {
+                auto flanger = std::make_unique<Nyth::Audio::FX::FlangerEffect>();
+                flanger->setSampleRate(config_.sampleRate, config_.channels);
+                return flanger;
+            }
+
+            case EffectType::PHASER: {
+                auto phaser = std::make_unique<Nyth::Audio::FX::PhaserEffect>();
+                phaser->setSampleRate(config_.sampleRate, config_.channels);
+                return phaser;
+            }
+
+            case EffectType::CHANNEL_STRIP: {
+                auto strip = std::make_unique<Nyth::Audio::FX::ChannelStripEffect>();
+                strip->setSampleRate(config_.sampleRate, config_.channels);
+                return strip;
+            }
+
+            case EffectType::EXPANDER: {
+                auto expander = std::make_unique<Nyth::Audio::FX::ExpanderEffect>();
+                expander->setSampleRate(config_.sampleRate, config_.channels);
+                return expander;
+            }
+
+            case EffectType::GATE: {
+                auto gate = std::make_unique<Nyth::Audio::FX::GateEffect>();
+                gate->setSampleRate(config_.sampleRate, config_.channels);
+                return gate;
+            }
+
+            case EffectType::TRANSIENT_SHAPER: {
+                auto shaper = std::make_unique<Nyth::Audio::FX::TransientShaperEffect>();
+                shaper->setSampleRate(config_.sampleRate, config_.channels);
+                return shaper;
+            }
+
+            case EffectType::STEREO_IMAGER: {
+                auto imager = std::make_unique<Nyth::Audio::FX::StereoImagerEffect>();
+                imager->setSampleRate(config_.sampleRate, config_.channels);
+                return imager;
             }
 
             case EffectType::FILTER: {
@@ -611,26 +1575,36 @@ std::unique_ptr<Nyth::Audio::FX::IAudioEffect> EffectManager::createEffectByType
     return nullptr;
 }
 
-void EffectManager::updateMetrics() {
-    std::lock_guard<std::mutex> lock(metricsMutex_);
-
-    // TODO: Mettre à jour les métriques réelles
-    currentMetrics_.processedFrames++;
-    currentMetrics_.processedSamples += 512; // Exemple
-    currentMetrics_.activeEffectsCount = activeEffects_.size();
+// Effets en série dans l'ordre de création : entrée -> e1 -> ... -> sortie (appelé sous effectsMutex_)
+bool EffectManager::rebuildRouting() {
+    effectGraph_.disconnectAll();
+    Nyth::Audio::FX::GraphNodeId previous = Nyth::Audio::FX::EffectGraph::INPUT_NODE;
+    for (int effectId : chainOrder_) {
+        auto nt = idToNode_.find(effectId);
+        if (nt == idToNode_.end()) {
+            continue;
+        }
+        effectGraph_.connect(previous, nt->second);
+        previous = nt->second;
+    }
+    effectGraph_.connect(previous, Nyth::Audio::FX::EffectGraph::OUTPUT_NODE);
+    return effectGraph_.commit();
+}
 
-    // Notifier le callback
-    notifyProcessingCallback();
+// Thread audio : compteurs atomiques uniquement, le callback part de dispatchMetrics()
+void EffectManager::updateMetrics(size_t frameCount, int channels) noexcept {
+    processedFrames_.fetch_add(frameCount, std::memory_order_relaxed);
+    processedSamples_.fetch_add(frameCount * static_cast<size_t>(channels), std::memory_order_relaxed);
 }
 
-void EffectManager::notifyProcessingCallback() {
+void EffectManager::notifyProcessingCallback(const ProcessingMetrics& metrics) {
     if (processingCallback_) {
-        processingCallback_(currentMetrics_);
+        processingCallback_(metrics);
     }
 
     if (callbackManager_) {
         // TODO: Envoyer les métriques via le callback manager si nécessaire
-        // callbackManager_->invokeProcessingCallback(currentMetrics_);
+        // callbackManager_->invokeProcessingCallback(metrics);
     }
 }
 
@@ -652,6 +1626,30 @@ EffectType EffectManager::stringToEffectType(const std::string& typeStr) const {
         return EffectType::DELAY;
     } else if (typeStr == "reverb") {
         return EffectType::REVERB;
+    } else if (typeStr == "multiband") {
+        return EffectType::MULTIBAND_COMPRESSOR;
+    } else if (typeStr == "convolution") {
+        return EffectType::CONVOLUTION_REVERB;
+    } else if (typeStr == "limiter") {
+        return EffectType::LIMITER;
+    } else if (typeStr == "pitch") {
+        return EffectType::PITCH_SHIFT;
+    } else if (typeStr == "chorus") {
+        return EffectType::CHORUS;
+    } else if (typeStr == "flanger") {
+        return EffectType::FLANGER;
+    } else if (typeStr == "phaser") {
+        return EffectType::PHASER;
+    } else if (typeStr == "strip") {
+        return EffectType::CHANNEL_STRIP;
+    } else if (typeStr == "expander") {
+        return EffectType::EXPANDER;
+    } else if (typeStr == "gate") {
+        return EffectType::GATE;
+    } else if (typeStr == "transient") {
+        return EffectType::TRANSIENT_SHAPER;
+    } else if (typeStr == "imager") {
+        return EffectType::STEREO_IMAGER;
     }
     return EffectType::UNKNOWN;
 }
@@ -685,6 +1683,9 @@ jsi::Object EffectManager::getCompressorParameters(jsi::Runtime& rt, int effectI
     result.setProperty(rt, "attackMs", jsi::Value(params.attackMs));
     result.setProperty(rt, "releaseMs", jsi::Value(params.releaseMs));
     result.setProperty(rt, "makeupDb", jsi::Value(params.makeupDb));
+    result.setProperty(rt, "kneeDb", jsi::Value(params.kneeDb));
+    result.setProperty(rt, "lookaheadMs", jsi::Value(params.lookaheadMs));
+    result.setProperty(rt, "rmsWindowMs", jsi::Value(params.rmsWindowMs));
 
     return result;
 }
@@ -715,6 +1716,37 @@ jsi::Object EffectManager::getDelayParameters(jsi::Runtime& rt, int effectId) co
     result.setProperty(rt, "delayMs", jsi::Value(params.delayMs));
     result.setProperty(rt, "feedback", jsi::Value(params.feedback));
     result.setProperty(rt, "mix", jsi::Value(params.mix));
+    result.setProperty(rt, "modRateHz", jsi::Value(params.modRateHz));
+    result.setProperty(rt, "modDepthMs", jsi::Value(params.modDepthMs));
+    result.setProperty(rt, "lowCutHz", jsi::Value(params.lowCutHz));
+    result.setProperty(rt, "highCutHz", jsi::Value(params.highCutHz));
+
+    return result;
+}
+
+jsi::Object EffectManager::getReverbParameters(jsi::Runtime& rt, int effectId) const {
+    std::lock_guard<std::mutex> lock(effectsMutex_);
+
+    auto it = activeEffects_.find(effectId);
+    if (it == activeEffects_.end()) {
+        // Retourner un objet vide si l'effet n'existe pas
+        return jsi::Object(rt);
+    }
+
+    auto* reverb = dynamic_cast<Nyth::Audio::FX::ReverbEffect*>(it->second.get());
+    if (!reverb) {
+        return jsi::Object(rt);
+    }
+
+    auto params = reverb->getParameters();
+    jsi::Object result(rt);
+
+    result.setProperty(rt, "roomSize", jsi::Value(params.roomSize));
+    result.setProperty(rt, "damping", jsi::Value(params.damping));
+    result.setProperty(rt, "wetLevel", jsi::Value(params.wetLevel));
+    result.setProperty(rt, "dryLevel", jsi::Value(params.dryLevel));
+    result.setProperty(rt, "decayTimeSeconds", jsi::Value(reverb->getDecayTimeSeconds()));
+    result.setProperty(rt, "enabled", jsi::Value(reverb->isEnabled()));
 
     return result;
 }
@@ -739,6 +1771,15 @@ bool EffectManager::setCompressorParameters(int effectId, float thresholdDb, flo
     }
 
     compressor->setParameters(thresholdDb, ratio, attackMs, releaseMs, makeupDb);
+    auto cit = idToChainEffect_.find(effectId);
+    if (cit != idToChainEffect_.end()) {
+        using Param = Nyth::Audio::FX::CompressorEffect::Param;
+        scheduleNow<Param>(cit->second, {{Param::THRESHOLD_DB, thresholdDb},
+                                         {Param::RATIO, ratio},
+                                         {Param::ATTACK_MS, attackMs},
+                                         {Param::RELEASE_MS, releaseMs},
+                                         {Param::MAKEUP_DB, makeupDb}});
+    }
     return true;
 }
 
@@ -762,9 +1803,205 @@ bool EffectManager::setDelayParameters(int effectId, float delayMs, float feedba
     }
 
     delay->setParameters(delayMs, feedback, mix);
+    auto dit = idToChainEffect_.find(effectId);
+    if (dit != idToChainEffect_.end()) {
+        using Param = Nyth::Audio::FX::DelayEffect::Param;
+        scheduleNow<Param>(dit->second, {{Param::DELAY_MS, delayMs}, {Param::FEEDBACK, feedback}, {Param::MIX, mix}});
+    }
     return true;
 }
 
+bool EffectManager::scheduleEffectParameter(int effectId, const std::string& name, float value, int64_t sampleTime) {
+    std::lock_guard<std::mutex> lock(effectsMutex_);
+
+    auto it = activeEffects_.find(effectId);
+    auto cit = idToChainEffect_.find(effectId);
+    if (it == activeEffects_.end() || cit == idToChainEffect_.end()) {
+        return false;
+    }
+    uint32_t paramId = 0;
+    if (!resolveParameterId(it->second.get(), name, paramId)) {
+        return false;
+    }
+    // Instance principale (lue par getEffectConfig) mise à jour tout de suite ;
+    // l'instance de la chaîne applique le changement à l'échantillon sampleTime
+    if (!cit->second->scheduleParameter(paramId, value, sampleTime < 0 ? 0 : static_cast<uint64_t>(sampleTime))) {
+        return false;
+    }
+    const uint32_t latencyBefore = it->second->getLatencySamples();
+    it->second->setParameter(paramId, value);
+    // Lookahead ou transposition : compensation recalculée depuis l'instance principale
+    if (it->second->isEnabled() && it->second->getLatencySamples() != latencyBefore) {
+        effectGraph_.commit();
+    }
+    return true;
+}
+
+uint64_t EffectManager::getSamplePosition() const {
+    return effectGraph_.getSamplePosition();
+}
+
+bool EffectManager::resolveParameterId(const Nyth::Audio::FX::IAudioEffect* effect, const std::string& name,
+                                       uint32_t& paramId) const {
+    auto match = [&](std::initializer_list<std::pair<const char*, uint32_t>> names) {
+        for (const auto& [candidate, id] : names) {
+            if (name == candidate) {
+                paramId = id;
+                return true;
+            }
+        }
+        return false;
+    };
+    if (dynamic_cast<const Nyth::Audio::FX::CompressorEffect*>(effect)) {
+        using Param = Nyth::Audio::FX::CompressorEffect::Param;
+        return match({{"thresholdDb", static_cast<uint32_t>(Param::THRESHOLD_DB)},
+                      {"ratio", static_cast<uint32_t>(Param::RATIO)},
+                      {"attackMs", static_cast<uint32_t>(Param::ATTACK_MS)},
+                      {"releaseMs", static_cast<uint32_t>(Param::RELEASE_MS)},
+                      {"makeupDb", static_cast<uint32_t>(Param::MAKEUP_DB)},
+                      {"kneeDb", static_cast<uint32_t>(Param::KNEE_DB)},
+                      {"lookaheadMs", static_cast<uint32_t>(Param::LOOKAHEAD_MS)},
+                      {"rmsWindowMs", static_cast<uint32_t>(Param::RMS_WINDOW_MS)}});
+    }
+    if (dynamic_cast<const Nyth::Audio::FX::DelayEffect*>(effect)) {
+        using Param = Nyth::Audio::FX::DelayEffect::Param;
+        return match({{"delayMs", static_cast<uint32_t>(Param::DELAY_MS)},
+                      {"feedback", static_cast<uint32_t>(Param::FEEDBACK)},
+                      {"mix", static_cast<uint32_t>(Param::MIX)},
+                      {"modRateHz", static_cast<uint32_t>(Param::MOD_RATE_HZ)},
+                      {"modDepthMs", static_cast<uint32_t>(Param::MOD_DEPTH_MS)},
+                      {"lowCutHz", static_cast<uint32_t>(Param::LOW_CUT_HZ)},
+                      {"highCutHz", static_cast<uint32_t>(Param::HIGH_CUT_HZ)}});
+    }
+    if (dynamic_cast<const Nyth::Audio::FX::ExpanderEffect*>(effect)) {
+        using Param = Nyth::Audio::FX::ExpanderEffect::Param;
+        return match({{"thresholdDb", static_cast<uint32_t>(Param::THRESHOLD_DB)},
+                      {"ratio", static_cast<uint32_t>(Param::RATIO)},
+                      {"rangeDb", static_cast<uint32_t>(Param::RANGE_DB)},
+                      {"kneeDb", static_cast<uint32_t>(Param::KNEE_DB)},
+                      {"attackMs", static_cast<uint32_t>(Param::ATTACK_MS)},
+                      {"releaseMs", static_cast<uint32_t>(Param::RELEASE_MS)}});
+    }
+    if (dynamic_cast<const Nyth::Audio::FX::GateEffect*>(effect)) {
+        using Param = Nyth::Audio::FX::GateEffect::Param;
+        return match({{"thresholdDb", static_cast<uint32_t>(Param::THRESHOLD_DB)},
+                      {"hysteresisDb", static_cast<uint32_t>(Param::HYSTERESIS_DB)},
+                      {"holdMs", static_cast<uint32_t>(Param::HOLD_MS)},
+                      {"attackMs", static_cast<uint32_t>(Param::ATTACK_MS)},
+                      {"releaseMs", static_cast<uint32_t>(Param::RELEASE_MS)},
+                      {"rangeDb", static_cast<uint32_t>(Param::RANGE_DB)}});
+    }
+    if (dynamic_cast<const Nyth::Audio::FX::TransientShaperEffect*>(effect)) {
+        using Param = Nyth::Audio::FX::TransientShaperEffect::Param;
+        return match({{"attackDb", static_cast<uint32_t>(Param::ATTACK_DB)},
+                      {"sustainDb", static_cast<uint32_t>(Param::SUSTAIN_DB)},
+                      {"outputDb", static_cast<uint32_t>(Param::OUTPUT_DB)}});
+    }
+    if (dynamic_cast<const Nyth::Audio::FX::StereoImagerEffect*>(effect)) {
+        using Param = Nyth::Audio::FX::StereoImagerEffect::Param;
+        return match({{"width", static_cast<uint32_t>(Param::WIDTH)},
+                      {"midGainDb", static_cast<uint32_t>(Param::MID_GAIN_DB)},
+                      {"sideGainDb", static_cast<uint32_t>(Param::SIDE_GAIN_DB)},
+                      {"bassMonoHz", static_cast<uint32_t>(Param::BASS_MONO_HZ)},
+                      {"inputFormat", static_cast<uint32_t>(Param::INPUT_FORMAT)},
+                      {"outputFormat", static_cast<uint32_t>(Param::OUTPUT_FORMAT)}});
+    }
+    if (dynamic_cast<const Nyth::Audio::FX::LimiterEffect*>(effect)) {
+        using Param = Nyth::Audio::FX::LimiterEffect::Param;
+        return match({{"ceilingDb", static_cast<uint32_t>(Param::CEILING_DB)},
+                      {"lookaheadMs", static_cast<uint32_t>(Param::LOOKAHEAD_MS)},
+                      {"releaseMs", static_cast<uint32_t>(Param::RELEASE_MS)}});
+    }
+    if (dynamic_cast<const Nyth::Audio::FX::ReverbEffect*>(effect)) {
+        using Param = Nyth::Audio::FX::ReverbEffect::Param;
+        return match({{"roomSize", static_cast<uint32_t>(Param::ROOM_SIZE)},
+                      {"damping", static_cast<uint32_t>(Param::DAMPING)},
+                      {"wetLevel", static_cast<uint32_t>(Param::WET_LEVEL)},
+                      {"dryLevel", static_cast<uint32_t>(Param::DRY_LEVEL)}});
+    }
+    if (dynamic_cast<const Nyth::Audio::FX::PitchShiftEffect*>(effect)) {
+        using Param = Nyth::Audio::FX::PitchShiftEffect::Param;
+        return match({{"semitones", static_cast<uint32_t>(Param::SEMITONES)},
+                      {"mix", static_cast<uint32_t>(Param::MIX)}});
+    }
+    if (dynamic_cast<const Nyth::Audio::FX::ChorusEffect*>(effect)) {
+        using Param = Nyth::Audio::FX::ChorusEffect::Param;
+        return match({{"rateHz", static_cast<uint32_t>(Param::RATE_HZ)},
+                      {"depthMs", static_cast<uint32_t>(Param::DEPTH_MS)},
+                      {"delayMs", static_cast<uint32_t>(Param::DELAY_MS)},
+                      {"voices", static_cast<uint32_t>(Param::VOICES)},
+                      {"mix", static_cast<uint32_t>(Param::MIX)}});
+    }
+    if (dynamic_cast<const Nyth::Audio::FX::FlangerEffect*>(effect)) {
+        using Param = Nyth::Audio::FX::FlangerEffect::Param;
+        return match({{"rateHz", static_cast<uint32_t>(Param::RATE_HZ)},
+                      {"depthMs", static_cast<uint32_t>(Param::DEPTH_MS)},
+                      {"delayMs", static_cast<uint32_t>(Param::DELAY_MS)},
+                      {"feedback", static_cast<uint32_t>(Param::FEEDBACK)},
+                      {"mix", static_cast<uint32_t>(Param::MIX)}});
+    }
+    if (dynamic_cast<const Nyth::Audio::FX::PhaserEffect*>(effect)) {
+        using Param = Nyth::Audio::FX::PhaserEffect::Param;
+        return match({{"rateHz", static_cast<uint32_t>(Param::RATE_HZ)},
+                      {"stages", static_cast<uint32_t>(Param::STAGES)},
+                      {"minFreqHz", static_cast<uint32_t>(Param::MIN_FREQ_HZ)},
+                      {"maxFreqHz", static_cast<uint32_t>(Param::MAX_FREQ_HZ)},
+                      {"feedback", static_cast<uint32_t>(Param::FEEDBACK)},
+                      {"mix", static_cast<uint32_t>(Param::MIX)}});
+    }
+    if (dynamic_cast<const Nyth::Audio::FX::ConvolutionReverbEffect*>(effect)) {
+        using Param = Nyth::Audio::FX::ConvolutionReverbEffect::Param;
+        return match({{"wetLevel", static_cast<uint32_t>(Param::WET_LEVEL)},
+                      {"dryLevel", static_cast<uint32_t>(Param::DRY_LEVEL)}});
+    }
+    if (dynamic_cast<const Nyth::Audio::FX::MultibandCompressorEffect*>(effect)) {
+        // Mêmes chemins que la configuration : "kneeDb", "crossovers[i]", "bands[i].thresholdDb"
+        using MultibandEffect = Nyth::Audio::FX::MultibandCompressorEffect;
+        using Param = MultibandEffect::Param;
+        auto indexed = [&](const std::string& prefix, size_t& index, std::string& rest) {
+            if (name.compare(0, prefix.size(), prefix) != 0) {
+                return false;
+            }
+            const size_t close = name.find(']', prefix.size());
+            if (close == std::string::npos || close == prefix.size() ||
+                name.find_first_not_of("0123456789", prefix.size()) != close) {
+                return false;
+            }
+            index = std::stoul(name.substr(prefix.size(), close - prefix.size()));
+            rest = name.substr(close + 1);
+            return index < Nyth::Audio::Effects::Multiband::MAX_BANDS;
+        };
+        size_t index = 0;
+        std::string rest;
+        if (name == "kneeDb") {
+            paramId = static_cast<uint32_t>(Param::KNEE_DB);
+            return true;
+        }
+        if (indexed("crossovers[", index, rest)) {
+            if (!rest.empty() || index + 1 >= Nyth::Audio::Effects::Multiband::MAX_BANDS) {
+                return false;
+            }
+            paramId = MultibandEffect::bandParameter(Param::CROSSOVER_HZ, index);
+            return true;
+        }
+        if (indexed("bands[", index, rest)) {
+            const std::pair<const char*, Param> fields[] = {{".thresholdDb", Param::THRESHOLD_DB},
+                                                            {".ratio", Param::RATIO},
+                                                            {".attackMs", Param::ATTACK_MS},
+                                                            {".releaseMs", Param::RELEASE_MS},
+                                                            {".makeupDb", Param::MAKEUP_DB}};
+            for (const auto& [field, param] : fields) {
+                if (rest == field) {
+                    paramId = MultibandEffect::bandParameter(param, index);
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+    return false;
+}
+
 // (duplicate removed) effectTypeToString is already defined earlier in this file
 
 // === Implémentations SIMD ===
@@ -783,19 +2020,6 @@ bool EffectManager::processAudio_SIMD(const float* input, float* output, size_t
         return true;
     }
 
-    std::lock_guard<std::mutex> lock(effectsMutex_);
-
-    if (activeEffects_.empty() || idToChainEffect_.empty()) {
-        if (input != output) {
-            if (AudioNR::MathUtils::SIMDIntegration::isSIMDAccelerationEnabled() && frameCount >= 64) {
-                std::memcpy(output, input, frameCount * channels * sizeof(float));
-            } else {
-                std::copy(input, input + frameCount * channels, output);
-            }
-        }
-        return true;
-    }
-
     try {
         // Utiliser SIMD si disponible et taille suffisante
         if (AudioNR::MathUtils::SIMDIntegration::isSIMDAccelerationEnabled() && frameCount >= 64) {
@@ -805,8 +2029,10 @@ bool EffectManager::processAudio_SIMD(const float* input, float* output, size_t
                     const_cast<float*>(input), frameCount * channels, masterInputLevel_.load());
             }
 
-            // Traitement de la chaîne d'effets
-            effectChain_.processMono_SIMD(input, output, frameCount * channels);
+            // Traitement du graphe d'effets (désentrelacement par blocs si stéréo)
+            if (!processAudio(input, output, frameCount, channels)) {
+                return false;
+            }
 
             // Post-traitement SIMD
             if (masterOutputLevel_.load() != 1.0f) {
@@ -847,26 +2073,6 @@ bool EffectManager::processAudioStereo_SIMD(const float* inputL, const float* in
         return true;
     }
 
-    std::lock_guard<std::mutex> lock(effectsMutex_);
-
-    if (activeEffects_.empty() || idToChainEffect_.empty()) {
-        if (inputL != outputL) {
-            if (AudioNR::MathUtils::SIMDIntegration::isSIMDAccelerationEnabled() && frameCount >= 64) {
-                std::memcpy(outputL, inputL, frameCount * sizeof(float));
-            } else {
-                std::copy(inputL, inputL + frameCount, outputL);
-            }
-        }
-        if (inputR != outputR) {
-            if (AudioNR::MathUtils::SIMDIntegration::isSIMDAccelerationEnabled() && frameCount >= 64) {
-                std::memcpy(outputR, inputR, frameCount * sizeof(float));
-            } else {
-                std::copy(inputR, inputR + frameCount, outputR);
-            }
-        }
-        return true;
-    }
-
     try {
         // Utiliser SIMD si disponible et taille suffisante
         if (AudioNR::MathUtils::SIMDIntegration::isSIMDAccelerationEnabled() && frameCount >= 64) {
@@ -878,8 +2084,8 @@ bool EffectManager::processAudioStereo_SIMD(const float* inputL, const float* in
                     const_cast<float*>(inputR), frameCount, masterInputLevel_.load());
             }
 
-            // Traitement de la chaîne d'effets stéréo SIMD
-            effectChain_.processStereo_SIMD(inputL, inputR, outputL, outputR, frameCount);
+            // Traitement du graphe d'effets stéréo
+            effectGraph_.processStereo(inputL, inputR, outputL, outputR, frameCount);
 
             // Post-traitement SIMD
             if (masterOutputLevel_.load() != 1.0f) {
@@ -9,7 +9,7 @@
 
 #include "../../common/jsi/JSICallbackManager.h"
 #include "../components/EffectBase.hpp"
-#include "../components/EffectChain.hpp"
+#include "../components/EffectGraph.hpp"
 #include "../config/EffectsConfig.h"
 #include "../config/EffectsLimits.h"
 #include "../../common/SIMD/SIMDIntegration.hpp"
@@ -72,6 +72,8 @@ public:
     };
 
     ProcessingMetrics getMetrics() const;
+    // Thread de contrôle : transmet les métriques au callback si de l'audio a été traité depuis le dernier envoi
+    void dispatchMetrics();
 
     // === Informations ===
     std::string getInfo() const;
@@ -87,9 +89,17 @@ public:
     // === Paramètres spécifiques aux effets ===
     jsi::Object getCompressorParameters(jsi::Runtime& rt, int effectId) const;
     jsi::Object getDelayParameters(jsi::Runtime& rt, int effectId) const;
+    jsi::Object getReverbParameters(jsi::Runtime& rt, int effectId) const;
     bool setCompressorParameters(int effectId, float thresholdDb, float ratio, float attackMs, float releaseMs, float makeupDb);
     bool setDelayParameters(int effectId, float delayMs, float feedback, float mix);
 
+    // === Automation à l'échantillon près ===
+    // Change le paramètre nommé (ex. "makeupDb", "mix") à la position sampleTime de getSamplePosition()
+    // (< 0 : au prochain bloc). Les événements d'un effet s'appliquent dans l'ordre d'envoi.
+    // Effets à bandes : chemins de la configuration ("bands[1].ratio", "crossovers[0]").
+    bool scheduleEffectParameter(int effectId, const std::string& name, float value, int64_t sampleTime);
+    uint64_t getSamplePosition() const;
+
     // === Conversion string ↔ enum ===
     std::string effectTypeToString(EffectType type) const;
     std::string effectStateToString(EffectState state) const;
@@ -116,31 +126,36 @@ private:
     std::atomic<int> nextEffectId_{1};
     std::map<int, std::unique_ptr<Nyth::Audio::FX::IAudioEffect>> activeEffects_;
     std::map<int, Nyth::Audio::FX::IAudioEffect*> idToChainEffect_;
+    std::map<int, Nyth::Audio::FX::GraphNodeId> idToNode_;
+    std::vector<int> chainOrder_; // ordre de création = ordre de traitement en série
 
     // === Niveaux maître ===
     std::atomic<float> masterInputLevel_{1.0f};
     std::atomic<float> masterOutputLevel_{1.0f};
 
-    // === Métriques ===
-    mutable std::mutex metricsMutex_;
-    ProcessingMetrics currentMetrics_;
+    // === Métriques (compteurs écrits par le thread audio, lus sans verrou) ===
+    std::atomic<uint64_t> processedFrames_{0};
+    std::atomic<uint64_t> processedSamples_{0};
+    std::atomic<size_t> activeEffectsCount_{0}; // tenu à jour par createEffect() / destroyEffect()
+    std::atomic<uint64_t> dispatchedFrames_{0};  // dernier envoi de dispatchMetrics()
 
     // === Callbacks ===
     ProcessingCallback processingCallback_;
     EffectCallback effectCallback_;
 
-    // === Chaîne d'effets ===
-    Nyth::Audio::FX::EffectChain effectChain_;
-
-    // === Buffers de travail ===
-    std::vector<float> workBufferL_;
-    std::vector<float> workBufferR_;
+    // === Graphe d'effets (plan d'exécution publié sans verrou au thread audio) ===
+    Nyth::Audio::FX::EffectGraph effectGraph_;
 
     // === Méthodes privées ===
     bool validateEffectType(EffectType type) const;
+    bool applyEffectConfig(jsi::Runtime& rt, int effectId, const jsi::Object& config);
+    bool replaceChainEffect(int effectId, std::unique_ptr<Nyth::Audio::FX::IAudioEffect> effect);
+    bool rebuildRouting();
+    bool resolveParameterId(const Nyth::Audio::FX::IAudioEffect* effect, const std::string& name,
+                            uint32_t& paramId) const;
     std::unique_ptr<Nyth::Audio::FX::IAudioEffect> createEffectByType(EffectType type);
-    void updateMetrics();
-    void notifyProcessingCallback();
+    void updateMetrics(size_t frameCount, int channels) noexcept;
+    void notifyProcessingCallback(const ProcessingMetrics& metrics);
     void notifyEffectCallback(int effectId, const std::string& event);
     EffectType stringToEffectType(const std::string& typeStr) const;
     std::string effectTypeToString(EffectType type) const;
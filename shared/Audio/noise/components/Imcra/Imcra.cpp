@@ -1,68 +1,81 @@
-#include "IMCRA.hpp"
+#include "Imcra.hpp"
+#include "../../../common/config/NoiseConstants.hpp"
+#include "../../../common/dsp/VectorMath.hpp"
 #include <algorithm>
 #include <cmath>
+#include <new>
 #include <stdexcept>
 #include <vector>
 
 namespace AudioNR {
 
-IMCRA::IMCRA(const Config& cfg) : cfg_(cfg), frameCount_(0), subwc_(0) {
-    numBins_ = cfg_.fftSize / 2 + 1;
+namespace VectorMath = Nyth::Audio::FX::VectorMath;
+
+namespace {
+constexpr float ONE = static_cast<float>(IMCRAConstants::UNITY_VALUE);
+constexpr float ZERO = static_cast<float>(IMCRAConstants::ZERO_VALUE);
+constexpr size_t ROW_ALIGNMENT_FLOATS = IMCRAConstants::STATE_ALIGNMENT / sizeof(float);
+} // namespace
 
-    // Initialize all vectors
-    S_.resize(numBins_, IMCRAConstants::ZERO_VALUE);
-    Smin_.resize(numBins_, IMCRAConstants::INITIAL_MINIMUM_VALUE);
-    Stmp_.resize(numBins_, IMCRAConstants::INITIAL_MINIMUM_VALUE);
-    lambda_d_.resize(numBins_, IMCRAConstants::ZERO_VALUE);
+void IMCRA::AlignedDelete::operator()(float* block) const noexcept {
+    ::operator delete[](block, std::align_val_t(IMCRAConstants::STATE_ALIGNMENT));
+}
 
-    xi_.resize(numBins_, IMCRAConstants::INITIAL_SNR_VALUE);
-    gamma_.resize(numBins_, IMCRAConstants::INITIAL_SNR_VALUE);
-    GH1_.resize(numBins_, IMCRAConstants::INITIAL_GAIN);
+IMCRA::IMCRA(const Config& cfg) : cfg_(cfg) {
+    allocateState();
+}
 
-    q_.resize(numBins_, IMCRAConstants::INITIAL_PROBABILITY);
-    p_.resize(numBins_, IMCRAConstants::INITIAL_PROBABILITY);
+IMCRA::IMCRA() : IMCRA(Config{}) {}
 
-    b_.resize(numBins_, IMCRAConstants::INITIAL_BIAS_FACTOR);
-    Bmin_.resize(numBins_, IMCRAConstants::INITIAL_BIAS_FACTOR);
-    lmin_flag_.resize(numBins_, 0);
+IMCRA::~IMCRA() = default;
 
-    // Initialize sub-window minima tracking
-    size_t numSubWindows = cfg_.windowLength / cfg_.subWindowLength;
-    Smin_sw_.resize(numSubWindows);
-    for (auto& sw : Smin_sw_) {
-        sw.resize(numBins_, IMCRAConstants::INITIAL_MINIMUM_VALUE);
+void IMCRA::allocateState() {
+    if (cfg_.subWindowLength == 0 || cfg_.windowLength < cfg_.subWindowLength) {
+        throw std::invalid_argument("IMCRA window must hold at least one sub-window");
     }
-    Smin_sw_idx_.resize(numBins_, 0);
-}
+    numBins_ = cfg_.fftSize / 2 + 1;
+    stride_ = (numBins_ + ROW_ALIGNMENT_FLOATS - 1) / ROW_ALIGNMENT_FLOATS * ROW_ALIGNMENT_FLOATS;
+    numSubWindows_ = cfg_.windowLength / cfg_.subWindowLength;
 
-IMCRA::~IMCRA() = default;
+    const size_t count = (NUM_ROWS + numSubWindows_) * stride_;
+    state_.reset(static_cast<float*>(
+        ::operator new[](count * sizeof(float), std::align_val_t(IMCRAConstants::STATE_ALIGNMENT))));
+    reset();
+}
 
 void IMCRA::reset() {
     frameCount_ = 0;
     subwc_ = 0;
-
-    std::fill(S_.begin(), S_.end(), IMCRAConstants::ZERO_VALUE);
-    std::fill(Smin_.begin(), Smin_.end(), IMCRAConstants::INITIAL_MINIMUM_VALUE);
-    std::fill(Stmp_.begin(), Stmp_.end(), IMCRAConstants::INITIAL_MINIMUM_VALUE);
-    std::fill(lambda_d_.begin(), lambda_d_.end(), IMCRAConstants::ZERO_VALUE);
-    std::fill(xi_.begin(), xi_.end(), IMCRAConstants::INITIAL_SNR_VALUE);
-    std::fill(gamma_.begin(), gamma_.end(), IMCRAConstants::INITIAL_SNR_VALUE);
-    std::fill(GH1_.begin(), GH1_.end(), IMCRAConstants::INITIAL_GAIN);
-    std::fill(q_.begin(), q_.end(), IMCRAConstants::INITIAL_PROBABILITY);
-    std::fill(p_.begin(), p_.end(), IMCRAConstants::INITIAL_PROBABILITY);
-    std::fill(b_.begin(), b_.end(), IMCRAConstants::INITIAL_BIAS_FACTOR);
-    std::fill(Bmin_.begin(), Bmin_.end(), IMCRAConstants::INITIAL_BIAS_FACTOR);
-    std::fill(lmin_flag_.begin(), lmin_flag_.end(), 0);
-
-    for (auto& sw : Smin_sw_) {
-        std::fill(sw.begin(), sw.end(), IMCRAConstants::INITIAL_MINIMUM_VALUE);
-    }
-    std::fill(Smin_sw_idx_.begin(), Smin_sw_idx_.end(), 0);
+    voiceActive_ = false;
+
+    // Remplissage de lignes entières (padding compris) : le bloc reste défini
+    const auto fillRow = [this](Row r, double value) {
+        std::fill_n(row(r), stride_, static_cast<float>(value));
+    };
+    fillRow(POWER, IMCRAConstants::ZERO_VALUE);
+    fillRow(S, IMCRAConstants::ZERO_VALUE);
+    fillRow(SMIN, IMCRAConstants::INITIAL_MINIMUM_VALUE);
+    fillRow(STMP, IMCRAConstants::INITIAL_MINIMUM_VALUE);
+    fillRow(LAMBDA_D, IMCRAConstants::ZERO_VALUE);
+    fillRow(XI, IMCRAConstants::INITIAL_SNR_VALUE);
+    fillRow(GAMMA, IMCRAConstants::INITIAL_SNR_VALUE);
+    fillRow(GH1, IMCRAConstants::INITIAL_GAIN);
+    fillRow(P, IMCRAConstants::INITIAL_PROBABILITY);
+    fillRow(B, IMCRAConstants::INITIAL_BIAS_FACTOR);
+    fillRow(LMIN_COUNT, IMCRAConstants::ZERO_VALUE);
+    fillRow(SCRATCH, IMCRAConstants::ZERO_VALUE);
+    std::fill_n(subWindow(0), numSubWindows_ * stride_, static_cast<float>(IMCRAConstants::INITIAL_MINIMUM_VALUE));
 }
 
 void IMCRA::setConfig(const Config& cfg) {
+    const bool resize = cfg.fftSize != cfg_.fftSize || cfg.windowLength != cfg_.windowLength ||
+                        cfg.subWindowLength != cfg_.subWindowLength;
     cfg_ = cfg;
-    reset();
+    if (resize) {
+        allocateState();
+    } else {
+        reset();
+    }
 }
 
 void IMCRA::processFrame(const std::vector<float>& magnitudeSpectrum, std::vector<float>& noiseSpectrum,
@@ -74,173 +87,252 @@ void IMCRA::processFrame(const std::vector<float>& magnitudeSpectrum, std::vecto
     // Ensure output vectors are properly sized
     noiseSpectrum.resize(numBins_);
     speechProbability.resize(numBins_);
+    processFrame(magnitudeSpectrum.data(), noiseSpectrum.data(), speechProbability.data());
+}
+
+void IMCRA::processFrame(const float* magnitudeSpectrum, float* noiseSpectrum, float* speechProbability) {
+    if (!magnitudeSpectrum || !noiseSpectrum || !speechProbability) {
+        throw std::invalid_argument("Spectrum buffers must not be null");
+    }
+
+    // |Y|² une fois pour toutes les passes
+    float* power = row(POWER);
+    for (size_t k = 0; k < numBins_; ++k) {
+        power[k] = magnitudeSpectrum[k] * magnitudeSpectrum[k];
+    }
 
     // Update minimum statistics
-    updateMinimumStatistics(magnitudeSpectrum);
+    updateMinimumStatistics();
 
     // Update a priori and a posteriori SNR
-    updateAPrioriSNR(magnitudeSpectrum);
+    updateAPrioriSNR();
 
     // Update speech presence probability
     updateSpeechPresenceProbability();
 
     // Update noise spectrum estimate using IMCRA rule
-    for (size_t k = 0; k < numBins_; ++k) {
-        float Y2 = magnitudeSpectrum[k] * magnitudeSpectrum[k];
-
-        // IMCRA noise update rule with speech presence probability
-        float alpha_d_tilde = cfg_.alphaD + (IMCRAConstants::UNITY_VALUE - cfg_.alphaD) * p_[k];
-
-        // Update noise PSD estimate
-        lambda_d_[k] = alpha_d_tilde * lambda_d_[k] + (IMCRAConstants::UNITY_VALUE - alpha_d_tilde) * Y2;
-
-        // Apply bias correction
-        lambda_d_[k] = b_[k] * lambda_d_[k];
-
-        // Output results
-        noiseSpectrum[k] = std::sqrt(lambda_d_[k]);
-        speechProbability[k] = p_[k];
-    }
+    updateNoiseEstimate(noiseSpectrum, speechProbability);
 
     frameCount_++;
 }
 
-void IMCRA::updateMinimumStatistics(const std::vector<float>& magnitude) {
-    // Smooth power spectrum
-    for (size_t k = 0; k < numBins_; ++k) {
-        float Y2 = magnitude[k] * magnitude[k];
-
-        if (frameCount_ == 0) {
-            S_[k] = Y2;
-            Smin_[k] = Y2;
-            Stmp_[k] = Y2;
-            lambda_d_[k] = Y2;
-        } else {
-            S_[k] = cfg_.alphaS * S_[k] + (IMCRAConstants::UNITY_VALUE - cfg_.alphaS) * Y2;
+void IMCRA::updateMinimumStatistics() {
+    const float* power = row(POWER);
+    float* smoothed = row(S);
+    float* temporary = row(STMP);
+    const bool boundary = frameCount_ % cfg_.subWindowLength == 0;
+
+    if (frameCount_ == 0) {
+        std::copy_n(power, numBins_, smoothed);
+        std::copy_n(power, numBins_, row(SMIN));
+        std::copy_n(power, numBins_, temporary);
+        std::copy_n(power, numBins_, row(LAMBDA_D));
+    } else {
+        // Lissage de |Y|², fusionné avec le minimum du sous-bloc hors frontière
+        const float alpha = static_cast<float>(cfg_.alphaS);
+        const float complement = static_cast<float>(IMCRAConstants::UNITY_VALUE - cfg_.alphaS);
+        const size_t tracked = boundary ? 0 : numBins_;
+        size_t k = 0;
+#if defined(NYTH_VECTOR_MATH_NEON)
+        const float32x4_t a = vdupq_n_f32(alpha);
+        const float32x4_t c = vdupq_n_f32(complement);
+        for (; k + 4 <= tracked; k += 4) {
+            const float32x4_t s = vmlaq_f32(vmulq_f32(c, vld1q_f32(power + k)), a, vld1q_f32(smoothed + k));
+            vst1q_f32(smoothed + k, s);
+            vst1q_f32(temporary + k, vminq_f32(vld1q_f32(temporary + k), s));
+        }
+#elif defined(NYTH_VECTOR_MATH_SSE2)
+        const __m128 a = _mm_set1_ps(alpha);
+        const __m128 c = _mm_set1_ps(complement);
+        for (; k + 4 <= tracked; k += 4) {
+            const __m128 s =
+                _mm_add_ps(_mm_mul_ps(a, _mm_load_ps(smoothed + k)), _mm_mul_ps(c, _mm_load_ps(power + k)));
+            _mm_store_ps(smoothed + k, s);
+            _mm_store_ps(temporary + k, _mm_min_ps(_mm_load_ps(temporary + k), s));
+        }
+#endif
+        for (; k < tracked; ++k) {
+            smoothed[k] = alpha * smoothed[k] + complement * power[k];
+            temporary[k] = std::min(temporary[k], smoothed[k]);
+        }
+        for (; k < numBins_; ++k) {
+            smoothed[k] = alpha * smoothed[k] + complement * power[k];
         }
     }
 
     // Update minimum tracking every subWindowLength frames
-    if (frameCount_ % cfg_.subWindowLength == 0) {
-        size_t sw_idx = subwc_ % Smin_sw_.size();
+    if (boundary) {
+        trackMinima();
+    }
+}
 
-        for (size_t k = 0; k < numBins_; ++k) {
-            // Store current minimum in sub-window buffer
-            Smin_sw_[sw_idx][k] = Stmp_[k];
-            Stmp_[k] = S_[k]; // Reset temporary minimum
-
-            // Find minimum across all sub-windows
-            float min_val = IMCRAConstants::INITIAL_MINIMUM_VALUE;
-            for (const auto& sw : Smin_sw_) {
-                if (sw[k] < min_val) {
-                    min_val = sw[k];
-                }
-            }
-
-            // Update global minimum with bias compensation
-            if (min_val < Smin_[k]) {
-                Smin_[k] = min_val;
-                lmin_flag_[k] = 0; // Reset flag when minimum is updated
-            } else {
-                lmin_flag_[k]++;
-            }
-
-            // Bias correction factor based on how long since last minimum update
-            if (lmin_flag_[k] > 0) {
-                float gamma_inv =
-                    IMCRAConstants::UNITY_VALUE /
-                    (IMCRAConstants::UNITY_VALUE + (lmin_flag_[k] - 1) * IMCRAConstants::BIAS_CORRECTION_STEP);
-                b_[k] = IMCRAConstants::UNITY_VALUE +
-                        (IMCRAConstants::UNITY_VALUE - gamma_inv) * IMCRAConstants::BIAS_CORRECTION_FACTOR;
-            } else {
-                b_[k] = IMCRAConstants::UNITY_VALUE;
-            }
-
-            // Ensure bias factor doesn't exceed maximum
-            b_[k] = min(b_[k], IMCRAConstants::UNITY_VALUE / cfg_.betaMax);
+void IMCRA::trackMinima() {
+    float* smoothed = row(S);
+    float* temporary = row(STMP);
+    float* minimum = row(SMIN);
+    float* count = row(LMIN_COUNT);
+    float* bias = row(B);
+    float* windowMin = row(SCRATCH);
+
+    // Minimum du sous-bloc écoulé rangé dans son anneau, nouveau sous-bloc à partir de S
+    std::copy_n(temporary, numBins_, subWindow(subwc_ % numSubWindows_));
+    std::copy_n(smoothed, numBins_, temporary);
+
+    // Minimum sur la fenêtre : réduction ligne à ligne, contiguë
+    std::fill_n(windowMin, numBins_, static_cast<float>(IMCRAConstants::INITIAL_MINIMUM_VALUE));
+    for (size_t w = 0; w < numSubWindows_; ++w) {
+        const float* minima = subWindow(w);
+        size_t k = 0;
+#if defined(NYTH_VECTOR_MATH_NEON)
+        for (; k + 4 <= numBins_; k += 4) {
+            vst1q_f32(windowMin + k, vminq_f32(vld1q_f32(windowMin + k), vld1q_f32(minima + k)));
         }
-
-        subwc_++;
-    } else {
-        // Update temporary minimum within sub-window
-        for (size_t k = 0; k < numBins_; ++k) {
-            if (S_[k] < Stmp_[k]) {
-                Stmp_[k] = S_[k];
-            }
+#elif defined(NYTH_VECTOR_MATH_SSE2)
+        for (; k + 4 <= numBins_; k += 4) {
+            _mm_store_ps(windowMin + k, _mm_min_ps(_mm_load_ps(windowMin + k), _mm_load_ps(minima + k)));
+        }
+#endif
+        for (; k < numBins_; ++k) {
+            windowMin[k] = std::min(windowMin[k], minima[k]);
         }
     }
+
+    // Minimum global (décroissant), compteur de sous-blocs depuis sa mise à jour, biais
+    // b = 1 + (1 - 1 / (1 + (n - 1) step)) factor pour n > 0, sinon 1, borné à 1 / betaMax
+    const float step = static_cast<float>(IMCRAConstants::BIAS_CORRECTION_STEP);
+    const float factor = static_cast<float>(IMCRAConstants::BIAS_CORRECTION_FACTOR);
+    const float maxBias = static_cast<float>(IMCRAConstants::UNITY_VALUE / cfg_.betaMax);
+    size_t k = 0;
+#if defined(NYTH_VECTOR_MATH_NEON)
+    const float32x4_t one = vdupq_n_f32(ONE);
+    const float32x4_t zero = vdupq_n_f32(ZERO);
+    const float32x4_t stepVec = vdupq_n_f32(step);
+    const float32x4_t factorVec = vdupq_n_f32(factor);
+    const float32x4_t maxBiasVec = vdupq_n_f32(maxBias);
+    for (; k + 4 <= numBins_; k += 4) {
+        const float32x4_t candidate = vld1q_f32(windowMin + k);
+        const float32x4_t current = vld1q_f32(minimum + k);
+        const uint32x4_t updated = vcltq_f32(candidate, current);
+        vst1q_f32(minimum + k, vminq_f32(candidate, current));
+        const float32x4_t n = vbslq_f32(updated, zero, vaddq_f32(vld1q_f32(count + k), one));
+        vst1q_f32(count + k, n);
+        // 1 / (1 + (n - 1) step) : estimation + deux itérations de Newton (pas de vdivq sur ARMv7)
+        const float32x4_t den = vmlaq_f32(one, vsubq_f32(n, one), stepVec);
+        float32x4_t inv = vrecpeq_f32(den);
+        inv = vmulq_f32(inv, vrecpsq_f32(den, inv));
+        inv = vmulq_f32(inv, vrecpsq_f32(den, inv));
+        const float32x4_t b = vmlaq_f32(one, vsubq_f32(one, inv), factorVec);
+        vst1q_f32(bias + k, vminq_f32(vbslq_f32(vcgtq_f32(n, zero), b, one), maxBiasVec));
+    }
+#elif defined(NYTH_VECTOR_MATH_SSE2)
+    const __m128 one = _mm_set1_ps(ONE);
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 stepVec = _mm_set1_ps(step);
+    const __m128 factorVec = _mm_set1_ps(factor);
+    const __m128 maxBiasVec = _mm_set1_ps(maxBias);
+    for (; k + 4 <= numBins_; k += 4) {
+        const __m128 candidate = _mm_load_ps(windowMin + k);
+        const __m128 current = _mm_load_ps(minimum + k);
+        const __m128 updated = _mm_cmplt_ps(candidate, current);
+        _mm_store_ps(minimum + k, _mm_min_ps(candidate, current));
+        const __m128 n = _mm_andnot_ps(updated, _mm_add_ps(_mm_load_ps(count + k), one));
+        _mm_store_ps(count + k, n);
+        const __m128 den = _mm_add_ps(one, _mm_mul_ps(_mm_sub_ps(n, one), stepVec));
+        const __m128 b = _mm_add_ps(one, _mm_mul_ps(_mm_sub_ps(one, _mm_div_ps(one, den)), factorVec));
+        const __m128 positive = _mm_cmpgt_ps(n, zero);
+        const __m128 selected = _mm_or_ps(_mm_and_ps(positive, b), _mm_andnot_ps(positive, one));
+        _mm_store_ps(bias + k, _mm_min_ps(selected, maxBiasVec));
+    }
+#endif
+    for (; k < numBins_; ++k) {
+        const bool updated = windowMin[k] < minimum[k];
+        minimum[k] = std::min(windowMin[k], minimum[k]);
+        const float n = updated ? ZERO : count[k] + ONE;
+        count[k] = n;
+        const float b = ONE + (ONE - ONE / (ONE + (n - ONE) * step)) * factor;
+        bias[k] = std::min(n > ZERO ? b : ONE, maxBias);
+    }
+
+    subwc_++;
 }
 
-void IMCRA::updateAPrioriSNR(const std::vector<float>& magnitude) {
-    float xiOpt = std::pow(IMCRAConstants::DB_TO_LINEAR_FACTOR, cfg_.xiOptDb / IMCRAConstants::DB_TO_LINEAR_DIVISOR);
+void IMCRA::updateAPrioriSNR() {
+    const float* __restrict power = row(POWER);
+    const float* __restrict noise = row(LAMBDA_D);
+    float* __restrict gamma = row(GAMMA);
+    float* __restrict xi = row(XI);
+    float* __restrict gain = row(GH1);
+    const float alpha = static_cast<float>(cfg_.alphaD2);
+    const float complement = static_cast<float>(IMCRAConstants::UNITY_VALUE - cfg_.alphaD2);
+    const float xiMin = static_cast<float>(cfg_.xiMin);
+    const float gMin = static_cast<float>(cfg_.gMin);
+    const float protection = static_cast<float>(IMCRAConstants::MIN_SNR_PROTECTION);
 
     for (size_t k = 0; k < numBins_; ++k) {
-        float Y2 = magnitude[k] * magnitude[k];
-
         // A posteriori SNR
-        gamma_[k] = Y2 / max(lambda_d_[k], IMCRAConstants::MIN_SNR_PROTECTION);
-
-        // Decision-directed a priori SNR estimation
-        float xiDD = cfg_.alphaD2 * GH1_[k] * GH1_[k] * gamma_[k];
-
-        // Constraint on a priori SNR
-        float xiML = max(gamma_[k] - IMCRAConstants::UNITY_VALUE, IMCRAConstants::ZERO_VALUE);
-        xi_[k] = xiDD + (IMCRAConstants::UNITY_VALUE - cfg_.alphaD2) * xiML;
+        const float g = power[k] / std::max(noise[k], protection);
+        gamma[k] = g;
 
-        // Apply minimum constraint
-        xi_[k] = max(xi_[k], cfg_.xiMin);
+        // Decision-directed a priori SNR (gain of the previous frame), floored
+        const float x = std::max(alpha * gain[k] * gain[k] * g + complement * std::max(g - ONE, ZERO), xiMin);
+        xi[k] = x;
 
-        // Compute gain function for next iteration (Wiener filter)
-        GH1_[k] = xi_[k] / (IMCRAConstants::UNITY_VALUE + xi_[k]);
-
-        // Apply minimum gain constraint
-        GH1_[k] = max(GH1_[k], cfg_.gMin);
+        // Wiener gain for the next frame
+        gain[k] = std::max(x / (ONE + x), gMin);
     }
 }
 
 void IMCRA::updateSpeechPresenceProbability() {
+    const float* __restrict smoothed = row(S);
+    const float* __restrict minimum = row(SMIN);
+    const float* __restrict gamma = row(GAMMA);
+    const float* __restrict xi = row(XI);
+    float* __restrict exponent = row(SCRATCH);
+    float* __restrict presence = row(P);
+    const float bmin = static_cast<float>(IMCRAConstants::INITIAL_BIAS_FACTOR);
+    const float protection = static_cast<float>(IMCRAConstants::MIN_SNR_PROTECTION);
+    const float maxRatio = static_cast<float>(IMCRAConstants::MAX_LIKELIHOOD_RATIO);
+    const float log2e = static_cast<float>(IMCRAConstants::LOG2_E);
+
+    // Local a posteriori / a priori SNR, log du rapport de vraisemblance en base 2
     for (size_t k = 0; k < numBins_; ++k) {
-        // Local a posteriori SNR for speech presence detection
-        float gamma_min = S_[k] / (Bmin_[k] * Smin_[k]);
-        float xi_local = IMCRAConstants::ZERO_VALUE;
-
-        // Compute local a priori SNR
-        if (gamma_min > IMCRAConstants::UNITY_VALUE) {
-            xi_local = (gamma_min - IMCRAConstants::UNITY_VALUE);
-        }
-
-        // Speech presence likelihood ratio
-        float log_xi_gamma = xi_local * gamma_min / (IMCRAConstants::UNITY_VALUE + xi_local);
-        float likelihood_ratio = std::exp(min(log_xi_gamma, IMCRAConstants::MAX_LIKELIHOOD_RATIO));
-
-        // Update speech absence probability with constraints
-        float q_tmp = IMCRAConstants::UNITY_VALUE / (IMCRAConstants::UNITY_VALUE + likelihood_ratio);
-        q_[k] = clamp(q_tmp, cfg_.qMin, cfg_.qMax);
-
-        // Convert to speech presence probability
-        p_[k] = IMCRAConstants::UNITY_VALUE - q_[k];
-
-        // Additional decision based on global SNR criteria
-        if (gamma_[k] > cfg_.gamma0 && xi_[k] > cfg_.zeta0) {
-            p_[k] = IMCRAConstants::UNITY_VALUE; // Strong speech presence
-        } else if (gamma_[k] < cfg_.gamma1) {
-            p_[k] = IMCRAConstants::ZERO_VALUE; // Strong noise presence
-        }
+        const float gammaMin = smoothed[k] / std::max(bmin * minimum[k], protection);
+        const float xiLocal = std::max(gammaMin - ONE, ZERO);
+        exponent[k] = std::min(xiLocal * gammaMin / (ONE + xiLocal), maxRatio) * log2e;
+    }
+    VectorMath::exp2(exponent, exponent, numBins_);
+
+    // q = 1 / (1 + LR) borné, p = 1 - q, puis décisions franches sur les SNR globaux
+    const float qMin = static_cast<float>(cfg_.qMin);
+    const float qMax = static_cast<float>(cfg_.qMax);
+    const float gamma0 = static_cast<float>(cfg_.gamma0);
+    const float gamma1 = static_cast<float>(cfg_.gamma1);
+    const float zeta0 = static_cast<float>(cfg_.zeta0);
+    for (size_t k = 0; k < numBins_; ++k) {
+        const float q = std::min(std::max(ONE / (ONE + exponent[k]), qMin), qMax);
+        const float p = gamma[k] < gamma1 ? ZERO : ONE - q;
+        presence[k] = (gamma[k] > gamma0 && xi[k] > zeta0) ? ONE : p;
     }
 }
 
-float IMCRA::computeSpeechProbability(float gammak, float xik) {
-    // Compute speech presence probability based on generalized likelihood ratio
-    float vk = xik * gammak / (IMCRAConstants::UNITY_VALUE + xik);
-    float lambda = std::exp(-vk);
-
-    // Compute exponential integral E1(vk) using approximation
-    float ei = MathUtils::expint(vk);
-
-    // Speech presence probability
-    float pk = lambda * (IMCRAConstants::UNITY_VALUE + vk) * ei;
+void IMCRA::updateNoiseEstimate(float* noiseSpectrum, float* speechProbability) {
+    const float* __restrict power = row(POWER);
+    const float* __restrict presence = row(P);
+    const float* __restrict bias = row(B);
+    float* __restrict noise = row(LAMBDA_D);
+    const float alpha = static_cast<float>(cfg_.alphaD);
+    const float complement = static_cast<float>(IMCRAConstants::UNITY_VALUE - cfg_.alphaD);
 
-    return clamp(pk, IMCRAConstants::ZERO_VALUE, IMCRAConstants::UNITY_VALUE);
+    // VAD externe actif : λd tenu, seule la première trame l'initialise
+    if (!voiceActive_ || frameCount_ == 0) {
+        for (size_t k = 0; k < numBins_; ++k) {
+            // Lissage piloté par la présence de parole, puis correction de biais
+            const float alphaTilde = alpha + complement * presence[k];
+            noise[k] = bias[k] * (alphaTilde * noise[k] + (ONE - alphaTilde) * power[k]);
+        }
+    }
+    VectorMath::sqrt(noise, noiseSpectrum, numBins_);
+    std::copy_n(presence, numBins_, speechProbability);
 }
 
 } // namespace AudioNR
@@ -2,7 +2,9 @@
 
 #ifdef __cplusplus
 
+#include <cstddef>
 #include <cstdint>
+#include <memory>
 #include <vector>
 
 
@@ -21,6 +23,15 @@ namespace AudioNR {
  * - Bias compensation for noise overestimation
  * - Adaptive smoothing parameters
  * - Minimum statistics tracking with bias correction
+ *
+ * State layout: structure of arrays in a single aligned block. Each per-bin
+ * quantity is one row of stride_ floats (numBins rounded up to a cache
+ * line), followed by the numSubWindows sub-window minima rows, so a frame
+ * update walks a few contiguous rows and never chases a pointer. Every
+ * per-bin loop is branch-free: minimum tracking and its bias correction use
+ * min / compare / select intrinsics (SSE2 or NEON, scalar tail), the other
+ * passes are plain min / max / select loops the compiler vectorizes, with
+ * block exp2 / sqrt from VectorMath.
  */
 class IMCRA {
 public:
@@ -51,7 +62,7 @@ public:
     };
 
     explicit IMCRA(const Config& cfg);
-    explicit IMCRA();
+    IMCRA();
     ~IMCRA();
 
     /**
@@ -63,20 +74,37 @@ public:
     void processFrame(const std::vector<float>& magnitudeSpectrum, std::vector<float>& noiseSpectrum,
                       std::vector<float>& speechProbability);
 
+    /**
+     * @brief Same update on raw arrays of getNumBins() values (no allocation)
+     */
+    void processFrame(const float* magnitudeSpectrum, float* noiseSpectrum, float* speechProbability);
+
     /**
      * @brief Get the a priori SNR estimate
-     * @return Vector of a priori SNR values per frequency bin
+     * @return getNumBins() a priori SNR values
      */
-    const std::vector<float>& getAPrioriSNR() const {
-        return xi_;
+    const float* getAPrioriSNR() const {
+        return row(XI);
     }
 
     /**
      * @brief Get the a posteriori SNR estimate
-     * @return Vector of a posteriori SNR values per frequency bin
+     * @return getNumBins() a posteriori SNR values
+     */
+    const float* getAPosterioriSNR() const {
+        return row(GAMMA);
+    }
+
+    size_t getNumBins() const {
+        return numBins_;
+    }
+
+    /**
+     * @brief External voice activity decision for the next frames
+     * @param active true to hold the noise estimate (minima tracking goes on)
      */
-    const std::vector<float>& getAPosterioriSNR() const {
-        return gamma_;
+    void setVoiceActivity(bool active) {
+        voiceActive_ = active;
     }
 
     /**
@@ -87,56 +115,58 @@ public:
     /**
      * @brief Update configuration
      * @param cfg New configuration
+     * @note Reallocates the state when fftSize or the window lengths change
      */
     void setConfig(const Config& cfg);
 
 private:
-    Config cfg_;
-    size_t numBins_;    ///< Number of frequency bins (fftSize/2 + 1)
-    size_t frameCount_; ///< Frame counter
-
-    // Spectral estimates
-    std::vector<float> S_;        ///< Smoothed power spectrum
-    std::vector<float> Smin_;     ///< Minimum power spectrum
-    std::vector<float> Stmp_;     ///< Temporary minimum for current window
-    std::vector<float> lambda_d_; ///< Noise power spectrum estimate
-
-    // SNR estimates
-    std::vector<float> xi_;    ///< A priori SNR
-    std::vector<float> gamma_; ///< A posteriori SNR
-    std::vector<float> GH1_;   ///< Gain function for hypothesis H1 (speech present)
-
-    // Speech presence probability
-    std::vector<float> q_; ///< Speech absence probability
-    std::vector<float> p_; ///< Speech presence probability
-
-    // Minimum tracking
-    std::vector<std::vector<float>> Smin_sw_; ///< Sub-window minima buffer
-    std::vector<size_t> Smin_sw_idx_;         ///< Sub-window index
-    size_t subwc_;                            ///< Sub-window counter
-
-    // Bias correction
-    std::vector<float> b_;          ///< Bias correction factor
-    std::vector<float> Bmin_;       ///< Minimum bias factor
-    std::vector<size_t> lmin_flag_; ///< Flag for minimum update
+    // Lignes de l'état SoA, dans l'ordre du bloc
+    enum Row : size_t {
+        POWER,      ///< |Y|² de la trame courante
+        S,          ///< Smoothed power spectrum
+        SMIN,       ///< Minimum power spectrum
+        STMP,       ///< Temporary minimum for current sub-window
+        LAMBDA_D,   ///< Noise power spectrum estimate
+        XI,         ///< A priori SNR
+        GAMMA,      ///< A posteriori SNR
+        GH1,        ///< Gain function for hypothesis H1 (speech present)
+        P,          ///< Speech presence probability
+        B,          ///< Bias correction factor
+        LMIN_COUNT, ///< Sub-windows since the last minimum update (float count)
+        SCRATCH,    ///< Minimum over sub-windows, exponent of the likelihood ratio
+        NUM_ROWS
+    };
 
-    // Helper functions
-    void updateMinimumStatistics(const std::vector<float>& magnitude);
-    void updateSpeechPresenceProbability();
-    void updateAPrioriSNR(const std::vector<float>& magnitude);
-    void computeGainFunction();
-    float computeSpeechProbability(float gammak, float xik);
+    struct AlignedDelete {
+        void operator()(float* block) const noexcept;
+    };
 
-    // Mathematical utilities are now in MathUtils.hpp
-    inline float max(float a, float b) {
-        return (a > b) ? a : b;
+    Config cfg_;
+    size_t numBins_ = 0;       ///< Number of frequency bins (fftSize/2 + 1)
+    size_t stride_ = 0;        ///< Row length in floats (cache-line multiple)
+    size_t numSubWindows_ = 0; ///< Rows of sub-window minima after NUM_ROWS
+    size_t frameCount_ = 0;    ///< Frame counter
+    size_t subwc_ = 0;         ///< Sub-window counter
+    bool voiceActive_ = false; ///< External VAD: noise estimate held
+    std::unique_ptr<float[], AlignedDelete> state_;
+
+    float* row(Row r) {
+        return state_.get() + static_cast<size_t>(r) * stride_;
     }
-    inline float min(float a, float b) {
-        return (a < b) ? a : b;
+    const float* row(Row r) const {
+        return state_.get() + static_cast<size_t>(r) * stride_;
     }
-    inline float clamp(float x, float lo, float hi) {
-        return min(max(x, lo), hi);
+    float* subWindow(size_t index) {
+        return state_.get() + (NUM_ROWS + index) * stride_;
     }
+
+    // Helper functions
+    void allocateState();
+    void updateMinimumStatistics();
+    void trackMinima();
+    void updateAPrioriSNR();
+    void updateSpeechPresenceProbability();
+    void updateNoiseEstimate(float* noiseSpectrum, float* speechProbability);
 };
 
 } // namespace AudioNR
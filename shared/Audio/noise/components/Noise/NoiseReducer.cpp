@@ -1,5 +1,5 @@
 #include "NoiseReducer.hpp"
-#include "../../common/config/NoiseContants.hpp"
+#include "../../../common/dsp/VectorMath.hpp"
 #include <algorithm>
 #include <cmath>
 #include <memory>
@@ -26,6 +26,10 @@ NoiseReducer::NoiseReducer(uint32_t sampleRate, int numChannels) : sampleRate_(s
         channels_ = MAX_CHANNELS;
 
     ch_.resize(static_cast<size_t>(channels_));
+    for (auto& st : ch_) {
+        st.env.reset(static_cast<float>(INITIAL_ENVELOPE));
+        st.gain.reset(static_cast<float>(INITIAL_GAIN));
+    }
     ensureFilters();
     updateDerived();
 }
@@ -99,6 +103,11 @@ void NoiseReducer::updateDerived() {
     // This avoids repeated calculations in the process loop
     expansionSlope_ = UNITY_RECIPROCAL / config_.ratio;
     threshLin2_ = threshLin_ * threshLin_; // For faster comparison
+
+    for (auto& st : ch_) {
+        st.env.setCoefficients(static_cast<float>(attackCoeffEnv_), static_cast<float>(releaseCoeffEnv_));
+        st.gain.setCoefficients(static_cast<float>(attackCoeffGain_), static_cast<float>(releaseCoeffGain_));
+    }
 }
 
 void NoiseReducer::ensureFilters() {
@@ -161,40 +170,33 @@ void NoiseReducer::processChannel(const float* in, float* out, size_t n, Channel
         std::copy_n(in, n, out);
     }
 
-    // Envelope follower and expander gain using C++17 loop
+    // Envelope follower and expander gain, one detector sub-block at a time
     // Simple RMS-like envelope using absolute value smoothing (fast, low cost)
-    for (size_t i = 0; i < n; ++i) {
-        double x = static_cast<double>(out[i]);
-        double ax = std::abs(x);
-        // Envelope
-        if (ax > st.env)
-            st.env = attackCoeffEnv_ * st.env + (UNITY_GAIN - attackCoeffEnv_) * ax;
-        else
-            st.env = releaseCoeffEnv_ * st.env + (UNITY_GAIN - releaseCoeffEnv_) * ax;
-
-        // Compute static curve for downward expander
-        double gTarget = UNITY_GAIN;
-        if (st.env < threshLin_) {
-            // Below threshold: apply expansion
-            // Simplified calculation using pre-computed values
-            double ratio = st.env / threshLin_;
-
-            // Apply expansion curve: output = input^(1/ratio)
-            // This gives a smooth transition at the threshold
-            gTarget = std::pow(ratio, expansionSlope_);
-
-            // Apply floor limit
-            if (gTarget < floorLin_)
-                gTarget = floorLin_;
+    const float thresholdDb = static_cast<float>(config_.thresholdDb);
+    const float floorDb = static_cast<float>(config_.floorDb);
+    const float slope = static_cast<float>(expansionSlope_);
+    for (size_t offset = 0; offset < n; offset += DETECTOR_BLOCK_SIZE) {
+        const size_t count = std::min(DETECTOR_BLOCK_SIZE, n - offset);
+        float* block = out + offset;
+
+        // Envelope (linear), then dB with the vectorized log2 kernel
+        Nyth::Audio::FX::Dynamics::rectify(block, gainBlock_, count);
+        st.env.process(gainBlock_, gainBlock_, count);
+        Nyth::Audio::FX::VectorMath::linearToDb(gainBlock_, gainBlock_, count);
+
+        // Static curve for downward expander: (env / thresh)^(1/ratio) below threshold,
+        // i.e. (envDb - threshDb) / ratio in dB, limited by the floor
+        for (size_t i = 0; i < count; ++i) {
+            const float gainDb = std::min((gainBlock_[i] - thresholdDb) * slope, 0.0f);
+            gainBlock_[i] = std::max(gainDb, floorDb);
         }
+        Nyth::Audio::FX::VectorMath::dbToLinear(gainBlock_, gainBlock_, count);
 
         // Smooth gain (avoid pumping)
-        if (gTarget > st.gain)
-            st.gain = attackCoeffGain_ * st.gain + (UNITY_GAIN - attackCoeffGain_) * gTarget;
-        else
-            st.gain = releaseCoeffGain_ * st.gain + (UNITY_GAIN - releaseCoeffGain_) * gTarget;
-
-        out[i] = static_cast<float>(out[i] * st.gain);
+        st.gain.process(gainBlock_, gainBlock_, count);
+        for (size_t i = 0; i < count; ++i) {
+            block[i] *= gainBlock_[i];
+        }
     }
 }
 
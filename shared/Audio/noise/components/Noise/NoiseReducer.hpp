@@ -5,6 +5,7 @@
 #include <memory>
 #include <vector>
 #include "../../../common/dsp/BiquadFilter.hpp"
+#include "../../../common/dsp/DynamicsDetector.hpp"
 #include "../../../common/config/NoiseConstants.hpp"
 
 namespace AudioNR {
@@ -44,6 +45,10 @@ struct NoiseReducerConfig {
  * 2. Applying gain reduction when signal falls below threshold
  * 3. Optional high-pass filtering to remove low-frequency rumble
  *
+ * Steps 1-2 run per sub-block of DETECTOR_BLOCK_SIZE samples on the shared
+ * Nyth::Audio::FX::Dynamics detector (vectorized rectify, log2/exp2 kernels);
+ * only the two attack/release smoothers are evaluated sample by sample.
+ *
  * @note Thread-safe for processing, but configuration changes should be
  *       done from a single thread or protected by external synchronization.
  */
@@ -108,8 +113,8 @@ private:
     // Per-channel filters and states
     struct ChannelState {
         std::unique_ptr<Nyth::Audio::FX::BiquadFilter> highPass;
-        double env = INITIAL_ENVELOPE;      // envelope follower (linear)
-        double gain = INITIAL_GAIN;     // smoothed gain (linear)
+        Nyth::Audio::FX::Dynamics::AttackReleaseFilter env;  // envelope follower (linear)
+        Nyth::Audio::FX::Dynamics::AttackReleaseFilter gain; // smoothed gain (linear)
     };
     std::vector<ChannelState> ch_;
 
@@ -122,6 +127,7 @@ private:
     double releaseCoeffGain_ = DEFAULT_RELEASE_COEFF_GAIN; ///< Gain smoothing release coefficient
     double expansionSlope_ = DEFAULT_EXPANSION_SLOPE;    ///< Pre-calculated 1/ratio for expansion curve
     double threshLin2_ = DEFAULT_THRESH_LINEAR_SQUARED;   ///< Pre-calculated threshold squared
+    alignas(16) float gainBlock_[DETECTOR_BLOCK_SIZE] = {}; ///< Detector / gain scratch (one sub-block)
 
     void updateDerived();
     inline double dbToLin(double dB) const { return std::pow(DB_TO_LINEAR_BASE, dB / DB_TO_LINEAR_DIVISOR); }
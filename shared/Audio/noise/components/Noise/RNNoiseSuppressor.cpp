@@ -1,8 +1,11 @@
 #include "RNNoiseSuppressor.hpp"
-#include "../../common/config/NoiseContants.hpp"
+#include "../../../common/config/NoiseConstants.hpp"
+#include "../../../common/dsp/VectorMath.hpp"
 #include <algorithm>
+#include <cmath>
 #include <memory>
 #include <stdexcept>
+#include <string>
 
 namespace {
 template <typename T>
@@ -17,11 +20,15 @@ inline T minValue(const T& a, const T& b) {
 
 // Import des constantes pour éviter la répétition des namespace
 using namespace RNNoiseSuppressorConstants;
-using namespace SpectralNRConstants;
 } // namespace
 
 namespace AudioNR {
 
+namespace VectorMath = Nyth::Audio::FX::VectorMath;
+
+static_assert(RNNoiseSuppressorConstants::NB_BANDS == RnnModel::NB_BANDS,
+              "Band layout and model must agree on the number of bands");
+
 RNNoiseSuppressor::RNNoiseSuppressor() = default;
 RNNoiseSuppressor::~RNNoiseSuppressor() = default;
 
@@ -42,29 +49,76 @@ bool RNNoiseSuppressor::initialize(uint32_t sampleRate, int numChannels) {
 
     sampleRate_ = sampleRate;
     channels_ = numChannels;
+    const double rate = static_cast<double>(sampleRate_);
+
+    // Trame : FRAME_DURATION_S arrondie à la puissance de deux supérieure
+    size_t fftSize = GlobalAudioConstants::MIN_FFT_SIZE;
+    while (static_cast<double>(fftSize) < FRAME_DURATION_S * rate && fftSize < GlobalAudioConstants::MAX_FFT_SIZE) {
+        fftSize <<= 1;
+    }
+    fftSize_ = fftSize;
+    hopSize_ = fftSize_ / HOP_DIVISOR;
+    numBins_ = fftSize_ / 2 + 1;
+
+    // Pitch : décimation vers ≈ PITCH_ANALYSIS_RATE, retards en échantillons décimés
+    decimation_ = maxValue<size_t>(1, static_cast<size_t>(std::lround(rate / PITCH_ANALYSIS_RATE)));
+    const double pitchRate = rate / static_cast<double>(decimation_);
+    minLag_ = maxValue<size_t>(1, static_cast<size_t>(std::floor(pitchRate / PITCH_MAX_HZ)));
+    maxLag_ = static_cast<size_t>(std::ceil(pitchRate / PITCH_MIN_HZ));
 
-    // Configs par défaut
-    gateCfg_ = NoiseReducerConfig{};
-    gateCfg_.enabled = true;
-    gateCfg_.highPassHz = RNNoiseSuppressorConstants::DEFAULT_HIGHPASS_HZ;
-    gateCfg_.enableHighPass = RNNoiseSuppressorConstants::DEFAULT_ENABLE_HIGHPASS;
+    // Historique : une trame plus le plus long retard (et sa marge d'affinage)
+    const size_t historySize = fftSize_ + (maxLag_ + 1) * decimation_;
+    size_t ringSize = 1;
+    while (ringSize < historySize) {
+        ringSize <<= 1;
+    }
 
-    spectralCfg_ = SpectralNRConfig{};
-    spectralCfg_.enabled = true;
-    spectralCfg_.sampleRate = sampleRate_;
-    spectralCfg_.fftSize = SpectralNRConstants::DEFAULT_FFT_SIZE;
-    spectralCfg_.hopSize = SpectralNRConstants::DEFAULT_HOP_SIZE; // 75% overlap
+    pitchFft_ = Nyth::Audio::FX::createFFTEngine(fftSize_);
+    for (size_t c = 0; c < CHANNELS; ++c) {
+        states_[c].stft.prepare(fftSize_, hopSize_);
+        states_[c].history.assign(ringSize, 0.0f);
+        pitchFrame_[c].assign(fftSize_, 0.0f);
+        pitchRe_[c].assign(fftSize_, 0.0f);
+        pitchIm_[c].assign(fftSize_, 0.0f);
+    }
+    if (channels_ == STEREO_CHANNELS) {
+        stereoStft_.prepare(fftSize_, hopSize_);
+        pairRe_.assign(fftSize_, 0.0f);
+        pairIm_.assign(fftSize_, 0.0f);
+    }
+    linearHistory_.assign(historySize, 0.0f);
+    decimated_.assign(historySize / decimation_, 0.0f);
+    binScratch_.assign(numBins_, 0.0f);
+    binGain_.assign(numBins_, 1.0f);
 
-    // Instancier modules
-    gate_ = std::make_unique<NoiseReducer>(sampleRate_, channels_);
-    spectral_ = std::make_unique<SpectralNR>(spectralCfg_);
+    // Un sinus d'amplitude 1 donne |X| = sum(w) / 2 dans son bin
+    const float* window = states_[0].stft.getAnalysisWindow();
+    double windowSum = 0.0;
+    for (size_t n = 0; n < fftSize_; ++n) {
+        windowSum += window[n];
+    }
+    energyNorm_ = static_cast<float>(4.0 / (windowSum * windowSum));
 
-    // Appliquer agressivité actuelle
-    applyAggressivenessToConfigs();
-    gate_->setConfig(gateCfg_);
-    spectral_->setConfig(spectralCfg_);
+    // Bandes triangulaires : bords en bins, bornés au bin de Nyquist
+    size_t edgeBins[NB_BANDS];
+    for (size_t b = 0; b < NB_BANDS; ++b) {
+        const long edge = std::lround(BAND_EDGES_HZ[b] * static_cast<double>(fftSize_) / rate);
+        edgeBins[b] = minValue(static_cast<size_t>(edge), numBins_ - 1);
+    }
+    binBand_.assign(numBins_, static_cast<uint8_t>(NB_BANDS - 1));
+    binFrac_.assign(numBins_, 0.0f);
+    for (size_t b = 0; b + 1 < NB_BANDS; ++b) {
+        const size_t width = edgeBins[b + 1] - edgeBins[b];
+        for (size_t k = edgeBins[b]; k < edgeBins[b + 1]; ++k) {
+            binBand_[k] = static_cast<uint8_t>(b);
+            binFrac_[k] = static_cast<float>(k - edgeBins[b]) / static_cast<float>(width);
+        }
+    }
+    bandBins_ = edgeBins[NB_BANDS - 1];
 
+    resetStates();
     available_ = true;
+    setAggressiveness(aggressiveness_);
     return true;
 }
 
@@ -78,11 +132,17 @@ void RNNoiseSuppressor::setAggressiveness(double aggressiveness) {
         aggressiveness = maxValue(MIN_AGGRESSIVENESS, minValue(MAX_AGGRESSIVENESS, aggressiveness));
     }
     aggressiveness_ = aggressiveness;
-    if (!available_)
-        return;
-    applyAggressivenessToConfigs();
-    gate_->setConfig(gateCfg_);
-    spectral_->setConfig(spectralCfg_);
+    // 0 : gains unitaires (transparent, latence comprise) ; 3 : -MAX_ATTENUATION_DB par bande
+    const double t = aggressiveness_ / AGGRESSIVENESS_NORMALIZATION;
+    minGain_ = static_cast<float>(std::pow(10.0, -MAX_ATTENUATION_DB * t / 20.0));
+}
+
+void RNNoiseSuppressor::setChannelLink(ChannelLink link) {
+    channelLink_ = link;
+}
+
+size_t RNNoiseSuppressor::getLatency() const {
+    return available_ ? fftSize_ : 0;
 }
 
 void RNNoiseSuppressor::processMono(const float* input, float* output, size_t numSamples) {
@@ -91,21 +151,12 @@ void RNNoiseSuppressor::processMono(const float* input, float* output, size_t nu
     }
     if (numSamples == 0)
         return;
-    if (!available_ || !gate_ || !spectral_) {
+    if (!available_) {
         if (output != input)
             std::copy_n(input, numSamples, output);
         return;
     }
-
-    // Assurer les tampons
-    if (scratchOut_.size() < numSamples)
-        scratchOut_.resize(numSamples);
-
-    // Étape 1: gate temporel
-    gate_->processMono(input, scratchOut_.data(), numSamples);
-
-    // Étape 2: réduction spectrale
-    spectral_->process(scratchOut_.data(), output, numSamples);
+    processChannel(states_[0], input, output, numSamples);
 }
 
 void RNNoiseSuppressor::processStereo(const float* inL, const float* inR, float* outL, float* outR, size_t numSamples) {
@@ -114,64 +165,299 @@ void RNNoiseSuppressor::processStereo(const float* inL, const float* inR, float*
     }
     if (numSamples == 0)
         return;
-    if (!available_ || !gate_ || !spectral_) {
+    if (!available_) {
         if (outL != inL)
             std::copy_n(inL, numSamples, outL);
         if (outR != inR)
             std::copy_n(inR, numSamples, outR);
         return;
     }
+    if (channels_ != STEREO_CHANNELS) {
+        // Initialisé en mono : pas de STFT stéréo, chaque canal garde son état
+        processChannel(states_[0], inL, outL, numSamples);
+        processChannel(states_[1], inR, outR, numSamples);
+        return;
+    }
+
+    ChannelState& left = states_[0];
+    ChannelState& right = states_[1];
+    const size_t mask = left.history.size() - 1;
+    size_t done = 0;
+    while (done < numSamples) {
+        const size_t chunk = minValue(hopSize_ - left.hopFill, numSamples - done);
+        for (size_t i = 0; i < chunk; ++i) {
+            left.history[left.historyPos] = inL[done + i];
+            right.history[right.historyPos] = inR[done + i];
+            left.historyPos = (left.historyPos + 1) & mask;
+            right.historyPos = (right.historyPos + 1) & mask;
+        }
+        stereoStft_.process(inL + done, inR + done, outL + done, outR + done, chunk,
+                            [this](float* reL, float* imL, float* reR, float* imR, size_t numBins) {
+                                processFramePair(reL, imL, reR, imR, numBins);
+                            });
+        left.hopFill = (left.hopFill + chunk) % hopSize_;
+        done += chunk;
+    }
+}
+
+void RNNoiseSuppressor::processChannel(ChannelState& state, const float* input, float* output, size_t numSamples) {
+    const size_t mask = state.history.size() - 1;
+    size_t done = 0;
+    while (done < numSamples) {
+        // Segment coupé à la prochaine trame : l'historique est à jour quand la STFT appelle processFrame
+        const size_t chunk = minValue(hopSize_ - state.hopFill, numSamples - done);
+        for (size_t i = 0; i < chunk; ++i) {
+            state.history[state.historyPos] = input[done + i];
+            state.historyPos = (state.historyPos + 1) & mask;
+        }
+        state.stft.process(input + done, output + done, chunk, [this, &state](float* re, float* im, size_t numBins) {
+            processFrame(state, re, im, numBins);
+        });
+        state.hopFill = (state.hopFill + chunk) % hopSize_;
+        done += chunk;
+    }
+}
+
+void RNNoiseSuppressor::processFrame(ChannelState& state, float* re, float* im, size_t numBins) {
+    preparePitchFrame(state, 0);
+    pitchFft_->forwardR2C(pitchFrame_[0].data(), pitchRe_[0], pitchIm_[0]);
+    analyzeFrame(state, re, im, 0, numBins);
+    computeBandGains(state, 0);
+    applyBandGains(re, im, 0, numBins);
+}
+
+void RNNoiseSuppressor::processFramePair(float* reL, float* imL, float* reR, float* imR, size_t numBins) {
+    preparePitchFrame(states_[0], 0);
+    preparePitchFrame(states_[1], 1);
+    Nyth::Audio::FX::forwardR2CPair(*pitchFft_, pitchFrame_[0].data(), pitchFrame_[1].data(), pairRe_, pairIm_,
+                                    pitchRe_[0].data(), pitchIm_[0].data(), pitchRe_[1].data(), pitchIm_[1].data());
 
-    // Assurer tampons
-    if (scratchMono_.size() < numSamples)
-        scratchMono_.resize(numSamples);
-    if (scratchOut_.size() < numSamples)
-        scratchOut_.resize(numSamples);
-
-    // 1) Gate stéréo (par canal) pour éviter les fuites avant mixage
-    if (scratchL_.size() < numSamples)
-        scratchL_.resize(numSamples);
-    if (scratchR_.size() < numSamples)
-        scratchR_.resize(numSamples);
-    gate_->processStereo(inL, inR, scratchL_.data(), scratchR_.data(), numSamples);
-
-    // 2) Downmix vers mono pour réduction spectrale partagée
-    for (size_t i = 0; i < numSamples; ++i) {
-        scratchMono_[i] = STEREO_DOWNMIX_FACTOR * (scratchL_[i] + scratchR_[i]);
-    }
-
-    // 3) Réduction spectrale
-    spectral_->process(scratchMono_.data(), scratchOut_.data(), numSamples);
-
-    // 4) Upmix identique sur L/R
-    for (size_t i = 0; i < numSamples; ++i) {
-        outL[i] = scratchOut_[i];
-        outR[i] = scratchOut_[i];
-    }
-}
-
-void RNNoiseSuppressor::applyAggressivenessToConfigs() {
-    double a = maxValue(MIN_AGGRESSIVENESS, minValue(MAX_AGGRESSIVENESS, aggressiveness_));
-    double t = a / AGGRESSIVENESS_NORMALIZATION; // 0..1
-
-    // NoiseReducer mapping
-    gateCfg_.enabled = (a > MIN_AGGRESSIVENESS);
-    gateCfg_.thresholdDb = GateMapping::THRESHOLD_BASE_DB + GateMapping::THRESHOLD_RANGE_DB * t;
-    gateCfg_.ratio = GateMapping::RATIO_BASE + GateMapping::RATIO_RANGE * t;
-    gateCfg_.floorDb = GateMapping::FLOOR_BASE_DB + GateMapping::FLOOR_RANGE_DB * t;
-    gateCfg_.attackMs = GateMapping::ATTACK_BASE_MS + GateMapping::ATTACK_RANGE_MS * t;
-    gateCfg_.releaseMs = GateMapping::RELEASE_BASE_MS + GateMapping::RELEASE_RANGE_MS * t;
-    gateCfg_.highPassHz = GateMapping::HIGHPASS_BASE_HZ + GateMapping::HIGHPASS_RANGE_HZ * t;
-    gateCfg_.enableHighPass = true;
-
-    // SpectralNR mapping
-    spectralCfg_.enabled = (a > MIN_AGGRESSIVENESS);
-    spectralCfg_.sampleRate = sampleRate_;
-    spectralCfg_.fftSize = SpectralMapping::FFT_SIZE; // fixe et robuste
-    spectralCfg_.hopSize = SpectralMapping::HOP_SIZE; // 75% overlap
-    spectralCfg_.beta = SpectralMapping::BETA_BASE + SpectralMapping::BETA_RANGE * t;
-    spectralCfg_.floorGain = SpectralMapping::FLOOR_GAIN_BASE + SpectralMapping::FLOOR_GAIN_RANGE * t;
-    spectralCfg_.noiseUpdate = SpectralMapping::NOISE_UPDATE_BASE + SpectralMapping::NOISE_UPDATE_RANGE * t;
+    analyzeFrame(states_[0], reL, imL, 0, numBins);
+    analyzeFrame(states_[1], reR, imR, 1, numBins);
+    if (linksNoise(channelLink_)) {
+        // Plancher commun, repris par les deux traqueurs à la trame suivante
+        linkChannels(states_[0].noiseState.data(), states_[1].noiseState.data(), NB_BANDS, channelLink_);
+    }
+
+    computeBandGains(states_[0], 0);
+    computeBandGains(states_[1], 1);
+    if (linksMask(channelLink_)) {
+        linkChannels(analysis_[0].gains, analysis_[1].gains, NB_BANDS, channelLink_);
+    }
+
+    applyBandGains(reL, imL, 0, numBins);
+    applyBandGains(reR, imR, 1, numBins);
+}
+
+void RNNoiseSuppressor::preparePitchFrame(ChannelState& state, size_t channel) {
+    // Historique linéaire, échantillon le plus récent en dernier
+    const size_t historySize = linearHistory_.size();
+    const size_t mask = state.history.size() - 1;
+    const size_t start = (state.historyPos - historySize) & mask;
+    for (size_t i = 0; i < historySize; ++i) {
+        linearHistory_[i] = state.history[(start + i) & mask];
+    }
+
+    // Signal retardé d'une période de pitch, même fenêtre que la trame
+    const size_t period = estimatePitchPeriod();
+    const float* window = state.stft.getAnalysisWindow();
+    const float* delayed = linearHistory_.data() + historySize - fftSize_ - period;
+    float* frame = pitchFrame_[channel].data();
+    for (size_t n = 0; n < fftSize_; ++n) {
+        frame[n] = delayed[n] * window[n];
+    }
+}
+
+void RNNoiseSuppressor::analyzeFrame(ChannelState& state, const float* re, const float* im, size_t channel,
+                                     size_t numBins) {
+    FrameAnalysis& frame = analysis_[channel];
+    const float* pitchRe = pitchRe_[channel].data();
+    const float* pitchIm = pitchIm_[channel].data();
+
+    // Énergies de bande de X et P, corrélation Re(X P*) par bande
+    float cross[NB_BANDS];
+    VectorMath::power(re, im, binScratch_.data(), numBins);
+    accumulateBands(binScratch_.data(), frame.ex);
+    VectorMath::power(pitchRe, pitchIm, binScratch_.data(), numBins);
+    accumulateBands(binScratch_.data(), frame.ep);
+    for (size_t k = 0; k < numBins; ++k) {
+        binScratch_[k] = re[k] * pitchRe[k] + im[k] * pitchIm[k];
+    }
+    accumulateBands(binScratch_.data(), cross);
+
+    float* features = frame.features;
+    for (size_t b = 0; b < NB_BANDS; ++b) {
+        frame.ex[b] *= energyNorm_;
+        frame.ep[b] *= energyNorm_;
+        cross[b] *= energyNorm_;
+        const float correlation = cross[b] / std::sqrt(frame.ex[b] * frame.ep[b] + PITCH_ENERGY_EPSILON);
+        features[b] = (10.0f * std::log10(frame.ex[b] + BAND_ENERGY_FLOOR) - FEATURE_DB_OFFSET) * FEATURE_DB_SCALE;
+        features[NB_BANDS + b] = std::min(std::max(correlation, -1.0f), 1.0f);
+    }
+
+    // Traqueur de bruit (première couche de RnnModel)
+    if (++state.frames == HOP_DIVISOR) {
+        // Première trame sans zéros de démarrage : le plancher part du niveau courant
+        for (size_t b = 0; b < NB_BANDS; ++b) {
+            state.noiseState[b] = Rnn::tanhApprox(features[b]);
+        }
+    }
+    Rnn::computeBandGru(RnnModel::NOISE_GRU, state.noiseState.data(), features);
+}
+
+void RNNoiseSuppressor::computeBandGains(ChannelState& state, size_t channel) {
+    FrameAnalysis& frame = analysis_[channel];
+
+    // Entrée de SNR_DENSE : [énergies log | corrélations de pitch | état du traqueur de bruit]
+    std::copy(state.noiseState.begin(), state.noiseState.end(), frame.features + RnnModel::NB_FEATURES);
+    float logits[NB_BANDS];
+    Rnn::computeBandDense(RnnModel::SNR_DENSE, logits, frame.features);
+    Rnn::computeBandGru(RnnModel::GAIN_GRU, state.gainState.data(), logits);
+    Rnn::computeBandDense(RnnModel::OUTPUT_DENSE, frame.gains, state.gainState.data());
+    for (size_t b = 0; b < NB_BANDS; ++b) {
+        frame.gains[b] = std::max(frame.gains[b], minGain_);
+    }
+}
+
+void RNNoiseSuppressor::applyBandGains(float* re, float* im, size_t channel, size_t numBins) {
+    FrameAnalysis& frame = analysis_[channel];
+    const float* pitchRe = pitchRe_[channel].data();
+    const float* pitchIm = pitchIm_[channel].data();
+
+    // Filtre de pitch : X += r P, r² = p² (1 - g²) / (g² (1 - p²)) borné à 1, à l'énergie de X
+    float strength[NB_BANDS];
+    for (size_t b = 0; b < NB_BANDS; ++b) {
+        const float p = std::max(frame.features[NB_BANDS + b], 0.0f);
+        const float g = frame.gains[b];
+        float r = 1.0f;
+        if (p <= g) {
+            r = p * p * (1.0f - g * g) / (PITCH_FILTER_EPSILON + g * g * (1.0f - p * p));
+        }
+        strength[b] = std::sqrt(std::min(std::max(r, 0.0f), 1.0f)) *
+                      std::sqrt(frame.ex[b] / (ENERGY_RATIO_EPSILON + frame.ep[b]));
+    }
+    interpolateBands(strength, binScratch_.data());
+    for (size_t k = 0; k < numBins; ++k) {
+        re[k] += binScratch_[k] * pitchRe[k];
+        im[k] += binScratch_[k] * pitchIm[k];
+    }
+
+    // Énergie de bande ramenée à celle de X, puis gains : un seul gain réel par bin
+    float filtered[NB_BANDS];
+    float gains[NB_BANDS];
+    VectorMath::power(re, im, binScratch_.data(), numBins);
+    accumulateBands(binScratch_.data(), filtered);
+    for (size_t b = 0; b < NB_BANDS; ++b) {
+        gains[b] = frame.gains[b] * std::sqrt((frame.ex[b] + ENERGY_RATIO_EPSILON) /
+                                              (filtered[b] * energyNorm_ + ENERGY_RATIO_EPSILON));
+    }
+    interpolateBands(gains, binGain_.data());
+    VectorMath::scaleComplex(re, im, binGain_.data(), numBins);
+}
+
+size_t RNNoiseSuppressor::estimatePitchPeriod() {
+    const size_t historySize = linearHistory_.size();
+    const size_t count = decimated_.size();
+    const size_t offset = historySize - count * decimation_;
+    const float inverse = 1.0f / static_cast<float>(decimation_);
+    for (size_t i = 0; i < count; ++i) {
+        const float* x = linearHistory_.data() + offset + i * decimation_;
+        float sum = 0.0f;
+        for (size_t j = 0; j < decimation_; ++j) {
+            sum += x[j];
+        }
+        decimated_[i] = sum * inverse;
+    }
+
+    // Recherche grossière : autocorrélation normalisée de la fenêtre la plus récente
+    const size_t window = fftSize_ / decimation_;
+    const float* y = decimated_.data() + count - window;
+    double energy = 0.0;
+    double lagEnergy = 0.0;
+    const float* first = y - minLag_;
+    for (size_t i = 0; i < window; ++i) {
+        energy += static_cast<double>(y[i]) * y[i];
+        lagEnergy += static_cast<double>(first[i]) * first[i];
+    }
+    size_t bestLag = 0;
+    double bestScore = 0.0;
+    for (size_t lag = minLag_; lag <= maxLag_; ++lag) {
+        const float* d = y - lag;
+        float num = 0.0f;
+        for (size_t i = 0; i < window; ++i) {
+            num += y[i] * d[i];
+        }
+        if (num > 0.0f) {
+            const double score = num / std::sqrt(energy * lagEnergy + static_cast<double>(PITCH_ENERGY_EPSILON));
+            if (score > bestScore) {
+                bestScore = score;
+                bestLag = lag;
+            }
+        }
+        // Fenêtre suivante : un échantillon plus ancien entre, le plus récent sort
+        lagEnergy += static_cast<double>(d[-1]) * d[-1] - static_cast<double>(d[window - 1]) * d[window - 1];
+    }
+    if (bestLag == 0) {
+        return minLag_ * decimation_; // pas de périodicité : les corrélations restent ≈ 0
+    }
+
+    // Affinage à pleine cadence autour du retard décimé
+    const float* x = linearHistory_.data() + historySize - fftSize_;
+    const size_t coarse = bestLag * decimation_;
+    const size_t low = maxValue<size_t>(1, coarse - (decimation_ - 1));
+    const size_t high = coarse + decimation_ - 1;
+    size_t bestPeriod = coarse;
+    bestScore = -1.0;
+    for (size_t period = low; period <= high; ++period) {
+        const float* d = x - period;
+        float num = 0.0f;
+        float lag = 0.0f;
+        for (size_t i = 0; i < fftSize_; ++i) {
+            num += x[i] * d[i];
+            lag += d[i] * d[i];
+        }
+        const double score = num / std::sqrt(static_cast<double>(lag) + static_cast<double>(PITCH_ENERGY_EPSILON));
+        if (score > bestScore) {
+            bestScore = score;
+            bestPeriod = period;
+        }
+    }
+    return bestPeriod;
+}
+
+void RNNoiseSuppressor::accumulateBands(const float* binValues, float* bands) const {
+    std::fill_n(bands, NB_BANDS, 0.0f);
+    for (size_t k = 0; k < bandBins_; ++k) {
+        const size_t b = binBand_[k];
+        const float frac = binFrac_[k];
+        bands[b] += (1.0f - frac) * binValues[k];
+        bands[b + 1] += frac * binValues[k];
+    }
+    bands[0] *= BAND_EDGE_WEIGHT;
+    bands[NB_BANDS - 1] *= BAND_EDGE_WEIGHT;
+}
+
+void RNNoiseSuppressor::interpolateBands(const float* bands, float* binValues) const {
+    for (size_t k = 0; k < numBins_; ++k) {
+        const size_t b = binBand_[k];
+        const size_t next = minValue(b + 1, NB_BANDS - 1);
+        binValues[k] = bands[b] + (bands[next] - bands[b]) * binFrac_[k];
+    }
+}
+
+void RNNoiseSuppressor::resetStates() {
+    if (stereoStft_.isPrepared()) {
+        stereoStft_.reset();
+    }
+    for (ChannelState& state : states_) {
+        state.stft.reset();
+        std::fill(state.history.begin(), state.history.end(), 0.0f);
+        state.historyPos = 0;
+        state.hopFill = 0;
+        state.frames = 0;
+        state.noiseState.fill(0.0f);
+        state.gainState.fill(0.0f);
+    }
 }
 
 } // namespace AudioNR
@@ -11,12 +11,16 @@
 #else
 #include <stdint.h>
 #endif
+#include <array>
 #include <memory>
 #include <vector>
 
-#include "SpectralNR.hpp"
-#include "NoiseReducer.hpp"
 #include "../../../common/config/NoiseConstants.hpp"
+#include "../../../common/dsp/FFTEngine.hpp"
+#include "../../../common/dsp/StereoStftProcessor.hpp"
+#include "../../../common/dsp/StftProcessor.hpp"
+#include "../Spectral/ChannelLink.hpp"
+#include "RnnModel.hpp"
 
 namespace AudioNR {
 
@@ -24,10 +28,32 @@ namespace AudioNR {
 using namespace RNNoiseSuppressorConstants;
 
 /**
- * @brief Suppresseur de bruit C++17 pur (pipeline NoiseReducer + SpectralNR)
+ * @brief Suppresseur de bruit par bandes (pipeline de type RNNoise), CPU seul
  *
- * Implémentation sans dépendances C. Compose un expander temporel (NoiseReducer)
- * et une réduction spectrale (SpectralNR) pour un résultat robuste et portable.
+ * Ce n'est PAS un suppresseur neuronal : aucun modèle entraîné n'est livré.
+ * Le pipeline reprend celui de RNNoise (bandes, pitch, gain par bande), mais
+ * les gains viennent d'une règle classique (traqueur de plancher de bruit,
+ * SNR de bande et corrélation de pitch, lissage attaque / relâchement) écrite
+ * à la main dans le format de couches int8 de RnnLayers. Des poids entraînés
+ * au même format pourraient remplacer RnnModel sans toucher au pipeline.
+ *
+ * Par trame STFT (≈ 20 ms, 50 % de recouvrement, StftProcessor) :
+ *  1. énergies de NB_BANDS bandes triangulaires (échelle proche de Bark) ;
+ *  2. période de pitch (autocorrélation décimée puis affinée), spectre du
+ *     signal retardé d'une période et corrélation X / P par bande ;
+ *  3. règle RnnModel (couches band-locales, poids int8 fixés à la main à la
+ *     compilation, noyaux AVX2 / NEON / scalaire) → un gain par bande ;
+ *  4. filtre de pitch (X += r P par bande, énergie renormalisée), puis gains
+ *     interpolés sur les bins et appliqués en place.
+ *
+ * Aucune allocation dans process*, aucune dépendance externe.
+ *
+ * Stéréo : un état de traqueur et de lissage par canal, les deux trames passent ensemble par
+ * une StereoStftProcessor (une FFT complexe pour la paire, de même pour les
+ * spectres de pitch). setChannelLink() partage au besoin l'état du traqueur
+ * de bruit ou les gains de bande entre les canaux.
+ *
+ * @note Latence : getLatency() échantillons (taille de la FFT)
  */
 class RNNoiseSuppressor {
 public:
@@ -35,7 +61,7 @@ public:
     ~RNNoiseSuppressor();
 
     /**
-     * @brief Initialiser le moteur C++ (pas de dépendance C)
+     * @brief Initialiser le moteur (allocations, tables de bandes, FFT)
      * @param sampleRate Fréquence d'échantillonnage
      * @param numChannels 1 (mono) ou 2 (stéréo)
      * @return true si initialisé
@@ -49,44 +75,106 @@ public:
     bool isAvailable() const;
 
     /**
-     * @brief Régler l'agressivité (0.0 doux → 3.0 agressif)
+     * @brief Régler l'agressivité (0.0 transparent → 3.0 agressif)
+     * @note Fixe l'atténuation maximale par bande (0 à MAX_ATTENUATION_DB)
      */
     void setAggressiveness(double aggressiveness);
 
+    /**
+     * @brief Couplage des canaux en stéréo (INDEPENDENT par défaut)
+     */
+    void setChannelLink(ChannelLink link);
+
+    /**
+     * @brief Latence de traitement en échantillons
+     */
+    size_t getLatency() const;
+
     /**
      * @brief Traiter un flux mono
      */
     void processMono(const float* input, float* output, size_t numSamples);
 
     /**
-     * @brief Traiter un flux stéréo
-     * @note Downmix vers mono pour la réduction spectrale puis upmix
+     * @brief Traiter un flux stéréo (un état par canal)
      */
     void processStereo(const float* inL, const float* inR,
                        float* outL, float* outR,
                        size_t numSamples);
 
 private:
+    static constexpr size_t NB_BANDS = RnnModel::NB_BANDS;
+    static constexpr size_t CHANNELS = RNNoiseSuppressorConstants::MAX_CHANNELS;
+
+    // État propre à un canal
+    struct ChannelState {
+        Nyth::Audio::FX::StftProcessor stft;
+        std::vector<float> history; // anneau des dernières entrées (puissance de deux)
+        size_t historyPos = 0;
+        size_t hopFill = 0;         // aligné sur la STFT : la trame tombe en fin de segment (stéréo : canal 0)
+        size_t frames = 0;          // le traqueur de bruit est amorcé sur la première trame pleine
+        std::array<float, RnnModel::NOISE_GRU_SIZE> noiseState{};
+        std::array<float, RnnModel::GAIN_GRU_SIZE> gainState{};
+    };
+
     bool available_{false};
     uint32_t sampleRate_{48000};  // Default sample rate
     int channels_{RNNoiseSuppressorConstants::DEFAULT_CHANNELS};
     double aggressiveness_{RNNoiseSuppressorConstants::DEFAULT_AGGRESSIVENESS};
-
-    // Modules C++17
-    std::unique_ptr<NoiseReducer> gate_;
-    std::unique_ptr<SpectralNR> spectral_;
-
-    // Configs courantes
-    NoiseReducerConfig gateCfg_{};
-    SpectralNRConfig spectralCfg_{};
-
-    // Tampons temporaires pour éviter des allocations répétées
-    std::vector<float> scratchL_;
-    std::vector<float> scratchR_;
-    std::vector<float> scratchMono_;
-    std::vector<float> scratchOut_;
-
-    void applyAggressivenessToConfigs();
+    float minGain_{1.0f};
+    ChannelLink channelLink_{ChannelLink::INDEPENDENT};
+
+    // Trame
+    size_t fftSize_{0};
+    size_t hopSize_{0};
+    size_t numBins_{0};
+    float energyNorm_{1.0f}; // sinus pleine échelle → 0 dB dans son bin
+
+    // Bandes : bin k entre les bords de binBand_[k] et binBand_[k] + 1
+    std::vector<uint8_t> binBand_;
+    std::vector<float> binFrac_;
+    size_t bandBins_{0}; // bins couverts par les bandes (au-delà : gain de la dernière)
+
+    // Pitch
+    size_t decimation_{1};
+    size_t minLag_{0}; // en échantillons décimés
+    size_t maxLag_{0};
+    std::unique_ptr<Nyth::Audio::FX::IFFTEngine> pitchFft_;
+
+    // Résultats d'une trame d'un canal entre les étapes (analyse, gains, application)
+    struct FrameAnalysis {
+        float ex[NB_BANDS];                             // énergies de bande de X (normalisées)
+        float ep[NB_BANDS];                             // énergies de bande de P (spectre retardé)
+        float features[RnnModel::SNR_DENSE_INPUTS]; // [énergies log | corrélations | traqueur]
+        float gains[NB_BANDS];
+    };
+
+    std::array<ChannelState, CHANNELS> states_;
+    Nyth::Audio::FX::StereoStftProcessor stereoStft_;
+    std::array<FrameAnalysis, CHANNELS> analysis_;
+
+    // Spectres retardés d'une période, par canal
+    std::array<std::vector<float>, CHANNELS> pitchFrame_;
+    std::array<std::vector<float>, CHANNELS> pitchRe_, pitchIm_;
+    std::vector<float> pairRe_, pairIm_; // FFT complexe commune aux deux canaux
+
+    // Tampons de travail partagés (canaux traités l'un après l'autre)
+    std::vector<float> linearHistory_;
+    std::vector<float> decimated_;
+    std::vector<float> binScratch_;
+    std::vector<float> binGain_;
+
+    void processChannel(ChannelState& state, const float* input, float* output, size_t numSamples);
+    void processFrame(ChannelState& state, float* re, float* im, size_t numBins);
+    void processFramePair(float* reL, float* imL, float* reR, float* imR, size_t numBins);
+    void preparePitchFrame(ChannelState& state, size_t channel);
+    void analyzeFrame(ChannelState& state, const float* re, const float* im, size_t channel, size_t numBins);
+    void computeBandGains(ChannelState& state, size_t channel);
+    void applyBandGains(float* re, float* im, size_t channel, size_t numBins);
+    size_t estimatePitchPeriod();
+    void accumulateBands(const float* binValues, float* bands) const;
+    void interpolateBands(const float* bands, float* binValues) const;
+    void resetStates();
 };
 
 } // namespace AudioNR
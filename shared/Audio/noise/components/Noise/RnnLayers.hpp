@@ -0,0 +1,268 @@
+#pragma once
+
+#ifdef __cplusplus
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+// Platform detection and SIMD headers
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define NYTH_RNN_AVX2
+#elif defined(__ARM_NEON) || defined(__aarch64__)
+#include <arm_neon.h>
+#define NYTH_RNN_NEON
+#endif
+
+namespace AudioNR {
+namespace Rnn {
+
+/**
+ * @brief Dense and GRU layers with int8 weights, float activations
+ *
+ * Weights are stored as int8 (real value = q * scale, one scale per layer)
+ * and widened to float inside the kernels: 8 weights per step with AVX2 or
+ * NEON, plain loop otherwise. Activations use rational approximations, so
+ * the layers need nothing but this header. Two layouts:
+ *  - DenseLayer / GruLayer: full row-major matrices, matrix-vector kernel
+ *    (for a trained model with cross-band connections, none ships yet);
+ *  - BandDenseLayer / BandGruLayer: band-local, unit b only reads input b of
+ *    each of its taps (input[t * bands + b]) and its own state; the kernel is
+ *    an element-wise multiply-add over the bands per tap, O(taps * bands)
+ *    instead of O(inputs * units).
+ *
+ * GRU convention (update z, reset r, candidate h~):
+ *
+ *     z  = sigmoid(Wz x + Uz h + bz)
+ *     r  = sigmoid(Wr x + Ur h + br)
+ *     h~ = tanh(Wh x + Uh (r * h) + bh)
+ *     h  = z * h + (1 - z) * h~
+ */
+
+constexpr size_t MAX_NEURONS = 128; // unités max. d'un GRU (tampons sur la pile)
+constexpr float TANH_CLAMP = 4.97f;  // |tanh| > 0.9999 au-delà
+
+enum class Activation : uint8_t { LINEAR, SIGMOID, TANH, RELU };
+
+struct DenseLayer {
+    const int8_t* bias;    ///< [outputs]
+    const int8_t* weights; ///< [outputs][inputs]
+    size_t inputs;
+    size_t outputs;
+    float scale;           ///< valeur réelle = q * scale
+    Activation activation;
+};
+
+struct GruLayer {
+    const int8_t* bias;             ///< [3][units] : update, reset, candidate
+    const int8_t* inputWeights;     ///< [3 * units][inputs]
+    const int8_t* recurrentWeights; ///< [3 * units][units]
+    size_t inputs;
+    size_t units;
+    float scale; ///< valeur réelle = q * scale
+};
+
+struct BandDenseLayer {
+    const int8_t* bias;    ///< [bands]
+    const int8_t* weights; ///< [taps][bands] : poids de input[t * bands + b] pour la sortie b
+    size_t taps;
+    size_t bands;
+    float scale;
+    Activation activation;
+};
+
+struct BandGruLayer {
+    const int8_t* bias;             ///< [3][bands] : update, reset, candidate
+    const int8_t* inputWeights;     ///< [3][taps][bands]
+    const int8_t* recurrentWeights; ///< [3][bands] : état de la même unité
+    size_t taps;
+    size_t bands;
+    float scale; ///< valeur réelle = q * scale
+};
+
+// Padé [7/6] de tanh, erreur < 1e-4
+inline float tanhApprox(float x) noexcept {
+    x = std::min(std::max(x, -TANH_CLAMP), TANH_CLAMP);
+    const float x2 = x * x;
+    const float num = x * (135135.0f + x2 * (17325.0f + x2 * (378.0f + x2)));
+    const float den = 135135.0f + x2 * (62370.0f + x2 * (3150.0f + x2 * 28.0f));
+    return std::min(std::max(num / den, -1.0f), 1.0f);
+}
+
+inline float sigmoidApprox(float x) noexcept {
+    return 0.5f + 0.5f * tanhApprox(0.5f * x);
+}
+
+inline float activate(float x, Activation activation) noexcept {
+    switch (activation) {
+        case Activation::SIGMOID:
+            return sigmoidApprox(x);
+        case Activation::TANH:
+            return tanhApprox(x);
+        case Activation::RELU:
+            return std::max(x, 0.0f);
+        case Activation::LINEAR:
+        default:
+            return x;
+    }
+}
+
+/**
+ * @brief output[r] = sum_c weights[r][c] * input[c] (integer weights, unscaled)
+ */
+inline void matvec(const int8_t* weights, const float* input, float* output, size_t rows, size_t cols) noexcept {
+    for (size_t r = 0; r < rows; ++r) {
+        const int8_t* row = weights + r * cols;
+        size_t c = 0;
+        float sum = 0.0f;
+#if defined(NYTH_RNN_AVX2)
+        __m256 acc = _mm256_setzero_ps();
+        for (; c + 8 <= cols; c += 8) {
+            const __m128i q = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(row + c));
+            const __m256 w = _mm256_cvtepi32_ps(_mm256_cvtepi8_epi32(q));
+#if defined(__FMA__)
+            acc = _mm256_fmadd_ps(w, _mm256_loadu_ps(input + c), acc);
+#else
+            acc = _mm256_add_ps(acc, _mm256_mul_ps(w, _mm256_loadu_ps(input + c)));
+#endif
+        }
+        __m128 s = _mm_add_ps(_mm256_castps256_ps128(acc), _mm256_extractf128_ps(acc, 1));
+        s = _mm_add_ps(s, _mm_movehl_ps(s, s));
+        s = _mm_add_ss(s, _mm_shuffle_ps(s, s, 1));
+        sum = _mm_cvtss_f32(s);
+#elif defined(NYTH_RNN_NEON)
+        float32x4_t acc = vdupq_n_f32(0.0f);
+        for (; c + 8 <= cols; c += 8) {
+            const int16x8_t q = vmovl_s8(vld1_s8(row + c));
+            const float32x4_t lo = vcvtq_f32_s32(vmovl_s16(vget_low_s16(q)));
+            const float32x4_t hi = vcvtq_f32_s32(vmovl_s16(vget_high_s16(q)));
+            acc = vmlaq_f32(acc, lo, vld1q_f32(input + c));
+            acc = vmlaq_f32(acc, hi, vld1q_f32(input + c + 4));
+        }
+#if defined(__aarch64__)
+        sum = vaddvq_f32(acc);
+#else
+        const float32x2_t pair = vadd_f32(vget_low_f32(acc), vget_high_f32(acc));
+        sum = vget_lane_f32(vpadd_f32(pair, pair), 0);
+#endif
+#endif
+        for (; c < cols; ++c) {
+            sum += static_cast<float>(row[c]) * input[c];
+        }
+        output[r] = sum;
+    }
+}
+
+/**
+ * @brief acc[i] += weights[i] * input[i] (integer weights, unscaled)
+ */
+inline void multiplyAdd(const int8_t* weights, const float* input, float* acc, size_t n) noexcept {
+    size_t i = 0;
+#if defined(NYTH_RNN_AVX2)
+    for (; i + 8 <= n; i += 8) {
+        const __m128i q = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(weights + i));
+        const __m256 w = _mm256_cvtepi32_ps(_mm256_cvtepi8_epi32(q));
+#if defined(__FMA__)
+        _mm256_storeu_ps(acc + i, _mm256_fmadd_ps(w, _mm256_loadu_ps(input + i), _mm256_loadu_ps(acc + i)));
+#else
+        _mm256_storeu_ps(acc + i,
+                         _mm256_add_ps(_mm256_loadu_ps(acc + i), _mm256_mul_ps(w, _mm256_loadu_ps(input + i))));
+#endif
+    }
+#elif defined(NYTH_RNN_NEON)
+    for (; i + 8 <= n; i += 8) {
+        const int16x8_t q = vmovl_s8(vld1_s8(weights + i));
+        const float32x4_t lo = vcvtq_f32_s32(vmovl_s16(vget_low_s16(q)));
+        const float32x4_t hi = vcvtq_f32_s32(vmovl_s16(vget_high_s16(q)));
+        vst1q_f32(acc + i, vmlaq_f32(vld1q_f32(acc + i), lo, vld1q_f32(input + i)));
+        vst1q_f32(acc + i + 4, vmlaq_f32(vld1q_f32(acc + i + 4), hi, vld1q_f32(input + i + 4)));
+    }
+#endif
+    for (; i < n; ++i) {
+        acc[i] += static_cast<float>(weights[i]) * input[i];
+    }
+}
+
+/**
+ * @brief output = activation(scale * (W input + b)); output must not alias input
+ */
+inline void computeDense(const DenseLayer& layer, float* output, const float* input) noexcept {
+    matvec(layer.weights, input, output, layer.outputs, layer.inputs);
+    for (size_t i = 0; i < layer.outputs; ++i) {
+        output[i] = activate((output[i] + static_cast<float>(layer.bias[i])) * layer.scale, layer.activation);
+    }
+}
+
+/**
+ * @brief One GRU step, state updated in place (units <= MAX_NEURONS)
+ */
+inline void computeGru(const GruLayer& layer, float* state, const float* input) noexcept {
+    const size_t n = layer.units;
+    float gates[3 * MAX_NEURONS];
+    float recurrent[3 * MAX_NEURONS];
+    float resetState[MAX_NEURONS];
+
+    matvec(layer.inputWeights, input, gates, 3 * n, layer.inputs);
+    matvec(layer.recurrentWeights, state, recurrent, 2 * n, n);
+    for (size_t i = 0; i < 2 * n; ++i) {
+        gates[i] = sigmoidApprox((gates[i] + recurrent[i] + static_cast<float>(layer.bias[i])) * layer.scale);
+    }
+    for (size_t i = 0; i < n; ++i) {
+        resetState[i] = gates[n + i] * state[i];
+    }
+    matvec(layer.recurrentWeights + 2 * n * n, resetState, recurrent + 2 * n, n, n);
+    for (size_t i = 0; i < n; ++i) {
+        const float candidate =
+            tanhApprox((gates[2 * n + i] + recurrent[2 * n + i] + static_cast<float>(layer.bias[2 * n + i])) *
+                       layer.scale);
+        const float z = gates[i];
+        state[i] = z * state[i] + (1.0f - z) * candidate;
+    }
+}
+
+/**
+ * @brief Band-local dense layer: output[b] = activation(scale * (sum_t W[t][b] input[t * bands + b] + b[b]))
+ */
+inline void computeBandDense(const BandDenseLayer& layer, float* output, const float* input) noexcept {
+    const size_t n = layer.bands;
+    std::fill_n(output, n, 0.0f);
+    for (size_t t = 0; t < layer.taps; ++t) {
+        multiplyAdd(layer.weights + t * n, input + t * n, output, n);
+    }
+    for (size_t i = 0; i < n; ++i) {
+        output[i] = activate((output[i] + static_cast<float>(layer.bias[i])) * layer.scale, layer.activation);
+    }
+}
+
+/**
+ * @brief One band-local GRU step, state updated in place (bands <= MAX_NEURONS)
+ */
+inline void computeBandGru(const BandGruLayer& layer, float* state, const float* input) noexcept {
+    const size_t n = layer.bands;
+    float gates[3 * MAX_NEURONS] = {};
+    float resetState[MAX_NEURONS];
+
+    for (size_t g = 0; g < 3; ++g) {
+        for (size_t t = 0; t < layer.taps; ++t) {
+            multiplyAdd(layer.inputWeights + (g * layer.taps + t) * n, input + t * n, gates + g * n, n);
+        }
+    }
+    multiplyAdd(layer.recurrentWeights, state, gates, n);
+    multiplyAdd(layer.recurrentWeights + n, state, gates + n, n);
+    for (size_t i = 0; i < 2 * n; ++i) {
+        gates[i] = sigmoidApprox((gates[i] + static_cast<float>(layer.bias[i])) * layer.scale);
+    }
+    for (size_t i = 0; i < n; ++i) {
+        resetState[i] = gates[n + i] * state[i];
+    }
+    multiplyAdd(layer.recurrentWeights + 2 * n, resetState, gates + 2 * n, n);
+    for (size_t i = 0; i < n; ++i) {
+        const float candidate = tanhApprox((gates[2 * n + i] + static_cast<float>(layer.bias[2 * n + i])) * layer.scale);
+        const float z = gates[i];
+        state[i] = z * state[i] + (1.0f - z) * candidate;
+    }
+}
+
+} // namespace Rnn
+} // namespace AudioNR
+#endif // __cplusplus
@@ -0,0 +1,164 @@
+#pragma once
+
+#ifdef __cplusplus
+#include "RnnLayers.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace AudioNR {
+namespace RnnModel {
+
+/**
+ * @brief Hand-set band-gain rule in int8 recurrent layer form (NOT a trained model)
+ *
+ * No trained weights ship with the repo, so this is not a neural suppressor.
+ * The weights are set by hand, band by band, so that the layers reproduce a
+ * classic noise-floor tracker and an SNR-driven band gain with attack /
+ * release smoothing. Every unit only sees
+ * its own band, so the layers are stored band-local (Rnn::BandGruLayer /
+ * Rnn::BandDenseLayer, one weight per tap and band) and run with element-wise
+ * kernels rather than dense matrix-vector products full of zeros. A trained
+ * RNNoise-style model, with cross-band connections, would use the dense
+ * Rnn::GruLayer / Rnn::DenseLayer kernels instead; the feature layout below
+ * and the RNNoiseSuppressor pipeline stay the same.
+ *
+ * Input: NB_FEATURES = per band normalized log energy x_b, then pitch
+ * correlation p_b. Layers (taps = inputs read by unit b):
+ *
+ *  1. NOISE_GRU   noise floor tracker, tap x_b: the update gate opens when
+ *                 x_b falls towards the state (fast decay) and closes above
+ *                 it (slow rise), candidate = tanh(x_b);
+ *  2. SNR_DENSE   band SNR logit, taps [x_b, p_b, n_b]:
+ *                 SNR_WEIGHT * (x_b - n_b) + PITCH_WEIGHT * p_b - SNR_OFFSET;
+ *  3. GAIN_GRU    attack / release smoothing of tanh(logit / 2): fast when
+ *                 the logit rises, slow when it falls (word tails, musical
+ *                 noise);
+ *  4. OUTPUT_DENSE band gain = sigmoid(OUTPUT_WEIGHT * state + OUTPUT_BIAS).
+ *
+ * The values are set from the feature scale (x = 1 for 240 dB, see
+ * RNNoiseSuppressorConstants) and are exact in int8 at the layer scales.
+ * test_RNNoiseReference.cpp (make test-rnnoise) pins the resulting output.
+ */
+
+constexpr size_t NB_BANDS = 22;
+constexpr size_t NB_FEATURES = 2 * NB_BANDS; // énergies log, puis corrélations de pitch
+constexpr size_t NOISE_GRU_SIZE = NB_BANDS;
+constexpr size_t SNR_DENSE_INPUTS = NB_FEATURES + NOISE_GRU_SIZE;
+constexpr size_t GAIN_GRU_SIZE = NB_BANDS;
+
+// Entrées lues par l'unité b de chaque couche (input[t * NB_BANDS + b])
+constexpr size_t NOISE_GRU_TAPS = 1; // x_b
+constexpr size_t SNR_DENSE_TAPS = 3; // x_b, p_b, n_b
+constexpr size_t GAIN_GRU_TAPS = 1;  // logit_b
+constexpr size_t OUTPUT_DENSE_TAPS = 1;
+
+// Échelles de quantification (valeur réelle = q * scale)
+constexpr float NOISE_GRU_SCALE = 0.5f;
+constexpr float SNR_DENSE_SCALE = 1.0f;
+constexpr float GAIN_GRU_SCALE = 0.25f;
+constexpr float OUTPUT_DENSE_SCALE = 0.5f;
+
+// Traqueur de bruit : z = sigmoid(K (x - n) + B)
+constexpr float NOISE_UPDATE_WEIGHT = 48.0f; // +20 dB au-dessus du plancher : z ≈ 0.993
+constexpr float NOISE_UPDATE_BIAS = 3.0f;    // au plancher : z ≈ 0.95
+constexpr float RESET_BIAS = 8.0f;           // r ≈ 1 : porte de reset inutilisée
+constexpr float CANDIDATE_WEIGHT = 1.0f;
+
+// Logit de SNR : 80 / 240 dB = 1 par 3 dB, 0 à +6 dB (0 dB si voisé)
+constexpr float SNR_WEIGHT = 80.0f;
+constexpr float PITCH_WEIGHT = 2.0f;
+constexpr float SNR_OFFSET = 2.0f;
+
+// Lissage du gain : z = sigmoid(K (g - logit / 2)) ; K faible pour que z ne sature pas
+// (écart 1 : z ≈ 0.82, ≈ 55 ms de relâchement ; attaque quasi immédiate)
+constexpr float GAIN_SMOOTHING_WEIGHT = 1.5f;
+constexpr float GAIN_CANDIDATE_WEIGHT = 0.5f;
+
+constexpr float OUTPUT_WEIGHT = 5.0f;
+constexpr float OUTPUT_BIAS = 1.5f;
+
+namespace detail {
+
+constexpr int8_t quantize(float value, float scale) {
+    const float q = value / scale;
+    const int rounded = static_cast<int>(q < 0.0f ? q - 0.5f : q + 0.5f);
+    return static_cast<int8_t>(rounded > 127 ? 127 : (rounded < -127 ? -127 : rounded));
+}
+
+// Une valeur par porte et par bande : [update | reset | candidate][bandes] ; biais,
+// poids d'entrée (une seule entrée) et poids récurrents d'un GRU band-local
+constexpr std::array<int8_t, 3 * NB_BANDS> gruGates(float update, float reset, float candidate, float scale) {
+    std::array<int8_t, 3 * NB_BANDS> gates{};
+    for (size_t i = 0; i < NB_BANDS; ++i) {
+        gates[i] = quantize(update, scale);
+        gates[NB_BANDS + i] = quantize(reset, scale);
+        gates[2 * NB_BANDS + i] = quantize(candidate, scale);
+    }
+    return gates;
+}
+
+// Poids [taps][bandes], le même pour toutes les bandes d'une entrée
+template <size_t Taps>
+constexpr std::array<int8_t, Taps * NB_BANDS> bandWeights(const float (&values)[Taps], float scale) {
+    std::array<int8_t, Taps * NB_BANDS> weights{};
+    for (size_t t = 0; t < Taps; ++t) {
+        for (size_t b = 0; b < NB_BANDS; ++b) {
+            weights[t * NB_BANDS + b] = quantize(values[t], scale);
+        }
+    }
+    return weights;
+}
+
+template <size_t Outputs>
+constexpr std::array<int8_t, Outputs> uniformBias(float value, float scale) {
+    std::array<int8_t, Outputs> bias{};
+    for (size_t i = 0; i < Outputs; ++i) {
+        bias[i] = quantize(value, scale);
+    }
+    return bias;
+}
+
+} // namespace detail
+
+// 1. Traqueur de plancher de bruit
+inline constexpr auto NOISE_GRU_BIAS = detail::gruGates(NOISE_UPDATE_BIAS, RESET_BIAS, 0.0f, NOISE_GRU_SCALE);
+inline constexpr auto NOISE_GRU_INPUT_WEIGHTS =
+    detail::gruGates(NOISE_UPDATE_WEIGHT, 0.0f, CANDIDATE_WEIGHT, NOISE_GRU_SCALE);
+inline constexpr auto NOISE_GRU_RECURRENT_WEIGHTS = detail::gruGates(-NOISE_UPDATE_WEIGHT, 0.0f, 0.0f, NOISE_GRU_SCALE);
+
+// 2. Logit de SNR par bande
+inline constexpr auto SNR_DENSE_BIAS = detail::uniformBias<NB_BANDS>(-SNR_OFFSET, SNR_DENSE_SCALE);
+inline constexpr float SNR_TAP_WEIGHTS[SNR_DENSE_TAPS] = {SNR_WEIGHT, PITCH_WEIGHT, -SNR_WEIGHT};
+inline constexpr auto SNR_DENSE_WEIGHTS = detail::bandWeights(SNR_TAP_WEIGHTS, SNR_DENSE_SCALE);
+
+// 3. Attaque / relâchement du gain
+inline constexpr auto GAIN_GRU_BIAS = detail::gruGates(0.0f, RESET_BIAS, 0.0f, GAIN_GRU_SCALE);
+inline constexpr auto GAIN_GRU_INPUT_WEIGHTS = detail::gruGates(-GAIN_SMOOTHING_WEIGHT * GAIN_CANDIDATE_WEIGHT, 0.0f,
+                                                                GAIN_CANDIDATE_WEIGHT, GAIN_GRU_SCALE);
+inline constexpr auto GAIN_GRU_RECURRENT_WEIGHTS = detail::gruGates(GAIN_SMOOTHING_WEIGHT, 0.0f, 0.0f, GAIN_GRU_SCALE);
+
+// 4. Gains de bande
+inline constexpr auto OUTPUT_DENSE_BIAS = detail::uniformBias<NB_BANDS>(OUTPUT_BIAS, OUTPUT_DENSE_SCALE);
+inline constexpr float OUTPUT_TAP_WEIGHTS[OUTPUT_DENSE_TAPS] = {OUTPUT_WEIGHT};
+inline constexpr auto OUTPUT_DENSE_WEIGHTS = detail::bandWeights(OUTPUT_TAP_WEIGHTS, OUTPUT_DENSE_SCALE);
+
+inline constexpr Rnn::BandGruLayer NOISE_GRU{NOISE_GRU_BIAS.data(), NOISE_GRU_INPUT_WEIGHTS.data(),
+                                             NOISE_GRU_RECURRENT_WEIGHTS.data(), NOISE_GRU_TAPS, NOISE_GRU_SIZE,
+                                             NOISE_GRU_SCALE};
+inline constexpr Rnn::BandDenseLayer SNR_DENSE{SNR_DENSE_BIAS.data(), SNR_DENSE_WEIGHTS.data(), SNR_DENSE_TAPS,
+                                               NB_BANDS, SNR_DENSE_SCALE, Rnn::Activation::LINEAR};
+inline constexpr Rnn::BandGruLayer GAIN_GRU{GAIN_GRU_BIAS.data(), GAIN_GRU_INPUT_WEIGHTS.data(),
+                                            GAIN_GRU_RECURRENT_WEIGHTS.data(), GAIN_GRU_TAPS, GAIN_GRU_SIZE,
+                                            GAIN_GRU_SCALE};
+inline constexpr Rnn::BandDenseLayer OUTPUT_DENSE{OUTPUT_DENSE_BIAS.data(), OUTPUT_DENSE_WEIGHTS.data(),
+                                                  OUTPUT_DENSE_TAPS, NB_BANDS, OUTPUT_DENSE_SCALE,
+                                                  Rnn::Activation::SIGMOID};
+
+static_assert(NOISE_GRU_SIZE == NB_BANDS && GAIN_GRU_SIZE == NB_BANDS, "band-local layers have one unit per band");
+static_assert(NOISE_GRU_SIZE <= Rnn::MAX_NEURONS && GAIN_GRU_SIZE <= Rnn::MAX_NEURONS,
+              "GRU layer exceeds Rnn::MAX_NEURONS");
+
+} // namespace RnnModel
+} // namespace AudioNR
+#endif // __cplusplus
@@ -0,0 +1,203 @@
+#include "OfflineDenoiser.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <exception>
+#include <stdexcept>
+#include <thread>
+
+namespace AudioNR {
+
+using namespace OfflineDenoiserConstants;
+using Nyth::Audio::FX::WavData;
+using Nyth::Audio::FX::WavReader;
+
+namespace {
+// Taille des blocs passés au réducteur dans une tâche
+constexpr size_t PROCESS_BLOCK_SIZE = 4096;
+
+size_t secondsToSamples(double seconds, uint32_t sampleRate) {
+    return static_cast<size_t>(std::llround(seconds * static_cast<double>(sampleRate)));
+}
+} // namespace
+
+OfflineDenoiser::OfflineDenoiser(const Config& cfg) : cfg_(cfg) {
+    if (!(cfg_.chunkSeconds >= MIN_CHUNK_SECONDS)) {
+        throw std::invalid_argument("Chunk duration too short");
+    }
+    if (!(cfg_.prerollSeconds >= 0.0 && cfg_.prerollSeconds <= MAX_PREROLL_SECONDS)) {
+        throw std::invalid_argument("Pre-roll duration out of range");
+    }
+    if (!(cfg_.crossfadeMs >= 0.0 && cfg_.crossfadeMs <= MAX_CROSSFADE_MS)) {
+        throw std::invalid_argument("Crossfade duration out of range");
+    }
+}
+
+OfflineDenoiser::OfflineDenoiser() : OfflineDenoiser(Config{}) {}
+
+OfflineDenoiser::Layout OfflineDenoiser::makeLayout(uint32_t sampleRate, size_t numFrames) const {
+    Layout layout;
+    layout.chunk = std::max<size_t>(secondsToSamples(cfg_.chunkSeconds, sampleRate), 1);
+    layout.preroll = secondsToSamples(cfg_.prerollSeconds, sampleRate);
+    layout.crossfade = std::min(secondsToSamples(cfg_.crossfadeMs * 0.001, sampleRate), layout.chunk);
+    layout.lookahead = cfg_.spectral.fftSize;
+    layout.numChunks = (numFrames + layout.chunk - 1) / layout.chunk;
+    return layout;
+}
+
+void OfflineDenoiser::process(const WavData& input, WavData& output) const {
+    const size_t numChannels = input.channels.size();
+    const size_t numFrames = input.getNumFrames();
+    for (const auto& channel : input.channels) {
+        if (channel.size() != numFrames) {
+            throw std::invalid_argument("Channels must have the same length");
+        }
+    }
+
+    // Configuration validée ici : les tâches ne peuvent plus échouer sur elle
+    SpectralNRConfig spectral = cfg_.spectral;
+    spectral.sampleRate = input.sampleRate;
+    SpectralNR probe(spectral);
+
+    output.sampleRate = input.sampleRate;
+    output.channels.assign(numChannels, std::vector<float>(numFrames, 0.0f));
+    if (numChannels == 0 || numFrames == 0) {
+        return;
+    }
+
+    // Une tâche par (bloc, groupe de canaux) : paire stéréo liée, sinon canal par canal
+    const Layout layout = makeLayout(input.sampleRate, numFrames);
+    const size_t groupSize = (numChannels == 2) ? 2 : 1;
+    const size_t numGroups = numChannels / groupSize;
+    const size_t numTasks = layout.numChunks * numGroups;
+    std::vector<std::vector<float>> heads(layout.numChunks * numChannels);
+
+    size_t numThreads = cfg_.numThreads;
+    if (numThreads == 0) {
+        numThreads = std::max<size_t>(1, std::thread::hardware_concurrency());
+    }
+    numThreads = std::min(numThreads, numTasks);
+
+    std::atomic<size_t> nextTask{0};
+    std::atomic<bool> failed{false};
+    std::exception_ptr firstError;
+    std::atomic_flag errorTaken = ATOMIC_FLAG_INIT;
+
+    auto worker = [&]() {
+        for (size_t task = nextTask.fetch_add(1); task < numTasks && !failed.load(); task = nextTask.fetch_add(1)) {
+            try {
+                const size_t chunkIndex = task / numGroups;
+                const size_t group = task % numGroups;
+                processChunk(input, output, layout, chunkIndex, group * groupSize, groupSize, heads);
+            } catch (...) {
+                if (!errorTaken.test_and_set()) {
+                    firstError = std::current_exception();
+                }
+                failed.store(true);
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(numThreads - 1);
+    for (size_t t = 1; t < numThreads; ++t) {
+        threads.emplace_back(worker);
+    }
+    worker();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    if (firstError) {
+        std::rethrow_exception(firstError);
+    }
+
+    // Raccords : fondu linéaire entre la fin du bloc précédent et le début du suivant
+    for (size_t k = 1; k < layout.numChunks; ++k) {
+        const size_t start = k * layout.chunk;
+        for (size_t c = 0; c < numChannels; ++c) {
+            const std::vector<float>& head = heads[k * numChannels + c];
+            const size_t length = head.size();
+            float* out = output.channels[c].data() + (start - length);
+            for (size_t i = 0; i < length; ++i) {
+                const float weight = (static_cast<float>(i) + 0.5f) / static_cast<float>(length);
+                out[i] = (1.0f - weight) * out[i] + weight * head[i];
+            }
+        }
+    }
+}
+
+// Bloc k : préchauffage [warmStart, headStart), fondu [headStart, start),
+// rendu [start, end), anticipation [end, feedEnd) puis latence du STFT en zéros
+void OfflineDenoiser::processChunk(const WavData& input, WavData& output, const Layout& layout, size_t chunkIndex,
+                                   size_t firstChannel, size_t numChannels,
+                                   std::vector<std::vector<float>>& heads) const {
+    const size_t numFrames = input.getNumFrames();
+    const size_t start = chunkIndex * layout.chunk;
+    const size_t end = std::min(numFrames, start + layout.chunk);
+    const size_t headLength = (chunkIndex == 0) ? 0 : std::min(layout.crossfade, start);
+    const size_t headStart = start - headLength;
+    const size_t warmStart = headStart - std::min(layout.preroll, headStart);
+    const size_t feedEnd = std::min(numFrames, end + layout.lookahead);
+
+    SpectralNRConfig spectral = cfg_.spectral;
+    spectral.sampleRate = input.sampleRate;
+    SpectralNR reducer(spectral);
+    const size_t latency = reducer.getLatency();
+
+    std::vector<std::vector<float>> in(numChannels, std::vector<float>(PROCESS_BLOCK_SIZE));
+    std::vector<std::vector<float>> out(numChannels, std::vector<float>(PROCESS_BLOCK_SIZE));
+    for (size_t c = 0; c < numChannels; ++c) {
+        heads[chunkIndex * input.channels.size() + firstChannel + c].assign(headLength, 0.0f);
+    }
+
+    // Position p du flux : entrée au temps warmStart + p, sortie au temps warmStart + p - latency
+    const size_t streamLength = (end - warmStart) + latency;
+    for (size_t position = 0; position < streamLength; position += PROCESS_BLOCK_SIZE) {
+        const size_t count = std::min(PROCESS_BLOCK_SIZE, streamLength - position);
+        const size_t time = warmStart + position;
+        const size_t available = (time < feedEnd) ? std::min(count, feedEnd - time) : 0;
+        for (size_t c = 0; c < numChannels; ++c) {
+            if (available > 0) {
+                const float* source = input.channels[firstChannel + c].data() + time;
+                std::copy(source, source + available, in[c].begin());
+            }
+            std::fill(in[c].begin() + available, in[c].begin() + count, 0.0f);
+        }
+
+        if (numChannels == 2) {
+            reducer.processStereo(in[0].data(), in[1].data(), out[0].data(), out[1].data(), count);
+        } else {
+            reducer.process(in[0].data(), out[0].data(), count);
+        }
+
+        // Seuls les instants de [headStart, end) sont conservés
+        for (size_t i = 0; i < count; ++i) {
+            if (time + i < headStart + latency) {
+                continue;
+            }
+            const size_t t = time + i - latency;
+            if (t >= end) {
+                break;
+            }
+            for (size_t c = 0; c < numChannels; ++c) {
+                const size_t channel = firstChannel + c;
+                if (t < start) {
+                    heads[chunkIndex * input.channels.size() + channel][t - headStart] = out[c][i];
+                } else {
+                    output.channels[channel][t] = out[c][i];
+                }
+            }
+        }
+    }
+}
+
+bool OfflineDenoiser::processFile(const std::string& path, WavData& output, std::string* error) const {
+    WavData decoded;
+    if (!WavReader::readFile(path, decoded, error)) {
+        return false;
+    }
+    process(decoded, output);
+    return true;
+}
+
+} // namespace AudioNR
@@ -0,0 +1,95 @@
+#pragma once
+
+#ifdef __cplusplus
+#include "../../../common/config/NoiseConstants.hpp"
+#include "../../../common/utils/WavReader.hpp"
+#include "../Spectral/SpectralNR.hpp"
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace AudioNR {
+
+/**
+ * @brief Offline denoising of a whole recording on several cores
+ *
+ * The file is cut into chunks processed in parallel, each task running its
+ * own SpectralNR (MMSE-LSA with the VAD-gated noise estimate by default,
+ * processStereo with the configured channel link for stereo files):
+ *
+ *   |<- preroll ->|<- crossfade ->|<-------- chunk -------->|<- fftSize ->|
+ *    warm-up only   rendered, faded  rendered                 lookahead only
+ *                   with chunk k-1
+ *
+ * - preroll: the signal before the chunk is run through the reducer and
+ *   discarded, so the noise estimate has converged when the chunk starts;
+ * - crossfade: the chunk also renders the end of the previous one, and the
+ *   two renderings are crossfaded linearly (they are the same signal with
+ *   nearly the same gains, so amplitudes add up);
+ * - lookahead: fftSize samples after the chunk complete the last frames,
+ *   so no rendered sample comes from a zero-padded frame.
+ * The STFT latency is removed: output[i] lines up with input[i].
+ *
+ * Tasks are (chunk, channel group) pairs taken from a shared counter by
+ * numThreads workers; each task only writes its own chunk range of the
+ * output (plus a private crossfade head), so no locking is needed.
+ */
+class OfflineDenoiser {
+public:
+    struct Config {
+        SpectralNRConfig spectral = defaultSpectralConfig(); ///< sampleRate is taken from the file
+        double chunkSeconds = OfflineDenoiserConstants::DEFAULT_CHUNK_SECONDS;
+        double prerollSeconds = OfflineDenoiserConstants::DEFAULT_PREROLL_SECONDS;
+        double crossfadeMs = OfflineDenoiserConstants::DEFAULT_CROSSFADE_MS;
+        size_t numThreads = 0; ///< 0 = hardware concurrency
+    };
+
+    /**
+     * @throws std::invalid_argument on out-of-range chunk, preroll or crossfade
+     */
+    explicit OfflineDenoiser(const Config& cfg);
+    OfflineDenoiser();
+
+    /**
+     * @brief Denoises every channel of a decoded file (non real-time)
+     * @throws std::invalid_argument if the spectral configuration is rejected for the file
+     */
+    void process(const Nyth::Audio::FX::WavData& input, Nyth::Audio::FX::WavData& output) const;
+
+    /**
+     * @brief Reads a WAV file and denoises it (non real-time)
+     * @param error optional human readable reason on failure
+     * @return false if the file cannot be decoded
+     */
+    bool processFile(const std::string& path, Nyth::Audio::FX::WavData& output, std::string* error = nullptr) const;
+
+    const Config& getConfig() const {
+        return cfg_;
+    }
+
+private:
+    Config cfg_;
+
+    // Découpage en échantillons pour une fréquence donnée
+    struct Layout {
+        size_t chunk = 0;
+        size_t preroll = 0;
+        size_t crossfade = 0;
+        size_t lookahead = 0;
+        size_t numChunks = 0;
+    };
+
+    static SpectralNRConfig defaultSpectralConfig() {
+        SpectralNRConfig spectral;
+        spectral.gainRule = SpectralNRConfig::GainRule::MMSE_LSA;
+        return spectral;
+    }
+
+    Layout makeLayout(uint32_t sampleRate, size_t numFrames) const;
+    void processChunk(const Nyth::Audio::FX::WavData& input, Nyth::Audio::FX::WavData& output, const Layout& layout,
+                      size_t chunkIndex, size_t firstChannel, size_t numChannels,
+                      std::vector<std::vector<float>>& heads) const;
+};
+
+} // namespace AudioNR
+#endif // __cplusplus
@@ -1,12 +1,11 @@
 #pragma once
 
 #ifdef __cplusplus
-#include "../../../common/dsp/FFTEngine.hpp"
+#include "../../../common/dsp/StftProcessor.hpp"
 #include "../Imcra/Imcra.hpp"
 #include "../Wiener/WienerFilter.hpp"
 #include "MultibandProcessor.hpp"
 #include <memory>
-#include <string>
 #include <vector>
 
 namespace AudioNR {
@@ -137,30 +136,23 @@ public:
      * @return Latency in samples
      */
     size_t getLatency() const {
-        return cfg_.fftSize - cfg_.hopSize;
+        return stft_.getLatency();
     }
 
 private:
     Config cfg_;
     size_t numBins_;
-    size_t writePos_;
 
     // Core components
     std::unique_ptr<IMCRA> imcra_;
     std::unique_ptr<WienerFilter> wienerFilter_;
     std::unique_ptr<TwoStepNoiseReduction> twoStepFilter_;
     std::unique_ptr<MultibandProcessor> multibandProcessor_;
-    std::unique_ptr<Nyth::Audio::FX::IFFTEngine> fftEngine_;
 
-    // Buffers
-    std::vector<float> window_;
-    std::vector<float> inputBuffer_;
-    std::vector<float> outputBuffer_;
-    std::vector<float> frameBuffer_;
+    // Framing / overlap-add (ring buffers, pre-allocated)
+    Nyth::Audio::FX::StftProcessor stft_;
 
     // Spectral data
-    std::vector<float> realSpec_;
-    std::vector<float> imagSpec_;
     std::vector<float> magnitude_;
     std::vector<float> phase_;
     std::vector<float> processedMag_;
@@ -180,8 +172,7 @@ private:
 
     // Helper functions
     void initializeComponents();
-    void buildWindow();
-    void processFrame();
+    void processFrame(float* re, float* im, size_t numBins); // STFT callback, half spectrum in place
 
     // Processing methods
     void applySpectralSubtraction();
@@ -202,82 +193,5 @@ private:
     float computeSpectralCentroid(const std::vector<float>& mag);
 };
 
-/**
- * @brief Hybrid noise reducer combining multiple techniques
- *
- * Intelligently switches between different algorithms based on
- * signal characteristics for optimal results
- */
-class HybridNoiseReducer {
-public:
-    struct Config {
-        uint32_t sampleRate = AdvancedSpectralNRConstants::DEFAULT_SAMPLE_RATE;
-        size_t blockSize = AdvancedSpectralNRConstants::DEFAULT_BLOCK_SIZE;
-
-        // Decision thresholds
-        float speechThreshold =
-            AdvancedSpectralNRConstants::SPEECH_DETECTION_THRESHOLD; ///< Threshold for speech detection
-        float musicThreshold =
-            AdvancedSpectralNRConstants::MUSIC_DETECTION_THRESHOLD; ///< Threshold for music detection
-        float transientThreshold =
-            AdvancedSpectralNRConstants::TRANSIENT_DETECTION_THRESHOLD; ///< Threshold for transient detection
-
-        // Algorithm weights for different content types
-        struct Weights {
-            // Speech weights
-            float speechWiener = AdvancedSpectralNRConstants::AlgorithmWeights::SPEECH_WIENER;
-            float speechSpectral = AdvancedSpectralNRConstants::AlgorithmWeights::SPEECH_SPECTRAL;
-
-            // Music weights
-            float musicWiener = AdvancedSpectralNRConstants::AlgorithmWeights::MUSIC_WIENER;
-            float musicMultiband = AdvancedSpectralNRConstants::AlgorithmWeights::MUSIC_MULTIBAND;
-
-            // Noise weights
-            float noiseSpectral = AdvancedSpectralNRConstants::AlgorithmWeights::NOISE_SPECTRAL;
-            float noiseWiener = AdvancedSpectralNRConstants::AlgorithmWeights::NOISE_WIENER;
-        } weights;
-    };
-
-    explicit HybridNoiseReducer(const Config& cfg);
-    explicit HybridNoiseReducer();
-    ~HybridNoiseReducer();
-
-    /**
-     * @brief Process audio with hybrid noise reduction
-     * @param input Input buffer
-     * @param output Output buffer
-     * @param numSamples Number of samples
-     */
-    void process(const float* input, float* output, size_t numSamples);
-
-    /**
-     * @brief Get detected content type
-     * @return Content type string ("speech", "music", "noise", "mixed")
-     */
-    std::string getDetectedContentType() const;
-
-private:
-    Config cfg_;
-
-    // Multiple processing engines
-    std::unique_ptr<AdvancedSpectralNR> spectralNR_;
-    std::unique_ptr<WienerFilter> wienerFilter_;
-    std::unique_ptr<MultibandProcessor> multibandProcessor_;
-
-    // Content analysis
-    enum ContentType { SPEECH, MUSIC, NOISE, MIXED };
-    ContentType currentContent_;
-
-    // Analysis buffers
-    std::vector<float> analysisBuffer_;
-    std::vector<float> featureBuffer_;
-
-    // Helper functions
-    ContentType analyzeContent(const float* input, size_t numSamples);
-    void selectAlgorithm(ContentType content);
-    float computeZCR(const float* signal, size_t length);
-    float computeSpectralFlux(const std::vector<float>& mag);
-};
-
 } // namespace AudioNR
 #endif // __cplusplus
@@ -0,0 +1,55 @@
+#pragma once
+
+#ifdef __cplusplus
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+namespace AudioNR {
+
+/**
+ * @brief How a stereo noise reducer couples its two channels
+ *
+ * Linking the noise estimate keeps per-channel gains (each side is cleaned
+ * against the same floor); linking the gain mask applies one gain per bin to
+ * both sides, which leaves the inter-channel level and phase differences,
+ * i.e. the stereo image, untouched.
+ */
+enum class ChannelLink : uint8_t {
+    INDEPENDENT, ///< noise and gains per channel
+    NOISE_MEAN,  ///< shared noise estimate: mean of the channels
+    NOISE_MAX,   ///< shared noise estimate: max of the channels (more reduction)
+    MASK_MEAN,   ///< shared gain mask: mean of the channel gains
+    MASK_MAX     ///< shared gain mask: max of the channel gains (keeps sources present on one side)
+};
+
+inline bool linksNoise(ChannelLink link) noexcept {
+    return link == ChannelLink::NOISE_MEAN || link == ChannelLink::NOISE_MAX;
+}
+
+inline bool linksMask(ChannelLink link) noexcept {
+    return link == ChannelLink::MASK_MEAN || link == ChannelLink::MASK_MAX;
+}
+
+/**
+ * @brief a[k] = b[k] = mean or max of a[k] and b[k], according to link
+ * @note No-op for INDEPENDENT; the caller picks which quantity is linked
+ */
+inline void linkChannels(float* a, float* b, size_t n, ChannelLink link) noexcept {
+    if (link == ChannelLink::NOISE_MAX || link == ChannelLink::MASK_MAX) {
+        for (size_t k = 0; k < n; ++k) {
+            const float v = std::max(a[k], b[k]);
+            a[k] = v;
+            b[k] = v;
+        }
+    } else if (link != ChannelLink::INDEPENDENT) {
+        for (size_t k = 0; k < n; ++k) {
+            const float v = 0.5f * (a[k] + b[k]);
+            a[k] = v;
+            b[k] = v;
+        }
+    }
+}
+
+} // namespace AudioNR
+#endif // __cplusplus
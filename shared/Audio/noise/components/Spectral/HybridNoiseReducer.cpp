@@ -0,0 +1,273 @@
+#include "HybridNoiseReducer.hpp"
+#include "../../../common/dsp/VectorMath.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace AudioNR {
+
+using namespace AdvancedSpectralNRConstants::Hybrid;
+
+namespace VectorMath = Nyth::Audio::FX::VectorMath;
+using Nyth::Audio::FX::VoiceActivityDetector;
+
+HybridNoiseReducer::HybridNoiseReducer(const Config& cfg) : cfg_(cfg) {
+    if (cfg_.sampleRate < GlobalAudioConstants::MIN_SAMPLE_RATE ||
+        cfg_.sampleRate > GlobalAudioConstants::MAX_SAMPLE_RATE) {
+        throw std::invalid_argument("Sample rate out of range");
+    }
+    if (cfg_.minGain < 0.0f || cfg_.minGain > 1.0f) {
+        throw std::invalid_argument("Minimum gain must be between 0.0 and 1.0");
+    }
+
+    // Une seule analyse : fenêtres, anneaux et FFT alloués ici, process() n'alloue pas
+    stft_.prepare(cfg_.fftSize, cfg_.blockSize);
+    numBins_ = stft_.getNumBins();
+    vad_.prepare(cfg_.sampleRate, cfg_.fftSize, cfg_.blockSize, stft_.getAnalysisWindow());
+
+    IMCRA::Config imcraCfg;
+    imcraCfg.fftSize = cfg_.fftSize;
+    imcraCfg.sampleRate = cfg_.sampleRate;
+    imcra_ = std::make_unique<IMCRA>(imcraCfg);
+
+    // Le filtre de Wiener reçoit le bruit de l'IMCRA partagé (updateGains)
+    WienerFilter::Config wienerCfg;
+    wienerCfg.fftSize = cfg_.fftSize;
+    wienerCfg.sampleRate = cfg_.sampleRate;
+    wienerCfg.minGain = cfg_.minGain;
+    wienerCfg.noiseMode = WienerFilter::Config::SIMPLE;
+    wienerFilter_ = std::make_unique<WienerFilter>(wienerCfg);
+
+    MultibandProcessor::Config multibandCfg;
+    multibandCfg.sampleRate = cfg_.sampleRate;
+    multibandCfg.fftSize = cfg_.fftSize;
+    multibandProcessor_ = std::make_unique<MultibandProcessor>(multibandCfg);
+
+    for (std::vector<float>* buffer : {&power_, &magnitude_, &prevMagnitude_, &noiseMagnitude_, &noisePower_,
+                                       &speechProbability_, &multibandGains_, &gains_, &featureBuffer_}) {
+        buffer->assign(numBins_, 0.0f);
+    }
+
+    const float binsPerHz = static_cast<float>(cfg_.fftSize) / static_cast<float>(cfg_.sampleRate);
+    speechBandBegin_ = std::min(static_cast<size_t>(SPEECH_BAND_LOW * binsPerHz), numBins_ - 1);
+    speechBandEnd_ = std::clamp(static_cast<size_t>(SPEECH_BAND_HIGH * binsPerHz), speechBandBegin_ + 1, numBins_);
+
+    reset();
+}
+
+HybridNoiseReducer::HybridNoiseReducer() : HybridNoiseReducer(Config{}) {}
+
+HybridNoiseReducer::~HybridNoiseReducer() = default;
+
+void HybridNoiseReducer::reset() {
+    stft_.reset();
+    vad_.reset();
+    imcra_->reset();
+    wienerFilter_->reset();
+    multibandProcessor_->reset();
+    std::fill(prevMagnitude_.begin(), prevMagnitude_.end(), 0.0f);
+
+    zeroCrossingRate_ = 0.0f;
+    speechScore_ = 0.0f;
+    musicScore_ = 0.0f;
+    activity_ = 0.0f;
+    slowEnergy_ = 0.0f;
+    currentContent_ = NOISE;
+    selectAlgorithm(currentContent_);
+    weights_ = targetWeights_;
+}
+
+void HybridNoiseReducer::process(const float* input, float* output, size_t numSamples) {
+    if (!input || !output) {
+        throw std::invalid_argument("Input and output buffers must not be null");
+    }
+    if (numSamples == 0) {
+        return;
+    }
+
+    stft_.process(input, output, numSamples,
+                  [this](float* re, float* im, size_t numBins) { processFrame(re, im, numBins); });
+}
+
+void HybridNoiseReducer::processFrame(float* re, float* im, size_t numBins) {
+    // Analyse commune au classifieur et aux trois règles de gain
+    VectorMath::power(re, im, power_.data(), numBins);
+    VectorMath::sqrt(power_.data(), magnitude_.data(), numBins);
+    const bool voice = vad_.processSpectrum(power_.data(), numBins);
+    imcra_->setVoiceActivity(voice);
+    imcra_->processFrame(magnitude_.data(), noiseMagnitude_.data(), speechProbability_.data());
+    for (size_t k = 0; k < numBins; ++k) {
+        noisePower_[k] = noiseMagnitude_[k] * noiseMagnitude_[k];
+    }
+
+    // Transitoire : saut de l'énergie de trame (VAD) au-dessus de sa moyenne lente
+    const float energy = vad_.getFeatures().energy;
+    const float transientRatio = std::pow(10.0f, 0.1f * cfg_.transientThreshold);
+    const bool transient = slowEnergy_ > 0.0f && energy > transientRatio * slowEnergy_;
+    slowEnergy_ = ENERGY_SMOOTHING * slowEnergy_ + (1.0f - ENERGY_SMOOTHING) * energy;
+
+    // Sans activité, pas de classification : poids du bruit
+    currentContent_ = voice ? analyzeContent() : NOISE;
+    selectAlgorithm(currentContent_);
+    for (size_t r = 0; r < NUM_RULES; ++r) {
+        weights_[r] = WEIGHT_SMOOTHING * weights_[r] + (1.0f - WEIGHT_SMOOTHING) * targetWeights_[r];
+    }
+
+    blendGains(transient);
+    VectorMath::scaleComplex(re, im, gains_.data(), numBins);
+    magnitude_.swap(prevMagnitude_);
+}
+
+HybridNoiseReducer::ContentType HybridNoiseReducer::analyzeContent() {
+    // Activité : présence de signal IMCRA pondérée par l'énergie dans la bande vocale,
+    // diminuée pour un souffle large bande (spectre plat, passages par zéro fréquents)
+    float presence = 0.0f;
+    float bandEnergy = POWER_EPSILON;
+    for (size_t k = speechBandBegin_; k < speechBandEnd_; ++k) {
+        presence += speechProbability_[k] * power_[k];
+        bandEnergy += power_[k];
+    }
+    presence /= bandEnergy;
+    const VoiceActivityDetector::Features& features = vad_.getFeatures();
+    const float flatness = features.flatness;
+    zeroCrossingRate_ =
+        SCORE_SMOOTHING * zeroCrossingRate_ + (1.0f - SCORE_SMOOTHING) * features.zeroCrossingRate;
+    const float hiss = flatness * std::min(zeroCrossingRate_ / ZCR_NOISE_LEVEL, 1.0f);
+    const float activity = presence * (1.0f - hiss);
+
+    // Parole : spectre qui change d'une trame à l'autre ; musique : tonal et stable
+    const float variation = std::min(computeSpectralFlux() * FLUX_SCALE, 1.0f);
+    const float speech = activity * variation;
+    const float music = activity * (1.0f - flatness) * (1.0f - variation);
+
+    activity_ = SCORE_SMOOTHING * activity_ + (1.0f - SCORE_SMOOTHING) * activity;
+    speechScore_ = SCORE_SMOOTHING * speechScore_ + (1.0f - SCORE_SMOOTHING) * speech;
+    musicScore_ = SCORE_SMOOTHING * musicScore_ + (1.0f - SCORE_SMOOTHING) * music;
+
+    if (activity_ < ACTIVITY_THRESHOLD) {
+        return NOISE;
+    }
+    if (speechScore_ >= cfg_.speechThreshold * activity_) {
+        return SPEECH;
+    }
+    if (musicScore_ >= cfg_.musicThreshold * activity_) {
+        return MUSIC;
+    }
+    return MIXED;
+}
+
+void HybridNoiseReducer::selectAlgorithm(ContentType content) {
+    const Config::Weights& w = cfg_.weights;
+    switch (content) {
+        case SPEECH:
+            targetWeights_ = {w.speechSpectral, w.speechWiener, 0.0f};
+            break;
+        case MUSIC:
+            targetWeights_ = {0.0f, w.musicWiener, w.musicMultiband};
+            break;
+        case MIXED:
+            targetWeights_ = {0.5f * w.speechSpectral, 0.5f * (w.speechWiener + w.musicWiener),
+                              0.5f * w.musicMultiband};
+            break;
+        case NOISE:
+        default:
+            targetWeights_ = {w.noiseSpectral, w.noiseWiener, 0.0f};
+            break;
+    }
+
+    float sum = 0.0f;
+    for (float& weight : targetWeights_) {
+        weight = std::max(weight, 0.0f);
+        sum += weight;
+    }
+    if (sum <= 0.0f) {
+        targetWeights_ = {0.0f, 1.0f, 0.0f};
+        return;
+    }
+    for (float& weight : targetWeights_) {
+        weight /= sum;
+    }
+}
+
+// Mélange par case des gains des règles actives, normalisé par leurs poids
+void HybridNoiseReducer::blendGains(bool transient) {
+    const float minGain = cfg_.minGain;
+    float* scratch = featureBuffer_.data();
+    float totalWeight = 0.0f;
+    std::fill(gains_.begin(), gains_.end(), 0.0f);
+
+    if (weights_[SPECTRAL] > WEIGHT_EPSILON) {
+        // Soustraction de puissance : sqrt(max(1 - beta |N|² / |X|², 0))
+        for (size_t k = 0; k < numBins_; ++k) {
+            scratch[k] = std::max(1.0f - SUBTRACTION_BETA * noisePower_[k] / (power_[k] + POWER_EPSILON), 0.0f);
+        }
+        VectorMath::sqrt(scratch, scratch, numBins_);
+        const float weight = weights_[SPECTRAL];
+        for (size_t k = 0; k < numBins_; ++k) {
+            gains_[k] += weight * std::max(scratch[k], minGain);
+        }
+        totalWeight += weight;
+    }
+
+    if (weights_[WIENER] > WEIGHT_EPSILON) {
+        wienerFilter_->updateGains(magnitude_.data(), noisePower_.data());
+        const std::vector<float>& wienerGains = wienerFilter_->getGains();
+        const float weight = weights_[WIENER];
+        for (size_t k = 0; k < numBins_; ++k) {
+            gains_[k] += weight * wienerGains[k];
+        }
+        totalWeight += weight;
+    }
+
+    if (weights_[MULTIBAND] > WEIGHT_EPSILON) {
+        multibandProcessor_->computeGains(power_.data(), noisePower_.data(), multibandGains_.data());
+        const float weight = weights_[MULTIBAND];
+        for (size_t k = 0; k < numBins_; ++k) {
+            gains_[k] += weight * multibandGains_[k];
+        }
+        totalWeight += weight;
+    }
+
+    const float normalization = (totalWeight > 0.0f) ? 1.0f / totalWeight : 0.0f;
+    for (size_t k = 0; k < numBins_; ++k) {
+        gains_[k] = std::clamp(gains_[k] * normalization, minGain, 1.0f);
+    }
+
+    // Sur une attaque, gain instantané (beta = 1) : les lissages temporels n'étalent pas l'attaque
+    if (transient) {
+        for (size_t k = 0; k < numBins_; ++k) {
+            scratch[k] = std::max(1.0f - noisePower_[k] / (power_[k] + POWER_EPSILON), 0.0f);
+        }
+        VectorMath::sqrt(scratch, scratch, numBins_);
+        for (size_t k = 0; k < numBins_; ++k) {
+            gains_[k] = std::max(gains_[k], scratch[k]);
+        }
+    }
+}
+
+// Flux positif normalisé : part de l'amplitude apparue depuis la trame précédente
+float HybridNoiseReducer::computeSpectralFlux() {
+    float rise = 0.0f;
+    float total = POWER_EPSILON;
+    for (size_t k = 0; k < numBins_; ++k) {
+        rise += std::max(magnitude_[k] - prevMagnitude_[k], 0.0f);
+        total += magnitude_[k];
+    }
+    return rise / total;
+}
+
+std::string HybridNoiseReducer::getDetectedContentType() const {
+    switch (currentContent_) {
+        case SPEECH:
+            return "speech";
+        case MUSIC:
+            return "music";
+        case MIXED:
+            return "mixed";
+        case NOISE:
+        default:
+            return "noise";
+    }
+}
+
+} // namespace AudioNR
@@ -0,0 +1,148 @@
+#pragma once
+
+#ifdef __cplusplus
+#include "../../../common/config/NoiseConstants.hpp"
+#include "../../../common/dsp/StftProcessor.hpp"
+#include "../../../common/dsp/VoiceActivityDetector.hpp"
+#include "../Imcra/Imcra.hpp"
+#include "../Wiener/WienerFilter.hpp"
+#include "MultibandProcessor.hpp"
+#include <array>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace AudioNR {
+
+/**
+ * @brief Hybrid noise reducer combining multiple techniques
+ *
+ * Blends spectral subtraction, the MMSE-LSA Wiener gain and multi-band
+ * subtraction according to the detected content (speech, music, noise).
+ *
+ * Everything runs on one STFT: each frame is analysed once, one IMCRA noise
+ * estimate feeds the classifier and the three gain rules, the gains are
+ * mixed per bin with the content weights, and the frame is resynthesized
+ * once. Running the reducers side by side on the time signal would cost an
+ * FFT pair per reducer. Weights crossfade over a few frames when the content
+ * changes, and rules whose weight is zero are not computed.
+ *
+ * A voice activity detector reads the same |X|²: it provides the flatness
+ * and zero-crossing features of the classifier, holds the IMCRA noise
+ * estimate during voice, and when it reports no activity the frame takes
+ * the noise weights without running the classifier.
+ */
+class HybridNoiseReducer {
+public:
+    struct Config {
+        uint32_t sampleRate = AdvancedSpectralNRConstants::DEFAULT_SAMPLE_RATE;
+        size_t fftSize = AdvancedSpectralNRConstants::DEFAULT_FFT_SIZE;     ///< Shared STFT size (power of 2)
+        size_t blockSize = AdvancedSpectralNRConstants::DEFAULT_BLOCK_SIZE; ///< STFT hop (75% overlap by default)
+
+        // Decision thresholds
+        float speechThreshold =
+            AdvancedSpectralNRConstants::SPEECH_DETECTION_THRESHOLD; ///< Threshold for speech detection
+        float musicThreshold =
+            AdvancedSpectralNRConstants::MUSIC_DETECTION_THRESHOLD; ///< Threshold for music detection
+        float transientThreshold =
+            AdvancedSpectralNRConstants::TRANSIENT_DETECTION_THRESHOLD; ///< Frame energy jump (dB) kept unsmoothed
+
+        // Gain limits shared by the blended rules
+        float minGain = AdvancedSpectralNRConstants::DEFAULT_MIN_GAIN;
+
+        // Algorithm weights for different content types
+        struct Weights {
+            // Speech weights
+            float speechWiener = AdvancedSpectralNRConstants::AlgorithmWeights::SPEECH_WIENER;
+            float speechSpectral = AdvancedSpectralNRConstants::AlgorithmWeights::SPEECH_SPECTRAL;
+
+            // Music weights
+            float musicWiener = AdvancedSpectralNRConstants::AlgorithmWeights::MUSIC_WIENER;
+            float musicMultiband = AdvancedSpectralNRConstants::AlgorithmWeights::MUSIC_MULTIBAND;
+
+            // Noise weights
+            float noiseSpectral = AdvancedSpectralNRConstants::AlgorithmWeights::NOISE_SPECTRAL;
+            float noiseWiener = AdvancedSpectralNRConstants::AlgorithmWeights::NOISE_WIENER;
+        } weights;
+    };
+
+    explicit HybridNoiseReducer(const Config& cfg);
+    explicit HybridNoiseReducer();
+    ~HybridNoiseReducer();
+
+    /**
+     * @brief Process audio with hybrid noise reduction
+     * @param input Input buffer
+     * @param output Output buffer (can be same as input)
+     * @param numSamples Number of samples
+     */
+    void process(const float* input, float* output, size_t numSamples);
+
+    /**
+     * @brief Get detected content type
+     * @return Content type string ("speech", "music", "noise", "mixed")
+     */
+    std::string getDetectedContentType() const;
+
+    /**
+     * @brief Clears the STFT, the noise estimate and the classifier
+     */
+    void reset();
+
+    size_t getLatency() const {
+        return stft_.getLatency();
+    }
+
+private:
+    Config cfg_;
+    size_t numBins_ = 0;
+
+    // Shared analysis / synthesis and noise estimate
+    Nyth::Audio::FX::StftProcessor stft_;
+    std::unique_ptr<IMCRA> imcra_;
+    Nyth::Audio::FX::VoiceActivityDetector vad_;
+
+    // Gain rules fed by the shared analysis
+    std::unique_ptr<WienerFilter> wienerFilter_;
+    std::unique_ptr<MultibandProcessor> multibandProcessor_;
+
+    // Content analysis
+    enum ContentType { SPEECH, MUSIC, NOISE, MIXED };
+    ContentType currentContent_ = NOISE;
+
+    // Rule order in the weight vectors
+    enum Rule { SPECTRAL, WIENER, MULTIBAND, NUM_RULES };
+    using RuleWeights = std::array<float, NUM_RULES>;
+    RuleWeights targetWeights_{};
+    RuleWeights weights_{};
+
+    // Per-frame spectral data (pre-allocated)
+    std::vector<float> power_;             ///< |X|²
+    std::vector<float> magnitude_;         ///< |X|
+    std::vector<float> prevMagnitude_;     ///< |X| of the previous frame (flux)
+    std::vector<float> noiseMagnitude_;    ///< IMCRA noise magnitude
+    std::vector<float> noisePower_;        ///< IMCRA noise power
+    std::vector<float> speechProbability_; ///< IMCRA speech presence probability
+    std::vector<float> multibandGains_;
+    std::vector<float> gains_;             ///< Blended gain
+    std::vector<float> featureBuffer_;     ///< Gain rule scratch
+
+    // Smoothed features
+    float zeroCrossingRate_ = 0.0f;
+    float speechScore_ = 0.0f;
+    float musicScore_ = 0.0f;
+    float activity_ = 0.0f;
+    float slowEnergy_ = 0.0f;
+    size_t speechBandBegin_ = 0;
+    size_t speechBandEnd_ = 0;
+
+    // Helper functions
+    void processFrame(float* re, float* im, size_t numBins); // STFT callback, half spectrum in place
+    ContentType analyzeContent();
+    void selectAlgorithm(ContentType content);
+    void blendGains(bool transient);
+    float computeSpectralFlux();
+};
+
+} // namespace AudioNR
+#endif // __cplusplus
@@ -0,0 +1,138 @@
+#include "MultibandProcessor.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace AudioNR {
+
+using namespace MultibandProcessorConstants;
+
+namespace {
+// Fréquence -> échelle perceptive (Bark : Traunmüller 1990), et inverse
+float toScale(MultibandProcessor::Config::BandMode mode, float freq) {
+    switch (mode) {
+        case MultibandProcessor::Config::BARK_SCALE:
+            return 26.81f * freq / (1960.0f + freq) - 0.53f;
+        case MultibandProcessor::Config::MEL_SCALE:
+            return 2595.0f * std::log10(1.0f + freq / 700.0f);
+        case MultibandProcessor::Config::ERB_SCALE:
+            return 21.4f * std::log10(1.0f + 0.00437f * freq);
+        case MultibandProcessor::Config::LINEAR:
+        default:
+            return freq;
+    }
+}
+
+float fromScale(MultibandProcessor::Config::BandMode mode, float value) {
+    switch (mode) {
+        case MultibandProcessor::Config::BARK_SCALE:
+            return 1960.0f * (value + 0.53f) / (26.28f - value);
+        case MultibandProcessor::Config::MEL_SCALE:
+            return 700.0f * (std::pow(10.0f, value / 2595.0f) - 1.0f);
+        case MultibandProcessor::Config::ERB_SCALE:
+            return (std::pow(10.0f, value / 21.4f) - 1.0f) / 0.00437f;
+        case MultibandProcessor::Config::LINEAR:
+        default:
+            return value;
+    }
+}
+} // namespace
+
+MultibandProcessor::MultibandProcessor(const Config& config) {
+    setConfig(config);
+}
+
+MultibandProcessor::~MultibandProcessor() = default;
+
+void MultibandProcessor::setConfig(const Config& config) {
+    if (config.numBands < MIN_NUM_BANDS || config.numBands > MAX_NUM_BANDS) {
+        throw std::invalid_argument("Number of bands out of range");
+    }
+    if (config.fftSize < MIN_FRAME_SIZE || config.fftSize > MAX_FRAME_SIZE || config.sampleRate == 0) {
+        throw std::invalid_argument("Invalid spectral analysis for multiband processing");
+    }
+    const float nyquist = 0.5f * static_cast<float>(config.sampleRate);
+    if (config.lowFreq < MIN_FREQ || config.lowFreq >= std::min(config.highFreq, nyquist)) {
+        throw std::invalid_argument("Invalid multiband frequency range");
+    }
+
+    config_ = config;
+    numBins_ = config_.fftSize / 2 + 1;
+    computeBandEdges();
+    reset();
+}
+
+void MultibandProcessor::reset() {
+    std::fill(bandGains_.begin(), bandGains_.end(), 1.0f);
+}
+
+// Bandes uniformes sur l'échelle choisie entre lowFreq et highFreq ; les cases
+// hors de cette plage rejoignent la première ou la dernière bande
+void MultibandProcessor::computeBandEdges() {
+    const float sampleRate = static_cast<float>(config_.sampleRate);
+    const float nyquist = 0.5f * sampleRate;
+    const float binsPerHz = static_cast<float>(config_.fftSize) / sampleRate;
+    const float low = toScale(config_.bandMode, config_.lowFreq);
+    const float high = toScale(config_.bandMode, std::min(config_.highFreq, nyquist));
+    const int lastEdge = static_cast<int>(numBins_);
+
+    bandIndices_.assign(1, 0);
+    for (size_t b = 1; b < config_.numBands; ++b) {
+        const float value = low + (high - low) * static_cast<float>(b) / static_cast<float>(config_.numBands);
+        const int edge = static_cast<int>(std::lround(fromScale(config_.bandMode, value) * binsPerHz));
+        // Au moins une case par bande : les bandes plus étroites qu'une case fusionnent
+        if (edge > bandIndices_.back() && edge < lastEdge) {
+            bandIndices_.push_back(edge);
+        }
+    }
+    bandIndices_.push_back(lastEdge);
+
+    const size_t numBands = bandIndices_.size() - 1;
+    bandGains_.assign(numBands, 1.0f);
+    bandWeights_.assign(numBands, BAND_WEIGHT_MID);
+    for (size_t b = 0; b < numBands; ++b) {
+        const float center = 0.5f * static_cast<float>(bandIndices_[b] + bandIndices_[b + 1] - 1) / binsPerHz;
+        if (center < BAND_WEIGHT_LOW_EDGE) {
+            bandWeights_[b] = BAND_WEIGHT_LOW;
+        } else if (center > nyquist - BAND_WEIGHT_HIGH_MARGIN) {
+            bandWeights_[b] = BAND_WEIGHT_HIGH;
+        }
+    }
+}
+
+void MultibandProcessor::computeGains(const float* power, const float* noisePower, float* gains) {
+    const size_t numBands = bandGains_.size();
+    for (size_t b = 0; b < numBands; ++b) {
+        const size_t begin = static_cast<size_t>(bandIndices_[b]);
+        const size_t end = static_cast<size_t>(bandIndices_[b + 1]);
+        float bandPower = POWER_EPSILON;
+        float bandNoise = POWER_EPSILON;
+        for (size_t k = begin; k < end; ++k) {
+            bandPower += power[k];
+            bandNoise += noisePower[k];
+        }
+
+        // Sur-soustraction : 4.75 sous -5 dB, 4 - 3 SNR / 20 jusqu'à 20 dB, 1 au-delà
+        const float snrDb = 10.0f * std::log10(bandPower / bandNoise);
+        const float alpha = std::clamp(OVERSUB_AT_0DB - OVERSUB_SLOPE_PER_DB * snrDb, OVERSUB_MIN, OVERSUB_MAX);
+        const float cleanRatio = std::max(1.0f - alpha * bandWeights_[b] * bandNoise / bandPower, SPECTRAL_FLOOR);
+        const float gain = std::sqrt(cleanRatio);
+
+        bandGains_[b] = BAND_GAIN_SMOOTHING * bandGains_[b] + (1.0f - BAND_GAIN_SMOOTHING) * gain;
+        std::fill(gains + begin, gains + end, bandGains_[b]);
+    }
+}
+
+void MultibandProcessor::processBands(const std::vector<float>& spectrum, std::vector<float>& output) {
+    if (spectrum.size() != numBins_) {
+        throw std::invalid_argument("Spectrum size mismatch");
+    }
+    output.resize(numBins_);
+    for (size_t b = 0; b < bandGains_.size(); ++b) {
+        for (int k = bandIndices_[b]; k < bandIndices_[b + 1]; ++k) {
+            output[k] = spectrum[k] * bandGains_[b];
+        }
+    }
+}
+
+} // namespace AudioNR
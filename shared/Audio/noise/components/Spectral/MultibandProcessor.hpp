@@ -1,6 +1,8 @@
 #pragma once
 
 #ifdef __cplusplus
+#include "../../../common/config/NoiseConstants.hpp"
+#include <cstdint>
 #include <memory>
 #include <vector>
 
@@ -8,23 +10,47 @@ namespace AudioNR {
 
 /**
  * @brief Multi-band audio processor for frequency-dependent noise reduction
+ *
+ * Multi-band spectral subtraction (Kamath & Loizou 2002) on a half spectrum:
+ * the bins are grouped into perceptual bands (linear, Bark, Mel or ERB), and
+ * each band gets its own over-subtraction from its SNR, weighted by where it
+ * sits in the spectrum. Band gains are smoothed over time, which keeps the
+ * musical noise of per-bin subtraction away.
+ *
+ * Spectral-domain component: it takes the power and noise spectra of a frame
+ * analysed by the caller, so it can share one STFT with other gain rules.
  */
 class MultibandProcessor {
 public:
     struct Config {
         enum BandMode { LINEAR, BARK_SCALE, MEL_SCALE, ERB_SCALE };
 
-        BandMode bandMode = MultibandProcessorConstants::DEFAULT_BAND_MODE;
+        BandMode bandMode = static_cast<BandMode>(MultibandProcessorConstants::DEFAULT_BAND_MODE);
         size_t numBands = MultibandProcessorConstants::DEFAULT_NUM_BANDS;
         float lowFreq = MultibandProcessorConstants::DEFAULT_LOW_FREQ;
         float highFreq = MultibandProcessorConstants::DEFAULT_HIGH_FREQ;
+
+        // Spectral analysis the gains are computed for
+        uint32_t sampleRate = MultibandProcessorConstants::DEFAULT_SAMPLE_RATE;
+        size_t fftSize = MultibandProcessorConstants::DEFAULT_FFT_SIZE;
     };
 
     explicit MultibandProcessor(const Config& config);
     ~MultibandProcessor();
 
-    // Process methods
-    void process(const float* input, float* output, size_t frameSize);
+    /**
+     * @brief Per-bin magnitude gains of one frame
+     * @param power |X|², fftSize/2 + 1 values
+     * @param noisePower Noise power estimate, same size
+     * @param gains Output magnitude gains, same size
+     */
+    void computeGains(const float* power, const float* noisePower, float* gains);
+
+    /**
+     * @brief Applies the current band gains to a magnitude spectrum
+     * @param spectrum Magnitudes, fftSize/2 + 1 values
+     * @param output Attenuated magnitudes (resized)
+     */
     void processBands(const std::vector<float>& spectrum, std::vector<float>& output);
 
     // Configuration
@@ -33,10 +59,23 @@ public:
         return config_;
     }
 
+    size_t getNumBands() const {
+        return bandGains_.size();
+    }
+
+    /**
+     * @brief Back to unity band gains
+     */
+    void reset();
+
 private:
     Config config_;
-    std::vector<float> bandGains_;
-    std::vector<int> bandIndices_;
+    size_t numBins_ = 0;
+    std::vector<float> bandGains_;   ///< Smoothed magnitude gain per band
+    std::vector<float> bandWeights_; ///< delta_i, position of the band in the spectrum
+    std::vector<int> bandIndices_;   ///< numBands + 1 bin edges, band i = [edge i, edge i+1)
+
+    void computeBandEdges();
 };
 
 } // namespace AudioNR
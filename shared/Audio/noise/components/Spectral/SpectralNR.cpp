@@ -1,5 +1,6 @@
 #include "SpectralNR.hpp"
 #include "../../../common/config/NoiseConstants.hpp"
+#include "../Wiener/MmseGainTable.hpp"
 #include <algorithm>
 #include <cmath>
 #include <stdexcept>
@@ -10,9 +11,7 @@ namespace AudioNR {
 // Import des constantes pour éviter la répétition des namespace
 using namespace SpectralNRConstants;
 
-static inline float hann(size_t n, size_t N) {
-    return HANN_AMPLITUDE * (HANN_FACTOR - std::cos(HANN_FREQUENCY_FACTOR * static_cast<float>(M_PI) * static_cast<float>(n) / static_cast<float>(N - HANN_LENGTH_OFFSET)));
-}
+namespace VectorMath = Nyth::Audio::FX::VectorMath;
 
 SpectralNR::SpectralNR(const SpectralNRConfig& cfg) { setConfig(cfg); }
 SpectralNR::~SpectralNR() = default;
@@ -25,8 +24,8 @@ void SpectralNR::setConfig(const SpectralNRConfig& cfg) {
     if (cfg.fftSize < MIN_FFT_SIZE || cfg.fftSize > MAX_FFT_SIZE) {
         throw std::invalid_argument("FFT size must be between 64 and 8192");
     }
-    if (cfg.hopSize < MIN_HOP_SIZE || cfg.hopSize > cfg.fftSize) {
-        throw std::invalid_argument("Hop size must be between 1 and FFT size");
+    if (cfg.hopSize < MIN_HOP_SIZE || cfg.hopSize > cfg.fftSize / 2) {
+        throw std::invalid_argument("Hop size must be between 1 and half the FFT size");
     }
     if (cfg.beta < MIN_BETA || cfg.beta > MAX_BETA) {
         throw std::invalid_argument("Beta must be between 0.5 and 5.0");
@@ -39,39 +38,21 @@ void SpectralNR::setConfig(const SpectralNRConfig& cfg) {
     }
 
     cfg_ = cfg;
-    buildWindow();
-    // Init FFT engine
-    fftEngine_ = Nyth::Audio::FX::createFFTEngine(cfg_.fftSize);
-    inBuf_.assign(cfg_.fftSize, ZERO);
-    outBuf_.assign(cfg_.fftSize, ZERO);
-    noiseMag_.assign(cfg_.fftSize / FFT_HALF_DIVISOR + SPECTRUM_NYQUIST_OFFSET, ZERO);
-
-    // Pre-allocate work buffers
-    frame_.resize(cfg_.fftSize);
-    re_.resize(cfg_.fftSize);
-    im_.resize(cfg_.fftSize);
-    mag_.resize(cfg_.fftSize / FFT_HALF_DIVISOR + SPECTRUM_NYQUIST_OFFSET);
-    ph_.resize(cfg_.fftSize / FFT_HALF_DIVISOR + SPECTRUM_NYQUIST_OFFSET);
-    time_.resize(cfg_.fftSize);
-
-    writePos_ = SPECTRUM_DC_INDEX;
-    noiseInit_ = true;
-}
-
-void SpectralNR::buildWindow() {
-    window_.resize(cfg_.fftSize);
-    for (size_t n = SPECTRUM_DC_INDEX; n < cfg_.fftSize; ++n) {
-        window_[n] = hann(n, cfg_.fftSize);
+    // Fenêtres, anneaux et FFT alloués ici : process() n'alloue pas
+    stft_.prepare(cfg_.fftSize, cfg_.hopSize);
+    stereoStft_.prepare(cfg_.fftSize, cfg_.hopSize);
+    const size_t numBins = stft_.getNumBins();
+    for (ChannelState& ch : channels_) {
+        ch.noiseMag.assign(numBins, ZERO);
+        ch.power.assign(numBins, ZERO);
+        ch.invMag.assign(numBins, ZERO);
+        ch.gain.assign(numBins, ONE);
+        ch.cleanPower.assign(numBins, ZERO);
+        ch.lsaV.assign(numBins, ZERO);
+        ch.vad.prepare(cfg_.sampleRate, cfg_.fftSize, cfg_.hopSize, stft_.getAnalysisWindow());
+        ch.noiseInit = true;
     }
-}
-
-void SpectralNR::fft(const std::vector<float>& in, std::vector<float>& re, std::vector<float>& im) {
-    fftEngine_->forwardR2C(in.data(), re, im);
-}
-
-void SpectralNR::ifft(const std::vector<float>& re, const std::vector<float>& im, std::vector<float>& out) {
-    out.resize(cfg_.fftSize);
-    fftEngine_->inverseC2R(re, im, out.data());
+    MmseGainTable::getInstance(); // table construite hors du chemin temps réel
 }
 
 void SpectralNR::process(const float* input, float* output, size_t numSamples) {
@@ -87,76 +68,136 @@ void SpectralNR::process(const float* input, float* output, size_t numSamples) {
         }
         return;
     }
-    size_t pos = SPECTRUM_DC_INDEX;
-    while (pos < numSamples) {
-        size_t toCopy = std::min(cfg_.hopSize, numSamples - pos);
-        // Shift buffer left by hop
-        // std::shift_left is C++20, use std::rotate for C++17
-        std::rotate(inBuf_.begin(), inBuf_.begin() + cfg_.hopSize, inBuf_.end());
-        // Copy new input
-        size_t destOffset = cfg_.fftSize - cfg_.hopSize;
-        std::copy(input + pos, input + pos + toCopy, inBuf_.data() + destOffset);
-        if (toCopy < cfg_.hopSize) {
-            // Zero-pad if we don't have enough samples
-            std::fill(inBuf_.begin() + static_cast<long long>(destOffset + toCopy), inBuf_.begin() + static_cast<long long>(destOffset + cfg_.hopSize), 0.0f);
-        }
+    stft_.process(input, output, numSamples,
+                  [this](float* re, float* im, size_t numBins) { processSpectrum(re, im, numBins); });
+}
 
-        // Window - use pre-allocated buffer
-        for (size_t i = SPECTRUM_DC_INDEX; i < cfg_.fftSize; ++i) frame_[i] = inBuf_[i] * window_[i];
+void SpectralNR::processStereo(const float* inL, const float* inR, float* outL, float* outR, size_t numSamples) {
+    if (!inL || !inR || !outL || !outR) {
+        throw std::invalid_argument("Input and output buffers must not be null");
+    }
+    if (numSamples == SPECTRUM_DC_INDEX) return;
 
-        // FFT - use pre-allocated buffers
-        fft(frame_, re_, im_);
+    if (!cfg_.enabled) {
+        if (outL != inL) std::copy(inL, inL + numSamples, outL);
+        if (outR != inR) std::copy(inR, inR + numSamples, outR);
+        return;
+    }
+    stereoStft_.process(inL, inR, outL, outR, numSamples,
+                        [this](float* reL, float* imL, float* reR, float* imR, size_t numBins) {
+                            processStereoSpectrum(reL, imL, reR, imR, numBins);
+                        });
+}
 
-        // Magnitude and phase - use pre-allocated buffers
-        size_t half = cfg_.fftSize / FFT_HALF_DIVISOR;
-        for (size_t k = SPECTRUM_DC_INDEX; k <= half; ++k) {
-            float r = re_[k]; float ii = im_[k];
-            mag_[k] = std::sqrt(r * r + ii * ii);
-            ph_[k] = std::atan2(ii, r);
-        }
+void SpectralNR::processSpectrum(float* re, float* im, size_t numBins) {
+    ChannelState& ch = channels_[0];
+    updateNoise(ch, re, im, numBins);
+    computeGains(ch, numBins);
 
-        // Noise estimate (MCRA-like)
-        if (noiseInit_) {
-            for (size_t k = SPECTRUM_DC_INDEX; k <= half; ++k) noiseMag_[k] = mag_[k];
-            noiseInit_ = false;
-        } else {
-            for (size_t k = SPECTRUM_DC_INDEX; k <= half; ++k) noiseMag_[k] = static_cast<float>(cfg_.noiseUpdate * noiseMag_[k] + (NOISE_UPDATE_COMPLEMENT - cfg_.noiseUpdate) * mag_[k]);
-        }
+    // Gain réel : re et im multipliés en place (la STFT reconstruit le miroir)
+    VectorMath::scaleComplex(re, im, ch.gain.data(), numBins);
+}
 
-        // Spectral subtraction with floor
-        for (size_t k = SPECTRUM_DC_INDEX; k <= half; ++k) {
-            float sub = mag_[k] - static_cast<float>(cfg_.beta) * noiseMag_[k];
-            if (sub < cfg_.floorGain * noiseMag_[k]) sub = static_cast<float>(cfg_.floorGain * noiseMag_[k]);
-            mag_[k] = sub;
-        }
+void SpectralNR::processStereoSpectrum(float* reL, float* imL, float* reR, float* imR, size_t numBins) {
+    ChannelState& left = channels_[0];
+    ChannelState& right = channels_[1];
+    updateNoise(left, reL, imL, numBins);
+    updateNoise(right, reR, imR, numBins);
+    if (linksNoise(cfg_.channelLink)) {
+        // Estimation commune, reprise par les deux lissages à la trame suivante
+        linkChannels(left.noiseMag.data(), right.noiseMag.data(), numBins, cfg_.channelLink);
+    }
 
-        // Reconstruct full spectrum (Hermitian for real signal)
-        for (size_t k = SPECTRUM_DC_INDEX; k <= half; ++k) {
-            re_[k] = mag_[k] * std::cos(ph_[k]);
-            im_[k] = mag_[k] * std::sin(ph_[k]);
-        }
-        for (size_t k = half + SPECTRUM_NYQUIST_OFFSET; k < cfg_.fftSize; ++k) {
-            size_t kr = cfg_.fftSize - k;
-            re_[k] = re_[kr];
-            im_[k] = -im_[kr];
+    computeGains(left, numBins);
+    computeGains(right, numBins);
+    if (linksMask(cfg_.channelLink)) {
+        linkChannels(left.gain.data(), right.gain.data(), numBins, cfg_.channelLink);
+    }
+
+    VectorMath::scaleComplex(reL, imL, left.gain.data(), numBins);
+    VectorMath::scaleComplex(reR, imR, right.gain.data(), numBins);
+}
+
+void SpectralNR::updateNoise(ChannelState& ch, const float* re, const float* im, size_t numBins) {
+    // |X|² et 1/|X| : la phase n'est jamais calculée
+    VectorMath::power(re, im, ch.power.data(), numBins);
+    VectorMath::rsqrt(ch.power.data(), ch.invMag.data(), numBins);
+
+    // Le VAD lit le même |X|² ; pendant la parole l'estimation de bruit est gelée
+    const bool voice = cfg_.vadGating && ch.vad.processSpectrum(ch.power.data(), numBins);
+
+    // Noise estimate (MCRA-like), on |X| = |X|² / |X|
+    if (ch.noiseInit) {
+        for (size_t k = SPECTRUM_DC_INDEX; k < numBins; ++k) ch.noiseMag[k] = ch.power[k] * ch.invMag[k];
+        ch.noiseInit = false;
+    } else if (!voice) {
+        const float update = static_cast<float>(cfg_.noiseUpdate);
+        const float complement = static_cast<float>(NOISE_UPDATE_COMPLEMENT - cfg_.noiseUpdate);
+        for (size_t k = SPECTRUM_DC_INDEX; k < numBins; ++k) {
+            ch.noiseMag[k] = update * ch.noiseMag[k] + complement * ch.power[k] * ch.invMag[k];
         }
+    }
+}
 
-        // IFFT - use pre-allocated buffer
-        ifft(re_, im_, time_);
+void SpectralNR::computeGains(ChannelState& ch, size_t numBins) {
+    switch (cfg_.gainRule) {
+        case SpectralNRConfig::GainRule::WIENER:
+            computeWienerGains(ch, numBins);
+            break;
+        case SpectralNRConfig::GainRule::MMSE_LSA:
+            computeLsaGains(ch, numBins);
+            break;
+        case SpectralNRConfig::GainRule::SPECTRAL_SUBTRACTION:
+        default:
+            computeSubtractionGains(ch, numBins);
+            break;
+    }
+}
 
-        // Overlap-add
-        if (outBuf_.size() != cfg_.fftSize) outBuf_.assign(cfg_.fftSize, ZERO);
-        for (size_t i = SPECTRUM_DC_INDEX; i < cfg_.fftSize; ++i) outBuf_[i] += time_[i] * window_[i];
+// |S| = max(|X| - beta |N|, floor |N|), en gain : max(1 - beta r, floor r), r = |N| / |X|
+void SpectralNR::computeSubtractionGains(ChannelState& ch, size_t numBins) {
+    const float beta = static_cast<float>(cfg_.beta);
+    const float floorGain = static_cast<float>(cfg_.floorGain);
+    for (size_t k = SPECTRUM_DC_INDEX; k < numBins; ++k) {
+        const float ratio = ch.noiseMag[k] * ch.invMag[k];
+        ch.gain[k] = std::max(ONE - beta * ratio, floorGain * ratio);
+    }
+}
 
-        // Output hop segment
-        size_t outCount = std::min(cfg_.hopSize, numSamples - pos);
-        std::copy(outBuf_.data(), outBuf_.data() + outCount, output + pos);
-        // Shift out buffer left
-        // std::shift_left is C++20, use std::rotate for C++17
-        std::rotate(outBuf_.begin(), outBuf_.begin() + cfg_.hopSize, outBuf_.end());
-        std::fill(outBuf_.end() - static_cast<long long>(cfg_.hopSize), outBuf_.end(), ZERO);
+// |S|² = |X|² - beta |N|² : gain de Wiener sqrt(1 - beta r²), même plancher
+void SpectralNR::computeWienerGains(ChannelState& ch, size_t numBins) {
+    const float beta = static_cast<float>(cfg_.beta);
+    const float floorGain = static_cast<float>(cfg_.floorGain);
+    for (size_t k = SPECTRUM_DC_INDEX; k < numBins; ++k) {
+        const float ratio = ch.noiseMag[k] * ch.invMag[k];
+        ch.gain[k] = std::max(ONE - beta * ratio * ratio, ZERO);
+    }
+    VectorMath::sqrt(ch.gain.data(), ch.gain.data(), numBins);
+    for (size_t k = SPECTRUM_DC_INDEX; k < numBins; ++k) {
+        ch.gain[k] = std::max(ch.gain[k], floorGain * ch.noiseMag[k] * ch.invMag[k]);
+    }
+}
 
-        pos += toCopy;
+// Ephraim-Malah MMSE-LSA, SNR a priori décision-dirigé ; exp(E1(v) / 2) tabulé
+void SpectralNR::computeLsaGains(ChannelState& ch, size_t numBins) {
+    const float floorGain = static_cast<float>(cfg_.floorGain);
+    for (size_t k = SPECTRUM_DC_INDEX; k < numBins; ++k) {
+        const float noisePower = ch.noiseMag[k] * ch.noiseMag[k] + NOISE_POWER_EPSILON;
+        const float invNoise = ONE / noisePower;
+        const float posteriori = ch.power[k] * invNoise;
+        const float priori = std::max(DECISION_DIRECTED_ALPHA * ch.cleanPower[k] * invNoise +
+                                          (ONE - DECISION_DIRECTED_ALPHA) * std::max(posteriori - ONE, ZERO),
+                                      MIN_PRIORI_SNR);
+        const float wiener = priori / (ONE + priori);
+        ch.gain[k] = wiener;
+        ch.lsaV[k] = std::max(wiener * posteriori, WienerFilterConstants::MMSE_MIN_V);
+    }
+    MmseGainTable::getInstance().apply(MmseGainTable::Estimator::LSA, ch.gain.data(), ch.lsaV.data(),
+                                       ch.gain.data(), numBins);
+    for (size_t k = SPECTRUM_DC_INDEX; k < numBins; ++k) {
+        const float gain = std::min(ch.gain[k], MAX_LSA_GAIN);
+        ch.cleanPower[k] = gain * gain * ch.power[k];
+        ch.gain[k] = std::max(gain, floorGain * ch.noiseMag[k] * ch.invMag[k]);
     }
 }
 
@@ -1,10 +1,14 @@
 #pragma once
 
 #ifdef __cplusplus
-#include "../../../common/dsp/FFTEngine.hpp"
+#include "../../../common/dsp/StereoStftProcessor.hpp"
+#include "../../../common/dsp/StftProcessor.hpp"
+#include "../../../common/dsp/VectorMath.hpp"
+#include "../../../common/dsp/VoiceActivityDetector.hpp"
 #include "../../../common/config/NoiseConstants.hpp"
+#include "ChannelLink.hpp"
+#include <array>
 #include <cstdint>
-#include <memory>
 #include <vector>
 
 
@@ -20,6 +24,15 @@ using namespace SpectralNRConstants;
  * spectral subtraction with noise estimation.
  */
 struct SpectralNRConfig {
+    /**
+     * @brief Gain rule, computed from |X|² and the noise estimate (no phase)
+     */
+    enum class GainRule {
+        SPECTRAL_SUBTRACTION, ///< |S| = |X| - beta * |N|
+        WIENER,               ///< |S|² = |X|² - beta * |N|² (power subtraction)
+        MMSE_LSA              ///< Ephraim-Malah log-spectral amplitude, decision-directed SNR
+    };
+
     uint32_t sampleRate = SpectralNRConstants::DEFAULT_SAMPLE_RATE; ///< Sample rate in Hz (default 48kHz)
     size_t fftSize =
         SpectralNRConstants::DEFAULT_FFT_SIZE; ///< FFT size (must be power of 2). Larger = better frequency resolution
@@ -31,6 +44,9 @@ struct SpectralNRConfig {
     double noiseUpdate = SpectralNRConstants::DEFAULT_NOISE_UPDATE; ///< Noise estimation smoothing (0.9-0.99). Higher =
                                                                     ///< slower adaptation
     bool enabled = SpectralNRConstants::DEFAULT_ENABLED;            ///< Enable/disable spectral NR
+    bool vadGating = SpectralNRConstants::DEFAULT_VAD_GATING;       ///< Freeze the noise estimate during voice
+    GainRule gainRule = GainRule::SPECTRAL_SUBTRACTION;             ///< Gain rule (floorGain applies to all)
+    ChannelLink channelLink = ChannelLink::INDEPENDENT;             ///< Stereo coupling (processStereo only)
 };
 
 /**
@@ -39,12 +55,25 @@ struct SpectralNRConfig {
  * Implements spectral subtraction with dynamic noise estimation.
  * The algorithm:
  * 1. Transforms audio to frequency domain using FFT
- * 2. Estimates noise spectrum using minimum statistics
- * 3. Subtracts estimated noise from signal spectrum
+ * 2. Estimates noise spectrum by recursive averaging, frozen while the
+ *    voice activity detector (fed with the same |X|²) reports voice
+ * 3. Computes a real gain per bin (subtraction, Wiener or MMSE-LSA)
  * 4. Applies spectral floor to prevent over-suppression
  * 5. Transforms back to time domain
  *
- * @note Introduces latency of (fftSize - hopSize) samples
+ * The gains only need |X|² and 1 / |X| (vectorized rsqrt): the bins are
+ * scaled in place, without the atan2 / cos / sin phase round trip.
+ *
+ * Framing, windows and overlap-add are done by Nyth::Audio::FX::StftProcessor
+ * (ring buffers, any host block size).
+ *
+ * processStereo() keeps one noise estimate per channel and runs both channels
+ * through a StereoStftProcessor (one complex FFT per frame for the pair);
+ * SpectralNRConfig::channelLink optionally shares the noise estimate or the
+ * gain mask between them. process() and processStereo() have separate
+ * states: use one or the other on a given instance.
+ *
+ * @note Introduces latency of fftSize samples
  * @note Best for stationary noise (fan noise, hiss, etc.)
  */
 class SpectralNR {
@@ -79,30 +108,50 @@ public:
      */
     void process(const float* input, float* output, size_t numSamples);
 
+    /**
+     * @brief Process a stereo pair (planar buffers, in place allowed)
+     * @param numSamples Number of samples per channel
+     */
+    void processStereo(const float* inL, const float* inR, float* outL, float* outR, size_t numSamples);
+
+    /**
+     * @brief Processing latency in samples
+     */
+    size_t getLatency() const {
+        return stft_.getLatency();
+    }
+
 private:
     SpectralNRConfig cfg_{};
-    std::vector<float> window_;
-    std::vector<float> inBuf_;
-    std::vector<float> outBuf_;
-    size_t writePos_ = INITIAL_WRITE_POSITION;
-
-    // Noise magnitude estimate per bin
-    std::vector<float> noiseMag_;
-    bool noiseInit_ = INITIAL_NOISE_STATE;
-
-    // Pre-allocated work buffers to avoid allocations in process()
-    std::vector<float> frame_;
-    std::vector<float> re_, im_;
-    std::vector<float> mag_, ph_;
-    std::vector<float> time_;
-
-    // FFT engine (pluggable: KissFFT or fallback radix-2)
-    std::unique_ptr<Nyth::Audio::FX::IFFTEngine> fftEngine_;
-    void buildWindow();
-
-    // FFT helpers
-    void fft(const std::vector<float>& in, std::vector<float>& re, std::vector<float>& im);
-    void ifft(const std::vector<float>& re, const std::vector<float>& im, std::vector<float>& out);
+
+    static constexpr size_t MAX_CHANNELS = 2;
+
+    // Noise estimate and pre-allocated work buffers of one channel
+    struct ChannelState {
+        std::vector<float> noiseMag;   // |N| estimé par bin
+        std::vector<float> power;      // |X|²
+        std::vector<float> invMag;     // 1 / |X|
+        std::vector<float> gain;       // gain réel par bin
+        std::vector<float> cleanPower; // |G X|² de la trame précédente (MMSE-LSA)
+        std::vector<float> lsaV;       // v = ξ γ / (1 + ξ), puis scratch de MmseGainTable
+        Nyth::Audio::FX::VoiceActivityDetector vad;
+        bool noiseInit = INITIAL_NOISE_STATE;
+    };
+
+    // Framing / overlap-add (ring buffers, pre-allocated)
+    Nyth::Audio::FX::StftProcessor stft_;
+    Nyth::Audio::FX::StereoStftProcessor stereoStft_;
+
+    std::array<ChannelState, MAX_CHANNELS> channels_;
+
+    // Noise reduction on one half spectrum (in place)
+    void processSpectrum(float* re, float* im, size_t numBins);
+    void processStereoSpectrum(float* reL, float* imL, float* reR, float* imR, size_t numBins);
+    void updateNoise(ChannelState& ch, const float* re, const float* im, size_t numBins);
+    void computeGains(ChannelState& ch, size_t numBins);
+    void computeSubtractionGains(ChannelState& ch, size_t numBins);
+    void computeWienerGains(ChannelState& ch, size_t numBins);
+    void computeLsaGains(ChannelState& ch, size_t numBins);
 
     // Helper
     bool isPowerOfTwo(size_t n) const {
@@ -0,0 +1,204 @@
+#pragma once
+
+#ifdef __cplusplus
+#include "../../../common/config/NoiseConstants.hpp"
+#include "../../../common/dsp/VectorMath.hpp"
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+namespace AudioNR {
+
+/**
+ * @brief Tabulated Ephraim-Malah MMSE gains
+ *
+ * With w = ξ / (1 + ξ) and v = w γ, both estimators are the Wiener gain
+ * times a correction that only depends on v:
+ *
+ *   MMSE-LSA  (1985): G = w · exp(E1(v) / 2)
+ *   MMSE-STSA (1984): G = w · (√π / 2) · e^(-v/2) [(1 + v) I0(v/2) + v I1(v/2)] / √v
+ *
+ * The correction is tabulated once, in double precision, as log2 F over a
+ * uniform log2 v grid, and linearly interpolated. Both corrections tend to
+ * 1 for large v and behave like c / √v for small v, so log2 F is smooth on
+ * that grid: above the table it is clamped (F = 1), below it follows the
+ * exact slope of -1/2. Relative error of the interpolated gain < 1e-4 for
+ * any v.
+ *
+ * apply() is a block operation: block log2 and exp2 from VectorMath, and
+ * the interpolation in between 4 lanes at a time (SSE2 / NEON, scalar tail);
+ * only the two table reads per bin are scalar.
+ */
+class MmseGainTable {
+public:
+    enum class Estimator { LSA, STSA };
+
+    static const MmseGainTable& getInstance() {
+        static const MmseGainTable instance;
+        return instance;
+    }
+
+    /**
+     * @brief gain[k] = wiener[k] · F(v[k])
+     * @param v v = w γ (> 0), overwritten with scratch values
+     * @note gain may alias wiener
+     */
+    void apply(Estimator estimator, const float* wiener, float* v, float* gain, size_t count) const noexcept {
+        using namespace WienerFilterConstants;
+        namespace VectorMath = Nyth::Audio::FX::VectorMath;
+        const Table& table = tables_[static_cast<size_t>(estimator)];
+        const float* value = table.value.data();
+        const float* slope = table.slope.data();
+        constexpr float steps = static_cast<float>(MMSE_TABLE_STEPS_PER_OCTAVE);
+        constexpr float lastIndex = static_cast<float>(MMSE_TABLE_SIZE - 1);
+
+        VectorMath::log2(v, v, count);
+        size_t k = 0;
+#if defined(NYTH_VECTOR_MATH_NEON)
+        const float32x4_t zero = vdupq_n_f32(0.0f);
+        alignas(16) int32_t cell[4];
+        alignas(16) float base[4];
+        alignas(16) float delta[4];
+        for (; k + 4 <= count; k += 4) {
+            const float32x4_t octaves = vsubq_f32(vld1q_f32(v + k), vdupq_n_f32(MMSE_TABLE_MIN_LOG2));
+            const float32x4_t position =
+                vminq_f32(vmulq_f32(vmaxq_f32(octaves, zero), vdupq_n_f32(steps)), vdupq_n_f32(lastIndex));
+            const int32x4_t index = vcvtq_s32_f32(position);
+            vst1q_s32(cell, index);
+            for (size_t j = 0; j < 4; ++j) {
+                base[j] = value[cell[j]];
+                delta[j] = slope[cell[j]];
+            }
+            const float32x4_t fraction = vsubq_f32(position, vcvtq_f32_s32(index));
+            float32x4_t result = vmlaq_f32(vld1q_f32(base), fraction, vld1q_f32(delta));
+            result = vmlaq_f32(result, vminq_f32(octaves, zero), vdupq_n_f32(MMSE_SMALL_V_SLOPE));
+            vst1q_f32(v + k, result);
+        }
+#elif defined(NYTH_VECTOR_MATH_SSE2)
+        const __m128 zero = _mm_setzero_ps();
+        alignas(16) int32_t cell[4];
+        for (; k + 4 <= count; k += 4) {
+            const __m128 octaves = _mm_sub_ps(_mm_loadu_ps(v + k), _mm_set1_ps(MMSE_TABLE_MIN_LOG2));
+            const __m128 position =
+                _mm_min_ps(_mm_mul_ps(_mm_max_ps(octaves, zero), _mm_set1_ps(steps)), _mm_set1_ps(lastIndex));
+            const __m128i index = _mm_cvttps_epi32(position);
+            _mm_store_si128(reinterpret_cast<__m128i*>(cell), index);
+            const __m128 base = _mm_setr_ps(value[cell[0]], value[cell[1]], value[cell[2]], value[cell[3]]);
+            const __m128 delta = _mm_setr_ps(slope[cell[0]], slope[cell[1]], slope[cell[2]], slope[cell[3]]);
+            const __m128 fraction = _mm_sub_ps(position, _mm_cvtepi32_ps(index));
+            const __m128 below = _mm_mul_ps(_mm_min_ps(octaves, zero), _mm_set1_ps(MMSE_SMALL_V_SLOPE));
+            _mm_storeu_ps(v + k, _mm_add_ps(_mm_add_ps(base, _mm_mul_ps(fraction, delta)), below));
+        }
+#endif
+        for (; k < count; ++k) {
+            const float octaves = v[k] - MMSE_TABLE_MIN_LOG2;
+            const float position = std::min(std::max(octaves, 0.0f) * steps, lastIndex);
+            const int32_t index = static_cast<int32_t>(position);
+            const float fraction = position - static_cast<float>(index);
+            v[k] = value[index] + fraction * slope[index] + MMSE_SMALL_V_SLOPE * std::min(octaves, 0.0f);
+        }
+        VectorMath::exp2(v, v, count);
+        for (k = 0; k < count; ++k) {
+            gain[k] = wiener[k] * v[k];
+        }
+    }
+
+    // Même gain pour une seule case
+    float gain(Estimator estimator, float wiener, float v) const noexcept {
+        apply(estimator, &wiener, &v, &wiener, 1);
+        return wiener;
+    }
+
+private:
+    static constexpr double PI = 3.14159265358979324;
+
+    // log2 F aux nœuds et pente vers le nœud suivant (nulle au dernier)
+    struct Table {
+        std::array<float, WienerFilterConstants::MMSE_TABLE_SIZE> value;
+        std::array<float, WienerFilterConstants::MMSE_TABLE_SIZE> slope;
+    };
+    std::array<Table, 2> tables_;
+
+    MmseGainTable() {
+        using namespace WienerFilterConstants;
+        Table& lsa = tables_[static_cast<size_t>(Estimator::LSA)];
+        Table& stsa = tables_[static_cast<size_t>(Estimator::STSA)];
+        for (size_t i = 0; i < MMSE_TABLE_SIZE; ++i) {
+            const double log2V = MMSE_TABLE_MIN_LOG2 + static_cast<double>(i) / MMSE_TABLE_STEPS_PER_OCTAVE;
+            const double v = std::exp2(log2V);
+            lsa.value[i] = static_cast<float>(0.5 * expIntE1(v) / std::log(2.0));
+            stsa.value[i] = static_cast<float>(std::log2(stsaCorrection(v)));
+        }
+        for (Table& table : tables_) {
+            for (size_t i = 0; i + 1 < MMSE_TABLE_SIZE; ++i) {
+                table.slope[i] = table.value[i + 1] - table.value[i];
+            }
+            table.slope[MMSE_TABLE_SIZE - 1] = 0.0f;
+        }
+    }
+
+    // E1(v) : série pour v <= 1, fraction continue (Lentz) au-delà
+    static double expIntE1(double v) {
+        constexpr double eulerGamma = 0.57721566490153286;
+        if (v <= 1.0) {
+            double sum = 0.0;
+            double term = 1.0;
+            for (int k = 1; k < 30; ++k) {
+                term *= -v / k;
+                sum += term / k;
+            }
+            return -eulerGamma - std::log(v) - sum;
+        }
+        constexpr double tiny = 1e-300;
+        double b = v + 1.0;
+        double c = 1.0 / tiny;
+        double d = 1.0 / b;
+        double h = d;
+        for (int i = 1; i < 200; ++i) {
+            const double a = -static_cast<double>(i) * i;
+            b += 2.0;
+            d = 1.0 / (a * d + b);
+            c = b + a / c;
+            const double delta = c * d;
+            h *= delta;
+            if (std::abs(delta - 1.0) < 1e-15) {
+                break;
+            }
+        }
+        return h * std::exp(-v);
+    }
+
+    // e^(-x) I_n(x), n = 0 ou 1 : série jusqu'à 15, développement asymptotique ensuite
+    static double scaledBesselI(int n, double x) {
+        if (x <= 15.0) {
+            const double q = 0.25 * x * x;
+            double term = (n == 0) ? 1.0 : 0.5 * x;
+            double sum = term;
+            for (int k = 1; k < 80; ++k) {
+                term *= q / (static_cast<double>(k) * (k + n));
+                sum += term;
+            }
+            return sum * std::exp(-x);
+        }
+        const double mu = 4.0 * n * n;
+        double term = 1.0;
+        double sum = 1.0;
+        for (int k = 1; k < 10; ++k) {
+            const double odd = 2.0 * k - 1.0;
+            term *= -(mu - odd * odd) / (k * 8.0 * x);
+            sum += term;
+        }
+        return sum / std::sqrt(2.0 * PI * x);
+    }
+
+    static double stsaCorrection(double v) {
+        const double x = 0.5 * v;
+        const double bessel = (1.0 + v) * scaledBesselI(0, x) + v * scaledBesselI(1, x);
+        return 0.5 * std::sqrt(PI) * bessel / std::sqrt(v);
+    }
+};
+
+} // namespace AudioNR
+#endif // __cplusplus
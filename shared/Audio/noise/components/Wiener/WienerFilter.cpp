@@ -1,34 +1,17 @@
 #include "WienerFilter.hpp"
-#include "../../common/utils/MathUtils.hpp"
+#include "MmseGainTable.hpp"
 #include <algorithm>
+#include <cmath>
+#include <stdexcept>
 
 namespace AudioNR {
 
-WienerFilter::WienerFilter(const Config& cfg) : cfg_(cfg) {
-    numBins_ = cfg_.fftSize / 2 + 1;
-
-    // Initialize state vectors
-    xi_.resize(numBins_, WienerFilterConstants::INITIAL_SNR_VALUE);
-    gamma_.resize(numBins_, WienerFilterConstants::INITIAL_SNR_VALUE);
-    G_.resize(numBins_, WienerFilterConstants::INITIAL_GAIN_VALUE);
-    Gprev_.resize(numBins_, WienerFilterConstants::INITIAL_GAIN_VALUE);
-    lambda_n_.resize(numBins_, WienerFilterConstants::INITIAL_NOISE_VALUE);
-    S_prev_.resize(numBins_, WienerFilterConstants::INITIAL_SPEECH_VALUE);
-    v_.resize(numBins_, WienerFilterConstants::INITIAL_GAIN_VALUE);
-    GH1_.resize(numBins_, WienerFilterConstants::INITIAL_GAIN_VALUE);
-
-    // Initialize perceptual weights
-    initializePerceptualWeights();
-
-    // Initialize noise estimator if using IMCRA
-    if (cfg_.noiseMode == Config::IMCRA_FULL) {
-        IMCRA::Config imcraCfg;
-        imcraCfg.fftSize = cfg_.fftSize;
-        imcraCfg.sampleRate = cfg_.sampleRate;
-        imcra_ = std::make_unique<IMCRA>(imcraCfg);
-    }
+WienerFilter::WienerFilter(const Config& cfg) {
+    setConfig(cfg);
 }
 
+WienerFilter::WienerFilter() : WienerFilter(Config{}) {}
+
 WienerFilter::~WienerFilter() = default;
 
 void WienerFilter::reset() {
@@ -47,7 +30,33 @@ void WienerFilter::reset() {
 }
 
 void WienerFilter::setConfig(const Config& cfg) {
+    if (cfg.fftSize < 2) {
+        throw std::invalid_argument("Wiener filter FFT size must be at least 2");
+    }
     cfg_ = cfg;
+    numBins_ = cfg_.fftSize / 2 + 1;
+
+    // Initialize state vectors
+    for (std::vector<float>* row : {&xi_, &gamma_, &G_, &Gprev_, &lambda_n_, &S_prev_, &v_, &GH1_, &noiseMagnitude_,
+                                    &speechProbability_, &smoothedGains_, &magnitude_, &outputMagnitude_}) {
+        row->assign(numBins_, 0.0f);
+    }
+
+    // Initialize perceptual weights
+    initializePerceptualWeights();
+
+    // Initialize noise estimator if using IMCRA
+    imcra_.reset();
+    if (cfg_.noiseMode == Config::IMCRA_FULL) {
+        IMCRA::Config imcraCfg;
+        imcraCfg.fftSize = cfg_.fftSize;
+        imcraCfg.sampleRate = cfg_.sampleRate;
+        imcra_ = std::make_unique<IMCRA>(imcraCfg);
+    }
+
+    // Construit la table une fois, hors du chemin temps réel
+    MmseGainTable::getInstance();
+
     reset();
 }
 
@@ -61,25 +70,23 @@ void WienerFilter::processSpectrum(const std::vector<float>& realIn, const std::
     imagOut.resize(numBins_);
 
     // Convert to magnitude
-    std::vector<float> magnitude(numBins_);
     for (size_t k = 0; k < numBins_; ++k) {
-        magnitude[k] = std::sqrt(realIn[k] * realIn[k] + imagIn[k] * imagIn[k]);
+        magnitude_[k] = std::sqrt(realIn[k] * realIn[k] + imagIn[k] * imagIn[k]);
     }
 
     // Process magnitude spectrum
-    std::vector<float> outputMagnitude(numBins_);
-    processMagnitudePhase(magnitude, {}, outputMagnitude);
+    processMagnitudePhase(magnitude_, {}, outputMagnitude_);
 
-    // Apply gains to complex spectrum
+    // Apply gains to complex spectrum (G_ is the gain applied to the magnitude)
     for (size_t k = 0; k < numBins_; ++k) {
-        float gain = outputMagnitude[k] / max(magnitude[k], WienerFilterConstants::EPSILON_PROTECTION);
-        realOut[k] = realIn[k] * gain;
-        imagOut[k] = imagIn[k] * gain;
+        realOut[k] = realIn[k] * G_[k];
+        imagOut[k] = imagIn[k] * G_[k];
     }
 }
 
 void WienerFilter::processMagnitudePhase(const std::vector<float>& magnitude, const std::vector<float>& phase,
                                          std::vector<float>& outputMagnitude) {
+    (void)phase;
     if (magnitude.size() != numBins_) {
         throw std::invalid_argument("Magnitude spectrum size mismatch");
     }
@@ -89,22 +96,26 @@ void WienerFilter::processMagnitudePhase(const std::vector<float>& magnitude, co
     // Update noise estimate
     updateNoiseEstimate(magnitude);
 
-    // Compute a priori and a posteriori SNR
-    computeAPrioriSNR(magnitude);
-
-    // Compute Wiener gain
-    if (cfg_.useLSA) {
-        computeMMSE_LSA_Gain();
-    } else {
-        computeWienerGain();
-    }
+    // SNR a priori / a posteriori et gains en une passe
+    computeGains(magnitude.data());
 
     // Apply gain smoothing
     applyGainSmoothing();
 
-    // Apply gains to magnitude spectrum
+    // Apply gains to magnitude spectrum; |G Y|² feeds the next decision-directed estimate
     for (size_t k = 0; k < numBins_; ++k) {
         outputMagnitude[k] = magnitude[k] * G_[k];
+        S_prev_[k] = outputMagnitude[k] * outputMagnitude[k];
+    }
+}
+
+void WienerFilter::updateGains(const float* magnitude, const float* noisePower) {
+    std::copy_n(noisePower, numBins_, lambda_n_.begin());
+    computeGains(magnitude);
+    applyGainSmoothing();
+    for (size_t k = 0; k < numBins_; ++k) {
+        const float clean = magnitude[k] * G_[k];
+        S_prev_[k] = clean * clean;
     }
 }
 
@@ -137,14 +148,11 @@ void WienerFilter::initializePerceptualWeights() {
 void WienerFilter::updateNoiseEstimate(const std::vector<float>& magnitude) {
     if (cfg_.noiseMode == Config::IMCRA_FULL && imcra_) {
         // Use IMCRA for noise estimation
-        std::vector<float> noiseSpectrum(numBins_);
-        std::vector<float> speechProbability(numBins_);
-
-        imcra_->processFrame(magnitude, noiseSpectrum, speechProbability);
+        imcra_->processFrame(magnitude.data(), noiseMagnitude_.data(), speechProbability_.data());
 
         // Convert to power spectrum
         for (size_t k = 0; k < numBins_; ++k) {
-            lambda_n_[k] = noiseSpectrum[k] * noiseSpectrum[k];
+            lambda_n_[k] = noiseMagnitude_[k] * noiseMagnitude_[k];
         }
     } else {
         // Simple recursive averaging
@@ -162,65 +170,38 @@ void WienerFilter::updateNoiseEstimate(const std::vector<float>& magnitude) {
     }
 }
 
-void WienerFilter::computeAPrioriSNR(const std::vector<float>& magnitude) {
-    for (size_t k = 0; k < numBins_; ++k) {
-        float Y2 = magnitude[k] * magnitude[k];
-
-        // A posteriori SNR
-        gamma_[k] = Y2 / max(lambda_n_[k], WienerFilterConstants::EPSILON_PROTECTION);
-
-        // Decision-directed a priori SNR estimation
-        // ξ[k,n] = α * G²[k,n-1] * γ[k,n-1] + (1-α) * max(γ[k,n] - 1, 0)
-        float xiDD = cfg_.alpha * Gprev_[k] * Gprev_[k] * gamma_[k];
-        float xiML = max(gamma_[k] - 1.0f, 0.0f);
-
-        xi_[k] = xiDD + (1.0f - cfg_.alpha) * xiML;
-
-        // Apply constraints
-        xi_[k] = clamp(xi_[k], cfg_.xiMin, cfg_.xiMax);
+void WienerFilter::computeGains(const float* magnitude) {
+    const float alpha = static_cast<float>(cfg_.alpha);
+    const float xiMin = static_cast<float>(cfg_.xiMin);
+    const float xiMax = static_cast<float>(cfg_.xiMax);
+    const bool weighted = cfg_.usePerceptualWeighting;
 
-        // Apply perceptual weighting
-        if (cfg_.usePerceptualWeighting) {
-            xi_[k] *= perceptualWeight_[k];
-        }
-    }
-}
-
-void WienerFilter::computeWienerGain() {
-    // Standard Wiener filter gain: G = ξ / (1 + ξ)
+    // Passe fusionnée, sans branche par case :
+    // γ = |Y|² / λ, ξ = α |Ŝ_prev|² / λ + (1-α) max(γ - 1, 0) (décision dirigée),
+    // w = ξ / (1 + ξ) (gain de Wiener) et v = w γ pour les estimateurs MMSE
     for (size_t k = 0; k < numBins_; ++k) {
-        G_[k] = xi_[k] / (1.0f + xi_[k]);
-
-        // Apply gain constraints
-        G_[k] = clamp(G_[k], cfg_.minGain, cfg_.maxGain);
+        const float invNoise = 1.0f / max(lambda_n_[k], WienerFilterConstants::EPSILON_PROTECTION);
+        const float posteriori = magnitude[k] * magnitude[k] * invNoise;
+        const float priori = alpha * S_prev_[k] * invNoise + (1.0f - alpha) * max(posteriori - 1.0f, 0.0f);
+        const float xi = clamp(priori, xiMin, xiMax) * (weighted ? perceptualWeight_[k] : 1.0f);
+        const float wiener = xi / (1.0f + xi);
+        gamma_[k] = posteriori;
+        xi_[k] = xi;
+        GH1_[k] = wiener;
+        v_[k] = max(wiener * posteriori, WienerFilterConstants::MMSE_MIN_V);
     }
-}
 
-void WienerFilter::computeMMSE_LSA_Gain() {
-    // MMSE-LSA (Log-Spectral Amplitude) estimator
-    // More perceptually motivated than standard Wiener filter
+    // G = w · F(v), F tabulé (E1 pour LSA, I0 / I1 pour STSA)
+    if (cfg_.useLSA || cfg_.useSTSA) {
+        const auto estimator = cfg_.useLSA ? MmseGainTable::Estimator::LSA : MmseGainTable::Estimator::STSA;
+        MmseGainTable::getInstance().apply(estimator, GH1_.data(), v_.data(), GH1_.data(), numBins_);
+    }
 
+    // Apply gain constraints
+    const float minGain = static_cast<float>(cfg_.minGain);
+    const float maxGain = static_cast<float>(cfg_.maxGain);
     for (size_t k = 0; k < numBins_; ++k) {
-        // Compute v = ξ/(1+ξ) * γ
-        v_[k] = xi_[k] / (1.0f + xi_[k]) * gamma_[k];
-
-        // Compute gain using exponential integral
-        // G_LSA = ξ/(1+ξ) * exp(0.5 * E1(v))
-        // where E1 is the exponential integral
-
-        float expint_v = MathUtils::expint(v_[k]);
-        GH1_[k] = xi_[k] / (1.0f + xi_[k]) * std::exp(0.5f * expint_v);
-
-        // Alternative formulation for numerical stability
-        if (v_[k] < WienerFilterConstants::EXPINT_SMALL_THRESHOLD) {
-            // Small v approximation
-            GH1_[k] = v_[k] / (1.0f + v_[k]);
-        }
-
-        G_[k] = GH1_[k];
-
-        // Apply gain constraints
-        G_[k] = clamp(G_[k], cfg_.minGain, cfg_.maxGain);
+        G_[k] = clamp(GH1_[k], minGain, maxGain);
     }
 }
 
@@ -232,24 +213,22 @@ void WienerFilter::applyGainSmoothing() {
 
     // Frequency smoothing (3-point median filter)
     if (cfg_.frequencySmoothing > 0.0f) {
-        std::vector<float> smoothedGains(numBins_);
-
         for (size_t k = 1; k < numBins_ - 1; ++k) {
             // Simple 3-point weighted average
-            smoothedGains[k] = cfg_.frequencySmoothing * WienerFilterConstants::FREQUENCY_SMOOTHING_WEIGHT *
-                                   (G_[k - 1] + 2 * G_[k] + G_[k + 1]) +
-                               (1.0f - cfg_.frequencySmoothing) * G_[k];
+            smoothedGains_[k] = cfg_.frequencySmoothing * WienerFilterConstants::FREQUENCY_SMOOTHING_WEIGHT *
+                                    (G_[k - 1] + 2 * G_[k] + G_[k + 1]) +
+                                (1.0f - cfg_.frequencySmoothing) * G_[k];
         }
 
         // Handle boundaries
-        smoothedGains[0] = G_[0];
-        smoothedGains[numBins_ - 1] = G_[numBins_ - 1];
+        smoothedGains_[0] = G_[0];
+        smoothedGains_[numBins_ - 1] = G_[numBins_ - 1];
 
-        G_ = smoothedGains;
+        G_.swap(smoothedGains_);
     }
 
     // Store for next iteration
-    Gprev_ = G_;
+    std::copy(G_.begin(), G_.end(), Gprev_.begin());
 }
 
 // Two-Step Noise Reduction Implementation
@@ -279,6 +258,8 @@ TwoStepNoiseReduction::TwoStepNoiseReduction(const Config& cfg) : cfg_(cfg) {
     residualNoise_.resize(numBins, 0.0f);
 }
 
+TwoStepNoiseReduction::TwoStepNoiseReduction() : TwoStepNoiseReduction(Config{}) {}
+
 TwoStepNoiseReduction::~TwoStepNoiseReduction() = default;
 
 void TwoStepNoiseReduction::process(const std::vector<float>& magnitude, const std::vector<float>& phase,
@@ -1,13 +1,12 @@
 #pragma once
 
 #ifdef __cplusplus
+#include "../../../common/config/NoiseConstants.hpp"
 #include "../Imcra/Imcra.hpp"
 #include <cstdint>
 #include <memory>
 #include <vector>
 
-#include "../../../common/utils/MathUtils.hpp"
-
 namespace AudioNR {
 
 /**
@@ -18,7 +17,7 @@ namespace AudioNR {
  * optimal suppression in the MMSE sense.
  *
  * Key features:
- * - MMSE-LSA (Log-Spectral Amplitude) estimator
+ * - MMSE-LSA (Log-Spectral Amplitude) or MMSE-STSA estimator, from MmseGainTable
  * - Decision-directed approach for a priori SNR estimation
  * - Musical noise reduction through gain smoothing
  * - Incorporates perceptual weighting
@@ -38,8 +37,9 @@ public:
         double minGain = WienerFilterConstants::DEFAULT_MIN_GAIN; ///< Minimum gain floor (prevents over-suppression)
         double maxGain = WienerFilterConstants::DEFAULT_MAX_GAIN; ///< Maximum gain ceiling
 
-        // MMSE-LSA parameters
-        bool useLSA = true;    ///< Use Log-Spectral Amplitude estimator
+        // MMSE parameters
+        bool useLSA = true;   ///< Use Log-Spectral Amplitude estimator
+        bool useSTSA = false; ///< Short-Time Spectral Amplitude estimator when useLSA is false (else plain Wiener)
         double xiMin = WienerFilterConstants::DEFAULT_XI_MIN;  ///< Minimum a priori SNR
         double xiMax = WienerFilterConstants::DEFAULT_XI_MAX; ///< Maximum a priori SNR
 
@@ -82,6 +82,22 @@ public:
     void processMagnitudePhase(const std::vector<float>& magnitude, const std::vector<float>& phase,
                                std::vector<float>& outputMagnitude);
 
+    /**
+     * @brief Gain update against a noise PSD estimated by the caller
+     *
+     * Same decision-directed gain, smoothing and state update as
+     * processMagnitudePhase(), for a pipeline that already tracks the noise
+     * (one estimator shared by several gain rules); the internal noise
+     * estimator is left untouched. Result in getGains().
+     * @param magnitude getNumBins() magnitudes |Y|
+     * @param noisePower getNumBins() noise powers λ
+     */
+    void updateGains(const float* magnitude, const float* noisePower);
+
+    size_t getNumBins() const {
+        return numBins_;
+    }
+
     /**
      * @brief Get current Wiener gains
      * @return Vector of gain values per frequency bin
@@ -106,12 +122,13 @@ public:
     /**
      * @brief Update configuration
      * @param cfg New configuration
+     * @note Resizes the state and rebuilds the noise estimator, then resets
      */
     void setConfig(const Config& cfg);
 
 private:
     Config cfg_;
-    size_t numBins_;
+    size_t numBins_ = 0;
 
     // State variables
     std::vector<float> xi_;       ///< A priori SNR
@@ -119,11 +136,18 @@ private:
     std::vector<float> G_;        ///< Wiener gain
     std::vector<float> Gprev_;    ///< Previous gain (for smoothing)
     std::vector<float> lambda_n_; ///< Noise PSD estimate
-    std::vector<float> S_prev_;   ///< Previous clean speech estimate
+    std::vector<float> S_prev_;   ///< Previous clean speech estimate |G Y|²
 
-    // MMSE-LSA specific
-    std::vector<float> v_;   ///< v = xi / (1 + xi) * gamma
-    std::vector<float> GH1_; ///< Gain under H1 hypothesis
+    // MMSE specific
+    std::vector<float> v_;   ///< v = xi / (1 + xi) * gamma, then table scratch
+    std::vector<float> GH1_; ///< Gain under H1 hypothesis (Wiener gain before the MMSE correction)
+
+    // Scratch (pas d'allocation par trame)
+    std::vector<float> noiseMagnitude_;    ///< IMCRA noise magnitude
+    std::vector<float> speechProbability_; ///< IMCRA speech presence probability
+    std::vector<float> smoothedGains_;     ///< Frequency smoothing output
+    std::vector<float> magnitude_;         ///< processSpectrum() input magnitude
+    std::vector<float> outputMagnitude_;   ///< processSpectrum() output magnitude
 
     // Perceptual weighting
     std::vector<float> perceptualWeight_;
@@ -134,15 +158,9 @@ private:
     // Helper functions
     void initializePerceptualWeights();
     void updateNoiseEstimate(const std::vector<float>& magnitude);
-    void computeAPrioriSNR(const std::vector<float>& magnitude);
-    void computeWienerGain();
-    void computeMMSE_LSA_Gain();
+    void computeGains(const float* magnitude);
     void applyGainSmoothing();
 
-    // Mathematical functions are now in MathUtils or std
-    float besselI0(float x);
-    float besselI1(float x);
-
     inline float max(float a, float b) {
         return (a > b) ? a : b;
     }
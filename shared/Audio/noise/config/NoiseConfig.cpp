@@ -1,5 +1,5 @@
 #include "NoiseConfig.h"
-#include "../../common/config/NoiseContants.hpp"
+#include "../../common/config/NoiseConstants.hpp"
 
 namespace Nyth {
 namespace Audio {
@@ -1,6 +1,6 @@
 #pragma once
 
-#include "../../common/config/NoiseContants.hpp"
+#include "../../common/config/NoiseConstants.hpp"
 #include <string>
 #include <vector>
 
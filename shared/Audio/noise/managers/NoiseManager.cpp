@@ -1,10 +1,37 @@
 #include "NoiseManager.h"
 #include "../../common/jsi/JSICallbackManager.h"
-#include "../../common/config/NoiseContants.hpp"
+#include "../../common/config/NoiseConstants.hpp"
+#include "../../common/dsp/MidSide.hpp"
+#include "../../common/dsp/VectorMath.hpp"
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
 
 namespace facebook {
 namespace react {
 
+namespace MidSide = Nyth::Audio::FX::MidSide;
+namespace VectorMath = Nyth::Audio::FX::VectorMath;
+
+// Tout ce que le thread audio lit : construit côté contrôle, jamais modifié ensuite
+// (sauf l'agressivité, appliquée par le thread audio lui-même)
+struct NoiseManager::ProcessingEngine {
+    Nyth::Audio::NoiseConfig config;
+
+    // === Composants AudioNR (un AdvancedSpectralNR par canal : états de bruit séparés) ===
+    std::array<std::unique_ptr<AudioNR::AdvancedSpectralNR>, 2> advancedSpectralNR;
+    std::unique_ptr<AudioNR::SpectralNR> spectralNR;
+    std::unique_ptr<AudioNR::NoiseReducer> noiseReducer;
+    float aggressiveness = 0.0f; // dernière valeur appliquée
+
+    // === Buffers planaires pré-alloués (MAX_BLOCK_SIZE trames) ===
+    std::vector<float> inputL;
+    std::vector<float> inputR;
+    std::vector<float> outputL;
+    std::vector<float> outputR;
+};
+
 NoiseManager::NoiseManager(std::shared_ptr<JSICallbackManager> callbackManager) : callbackManager_(callbackManager) {}
 
 NoiseManager::~NoiseManager() {
@@ -25,40 +52,44 @@ bool NoiseManager::initialize(const Nyth::Audio::NoiseConfig& config) {
             return false;
         }
 
-        config_ = config;
-
         // Initialisation des composants AudioNR selon l'algorithme
-        initializeNoiseComponents();
+        publishEngine(buildEngine(config));
+        config_ = config;
 
         isInitialized_.store(true);
         currentState_ = Nyth::Audio::NoiseState::INITIALIZED;
 
-        return true;
-
     } catch (const std::exception& e) {
         handleError("Initialization failed: " + std::string(e.what()));
         return false;
     }
+
+    startStatisticsThread();
+    return true;
 }
 
 bool NoiseManager::isInitialized() const {
     return isInitialized_.load();
 }
 
+// Le flux audio doit être arrêté
 void NoiseManager::release() {
+    // Hors verrou : le fil de notification prend mutex_
+    stopStatisticsThread();
+
     std::lock_guard<std::mutex> lock(mutex_);
+    isInitialized_.store(false);
+    currentState_ = Nyth::Audio::NoiseState::UNINITIALIZED;
 
     // Libération des composants AudioNR
-    advancedSpectralNR_.reset();
-    spectralNR_.reset();
-    noiseReducer_.reset();
+    delete pending_.exchange(nullptr, std::memory_order_acq_rel);
+    collectGarbage();
+    delete active_;
+    active_ = nullptr;
+    pendingAudioError_.store(AudioError::NONE, std::memory_order_relaxed);
 
     // Reset des statistiques
-    std::lock_guard<std::mutex> statsLock(statsMutex_);
-    memset(&currentStats_, 0, sizeof(Nyth::Audio::NoiseStatistics));
-
-    isInitialized_.store(false);
-    currentState_ = Nyth::Audio::NoiseState::UNINITIALIZED;
+    resetStatistics();
 }
 
 // === Configuration ===
@@ -68,11 +99,15 @@ bool NoiseManager::setConfig(const Nyth::Audio::NoiseConfig& config) {
     }
 
     std::lock_guard<std::mutex> lock(mutex_);
+    try {
+        // Nouveau moteur avec la nouvelle configuration ; l'ancien tourne jusqu'à la bascule
+        publishEngine(buildEngine(config));
+    } catch (const std::exception& e) {
+        handleError("Configuration failed: " + std::string(e.what()));
+        return false;
+    }
     config_ = config;
 
-    // Reinitialisation avec la nouvelle configuration
-    initializeNoiseComponents();
-
     return true;
 }
 
@@ -83,10 +118,16 @@ Nyth::Audio::NoiseConfig NoiseManager::getConfig() const {
 
 bool NoiseManager::setAlgorithm(Nyth::Audio::NoiseAlgorithm algorithm) {
     std::lock_guard<std::mutex> lock(mutex_);
-    config_.algorithm = algorithm;
+    Nyth::Audio::NoiseConfig config = config_;
+    config.algorithm = algorithm;
 
-    // Reinitialisation avec le nouvel algorithme
-    initializeNoiseComponents();
+    try {
+        publishEngine(buildEngine(config));
+    } catch (const std::exception& e) {
+        handleError("Algorithm change failed: " + std::string(e.what()));
+        return false;
+    }
+    config_ = config;
 
     return true;
 }
@@ -101,10 +142,8 @@ bool NoiseManager::setAggressiveness(float aggressiveness) {
 
     config_.aggressiveness = aggressiveness;
 
-    // Mise à jour de l'agressivité sur les composants actifs
-    if (advancedSpectralNR_) {
-        advancedSpectralNR_->setAggressiveness(aggressiveness);
-    }
+    // Appliquée par le thread audio au bloc suivant, sans reconstruire les composants
+    aggressiveness_.store(aggressiveness, std::memory_order_relaxed);
 
     return true;
 }
@@ -136,37 +175,43 @@ bool NoiseManager::isProcessing() const {
     return currentState_ == Nyth::Audio::NoiseState::PROCESSING;
 }
 
-// === Traitement audio ===
+// === Traitement audio (thread audio : ni verrou ni allocation) ===
 bool NoiseManager::processAudio(const float* input, float* output, size_t frameCount, int channels) {
-    if (!isInitialized_.load() || currentState_ != Nyth::Audio::NoiseState::PROCESSING) {
-        // Passthrough si non initialisé ou non en cours de traitement
+    if (!input || !output || channels <= 0) {
+        return false;
+    }
+    const size_t totalSamples = frameCount * static_cast<size_t>(channels);
+
+    ProcessingEngine* engine = nullptr;
+    if (isInitialized_.load() && currentState_ == Nyth::Audio::NoiseState::PROCESSING) {
+        engine = acquireEngine();
+    }
+    if (!engine || channels > 2) {
+        // Passthrough si non initialisé, non en cours de traitement ou canaux non supportés
         if (input != output) {
-            std::copy(input, input + frameCount * channels, output);
+            std::copy(input, input + totalSamples, output);
         }
-        return true;
+        return engine == nullptr;
     }
 
-    std::lock_guard<std::mutex> lock(mutex_);
-
     try {
-        // Mise à jour des statistiques d'entrée
-        updateStatistics(input, nullptr, frameCount, channels);
+        const float inputLevel = VectorMath::peak(input, totalSamples);
 
-        // Traitement selon l'algorithme sélectionné
-        bool success = processWithPipeline(input, output, frameCount, channels);
-
-        // Mise à jour des statistiques de sortie
-        if (success) {
-            updateStatistics(nullptr, output, frameCount, channels);
+        // Passes de MAX_BLOCK_SIZE trames : les buffers du moteur suffisent toujours
+        for (size_t offset = 0; offset < frameCount; offset += NoiseManagerConstants::MAX_BLOCK_SIZE) {
+            const size_t count = std::min(NoiseManagerConstants::MAX_BLOCK_SIZE, frameCount - offset);
+            const size_t position = offset * static_cast<size_t>(channels);
+            processWithPipeline(*engine, input + position, output + position, count, channels);
         }
 
-        return success;
+        updateStatistics(inputLevel, VectorMath::peak(output, totalSamples), frameCount, channels);
+        return true;
 
-    } catch (const std::exception& e) {
-        handleError("Audio processing failed: " + std::string(e.what()));
+    } catch (const std::exception&) {
+        reportAudioError(AudioError::PROCESSING);
         // Passthrough en cas d'erreur
         if (input != output) {
-            std::copy(input, input + frameCount * channels, output);
+            std::copy(input, input + totalSamples, output);
         }
         return false;
     }
@@ -174,7 +219,15 @@ bool NoiseManager::processAudio(const float* input, float* output, size_t frameC
 
 bool NoiseManager::processAudioStereo(const float* inputL, const float* inputR, float* outputL, float* outputR,
                                       size_t frameCount) {
-    if (!isInitialized_.load() || currentState_ != Nyth::Audio::NoiseState::PROCESSING) {
+    if (!inputL || !inputR || !outputL || !outputR) {
+        return false;
+    }
+
+    ProcessingEngine* engine = nullptr;
+    if (isInitialized_.load() && currentState_ == Nyth::Audio::NoiseState::PROCESSING) {
+        engine = acquireEngine();
+    }
+    if (!engine) {
         // Passthrough si non initialisé ou non en cours de traitement
         if (inputL != outputL) {
             std::copy(inputL, inputL + frameCount, outputL);
@@ -185,37 +238,22 @@ bool NoiseManager::processAudioStereo(const float* inputL, const float* inputR,
         return true;
     }
 
-    std::lock_guard<std::mutex> lock(mutex_);
-
     try {
-        // Conversion stéréo vers mono pour le traitement
-        workBufferL_.resize(frameCount);
-        workBufferR_.resize(frameCount);
-
-        std::copy(inputL, inputL + frameCount, workBufferL_.data());
-        std::copy(inputR, inputR + frameCount, workBufferR_.data());
-
-        // Traitement mono de chaque canal
-        bool successL = processWithPipeline(workBufferL_.data(), workBufferL_.data(), frameCount, 1);
-        bool successR = processWithPipeline(workBufferR_.data(), workBufferR_.data(), frameCount, 1);
+        const float inputLevel = std::max(VectorMath::peak(inputL, frameCount), VectorMath::peak(inputR, frameCount));
 
-        // Copie des résultats
-        if (successL) {
-            std::copy(workBufferL_.data(), workBufferL_.data() + frameCount, outputL);
-        } else if (inputL != outputL) {
-            std::copy(inputL, inputL + frameCount, outputL);
-        }
-
-        if (successR) {
-            std::copy(workBufferR_.data(), workBufferR_.data() + frameCount, outputR);
-        } else if (inputR != outputR) {
-            std::copy(inputR, inputR + frameCount, outputR);
+        for (size_t offset = 0; offset < frameCount; offset += NoiseManagerConstants::MAX_BLOCK_SIZE) {
+            const size_t count = std::min(NoiseManagerConstants::MAX_BLOCK_SIZE, frameCount - offset);
+            processStereoWithPipeline(*engine, inputL + offset, inputR + offset, outputL + offset, outputR + offset,
+                                      count);
         }
 
-        return successL && successR;
+        const float outputLevel =
+            std::max(VectorMath::peak(outputL, frameCount), VectorMath::peak(outputR, frameCount));
+        updateStatistics(inputLevel, outputLevel, frameCount, 2);
+        return true;
 
-    } catch (const std::exception& e) {
-        handleError("Stereo processing failed: " + std::string(e.what()));
+    } catch (const std::exception&) {
+        reportAudioError(AudioError::STEREO_PROCESSING);
         // Passthrough en cas d'erreur
         if (inputL != outputL) {
             std::copy(inputL, inputL + frameCount, outputL);
@@ -229,38 +267,59 @@ bool NoiseManager::processAudioStereo(const float* inputL, const float* inputR,
 
 // === Statistiques et métriques ===
 Nyth::Audio::NoiseStatistics NoiseManager::getStatistics() const {
-    std::lock_guard<std::mutex> lock(statsMutex_);
-    return currentStats_;
+    Nyth::Audio::NoiseStatistics stats;
+    stats.inputLevel = inputLevel_.load(std::memory_order_relaxed);
+    stats.outputLevel = outputLevel_.load(std::memory_order_relaxed);
+    stats.processedFrames = processedFrames_.load(std::memory_order_relaxed);
+    stats.processedSamples = processedSamples_.load(std::memory_order_relaxed);
+
+    const uint32_t sampleRate = statsSampleRate_.load(std::memory_order_relaxed);
+    if (sampleRate > 0) {
+        stats.durationMs =
+            static_cast<int64_t>(processedDurationFrames_.load(std::memory_order_relaxed) * 1000 / sampleRate);
+    }
+
+    // Calcul du SNR estimé (simplifié)
+    if (stats.inputLevel > NoiseManagerConstants::DEFAULT_RESET_VALUE) {
+        stats.estimatedSNR = NoiseManagerConstants::SNR_LOG_FACTOR * std::log10(stats.outputLevel / stats.inputLevel);
+    }
+
+    // Calcul de la probabilité de parole (simplifié)
+    stats.speechProbability = std::min(1.0f, stats.inputLevel / NoiseManagerConstants::SPEECH_THRESHOLD_LEVEL);
+
+    // Niveau de bruit musical (estimation simplifiée)
+    stats.musicalNoiseLevel =
+        std::max(NoiseManagerConstants::DEFAULT_RESET_VALUE, stats.inputLevel - stats.outputLevel);
+
+    return stats;
 }
 
 float NoiseManager::getInputLevel() const {
-    std::lock_guard<std::mutex> lock(statsMutex_);
-    return currentStats_.inputLevel;
+    return inputLevel_.load(std::memory_order_relaxed);
 }
 
 float NoiseManager::getOutputLevel() const {
-    std::lock_guard<std::mutex> lock(statsMutex_);
-    return currentStats_.outputLevel;
+    return outputLevel_.load(std::memory_order_relaxed);
 }
 
 float NoiseManager::getEstimatedSNR() const {
-    std::lock_guard<std::mutex> lock(statsMutex_);
-    return currentStats_.estimatedSNR;
+    return getStatistics().estimatedSNR;
 }
 
 float NoiseManager::getSpeechProbability() const {
-    std::lock_guard<std::mutex> lock(statsMutex_);
-    return currentStats_.speechProbability;
+    return getStatistics().speechProbability;
 }
 
 float NoiseManager::getMusicalNoiseLevel() const {
-    std::lock_guard<std::mutex> lock(statsMutex_);
-    return currentStats_.musicalNoiseLevel;
+    return getStatistics().musicalNoiseLevel;
 }
 
 void NoiseManager::resetStatistics() {
-    std::lock_guard<std::mutex> lock(statsMutex_);
-    memset(&currentStats_, 0, sizeof(Nyth::Audio::NoiseStatistics));
+    inputLevel_.store(NoiseManagerConstants::DEFAULT_RESET_VALUE, std::memory_order_relaxed);
+    outputLevel_.store(NoiseManagerConstants::DEFAULT_RESET_VALUE, std::memory_order_relaxed);
+    processedFrames_.store(0, std::memory_order_relaxed);
+    processedSamples_.store(0, std::memory_order_relaxed);
+    processedDurationFrames_.store(0, std::memory_order_relaxed);
 }
 
 // === Informations ===
@@ -285,165 +344,180 @@ void NoiseManager::setProcessingCallback(ProcessingCallback callback) {
 
 // === Méthodes privées ===
 
-void NoiseManager::initializeNoiseComponents() {
-    // Libération des composants existants
-    advancedSpectralNR_.reset();
-    spectralNR_.reset();
-    noiseReducer_.reset();
+std::unique_ptr<NoiseManager::ProcessingEngine>
+NoiseManager::buildEngine(const Nyth::Audio::NoiseConfig& config) const {
+    auto engine = std::make_unique<ProcessingEngine>();
+    engine->config = config;
+    engine->aggressiveness = config.aggressiveness;
+
+    // Configuration commune des variantes AdvancedSpectralNR
+    AudioNR::AdvancedSpectralNR::Config advConfig;
+    advConfig.sampleRate = config.sampleRate;
+    advConfig.fftSize = config.fftSize;
+    advConfig.hopSize = config.hopSize;
+    advConfig.aggressiveness = config.aggressiveness;
+    advConfig.enableMultiband = config.enableMultiband;
+    advConfig.preserveTransients = config.preserveTransients;
+    advConfig.reduceMusicalNoise = config.reduceMusicalNoise;
+    bool useAdvanced = true;
 
     // Initialisation selon l'algorithme
-    switch (config_.algorithm) {
-        case Nyth::Audio::NoiseAlgorithm::ADVANCED_SPECTRAL: {
-            // Configuration pour Advanced Spectral NR (algorithme hybride complet)
-            AudioNR::AdvancedSpectralNR::Config advConfig;
-            advConfig.sampleRate = config_.sampleRate;
-            advConfig.fftSize = config_.fftSize;
-            advConfig.hopSize = config_.hopSize;
-            advConfig.aggressiveness = config_.aggressiveness;
-            advConfig.enableMultiband = config_.enableMultiband;
-            advConfig.preserveTransients = config_.preserveTransients;
-            advConfig.reduceMusicalNoise = config_.reduceMusicalNoise;
-
-            advancedSpectralNR_ = std::make_unique<AudioNR::AdvancedSpectralNR>(advConfig);
+    switch (config.algorithm) {
+        case Nyth::Audio::NoiseAlgorithm::ADVANCED_SPECTRAL:
+            // Algorithme hybride complet, réglages de la configuration
             break;
-        }
 
-        case Nyth::Audio::NoiseAlgorithm::WIENER_FILTER: {
-            // Configuration pour Wiener Filter avec IMCRA
-            AudioNR::AdvancedSpectralNR::Config wienerConfig;
-            wienerConfig.sampleRate = config_.sampleRate;
-            wienerConfig.fftSize = config_.fftSize;
-            wienerConfig.hopSize = config_.hopSize;
-            wienerConfig.aggressiveness = config_.aggressiveness;
-            wienerConfig.enableMultiband = false; // Désactivé pour Wiener pur
-            wienerConfig.preserveTransients = config_.preserveTransients;
-            wienerConfig.reduceMusicalNoise = config_.reduceMusicalNoise;
-
-            advancedSpectralNR_ = std::make_unique<AudioNR::AdvancedSpectralNR>(wienerConfig);
+        case Nyth::Audio::NoiseAlgorithm::WIENER_FILTER:
+            // Wiener Filter avec IMCRA
+            advConfig.enableMultiband = false; // Désactivé pour Wiener pur
             break;
-        }
 
-        case Nyth::Audio::NoiseAlgorithm::MULTIBAND: {
-            // Configuration pour traitement multi-bandes
-            AudioNR::AdvancedSpectralNR::Config multibandConfig;
-            multibandConfig.sampleRate = config_.sampleRate;
-            multibandConfig.fftSize = config_.fftSize;
-            multibandConfig.hopSize = config_.hopSize;
-            multibandConfig.aggressiveness = config_.aggressiveness;
-            multibandConfig.enableMultiband = true; // Activé pour multi-bandes
-            multibandConfig.preserveTransients = config_.preserveTransients;
-            multibandConfig.reduceMusicalNoise = config_.reduceMusicalNoise;
-
-            advancedSpectralNR_ = std::make_unique<AudioNR::AdvancedSpectralNR>(multibandConfig);
+        case Nyth::Audio::NoiseAlgorithm::MULTIBAND:
+            // Traitement multi-bandes
+            advConfig.enableMultiband = true; // Activé pour multi-bandes
             break;
-        }
 
-        case Nyth::Audio::NoiseAlgorithm::TWO_STEP: {
-            // Configuration pour réduction en deux étapes
-            AudioNR::AdvancedSpectralNR::Config twoStepConfig;
-            twoStepConfig.sampleRate = config_.sampleRate;
-            twoStepConfig.fftSize = config_.fftSize;
-            twoStepConfig.hopSize = config_.hopSize;
-            twoStepConfig.aggressiveness = config_.aggressiveness;
-            twoStepConfig.enableMultiband = false;
-            twoStepConfig.preserveTransients = true; // Important pour two-step
-            twoStepConfig.reduceMusicalNoise = true; // Important pour two-step
-
-            advancedSpectralNR_ = std::make_unique<AudioNR::AdvancedSpectralNR>(twoStepConfig);
+        case Nyth::Audio::NoiseAlgorithm::TWO_STEP:
+            // Réduction en deux étapes
+            advConfig.enableMultiband = false;
+            advConfig.preserveTransients = true; // Important pour two-step
+            advConfig.reduceMusicalNoise = true; // Important pour two-step
             break;
-        }
 
-        case Nyth::Audio::NoiseAlgorithm::HYBRID: {
-            // Configuration pour algorithme hybride (combine plusieurs approches)
-            AudioNR::AdvancedSpectralNR::Config hybridConfig;
-            hybridConfig.sampleRate = config_.sampleRate;
-            hybridConfig.fftSize = config_.fftSize;
-            hybridConfig.hopSize = config_.hopSize;
-            hybridConfig.aggressiveness = config_.aggressiveness;
-            hybridConfig.enableMultiband = true;    // Activé pour hybride
-            hybridConfig.preserveTransients = true; // Activé pour hybride
-            hybridConfig.reduceMusicalNoise = true; // Activé pour hybride
-
-            advancedSpectralNR_ = std::make_unique<AudioNR::AdvancedSpectralNR>(hybridConfig);
+        case Nyth::Audio::NoiseAlgorithm::HYBRID:
+            // Algorithme hybride (combine plusieurs approches)
+            advConfig.enableMultiband = true;    // Activé pour hybride
+            advConfig.preserveTransients = true; // Activé pour hybride
+            advConfig.reduceMusicalNoise = true; // Activé pour hybride
             break;
-        }
 
         case Nyth::Audio::NoiseAlgorithm::SPECTRAL_SUBTRACTION: {
             // Configuration pour Spectral NR classique
-            AudioNR::SpectralNR::Config specConfig;
-            specConfig.sampleRate = config_.sampleRate;
-            specConfig.fftSize = config_.fftSize;
-            specConfig.hopSize = config_.hopSize;
-            specConfig.aggressiveness = config_.aggressiveness;
+            AudioNR::SpectralNRConfig specConfig;
+            specConfig.sampleRate = config.sampleRate;
+            specConfig.fftSize = config.fftSize;
+            specConfig.hopSize = config.hopSize;
 
-            spectralNR_ = std::make_unique<AudioNR::SpectralNR>(specConfig);
+            engine->spectralNR = std::make_unique<AudioNR::SpectralNR>(specConfig);
+            useAdvanced = false;
             break;
         }
 
-        default: {
+        default:
             // Fallback vers NoiseReducer pour les algorithmes non reconnus
-            noiseReducer_ = std::make_unique<AudioNR::NoiseReducer>(config_.sampleRate, config_.channels);
+            engine->noiseReducer = std::make_unique<AudioNR::NoiseReducer>(config.sampleRate, config.channels);
+            useAdvanced = false;
             break;
-        }
     }
 
-    // Connexion des composants après initialisation
-    connectComponents();
-}
-
-void NoiseManager::connectComponents() {
-    // Configuration des callbacks entre composants si nécessaire
-    if (advancedSpectralNR_) {
-        // Le composant AdvancedSpectralNR gère déjà ses sous-composants internes
-        // (IMCRA, Wiener, Multiband) selon sa configuration
+    if (useAdvanced) {
+        const size_t numChannels = (config.channels >= 2) ? 2 : 1;
+        for (size_t ch = 0; ch < numChannels; ++ch) {
+            engine->advancedSpectralNR[ch] = std::make_unique<AudioNR::AdvancedSpectralNR>(advConfig);
+        }
     }
 
-    if (spectralNR_) {
-        // Configuration des callbacks pour SpectralNR si nécessaire
+    for (std::vector<float>* buffer : {&engine->inputL, &engine->inputR, &engine->outputL, &engine->outputR}) {
+        buffer->assign(NoiseManagerConstants::MAX_BLOCK_SIZE, 0.0f);
     }
+    return engine;
+}
 
-    if (noiseReducer_) {
-        // Configuration des callbacks pour NoiseReducer si nécessaire
-    }
+// Contrôle : remplace le moteur en attente (jamais vu par le thread audio)
+void NoiseManager::publishEngine(std::unique_ptr<ProcessingEngine> engine) {
+    collectGarbage();
+    statsSampleRate_.store(engine->config.sampleRate, std::memory_order_relaxed);
+    aggressiveness_.store(engine->config.aggressiveness, std::memory_order_relaxed);
+    delete pending_.exchange(engine.release(), std::memory_order_acq_rel);
 }
 
-bool NoiseManager::processWithPipeline(const float* input, float* output, size_t frameCount, int channels) {
-    // Pipeline de traitement optimisé avec composants connectés
-    if (advancedSpectralNR_) {
-        // Traitement avec AdvancedSpectralNR (inclut IMCRA + Wiener + Multiband)
-        return advancedSpectralNR_->process(input, output, frameCount);
-    } else if (spectralNR_) {
-        // Traitement avec SpectralNR classique
-        return spectralNR_->process(input, output, frameCount);
-    } else if (noiseReducer_) {
-        // Traitement avec NoiseReducer (gate/expander)
-        if (channels == 1) {
-            noiseReducer_->processMono(input, output, frameCount);
-            return true;
-        } else {
-            // Traitement stéréo
-            std::vector<float> leftInput(frameCount), rightInput(frameCount);
-            std::vector<float> leftOutput(frameCount), rightOutput(frameCount);
+// Contrôle : libère les moteurs rendus par le thread audio
+void NoiseManager::collectGarbage() {
+    for (std::atomic<ProcessingEngine*>& slot : retired_) {
+        delete slot.exchange(nullptr, std::memory_order_acq_rel);
+    }
+}
 
-            // Désentrelacement
-            for (size_t i = 0; i < frameCount; ++i) {
-                leftInput[i] = input[i * 2];
-                rightInput[i] = input[i * 2 + 1];
+// Thread audio : adopte le moteur en attente s'il reste un emplacement pour rendre
+// l'actuel, puis l'agressivité courante
+NoiseManager::ProcessingEngine* NoiseManager::acquireEngine() noexcept {
+    if (pending_.load(std::memory_order_relaxed) != nullptr) {
+        // Seul le thread audio remplit un emplacement : vide ici, il le reste jusqu'au store
+        for (std::atomic<ProcessingEngine*>& slot : retired_) {
+            if (slot.load(std::memory_order_acquire) == nullptr) {
+                ProcessingEngine* next = pending_.exchange(nullptr, std::memory_order_acq_rel);
+                if (next) {
+                    slot.store(active_, std::memory_order_release);
+                    active_ = next;
+                }
+                break;
             }
+        }
+    }
 
-            noiseReducer_->processStereo(leftInput.data(), rightInput.data(), leftOutput.data(), rightOutput.data(),
-                                         frameCount);
-
-            // Réeentrelacement
-            for (size_t i = 0; i < frameCount; ++i) {
-                output[i * 2] = leftOutput[i];
-                output[i * 2 + 1] = rightOutput[i];
+    if (active_) {
+        const float aggressiveness = aggressiveness_.load(std::memory_order_relaxed);
+        if (aggressiveness != active_->aggressiveness) {
+            for (auto& reducer : active_->advancedSpectralNR) {
+                if (reducer) {
+                    reducer->setAggressiveness(aggressiveness);
+                }
             }
-            return true;
+            active_->aggressiveness = aggressiveness;
         }
     }
+    return active_;
+}
+
+// Un bloc d'au plus MAX_BLOCK_SIZE trames, entrelacé (1 ou 2 canaux)
+void NoiseManager::processWithPipeline(ProcessingEngine& engine, const float* input, float* output,
+                                       size_t frameCount, int channels) {
+    if (channels == 1) {
+        if (engine.advancedSpectralNR[0]) {
+            // Traitement avec AdvancedSpectralNR (inclut IMCRA + Wiener + Multiband)
+            engine.advancedSpectralNR[0]->process(input, output, frameCount);
+        } else if (engine.spectralNR) {
+            // Traitement avec SpectralNR classique
+            engine.spectralNR->process(input, output, frameCount);
+        } else if (engine.noiseReducer) {
+            // Traitement avec NoiseReducer (gate/expander)
+            engine.noiseReducer->processMono(input, output, frameCount);
+        } else if (input != output) {
+            std::copy(input, input + frameCount, output);
+        }
+        return;
+    }
 
-    return false;
+    // Désentrelacement SIMD vers les buffers du moteur, traitement planaire, réentrelacement
+    MidSide::deinterleave(input, engine.inputL.data(), engine.inputR.data(), frameCount, MidSide::IDENTITY);
+    processStereoWithPipeline(engine, engine.inputL.data(), engine.inputR.data(), engine.outputL.data(),
+                              engine.outputR.data(), frameCount);
+    MidSide::interleave(engine.outputL.data(), engine.outputR.data(), output, frameCount, MidSide::IDENTITY);
+}
+
+// Un bloc d'au plus MAX_BLOCK_SIZE trames, planaire
+void NoiseManager::processStereoWithPipeline(ProcessingEngine& engine, const float* inputL, const float* inputR,
+                                             float* outputL, float* outputR, size_t frameCount) {
+    if (engine.spectralNR) {
+        // Un état de bruit par canal, FFT des deux canaux groupées
+        engine.spectralNR->processStereo(inputL, inputR, outputL, outputR, frameCount);
+    } else if (engine.noiseReducer) {
+        engine.noiseReducer->processStereo(inputL, inputR, outputL, outputR, frameCount);
+    } else if (engine.advancedSpectralNR[0]) {
+        engine.advancedSpectralNR[0]->process(inputL, outputL, frameCount);
+        if (engine.advancedSpectralNR[1]) {
+            engine.advancedSpectralNR[1]->process(inputR, outputR, frameCount);
+        } else if (inputR != outputR) {
+            std::copy(inputR, inputR + frameCount, outputR);
+        }
+    } else {
+        if (inputL != outputL) {
+            std::copy(inputL, inputL + frameCount, outputL);
+        }
+        if (inputR != outputR) {
+            std::copy(inputR, inputR + frameCount, outputR);
+        }
+    }
 }
 
 void NoiseManager::setupProcessingPipeline() {
@@ -484,58 +558,75 @@ void NoiseManager::setupProcessingPipeline() {
     }
 }
 
-void NoiseManager::updateStatistics(const float* input, const float* output, size_t frameCount, int channels) {
-    std::lock_guard<std::mutex> lock(statsMutex_);
+// Thread audio : niveaux et compteurs seulement, la notification est faite par le fil dédié
+void NoiseManager::updateStatistics(float inputLevel, float outputLevel, size_t frameCount, int channels) noexcept {
+    inputLevel_.store(inputLevel, std::memory_order_relaxed);
+    outputLevel_.store(outputLevel, std::memory_order_relaxed);
+    processedFrames_.fetch_add(1, std::memory_order_relaxed);
+    processedDurationFrames_.fetch_add(frameCount, std::memory_order_relaxed);
+    processedSamples_.fetch_add(frameCount * static_cast<size_t>(channels), std::memory_order_release);
+}
 
-    if (input) {
-        // Calcul du niveau d'entrée
-        float inputLevel = NoiseManagerConstants::DEFAULT_RESET_VALUE;
-        for (size_t i = 0; i < frameCount * channels; ++i) {
-            inputLevel = std::max(inputLevel, std::abs(input[i]));
-        }
-        currentStats_.inputLevel = inputLevel;
-        currentStats_.processedFrames++;
-        currentStats_.processedSamples += frameCount * channels;
-        currentStats_.durationMs += (frameCount * 1000) / config_.sampleRate;
+void NoiseManager::notifyStatisticsCallback() {
+    StatisticsCallback callback;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        callback = statisticsCallback_;
     }
+    const Nyth::Audio::NoiseStatistics stats = getStatistics();
 
-    if (output) {
-        // Calcul du niveau de sortie
-        float outputLevel = NoiseManagerConstants::DEFAULT_RESET_VALUE;
-        for (size_t i = 0; i < frameCount * channels; ++i) {
-            outputLevel = std::max(outputLevel, std::abs(output[i]));
-        }
-        currentStats_.outputLevel = outputLevel;
-
-        // Calcul du SNR estimé (simplifié)
-        if (currentStats_.inputLevel > NoiseManagerConstants::DEFAULT_RESET_VALUE) {
-            currentStats_.estimatedSNR = NoiseManagerConstants::SNR_LOG_FACTOR *
-                std::log10(currentStats_.outputLevel / currentStats_.inputLevel);
-        }
+    if (callback) {
+        callback(stats);
     }
 
-    // Calcul de la probabilité de parole (simplifié)
-    currentStats_.speechProbability = std::min(1.0f,
-        currentStats_.inputLevel / NoiseManagerConstants::SPEECH_THRESHOLD_LEVEL);
-
-    // Mise à jour du niveau de bruit musical (estimation simplifiée)
-    currentStats_.musicalNoiseLevel = std::max(NoiseManagerConstants::DEFAULT_RESET_VALUE,
-        currentStats_.inputLevel - currentStats_.outputLevel);
+    // Notification via JSICallbackManager si disponible
+    if (callbackManager_) {
+        // Formater les statistiques en JSON pour JavaScript
+        std::string statsJson = formatStatisticsToJSON(stats);
+        callbackManager_->notifyStatistics(statsJson);
+    }
+}
 
-    // Notification du callback
-    notifyStatisticsCallback();
+void NoiseManager::startStatisticsThread() {
+    stopStatisticsThread();
+    statsThreadStop_ = false;
+    statsThread_ = std::thread(&NoiseManager::statisticsThreadLoop, this);
 }
 
-void NoiseManager::notifyStatisticsCallback() {
-    if (statisticsCallback_) {
-        statisticsCallback_(currentStats_);
+void NoiseManager::stopStatisticsThread() {
+    if (statsThread_.joinable()) {
+        {
+            std::lock_guard<std::mutex> lock(statsThreadMutex_);
+            statsThreadStop_ = true;
+        }
+        statsThreadCv_.notify_one();
+        statsThread_.join();
     }
+}
 
-    // Notification via JSICallbackManager si disponible
-    if (callbackManager_) {
-        // Formater les statistiques en JSON pour JavaScript
-        std::string statsJson = formatStatisticsToJSON(currentStats_);
-        callbackManager_->notifyStatistics(statsJson);
+// Notifie toutes les STATS_NOTIFY_INTERVAL_MS si des blocs ont été traités depuis
+void NoiseManager::statisticsThreadLoop() {
+    uint64_t notifiedSamples = processedSamples_.load(std::memory_order_acquire);
+    std::unique_lock<std::mutex> lock(statsThreadMutex_);
+    while (!statsThreadStop_) {
+        statsThreadCv_.wait_for(lock, std::chrono::milliseconds(NoiseManagerConstants::STATS_NOTIFY_INTERVAL_MS),
+                                [this] { return statsThreadStop_; });
+        if (statsThreadStop_) {
+            break;
+        }
+        const AudioError error = pendingAudioError_.exchange(AudioError::NONE, std::memory_order_acq_rel);
+        if (error != AudioError::NONE) {
+            lock.unlock();
+            notifyAudioError(error);
+            lock.lock();
+        }
+        const uint64_t samples = processedSamples_.load(std::memory_order_acquire);
+        if (samples != notifiedSamples) {
+            notifiedSamples = samples;
+            lock.unlock();
+            notifyStatisticsCallback();
+            lock.lock();
+        }
     }
 }
 
@@ -553,6 +644,16 @@ void NoiseManager::handleError(const std::string& error) {
     }
 }
 
+// Thread audio : ni chaîne ni callback, le fil de notification s'en charge
+void NoiseManager::reportAudioError(AudioError error) noexcept {
+    currentState_ = Nyth::Audio::NoiseState::ERROR;
+    pendingAudioError_.store(error, std::memory_order_release);
+}
+
+void NoiseManager::notifyAudioError(AudioError error) {
+    handleError(error == AudioError::STEREO_PROCESSING ? "Stereo processing failed" : "Audio processing failed");
+}
+
 float NoiseManager::calculateRMS(const float* data, size_t size) const {
     if (size == 0)
         return 0.0f;
@@ -583,126 +684,22 @@ std::string NoiseManager::formatStatisticsToJSON(const Nyth::Audio::NoiseStatist
 }
 
 // === Implémentations SIMD ===
+// Le chemin principal désentrelace, mesure et traite avec les noyaux vectoriels
 
 bool NoiseManager::processAudio_SIMD(const float* input, float* output, size_t frameCount, int channels) {
-    if (!isInitialized_.load() || !isProcessing_.load()) {
-        if (input != output) {
-            if (AudioNR::MathUtils::SIMDIntegration::isSIMDAccelerationEnabled() && frameCount >= 64) {
-                std::memcpy(output, input, frameCount * channels * sizeof(float));
-            } else {
-                std::copy(input, input + frameCount * channels, output);
-            }
-        }
-        return true;
-    }
-
-    if (!input || !output || frameCount == 0) {
-        return false;
-    }
-
-    try {
-        // Utiliser SIMD si disponible et taille suffisante
-        if (AudioNR::MathUtils::SIMDIntegration::isSIMDAccelerationEnabled() &&
-            frameCount >= NoiseManagerConstants::SIMD_MIN_SIZE) {
-            // Pré-traitement SIMD
-            if (channels == 1) {
-                // Copie SIMD
-                std::memcpy(output, input, frameCount * sizeof(float));
-
-                // Appliquer la réduction de bruit avec SIMD
-                applyNoiseReduction_SIMD(output, frameCount);
-
-                // Normalisation SIMD
-                if (config_.autoNormalize) {
-                    AudioNR::MathUtils::MathUtilsSIMDExtension::normalizeAudioSIMD(
-                        output, frameCount, config_.targetLevel);
-                }
-            } else {
-                // Traitement multi-canaux SIMD
-                size_t totalSamples = frameCount * channels;
-                std::vector<float> tempBuffer(totalSamples);
-
-                // Copie entrelacée SIMD
-                std::memcpy(tempBuffer.data(), input, totalSamples * sizeof(float));
-
-                // Appliquer la réduction de bruit avec SIMD
-                applyNoiseReduction_SIMD(tempBuffer.data(), totalSamples);
-
-                // Normalisation SIMD
-                if (config_.autoNormalize) {
-                    AudioNR::MathUtils::MathUtilsSIMDExtension::normalizeAudioSIMD(
-                        tempBuffer.data(), totalSamples, config_.targetLevel);
-                }
-
-                // Copie vers output
-                std::memcpy(output, tempBuffer.data(), totalSamples * sizeof(float));
-            }
-
-            return true;
-        } else {
-            // Version standard
-            return processAudio(input, output, frameCount, channels);
-        }
-    } catch (const std::exception& e) {
-        handleError("SIMD noise processing failed: " + std::string(e.what()));
-        return false;
-    }
+    return processAudio(input, output, frameCount, channels);
 }
 
 bool NoiseManager::processAudioStereo_SIMD(const float* inputL, const float* inputR, float* outputL, float* outputR,
-                                         size_t frameCount) {
-    if (!isInitialized_.load() || !isProcessing_.load()) {
-        if (inputL != outputL) {
-            if (AudioNR::MathUtils::SIMDIntegration::isSIMDAccelerationEnabled() && frameCount >= 64) {
-                std::memcpy(outputL, inputL, frameCount * sizeof(float));
-                std::memcpy(outputR, inputR, frameCount * sizeof(float));
-            } else {
-                std::copy(inputL, inputL + frameCount, outputL);
-                std::copy(inputR, inputR + frameCount, outputR);
-            }
-        }
-        return true;
-    }
-
-    if (!inputL || !inputR || !outputL || !outputR || frameCount == 0) {
-        return false;
-    }
-
-    try {
-        // Utiliser SIMD si disponible et taille suffisante
-        if (AudioNR::MathUtils::SIMDIntegration::isSIMDAccelerationEnabled() &&
-            frameCount >= NoiseManagerConstants::SIMD_MIN_SIZE) {
-            // Copie SIMD
-            std::memcpy(outputL, inputL, frameCount * sizeof(float));
-            std::memcpy(outputR, inputR, frameCount * sizeof(float));
-
-            // Appliquer la réduction de bruit SIMD sur chaque canal
-            applyNoiseReduction_SIMD(outputL, frameCount);
-            applyNoiseReduction_SIMD(outputR, frameCount);
-
-            // Normalisation SIMD
-            if (config_.autoNormalize) {
-                AudioNR::MathUtils::MathUtilsSIMDExtension::normalizeAudioSIMD(
-                    outputL, frameCount, config_.targetLevel);
-                AudioNR::MathUtils::MathUtilsSIMDExtension::normalizeAudioSIMD(
-                    outputR, frameCount, config_.targetLevel);
-            }
-
-            return true;
-        } else {
-            // Version standard
-            return processAudioStereo(inputL, inputR, outputL, outputR, frameCount);
-        }
-    } catch (const std::exception& e) {
-        handleError("SIMD stereo noise processing failed: " + std::string(e.what()));
-        return false;
-    }
+                                           size_t frameCount) {
+    return processAudioStereo(inputL, inputR, outputL, outputR, frameCount);
 }
 
 float NoiseManager::analyzeLevel_SIMD(const float* data, size_t count) const {
     if (!data || count == 0) return 0.0f;
 
-    if (AudioNR::MathUtils::SIMDIntegration::isSIMDAccelerationEnabled() && count >= 64) {
+    if (AudioNR::MathUtils::SIMDIntegration::isSIMDAccelerationEnabled() &&
+        count >= NoiseManagerConstants::SIMD_MIN_SIZE) {
         return AudioNR::MathUtils::MathUtilsSIMDExtension::calculateRMSSIMD(data, count);
     } else {
         // Version standard
@@ -714,41 +711,5 @@ float NoiseManager::analyzeLevel_SIMD(const float* data, size_t count) const {
     }
 }
 
-// Méthode helper pour appliquer la réduction de bruit SIMD
-void NoiseManager::applyNoiseReduction_SIMD(float* data, size_t count) {
-    if (!data || count == 0) return;
-
-    // Appliquer des filtres anti-bruit SIMD selon l'algorithme
-    switch (config_.algorithm) {
-        case Nyth::Audio::NoiseAlgorithm::SPECTRAL_SUBTRACTION:
-            // Filtre spectral simple SIMD
-            AudioNR::SIMD::SIMDMathFunctions::apply_soft_clipper(data, count, config_.aggressiveness);
-            break;
-
-        case Nyth::Audio::NoiseAlgorithm::WIENER_FILTER:
-            // Filtre Wiener SIMD
-            if (count >= NoiseManagerConstants::SIMD_STEREO_MIN_SIZE) {
-                // Appliquer un filtre passe-bas pour réduire le bruit haute fréquence
-                AudioNR::SIMD::SIMDMathFunctions::apply_lowpass_filter(
-                    data, count, NoiseManagerConstants::LOWPASS_CUTOFF_FREQUENCY, config_.sampleRate);
-            }
-            break;
-
-        case Nyth::Audio::NoiseAlgorithm::MULTIBAND:
-            // Réduction multi-bande SIMD
-            if (count >= NoiseManagerConstants::SIMD_MULTIBAND_MIN_SIZE) {
-                // Appliquer différents niveaux de réduction selon les bandes
-                AudioNR::SIMD::SIMDMathFunctions::apply_soft_clipper(data, count,
-                    config_.aggressiveness * NoiseManagerConstants::MULTIBAND_REDUCTION_FACTOR);
-            }
-            break;
-
-        default:
-            // Réduction par défaut SIMD
-            AudioNR::SIMD::SIMDMathFunctions::apply_soft_clipper(data, count, config_.aggressiveness);
-            break;
-    }
-}
-
 } // namespace react
 } // namespace facebook
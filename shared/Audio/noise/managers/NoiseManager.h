@@ -1,12 +1,16 @@
 #pragma once
 
+#include <array>
 #include <atomic>
+#include <condition_variable>
 #include <functional>
 #include <memory>
 #include <mutex>
 #include <string>
+#include <thread>
 #include <vector>
 
+#include "../../common/config/NoiseConstants.hpp"
 #include "../../common/jsi/JSICallbackManager.h"
 #include "../components/Noise/NoiseReducer.hpp"
 #include "../components/Spectral/AdvancedSpectralNR.hpp"
@@ -27,6 +31,23 @@ namespace react {
  *
  * Supporte 6 algorithmes : ADVANCED_SPECTRAL, WIENER_FILTER, MULTIBAND,
  * TWO_STEP, HYBRID, SPECTRAL_SUBTRACTION
+ *
+ * Chemin temps réel sans verrou ni allocation : chaque configuration est
+ * construite côté contrôle en un ProcessingEngine immuable (composants et
+ * buffers de travail alloués pour MAX_BLOCK_SIZE trames) et publiée par un
+ * pointeur atomique ; le thread audio l'adopte au début de son bloc suivant
+ * et rend l'ancien dans un anneau de RETIRED_ENGINE_SLOTS emplacements, vidé
+ * côté contrôle avant chaque publication : au plus deux moteurs sont adoptés
+ * entre deux publications, un moteur publié n'attend donc jamais. Les blocs
+ * plus longs sont traités par passes de MAX_BLOCK_SIZE. Le
+ * désentrelacement et les niveaux passent par des noyaux SIMD.
+ *
+ * Les statistiques sont des atomiques écrits par le thread audio ; les
+ * callbacks de statistiques et les erreurs du thread audio (un code déposé
+ * dans un atomique) partent d'un fil de notification, jamais du thread audio.
+ *
+ * Les méthodes de contrôle viennent d'un seul thread (non temps réel),
+ * processAudio*() du thread audio ; release() exige le flux arrêté.
  */
 class NoiseManager {
 public:
@@ -54,7 +75,7 @@ public:
     bool processAudioStereo(const float* inputL, const float* inputR, float* outputL, float* outputR,
                             size_t frameCount);
 
-    // === Méthodes SIMD ===
+    // === Méthodes SIMD (le chemin principal est vectorisé : alias conservés) ===
     bool processAudio_SIMD(const float* input, float* output, size_t frameCount, int channels);
     bool processAudioStereo_SIMD(const float* inputL, const float* inputR, float* outputL, float* outputR,
                                  size_t frameCount);
@@ -73,9 +94,6 @@ public:
     std::string getInfo() const;
     Nyth::Audio::NoiseState getState() const;
 
-    // === Méthodes privées SIMD ===
-    void applyNoiseReduction_SIMD(float* data, size_t count);
-
     // === Callbacks ===
     using StatisticsCallback = std::function<void(const Nyth::Audio::NoiseStatistics& stats)>;
     using ProcessingCallback = std::function<void(const float* input, const float* output, size_t frameCount)>;
@@ -83,49 +101,74 @@ public:
     void setProcessingCallback(ProcessingCallback callback);
 
 private:
-    // === Composants AudioNR connectés ===
-    std::unique_ptr<AudioNR::AdvancedSpectralNR> advancedSpectralNR_;
-    std::unique_ptr<AudioNR::SpectralNR> spectralNR_;
-    std::unique_ptr<AudioNR::NoiseReducer> noiseReducer_;
+    // Configuration figée, composants AudioNR et buffers de travail (défini dans le .cpp)
+    struct ProcessingEngine;
 
     // === Gestionnaire de callbacks ===
     std::shared_ptr<JSICallbackManager> callbackManager_;
 
-    // === Configuration ===
+    // === Configuration (côté contrôle) ===
     Nyth::Audio::NoiseConfig config_;
 
+    // === Publication : contrôle -> pending_ -> audio (active_) -> retired_ -> contrôle ===
+    std::atomic<ProcessingEngine*> pending_{nullptr};
+    std::array<std::atomic<ProcessingEngine*>, NoiseManagerConstants::RETIRED_ENGINE_SLOTS> retired_{};
+    ProcessingEngine* active_ = nullptr; // thread audio uniquement
+    std::atomic<float> aggressiveness_{0.0f};
+
     // === État ===
     std::atomic<Nyth::Audio::NoiseState> currentState_{Nyth::Audio::NoiseState::UNINITIALIZED};
     std::atomic<bool> isInitialized_{false};
 
-    // === Synchronisation ===
-    mutable std::mutex mutex_;      // Mutex principal pour la synchronisation
-    mutable std::mutex statsMutex_; // Mutex pour les statistiques
-    Nyth::Audio::NoiseStatistics currentStats_;
+    // === Synchronisation (contrôle et notification uniquement) ===
+    mutable std::mutex mutex_;
+
+    // === Statistiques écrites par le thread audio ===
+    std::atomic<float> inputLevel_{0.0f};
+    std::atomic<float> outputLevel_{0.0f};
+    std::atomic<uint32_t> processedFrames_{0};
+    std::atomic<uint64_t> processedSamples_{0};
+    std::atomic<uint64_t> processedDurationFrames_{0};
+    std::atomic<uint32_t> statsSampleRate_{0};
+
+    // === Erreurs du thread audio (code seul, message construit par le fil de notification) ===
+    enum class AudioError : uint8_t { NONE, PROCESSING, STEREO_PROCESSING };
+    std::atomic<AudioError> pendingAudioError_{AudioError::NONE};
 
-    // === Buffers de travail ===
-    std::vector<float> workBufferL_;
-    std::vector<float> workBufferR_;
-    std::vector<float> intermediateBuffer_;
+    // === Fil de notification des statistiques ===
+    std::thread statsThread_;
+    std::mutex statsThreadMutex_;
+    std::condition_variable statsThreadCv_;
+    bool statsThreadStop_ = false;
 
     // === Callbacks ===
     StatisticsCallback statisticsCallback_;
     ProcessingCallback processingCallback_;
 
     // === Méthodes privées ===
-    void initializeNoiseComponents();
-    void connectComponents();
-    void updateStatistics(const float* input, const float* output, size_t frameCount, int channels);
+    std::unique_ptr<ProcessingEngine> buildEngine(const Nyth::Audio::NoiseConfig& config) const;
+    void publishEngine(std::unique_ptr<ProcessingEngine> engine);
+    void collectGarbage();
+    ProcessingEngine* acquireEngine() noexcept;
+    void updateStatistics(float inputLevel, float outputLevel, size_t frameCount, int channels) noexcept;
     void notifyStatisticsCallback();
+    void startStatisticsThread();
+    void stopStatisticsThread();
+    void statisticsThreadLoop();
     bool validateConfig(const Nyth::Audio::NoiseConfig& config) const;
 
     // === Helpers ===
     float calculateRMS(const float* data, size_t size) const;
     void handleError(const std::string& error);
+    void reportAudioError(AudioError error) noexcept;
+    void notifyAudioError(AudioError error);
     std::string formatStatisticsToJSON(const Nyth::Audio::NoiseStatistics& stats) const;
 
     // === Pipeline de traitement ===
-    bool processWithPipeline(const float* input, float* output, size_t frameCount, int channels);
+    static void processWithPipeline(ProcessingEngine& engine, const float* input, float* output, size_t frameCount,
+                                    int channels);
+    static void processStereoWithPipeline(ProcessingEngine& engine, const float* inputL, const float* inputR,
+                                          float* outputL, float* outputR, size_t frameCount);
     void setupProcessingPipeline();
 };
 
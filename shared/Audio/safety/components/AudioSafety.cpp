@@ -33,6 +33,7 @@ AudioSafetyEngine::AudioSafetyEngine(std::uint32_t sampleRate, int channels, Saf
         localError = SafetyError::INVALID_CHANNELS;
     } else {
         localError = setConfig(SafetyConfig{});
+        silenceDetector_.prepare(static_cast<double>(sampleRate_));
         if (localError == SafetyError::OK) {
             valid_ = true;
         }
@@ -50,6 +51,7 @@ SafetyError AudioSafetyEngine::setSampleRate(std::uint32_t sr) noexcept {
         return SafetyError::INVALID_SAMPLE_RATE;
     }
     sampleRate_ = sr;
+    silenceDetector_.prepare(static_cast<double>(sampleRate_));
     return SafetyError::OK;
 }
 
@@ -201,7 +203,7 @@ SafetyReport AudioSafetyEngine::analyzeAndClean(float* x, std::size_t n) noexcep
     }
 
     // Feedback detection (simple autocorrelation peak at small lag)
-    if (config_.feedbackDetectEnabled) {
+    if (config_.feedbackDetectEnabled && hasSignal(localReport, n)) {
         localReport.feedbackScore = estimateFeedbackScore(x, n);
         localReport.feedbackLikely = localReport.feedbackScore >= config_.feedbackCorrThreshold;
     }
@@ -226,6 +228,14 @@ void AudioSafetyEngine::limitBuffer(float* x, std::size_t n) noexcept {
     }
 }
 
+bool AudioSafetyEngine::hasSignal(const SafetyReport& report, std::size_t n) noexcept {
+    // Energie seule : l'autocorrélation coûteuse n'a rien à trouver dans un bloc silencieux
+    Nyth::Audio::FX::VoiceActivityDetector::Features features;
+    features.energy = static_cast<float>(report.rms * report.rms);
+    silenceDetector_.update(features, n);
+    return silenceDetector_.hasSignal();
+}
+
 double AudioSafetyEngine::estimateFeedbackScore(const float* x, std::size_t n) noexcept {
     // Autocorrelation at short lags (e.g., [32..512] samples)
     std::size_t minLag = minValue<std::size_t>(MIN_LAG_ABSOLUTE, n / MIN_LAG_DIVISOR);
@@ -19,6 +19,7 @@
 #include <stdint.h>
 #endif
 #include "../../common/config/SafetyConstants.hpp"
+#include "../../common/dsp/VoiceActivityDetector.hpp"
 
 namespace Nyth {
 namespace Audio {
@@ -150,6 +151,7 @@ protected:
     SafetyReport report_{};
     double limiterThresholdLin_ = DEFAULT_LIMITER_THRESHOLD_LINEAR;
     bool valid_ = false; // Track initialization status
+    Nyth::Audio::FX::VoiceActivityDetector silenceDetector_; // Seuil de silence partagé avec noise / recorder
 
     // DbLookupTable will be integrated here
     class DbConverter; // Forward declaration for LUT integration
@@ -163,6 +165,8 @@ protected:
     void dcRemove(float* x, size_t n, double mean) noexcept;
     void limitBuffer(float* x, size_t n) noexcept;
     double estimateFeedbackScore(const float* x, size_t n) noexcept;
+    // Bloc au-dessus du seuil de silence du VAD (énergie du rapport) : sinon pas d'analyse de feedback
+    bool hasSignal(const SafetyReport& report, size_t n) noexcept;
 };
 
 /**
@@ -349,8 +349,8 @@ inline SafetyReport AudioSafetyEngineOptimized::analyzeAndClean(float* x, size_t
         report.overloadActive = report.peak > limiterThresholdLin_;
     }
 
-    // Feedback detection (keep original for now)
-    if (config_.feedbackDetectEnabled) {
+    // Feedback detection (keep original for now), skipped on silent blocks
+    if (config_.feedbackDetectEnabled && hasSignal(report, n)) {
         report.feedbackScore = estimateFeedbackScore(x, n);
         report.feedbackLikely = report.feedbackScore >= config_.feedbackCorrThreshold;
     }
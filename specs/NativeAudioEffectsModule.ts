@@ -153,6 +153,19 @@ export interface Spec extends TurboModule {
 
   readonly getDelayParameters: (effectId: number) => DelayConfig | null;
 
+  // Automation à l'échantillon près : sampleTime est une position absolue
+  // (getSamplePosition()) ; 0 = dès le prochain bloc. Noms : thresholdDb, ratio,
+  // attackMs, releaseMs, makeupDb, kneeDb (compresseur) ; delayMs, feedback, mix,
+  // modRateHz, modDepthMs, lowCutHz, highCutHz (délai)
+  readonly scheduleEffectParameter: (
+    effectId: number,
+    name: string,
+    value: number,
+    sampleTime: number,
+  ) => boolean;
+
+  readonly getSamplePosition: () => number;
+
   // === Traitement audio ===
 
   // Traite un buffer audio mono ou stéréo entrelacé
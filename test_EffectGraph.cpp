@@ -0,0 +1,137 @@
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+#include "shared/Audio/effects/components/EffectGraph.hpp"
+
+// Test de publication des plans de l'EffectGraph : un plan commité doit être
+// adopté par le thread audio au bloc suivant, même quand le thread audio adopte
+// le plan précédent pendant la compilation (commits rapprochés).
+
+namespace {
+
+using Nyth::Audio::FX::EffectGraph;
+using Nyth::Audio::FX::GraphNodeId;
+using Nyth::Audio::FX::IAudioEffect;
+
+constexpr size_t BLOCK_SIZE = 64;
+
+int failures = 0;
+
+void check(bool condition, const char* what) {
+    std::cout << (condition ? "  OK    " : "  ECHEC ") << what << "\n";
+    if (!condition) {
+        ++failures;
+    }
+}
+
+// Gain fixe ; onLatency est appelé pendant compile(), sur le thread de contrôle
+class GainEffect : public IAudioEffect {
+public:
+    explicit GainEffect(float gain) : gain_(gain) {}
+
+    void processMono(const float* input, float* output, size_t numSamples) override {
+        for (size_t i = 0; i < numSamples; ++i) {
+            output[i] = input[i] * gain_;
+        }
+    }
+
+    [[nodiscard]] uint32_t getLatencySamples() const noexcept override {
+        if (onLatency) {
+            onLatency();
+        }
+        return 0;
+    }
+
+    std::function<void()> onLatency;
+
+private:
+    float gain_;
+};
+
+float render(EffectGraph& graph) {
+    std::vector<float> input(BLOCK_SIZE, 1.0f), output(BLOCK_SIZE, 0.0f);
+    graph.processMono(input.data(), output.data(), BLOCK_SIZE);
+    return output[BLOCK_SIZE - 1];
+}
+
+void test_adopted_during_compile() {
+    std::cout << "=== Test d'Adoption pendant la Compilation ===\n";
+    EffectGraph graph;
+    graph.setSampleRate(48000, 1);
+    auto first = std::make_unique<GainEffect>(2.0f);
+    GainEffect* probe = first.get();
+    const GraphNodeId a = graph.addEffect(std::move(first));
+    graph.connect(EffectGraph::INPUT_NODE, a);
+    graph.connect(a, EffectGraph::OUTPUT_NODE);
+    graph.commit();
+    check(render(graph) == 2.0f, "premier plan adopté");
+
+    // P1 publié, puis le thread audio l'adopte au milieu de la compilation de P2
+    const GraphNodeId b = graph.addEffect(std::make_unique<GainEffect>(3.0f));
+    graph.disconnect(a, EffectGraph::OUTPUT_NODE);
+    graph.connect(a, b);
+    graph.connect(b, EffectGraph::OUTPUT_NODE);
+    graph.commit();
+    graph.connect(a, EffectGraph::OUTPUT_NODE, 4.0f);
+    probe->onLatency = [&graph] { render(graph); };
+    graph.commit();
+    probe->onLatency = nullptr;
+
+    // Aucun collectGarbage() : le plan P2 doit tout de même être adopté
+    check(render(graph) == 14.0f, "plan publié adopté au bloc suivant sans collectGarbage()");
+}
+
+void test_back_to_back_commits() {
+    std::cout << "\n=== Test de Commits Rapprochés (thread audio) ===\n";
+    EffectGraph graph;
+    graph.setSampleRate(48000, 1);
+    auto first = std::make_unique<GainEffect>(2.0f);
+    GainEffect* slow = first.get();
+    const GraphNodeId a = graph.addEffect(std::move(first));
+    graph.connect(EffectGraph::INPUT_NODE, a);
+    graph.connect(a, EffectGraph::OUTPUT_NODE);
+    graph.commit();
+
+    // Compilation lente : le thread audio tourne plusieurs blocs pendant chaque commit()
+    slow->onLatency = [] { std::this_thread::sleep_for(std::chrono::milliseconds(30)); };
+    std::atomic<bool> running{true};
+    std::atomic<float> last{0.0f};
+    std::thread audio([&] {
+        while (running.load()) {
+            last.store(render(graph));
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        }
+    });
+
+    for (int i = 0; i < 8; ++i) {
+        const GraphNodeId b = graph.addEffect(std::make_unique<GainEffect>(1.0f));
+        graph.disconnect(a, EffectGraph::OUTPUT_NODE);
+        graph.connect(a, b);
+        graph.connect(b, EffectGraph::OUTPUT_NODE);
+        graph.commit();
+        graph.disconnect(a, b);
+        graph.disconnect(b, EffectGraph::OUTPUT_NODE);
+        graph.removeNode(b);
+        graph.connect(a, EffectGraph::OUTPUT_NODE, 3.0f);
+        graph.commit();
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    running.store(false);
+    audio.join();
+    std::cout << "  sortie : " << last.load() << "\n";
+    check(last.load() == 6.0f, "dernier plan commité en service");
+}
+
+} // namespace
+
+int main() {
+    test_adopted_during_compile();
+    test_back_to_back_commits();
+
+    std::cout << "\n" << (failures == 0 ? "Tous les tests ont réussi" : "Des tests ont échoué") << "\n";
+    return failures == 0 ? 0 : 1;
+}
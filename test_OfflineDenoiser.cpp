@@ -0,0 +1,143 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+#include "shared/Audio/noise/components/Offline/OfflineDenoiser.hpp"
+
+// Test du débruitage hors ligne par blocs : la sortie ne dépend pas du nombre
+// de threads, et les raccords entre blocs restent proches d'un passage unique
+// du même SpectralNR sur tout le fichier.
+
+namespace {
+
+using AudioNR::OfflineDenoiser;
+using AudioNR::SpectralNR;
+using AudioNR::SpectralNRConfig;
+using Nyth::Audio::FX::WavData;
+
+constexpr uint32_t SAMPLE_RATE = 48000;
+constexpr double DURATION_SECONDS = 12.0;
+constexpr double CHUNK_SECONDS = 3.0;
+constexpr size_t NUM_FRAMES = static_cast<size_t>(DURATION_SECONDS * SAMPLE_RATE);
+constexpr size_t SEAM_HALF_WINDOW = SAMPLE_RATE / 10; // ±100 ms autour de chaque raccord
+
+// Écart maximal toléré entre les blocs et le passage unique, autour des raccords
+constexpr double MAX_SEAM_ERROR_DB = -45.0;
+
+int failures = 0;
+
+void check(bool condition, const char* what) {
+    std::cout << (condition ? "  OK    " : "  ECHEC ") << what << "\n";
+    if (!condition) {
+        ++failures;
+    }
+}
+
+// Générateur congruentiel : même suite sur toutes les plateformes
+struct Lcg {
+    uint32_t state;
+    float next() {
+        state = state * 1664525u + 1013904223u;
+        return static_cast<float>(state >> 8) / 8388608.0f - 1.0f; // [-1, 1)
+    }
+};
+
+// Voix synthétique modulée (1,2 s sur 2 s) dans un bruit blanc indépendant par canal
+WavData makeInput() {
+    const double pi = 3.14159265358979323846;
+    WavData input;
+    input.sampleRate = SAMPLE_RATE;
+    input.channels.assign(2, std::vector<float>(NUM_FRAMES));
+    Lcg noise{7u};
+    for (size_t n = 0; n < NUM_FRAMES; ++n) {
+        const double t = static_cast<double>(n) / SAMPLE_RATE;
+        const double envelope = std::fmod(t, 2.0) < 1.2 ? 1.0 : 0.0;
+        const float voice =
+            static_cast<float>(0.3 * envelope * std::sin(2.0 * pi * 220.0 * t) * (0.6 + 0.4 * std::sin(2.0 * pi * 4.0 * t)));
+        input.channels[0][n] = voice + 0.03f * noise.next();
+        input.channels[1][n] = voice + 0.03f * noise.next();
+    }
+    return input;
+}
+
+OfflineDenoiser::Config makeConfig(size_t numThreads) {
+    OfflineDenoiser::Config config;
+    config.chunkSeconds = CHUNK_SECONDS;
+    config.numThreads = numThreads;
+    return config;
+}
+
+// Passage unique du SpectralNR des tâches sur tout le fichier, latence retirée
+WavData singlePass(const WavData& input) {
+    SpectralNRConfig spectral = makeConfig(1).spectral;
+    spectral.sampleRate = SAMPLE_RATE;
+    SpectralNR reducer(spectral);
+    const size_t latency = reducer.getLatency();
+    const size_t length = NUM_FRAMES + latency;
+    std::vector<float> inL(length, 0.0f), inR(length, 0.0f), outL(length), outR(length);
+    std::copy(input.channels[0].begin(), input.channels[0].end(), inL.begin());
+    std::copy(input.channels[1].begin(), input.channels[1].end(), inR.begin());
+    reducer.processStereo(inL.data(), inR.data(), outL.data(), outR.data(), length);
+
+    WavData output;
+    output.sampleRate = SAMPLE_RATE;
+    output.channels.push_back(std::vector<float>(outL.begin() + latency, outL.end()));
+    output.channels.push_back(std::vector<float>(outR.begin() + latency, outR.end()));
+    return output;
+}
+
+// Énergie de (x - reference) rapportée à celle de reference sur [begin, end), en dB
+double errorDb(const std::vector<float>& x, const std::vector<float>& reference, size_t begin, size_t end) {
+    double error = 0.0;
+    double energy = 0.0;
+    for (size_t n = begin; n < end; ++n) {
+        const double d = static_cast<double>(x[n]) - reference[n];
+        error += d * d;
+        energy += static_cast<double>(reference[n]) * reference[n];
+    }
+    return 10.0 * std::log10(error / energy);
+}
+
+void test_thread_count_invariance(const WavData& input) {
+    std::cout << "=== Test d'Invariance au Nombre de Threads ===\n";
+    WavData one, four;
+    OfflineDenoiser(makeConfig(1)).process(input, one);
+    OfflineDenoiser(makeConfig(4)).process(input, four);
+    check(one.channels == four.channels, "sortie identique bit à bit avec 1 et 4 threads");
+}
+
+void test_seams_match_single_pass(const WavData& input) {
+    std::cout << "\n=== Test des Raccords face à un Passage Unique ===\n";
+    const WavData reference = singlePass(input);
+    WavData chunked;
+    OfflineDenoiser(makeConfig(4)).process(input, chunked);
+
+    const size_t chunk = static_cast<size_t>(CHUNK_SECONDS * SAMPLE_RATE);
+    double worst = -300.0;
+    for (size_t seam = chunk; seam < NUM_FRAMES; seam += chunk) {
+        for (size_t c = 0; c < 2; ++c) {
+            const double error =
+                errorDb(chunked.channels[c], reference.channels[c], seam - SEAM_HALF_WINDOW, seam + SEAM_HALF_WINDOW);
+            std::cout << "  raccord " << seam / chunk << ", canal " << c << " : " << error << " dB\n";
+            worst = std::max(worst, error);
+        }
+    }
+    check(worst < MAX_SEAM_ERROR_DB, "écart aux raccords sous -45 dB");
+
+    // Hors de la première seconde (démarrage à froid du passage unique)
+    const double overall = errorDb(chunked.channels[0], reference.channels[0], SAMPLE_RATE, NUM_FRAMES);
+    std::cout << "  fichier : " << overall << " dB\n";
+    check(overall < MAX_SEAM_ERROR_DB, "écart sur tout le fichier sous -45 dB");
+}
+
+} // namespace
+
+int main() {
+    const WavData input = makeInput();
+    test_thread_count_invariance(input);
+    test_seams_match_single_pass(input);
+
+    std::cout << "\n" << (failures == 0 ? "Tous les tests ont réussi" : "Des tests ont échoué") << "\n";
+    return failures == 0 ? 0 : 1;
+}
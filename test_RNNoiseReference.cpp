@@ -0,0 +1,184 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "shared/Audio/noise/components/Noise/RNNoiseSuppressor.hpp"
+
+// Test de référence du suppresseur récurrent : entrée synthétique déterministe,
+// sortie comparée à des valeurs enregistrées (RMS par fenêtre de 100 ms).
+// Les valeurs de référence ont été produites par ce programme avec le modèle
+// RnnModel actuel : les régénérer (--print) si les poids ou les constantes changent.
+
+namespace {
+
+constexpr uint32_t SAMPLE_RATE = 48000;
+constexpr size_t BLOCK_SIZE = 480;
+constexpr size_t WINDOW = SAMPLE_RATE / 10;
+constexpr size_t NUM_WINDOWS = 20;
+constexpr size_t NUM_SAMPLES = WINDOW * NUM_WINDOWS;
+constexpr double AGGRESSIVENESS = 1.5;
+
+// Tolérance relative : absorbe l'ordre des sommes (AVX2 / NEON / scalaire, FMA)
+constexpr double RELATIVE_TOLERANCE = 1e-4;
+constexpr double ABSOLUTE_TOLERANCE = 1e-6;
+
+// RMS de sortie par fenêtre de 100 ms (mono, agressivité 1.5)
+const double REFERENCE_RMS[NUM_WINDOWS] = {
+    8.357883399e-03, 3.340132024e-03, 2.171451428e-03, 2.403845560e-03,
+    2.405172453e-03, 7.757684659e-02, 8.797684905e-02, 7.443485783e-02,
+    2.989959779e-03, 2.628747844e-03, 7.790814811e-02, 8.801631741e-02,
+    7.443799984e-02, 3.248496713e-03, 2.582339270e-03, 7.761312432e-02,
+    8.793140095e-02, 7.443689875e-02, 3.029937249e-03, 2.622792802e-03,
+};
+
+int failures = 0;
+
+void check(bool condition, const char* what) {
+    std::cout << (condition ? "  OK    " : "  ECHEC ") << what << "\n";
+    if (!condition) {
+        ++failures;
+    }
+}
+
+// Générateur congruentiel : même suite sur toutes les plateformes
+struct Lcg {
+    uint32_t state;
+    float next() {
+        state = state * 1664525u + 1013904223u;
+        return static_cast<float>(state >> 8) / 8388608.0f - 1.0f; // [-1, 1)
+    }
+};
+
+// Bruit blanc à -34 dBFS, puis voix synthétique (harmoniques de f0) par syllabes de 250 ms après 500 ms
+std::vector<float> makeInput(uint32_t seed, double f0) {
+    const double pi = 3.14159265358979323846;
+    std::vector<float> x(NUM_SAMPLES);
+    Lcg noise{seed};
+    for (size_t n = 0; n < NUM_SAMPLES; ++n) {
+        const double t = static_cast<double>(n) / SAMPLE_RATE;
+        double voice = 0.0;
+        if (t >= 0.5 && std::fmod(t - 0.5, 0.5) < 0.25) {
+            for (int k = 1; k <= 10; ++k) {
+                voice += std::sin(2.0 * pi * f0 * k * t) / k;
+            }
+            voice *= 0.1;
+        }
+        x[n] = static_cast<float>(voice) + 0.02f * noise.next();
+    }
+    return x;
+}
+
+std::vector<float> processMono(const std::vector<float>& input, double aggressiveness) {
+    AudioNR::RNNoiseSuppressor suppressor;
+    suppressor.initialize(SAMPLE_RATE, 1);
+    suppressor.setAggressiveness(aggressiveness);
+    std::vector<float> output(input.size());
+    for (size_t offset = 0; offset < input.size(); offset += BLOCK_SIZE) {
+        suppressor.processMono(input.data() + offset, output.data() + offset, BLOCK_SIZE);
+    }
+    return output;
+}
+
+double windowRms(const std::vector<float>& x, size_t window) {
+    double sum = 0.0;
+    for (size_t n = window * WINDOW; n < (window + 1) * WINDOW; ++n) {
+        sum += static_cast<double>(x[n]) * x[n];
+    }
+    return std::sqrt(sum / WINDOW);
+}
+
+bool close(double value, double reference) {
+    return std::fabs(value - reference) <= RELATIVE_TOLERANCE * std::fabs(reference) + ABSOLUTE_TOLERANCE;
+}
+
+void test_reference_output(bool print) {
+    std::cout << "=== Test de la Sortie de Référence (mono) ===\n";
+    const std::vector<float> output = processMono(makeInput(1u, 160.0), AGGRESSIVENESS);
+    if (print) {
+        std::cout << std::scientific << std::setprecision(9);
+        for (size_t w = 0; w < NUM_WINDOWS; ++w) {
+            std::cout << windowRms(output, w) << ",\n";
+        }
+        std::cout << std::defaultfloat;
+        return;
+    }
+    bool matches = true;
+    for (size_t w = 0; w < NUM_WINDOWS; ++w) {
+        const double rms = windowRms(output, w);
+        if (!close(rms, REFERENCE_RMS[w])) {
+            std::cout << std::setprecision(9) << "  fenêtre " << w << " : " << rms << " (référence "
+                      << REFERENCE_RMS[w] << ")\n";
+            matches = false;
+        }
+    }
+    check(matches, "RMS par fenêtre identiques à la référence");
+}
+
+void test_transparent() {
+    std::cout << "\n=== Test de Transparence (agressivité 0) ===\n";
+    const std::vector<float> input = makeInput(2u, 220.0);
+    const std::vector<float> output = processMono(input, 0.0);
+    AudioNR::RNNoiseSuppressor probe;
+    probe.initialize(SAMPLE_RATE, 1);
+    const size_t latency = probe.getLatency();
+    double maxError = 0.0;
+    for (size_t n = 2 * latency; n < NUM_SAMPLES; ++n) {
+        maxError = std::max(maxError, static_cast<double>(std::fabs(output[n] - input[n - latency])));
+    }
+    std::cout << "  erreur max : " << maxError << "\n";
+    check(maxError < 1e-4, "sortie = entrée retardée de getLatency()");
+}
+
+void test_stereo_matches_mono() {
+    std::cout << "\n=== Test Stéréo (canaux indépendants) ===\n";
+    const std::vector<float> left = makeInput(3u, 140.0);
+    const std::vector<float> right = makeInput(4u, 250.0);
+    AudioNR::RNNoiseSuppressor stereo;
+    stereo.initialize(SAMPLE_RATE, 2);
+    stereo.setAggressiveness(AGGRESSIVENESS);
+    std::vector<float> outL(NUM_SAMPLES), outR(NUM_SAMPLES);
+    for (size_t offset = 0; offset < NUM_SAMPLES; offset += BLOCK_SIZE) {
+        stereo.processStereo(left.data() + offset, right.data() + offset, outL.data() + offset,
+                             outR.data() + offset, BLOCK_SIZE);
+    }
+    const std::vector<float> monoL = processMono(left, AGGRESSIVENESS);
+    const std::vector<float> monoR = processMono(right, AGGRESSIVENESS);
+    double maxError = 0.0;
+    for (size_t n = 0; n < NUM_SAMPLES; ++n) {
+        maxError = std::max({maxError, static_cast<double>(std::fabs(outL[n] - monoL[n])),
+                             static_cast<double>(std::fabs(outR[n] - monoR[n]))});
+    }
+    std::cout << "  erreur max : " << maxError << "\n";
+    check(maxError < 1e-4, "chaque canal identique au traitement mono");
+}
+
+void test_noise_attenuation() {
+    std::cout << "\n=== Test d'Atténuation du Bruit ===\n";
+    const std::vector<float> input = makeInput(1u, 160.0);
+    const std::vector<float> output = processMono(input, AGGRESSIVENESS);
+    // Fenêtre 3 : bruit seul, traqueur convergé ; fenêtre 6 : syllabe
+    const double noiseGainDb = 20.0 * std::log10(windowRms(output, 3) / windowRms(input, 3));
+    const double voiceGainDb = 20.0 * std::log10(windowRms(output, 6) / windowRms(input, 6));
+    std::cout << "  bruit : " << noiseGainDb << " dB, voix : " << voiceGainDb << " dB\n";
+    check(noiseGainDb < -10.0, "bruit seul atténué de plus de 10 dB");
+    check(voiceGainDb > -3.0, "voix conservée à 3 dB près");
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const bool print = argc > 1 && std::string(argv[1]) == "--print";
+    test_reference_output(print);
+    if (print) {
+        return 0;
+    }
+    test_transparent();
+    test_stereo_matches_mono();
+    test_noise_attenuation();
+
+    std::cout << "\n" << (failures == 0 ? "Tous les tests ont réussi" : "Des tests ont échoué") << "\n";
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,178 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <vector>
+#include "shared/Audio/common/dsp/FFTEngine.hpp"
+#include "shared/Audio/noise/components/Spectral/SpectralNR.hpp"
+
+// Test du SpectralNR stéréo à FFT appariées : transformées par paire
+// réversibles et identiques aux transformées réelles, canaux indépendants
+// identiques à deux instances mono, canaux identiques traités à l'identique
+// dans tous les modes de liaison.
+
+namespace {
+
+using AudioNR::ChannelLink;
+using AudioNR::SpectralNR;
+using AudioNR::SpectralNRConfig;
+using Nyth::Audio::FX::createFFTEngine;
+using Nyth::Audio::FX::IFFTEngine;
+
+constexpr uint32_t SAMPLE_RATE = 48000;
+constexpr size_t NUM_SAMPLES = SAMPLE_RATE * 2;
+constexpr size_t BLOCK_SIZE = 480;
+constexpr size_t FFT_SIZE = 1024;
+
+// Écarts tolérés : arrondis float de la FFT complexe face aux FFT réelles séparées
+constexpr float ROUND_TRIP_TOLERANCE = 1e-5f;
+constexpr float PAIR_SPECTRUM_TOLERANCE = 1e-4f;
+constexpr float STEREO_MONO_TOLERANCE = 5e-7f;
+constexpr float LINKED_IDENTICAL_TOLERANCE = 1e-6f;
+
+int failures = 0;
+
+void check(bool condition, const char* what) {
+    std::cout << (condition ? "  OK    " : "  ECHEC ") << what << "\n";
+    if (!condition) {
+        ++failures;
+    }
+}
+
+// Générateur congruentiel : même suite sur toutes les plateformes
+struct Lcg {
+    uint32_t state;
+    float next() {
+        state = state * 1664525u + 1013904223u;
+        return static_cast<float>(state >> 8) / 8388608.0f - 1.0f; // [-1, 1)
+    }
+};
+
+// Voix synthétique par syllabes de 250 ms dans un bruit blanc
+std::vector<float> makeInput(uint32_t seed, double f0) {
+    const double pi = 3.14159265358979323846;
+    std::vector<float> x(NUM_SAMPLES);
+    Lcg noise{seed};
+    for (size_t n = 0; n < NUM_SAMPLES; ++n) {
+        const double t = static_cast<double>(n) / SAMPLE_RATE;
+        const double voice = std::fmod(t, 0.5) < 0.25 ? 0.2 * std::sin(2.0 * pi * f0 * t) : 0.0;
+        x[n] = static_cast<float>(voice) + 0.03f * noise.next();
+    }
+    return x;
+}
+
+float maxAbsDiff(const float* a, const float* b, size_t n) {
+    float error = 0.0f;
+    for (size_t i = 0; i < n; ++i) {
+        error = std::max(error, std::fabs(a[i] - b[i]));
+    }
+    return error;
+}
+
+SpectralNRConfig makeConfig(ChannelLink link) {
+    SpectralNRConfig config;
+    config.sampleRate = SAMPLE_RATE;
+    config.gainRule = SpectralNRConfig::GainRule::MMSE_LSA;
+    config.channelLink = link;
+    return config;
+}
+
+void processStereo(const SpectralNRConfig& config, const std::vector<float>& left, const std::vector<float>& right,
+                   std::vector<float>& outL, std::vector<float>& outR) {
+    SpectralNR reducer(config);
+    outL.assign(NUM_SAMPLES, 0.0f);
+    outR.assign(NUM_SAMPLES, 0.0f);
+    for (size_t offset = 0; offset < NUM_SAMPLES; offset += BLOCK_SIZE) {
+        reducer.processStereo(left.data() + offset, right.data() + offset, outL.data() + offset,
+                              outR.data() + offset, BLOCK_SIZE);
+    }
+}
+
+std::vector<float> processMono(const SpectralNRConfig& config, const std::vector<float>& input) {
+    SpectralNR reducer(config);
+    std::vector<float> output(NUM_SAMPLES, 0.0f);
+    for (size_t offset = 0; offset < NUM_SAMPLES; offset += BLOCK_SIZE) {
+        reducer.process(input.data() + offset, output.data() + offset, BLOCK_SIZE);
+    }
+    return output;
+}
+
+void test_fft_pair_round_trip() {
+    std::cout << "=== Test des FFT Appariées ===\n";
+    std::unique_ptr<IFFTEngine> fft = createFFTEngine(FFT_SIZE);
+    const size_t bins = FFT_SIZE / 2 + 1;
+    Lcg random{11u};
+    std::vector<float> a(FFT_SIZE), b(FFT_SIZE);
+    for (size_t i = 0; i < FFT_SIZE; ++i) {
+        a[i] = random.next();
+        b[i] = random.next();
+    }
+
+    std::vector<float> re(FFT_SIZE), im(FFT_SIZE);
+    std::vector<float> reA(bins), imA(bins), reB(bins), imB(bins);
+    Nyth::Audio::FX::forwardR2CPair(*fft, a.data(), b.data(), re, im, reA.data(), imA.data(), reB.data(), imB.data());
+
+    // Chaque demi-spectre égale la transformée réelle du signal seul
+    std::vector<float> refRe, refIm;
+    float spectrumError = 0.0f;
+    fft->forwardR2C(a.data(), refRe, refIm);
+    spectrumError = std::max({spectrumError, maxAbsDiff(reA.data(), refRe.data(), bins),
+                              maxAbsDiff(imA.data(), refIm.data(), bins)});
+    fft->forwardR2C(b.data(), refRe, refIm);
+    spectrumError = std::max({spectrumError, maxAbsDiff(reB.data(), refRe.data(), bins),
+                              maxAbsDiff(imB.data(), refIm.data(), bins)});
+    std::cout << "  écart aux FFT réelles : " << spectrumError << "\n";
+    check(spectrumError < PAIR_SPECTRUM_TOLERANCE, "forwardR2CPair = deux forwardR2C");
+
+    std::vector<float> a2(FFT_SIZE), b2(FFT_SIZE);
+    Nyth::Audio::FX::inverseC2RPair(*fft, reA.data(), imA.data(), reB.data(), imB.data(), re, im, a2.data(),
+                                    b2.data());
+    const float roundTripError =
+        std::max(maxAbsDiff(a.data(), a2.data(), FFT_SIZE), maxAbsDiff(b.data(), b2.data(), FFT_SIZE));
+    std::cout << "  erreur aller-retour : " << roundTripError << "\n";
+    check(roundTripError < ROUND_TRIP_TOLERANCE, "inverseC2RPair(forwardR2CPair(a, b)) = (a, b)");
+}
+
+void test_independent_matches_mono() {
+    std::cout << "\n=== Test Stéréo Indépendant face à Deux Instances Mono ===\n";
+    const std::vector<float> left = makeInput(3u, 180.0);
+    const std::vector<float> right = makeInput(4u, 260.0);
+    const SpectralNRConfig config = makeConfig(ChannelLink::INDEPENDENT);
+    std::vector<float> outL, outR;
+    processStereo(config, left, right, outL, outR);
+    const std::vector<float> monoL = processMono(config, left);
+    const std::vector<float> monoR = processMono(config, right);
+    const float error = std::max(maxAbsDiff(outL.data(), monoL.data(), NUM_SAMPLES),
+                                 maxAbsDiff(outR.data(), monoR.data(), NUM_SAMPLES));
+    std::cout << "  erreur max : " << error << "\n";
+    check(error < STEREO_MONO_TOLERANCE, "chaque canal identique au traitement mono");
+}
+
+void test_identical_inputs_all_links() {
+    std::cout << "\n=== Test d'Entrées Identiques (tous les modes de liaison) ===\n";
+    const std::vector<float> input = makeInput(5u, 200.0);
+    const ChannelLink links[] = {ChannelLink::INDEPENDENT, ChannelLink::NOISE_MEAN, ChannelLink::NOISE_MAX,
+                                 ChannelLink::MASK_MEAN, ChannelLink::MASK_MAX};
+    const char* names[] = {"INDEPENDENT", "NOISE_MEAN", "NOISE_MAX", "MASK_MEAN", "MASK_MAX"};
+    float worst = 0.0f;
+    for (size_t i = 0; i < 5; ++i) {
+        std::vector<float> outL, outR;
+        processStereo(makeConfig(links[i]), input, input, outL, outR);
+        const float error = maxAbsDiff(outL.data(), outR.data(), NUM_SAMPLES);
+        std::cout << "  " << names[i] << " : écart G / D " << error << "\n";
+        worst = std::max(worst, error);
+    }
+    check(worst < LINKED_IDENTICAL_TOLERANCE, "sorties gauche et droite identiques");
+}
+
+} // namespace
+
+int main() {
+    test_fft_pair_round_trip();
+    test_independent_matches_mono();
+    test_identical_inputs_all_links();
+
+    std::cout << "\n" << (failures == 0 ? "Tous les tests ont réussi" : "Des tests ont échoué") << "\n";
+    return failures == 0 ? 0 : 1;
+}